@@ -0,0 +1,300 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "AlterTableTest.h"
+
+#include <KDbConnection>
+#include <KDbTableSchema>
+
+#include <QTest>
+
+QTEST_GUILESS_MAIN(AlterTableTest)
+
+void AlterTableTest::initTestCase()
+{
+    QVERIFY(utils.testCreateDbWithTables("AlterTableTest"));
+}
+
+bool AlterTableTest::simulate(KDbAlterTableHandler::ActionBase *action,
+                              KDbAlterTableHandler::ExecutionArguments *args)
+{
+    KDbTableSchema *persons = utils.connection()->tableSchema("persons");
+    if (!persons) {
+        qWarning() << "No persons table";
+        return false;
+    }
+    KDbAlterTableHandler handler(utils.connection());
+    handler.addAction(action);
+    QString debugString;
+    args->debugString = &debugString;
+    args->simulate = true;
+    KDbTableSchema *result = handler.execute("persons", args);
+    if (args->result != true) {
+        qWarning() << "Simulation failed:" << handler.result();
+        return false;
+    }
+    // nothing is changed in simulation mode
+    if (result != persons || utils.connection()->tableSchema("persons") != persons
+        || persons->fieldCount() != 4 || !persons->field("surname"))
+    {
+        qWarning() << "Table schema changed in simulation mode";
+        return false;
+    }
+    return true;
+}
+
+KDbTableSchema* AlterTableTest::execute(KDbAlterTableHandler::ActionBase *action,
+                                        KDbAlterTableHandler::ExecutionArguments *args)
+{
+    KDbAlterTableHandler handler(utils.connection());
+    handler.addAction(action);
+    QString debugString;
+    args->debugString = &debugString;
+    KDbTableSchema *result = handler.execute("persons", args);
+    if (args->result != true || !result) {
+        qWarning() << "Altering failed:" << handler.result();
+        return nullptr;
+    }
+    if (utils.connection()->tableSchema("persons") != result) {
+        qWarning() << "Altered table schema is not used by the connection";
+        return nullptr;
+    }
+    return result;
+}
+
+bool AlterTableTest::reopenDatabase()
+{
+    return utils.connection()->closeDatabase() && utils.connection()->useDatabase();
+}
+
+QString AlterTableTest::personValue(int id, const QString &column)
+{
+    QString value;
+    if (true != utils.connection()->querySingleString(
+            KDbEscapedString("SELECT %1 FROM persons WHERE id=%2")
+                .arg(utils.connection()->escapeIdentifier(column)).arg(id), &value))
+    {
+        qWarning() << "Could not read" << column << "of person" << id;
+        return QString();
+    }
+    return value;
+}
+
+int AlterTableTest::sqliteVersion()
+{
+    const KDbServerVersionInfo version(utils.connection()->serverVersion());
+    return version.major() * 1000000 + version.minor() * 1000 + version.release();
+}
+
+void AlterTableTest::testSimulateRename()
+{
+    KDbAlterTableHandler::ExecutionArguments args;
+    QVERIFY(simulate(new KDbAlterTableHandler::ChangeFieldPropertyAction(
+                         "surname", "name", "last_name", 4), &args));
+    QVERIFY(args.requirements & KDbAlterTableHandler::PhysicalAlteringRequired);
+    if (sqliteVersion() < 3025000) { // RENAME COLUMN is not supported
+        QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+        QVERIFY(args.statements.isEmpty());
+        return;
+    }
+    QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::InPlace);
+    QCOMPARE(args.statements.count(), 1);
+    QCOMPARE(args.statements.first(),
+             KDbEscapedString("ALTER TABLE \"persons\" RENAME COLUMN \"surname\" TO \"last_name\""));
+}
+
+void AlterTableTest::testSimulateInsert()
+{
+    {
+        // appending a column
+        KDbAlterTableHandler::ExecutionArguments args;
+        QVERIFY(simulate(new KDbAlterTableHandler::InsertFieldAction(
+                             4, new KDbField("email", KDbField::Text), 5), &args));
+        QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::InPlace);
+        QCOMPARE(args.statements.count(), 1);
+        QVERIFY2(args.statements.first().startsWith("ALTER TABLE \"persons\" ADD COLUMN \"email\" "),
+                 args.statements.first().constData());
+    }
+    {
+        // SQLite cannot insert a column in the middle of a table
+        KDbAlterTableHandler::ExecutionArguments args;
+        QVERIFY(simulate(new KDbAlterTableHandler::InsertFieldAction(
+                             1, new KDbField("email", KDbField::Text), 5), &args));
+        QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+        QVERIFY(args.statements.isEmpty());
+    }
+    {
+        // NOT NULL column without default value has to be filled with values
+        KDbAlterTableHandler::ExecutionArguments args;
+        QVERIFY(simulate(new KDbAlterTableHandler::InsertFieldAction(
+                             4, new KDbField("email", KDbField::Text, KDbField::NotNull), 5), &args));
+        QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+        QVERIFY(args.statements.isEmpty());
+    }
+}
+
+void AlterTableTest::testSimulateRemove()
+{
+    {
+        KDbAlterTableHandler::ExecutionArguments args;
+        QVERIFY(simulate(new KDbAlterTableHandler::RemoveFieldAction("age", 2), &args));
+        if (sqliteVersion() < 3035000) { // DROP COLUMN is not supported
+            QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+            QVERIFY(args.statements.isEmpty());
+        } else {
+            QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::InPlace);
+            QCOMPARE(args.statements.count(), 1);
+            QCOMPARE(args.statements.first(),
+                     KDbEscapedString("ALTER TABLE \"persons\" DROP COLUMN \"age\""));
+        }
+    }
+    {
+        // primary key cannot be dropped in place
+        KDbAlterTableHandler::ExecutionArguments args;
+        QVERIFY(simulate(new KDbAlterTableHandler::RemoveFieldAction("id", 1), &args));
+        QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+        QVERIFY(args.statements.isEmpty());
+    }
+}
+
+void AlterTableTest::testSimulateTypeChange()
+{
+    // SQLite cannot change type of a column in place
+    KDbAlterTableHandler::ExecutionArguments args;
+    QVERIFY(simulate(new KDbAlterTableHandler::ChangeFieldPropertyAction(
+                         "age", "type", int(KDbField::Text), 2), &args));
+    QVERIFY(args.requirements & KDbAlterTableHandler::PhysicalAlteringRequired);
+    QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+    QVERIFY(args.statements.isEmpty());
+}
+
+void AlterTableTest::testSimulateMove()
+{
+    // physical order of columns has to be changed, SQLite cannot reorder columns in place
+    KDbAlterTableHandler::ExecutionArguments args;
+    QVERIFY(simulate(new KDbAlterTableHandler::MoveFieldPositionAction(1, "surname", 4), &args));
+    QVERIFY(args.requirements & KDbAlterTableHandler::PhysicalAlteringRequired);
+    QVERIFY(args.requirements & KDbAlterTableHandler::MainSchemaAlteringRequired);
+    QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+    QVERIFY(args.statements.isEmpty());
+}
+
+void AlterTableTest::testSimulateSchemaOnly()
+{
+    KDbAlterTableHandler::ExecutionArguments args;
+    QVERIFY(simulate(new KDbAlterTableHandler::ChangeFieldPropertyAction(
+                         "surname", "caption", "Last name", 4), &args));
+    QVERIFY(!(args.requirements & KDbAlterTableHandler::PhysicalAlteringRequired));
+    QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::None);
+    QVERIFY(args.statements.isEmpty());
+}
+
+void AlterTableTest::testRenameInPlace()
+{
+    KDbAlterTableHandler::ExecutionArguments args;
+    KDbTableSchema *persons = execute(new KDbAlterTableHandler::ChangeFieldPropertyAction(
+                                          "surname", "name", "last_name", 4), &args);
+    QVERIFY(persons);
+    QCOMPARE(args.method, sqliteVersion() < 3025000
+                              ? KDbAlterTableHandler::AlteringMethod::Recreate
+                              : KDbAlterTableHandler::AlteringMethod::InPlace);
+    QVERIFY(persons->field("last_name"));
+    QVERIFY(!persons->field("surname"));
+    QCOMPARE(personValue(2, "last_name"), QString("Walesa"));
+
+    // the altered schema is stored in kexi__fields
+    QVERIFY(reopenDatabase());
+    persons = utils.connection()->tableSchema("persons");
+    QVERIFY(persons);
+    QCOMPARE(persons->fieldCount(), 4);
+    QVERIFY(persons->field("last_name"));
+    QCOMPARE(persons->field("last_name")->order(), 3);
+    QCOMPARE(personValue(3, "last_name"), QString("Gates"));
+}
+
+void AlterTableTest::testInsertInPlace()
+{
+    KDbAlterTableHandler::ExecutionArguments args;
+    KDbField *email = new KDbField("email", KDbField::Text);
+    email->setDefaultValue(QString("unknown"));
+    KDbTableSchema *persons = execute(new KDbAlterTableHandler::InsertFieldAction(4, email, 5),
+                                      &args);
+    QVERIFY(persons);
+    QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::InPlace);
+    QCOMPARE(args.statements.count(), 1);
+    QCOMPARE(persons->fieldCount(), 5);
+    QCOMPARE(personValue(1, "email"), QString("unknown"));
+    QVERIFY(!utils.connection()->insertRecord(persons, QVariant(5), QVariant(50), QVariant("Ada"),
+                                              QVariant("Lovelace"), QVariant("ada@example.org"))
+                 .isNull());
+    QCOMPARE(personValue(5, "email"), QString("ada@example.org"));
+
+    QVERIFY(reopenDatabase());
+    persons = utils.connection()->tableSchema("persons");
+    QVERIFY(persons);
+    QCOMPARE(persons->fieldCount(), 5);
+    QVERIFY(persons->field("email"));
+    QCOMPARE(persons->field("email")->defaultValue(), QVariant("unknown"));
+}
+
+void AlterTableTest::testRemoveInPlace()
+{
+    KDbAlterTableHandler::ExecutionArguments args;
+    KDbTableSchema *persons = execute(new KDbAlterTableHandler::RemoveFieldAction("age", 2), &args);
+    QVERIFY(persons);
+    QCOMPARE(args.method, sqliteVersion() < 3035000
+                              ? KDbAlterTableHandler::AlteringMethod::Recreate
+                              : KDbAlterTableHandler::AlteringMethod::InPlace);
+    QCOMPARE(persons->fieldCount(), 4);
+    QVERIFY(!persons->field("age"));
+    QCOMPARE(personValue(4, "name"), QString("John"));
+
+    QVERIFY(reopenDatabase());
+    persons = utils.connection()->tableSchema("persons");
+    QVERIFY(persons);
+    QCOMPARE(persons->fieldCount(), 4);
+    QVERIFY(!persons->field("age"));
+    QCOMPARE(persons->field("name")->order(), 1);
+}
+
+void AlterTableTest::testRecreate()
+{
+    // SQLite cannot reorder columns in place so the table is recreated
+    KDbAlterTableHandler::ExecutionArguments args;
+    KDbTableSchema *persons = execute(new KDbAlterTableHandler::MoveFieldPositionAction(
+                                          1, "last_name", 4), &args);
+    QVERIFY(persons);
+    QCOMPARE(args.method, KDbAlterTableHandler::AlteringMethod::Recreate);
+    QVERIFY(args.statements.isEmpty());
+    QCOMPARE(persons->field(1)->name(), QString("last_name"));
+    QCOMPARE(personValue(2, "last_name"), QString("Walesa"));
+    QCOMPARE(personValue(5, "email"), QString("ada@example.org"));
+
+    QVERIFY(reopenDatabase());
+    persons = utils.connection()->tableSchema("persons");
+    QVERIFY(persons);
+    QCOMPARE(persons->fieldCount(), 4);
+    QCOMPARE(persons->field(1)->name(), QString("last_name"));
+    QCOMPARE(personValue(1, "last_name"), QString("Staniek"));
+}
+
+void AlterTableTest::cleanupTestCase()
+{
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
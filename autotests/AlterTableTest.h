@@ -0,0 +1,67 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_ALTERTABLETEST_H
+#define KDB_ALTERTABLETEST_H
+
+#include "KDbTestUtils.h"
+
+#include <KDbAlter>
+
+//! Tests for altering tables using KDbAlterTableHandler
+class AlterTableTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testSimulateRename();
+    void testSimulateInsert();
+    void testSimulateRemove();
+    void testSimulateTypeChange();
+    void testSimulateMove();
+    void testSimulateSchemaOnly();
+    void testRenameInPlace();
+    void testInsertInPlace();
+    void testRemoveInPlace();
+    void testRecreate();
+    void cleanupTestCase();
+
+private:
+    //! Simulates execution of @a action for the persons table, @a args are filled
+    bool simulate(KDbAlterTableHandler::ActionBase *action,
+                  KDbAlterTableHandler::ExecutionArguments *args);
+
+    //! Executes @a action for the persons table, @a args are filled
+    //! @return the altered table schema or @c nullptr on failure
+    KDbTableSchema* execute(KDbAlterTableHandler::ActionBase *action,
+                            KDbAlterTableHandler::ExecutionArguments *args);
+
+    //! Closes and reopens the database, so table schemas are loaded again
+    bool reopenDatabase();
+
+    //! @return value of @a column for person with @a id
+    QString personValue(int id, const QString &column);
+
+    //! @return version of SQLite in the format of sqlite3_libversion_number()
+    int sqliteVersion();
+
+    KDbTestUtils utils;
+};
+
+#endif
@@ -0,0 +1,213 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "BackgroundTasksTest.h"
+
+#include <KDbConnectionWorker>
+#include <KDbOrderByColumn>
+#include <KDbParallelScan>
+#include <KDbQuerySchema>
+#include <KDbRecordData>
+#include <KDbTableCopy>
+
+#include <QSignalSpy>
+#include <QTest>
+
+QTEST_GUILESS_MAIN(BackgroundTasksTest)
+
+//! @return values of column @a column of @a records, deletes the records
+static QList<QVariant> takeColumn(QList<KDbRecordData*> records, int column = 0)
+{
+    QList<QVariant> values;
+    for (const KDbRecordData *record : qAsConst(records)) {
+        values.append(record->at(column));
+    }
+    qDeleteAll(records);
+    return values;
+}
+
+static const QList<QVariant> personIds(QList<QVariant>() << 1 << 2 << 3 << 4);
+
+void BackgroundTasksTest::initTestCase()
+{
+}
+
+void BackgroundTasksTest::testConnectionWorker()
+{
+    QVERIFY(utils.testCreateDbWithTables("BackgroundTasksTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    {
+        KDbConnectionWorker worker(conn);
+        QCOMPARE(worker.connection(), conn);
+        worker.setBatchSize(3);
+
+        QScopedPointer<KDbAsyncResult> select(
+            worker.executeQuery(KDbEscapedString("SELECT id FROM persons ORDER BY id")));
+        QSignalSpy finishedSpy(select.data(), &KDbAsyncResult::finished);
+        QScopedPointer<KDbAsyncResult> failing(
+            worker.executeSql(KDbEscapedString("DELETE FROM nonexisting_table")));
+        QScopedPointer<KDbAsyncResult> insert(
+            worker.insertRecord(personsTable, QList<QVariant>() << 5 << 30 << "Ada" << "Lovelace"));
+        QScopedPointer<KDbAsyncResult> single(
+            worker.querySingleRecord(KDbEscapedString("SELECT name FROM persons WHERE id=5")));
+        QVERIFY(worker.waitForDone());
+        QCOMPARE(worker.pendingCount(), 0);
+
+        QCOMPARE(select->status(), KDbAsyncResult::Status::Finished);
+        QVERIFY(!select->result().isError());
+        QCOMPARE(takeColumn(select->takeRecords()), personIds);
+        QVERIFY(finishedSpy.count() == 1 || finishedSpy.wait());
+
+        // statements following a failed one are executed
+        QCOMPARE(failing->status(), KDbAsyncResult::Status::Failed);
+        QVERIFY(failing->result().isError());
+        QCOMPARE(insert->status(), KDbAsyncResult::Status::Finished);
+        QCOMPARE(insert->lastInsertRecordId(), quint64(5));
+        QCOMPARE(takeColumn(single->takeRecords()), QList<QVariant>() << "Ada");
+
+        // deleting the result cancels the statement
+        KDbAsyncResult *cancelled = worker.executeSql(KDbEscapedString("DELETE FROM persons"));
+        delete cancelled;
+        QVERIFY(worker.waitForDone());
+    }
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void BackgroundTasksTest::testConnectionWorkerQueryCopy()
+{
+    QVERIFY(utils.testCreateDbWithTables("BackgroundTasksTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    {
+        KDbConnectionWorker worker(conn);
+        KDbQuerySchema *query = new KDbQuerySchema(personsTable);
+        query->orderByColumnList()->appendField(personsTable->field("id"));
+        QScopedPointer<KDbAsyncResult> result(worker.executeQuery(query));
+        QVERIFY(result->waitForFinished());
+        QCOMPARE(result->status(), KDbAsyncResult::Status::Finished);
+        QCOMPARE(takeColumn(result->takeRecords()), personIds);
+        delete query; // the worker executed its own copy, this does not touch its connection
+    }
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void BackgroundTasksTest::testParallelScan()
+{
+    QVERIFY(utils.testCreateDbWithTables("BackgroundTasksTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+
+    KDbParallelScan scan(conn, personsTable);
+    scan.setPartitionCount(3);
+    scan.setBatchSize(1);
+    QSignalSpy finishedSpy(&scan, &KDbParallelScan::finished);
+    KDB_VERIFY(&scan, scan.start(), "Failed to start scan");
+    QCOMPARE(scan.startedPartitionCount(), 3);
+    KDB_EXPECT_FAIL(&scan, scan.start(), ERR_OTHER, "Scan should not start twice");
+    QVERIFY(scan.waitForFinished());
+    QVERIFY(scan.isFinished());
+    QVERIFY(finishedSpy.count() == 1 || finishedSpy.wait());
+    QVERIFY(!scan.result().isError());
+    // partitions are merged in order of the primary key
+    QCOMPARE(takeColumn(scan.takeRecords()), personIds);
+    QVERIFY(scan.takeRecords().isEmpty());
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void BackgroundTasksTest::testParallelScanRejectsGroupedQuery()
+{
+    QVERIFY(utils.testCreateDbWithTables("BackgroundTasksTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    KDbField *ageField = personsTable->field("age");
+    QVERIFY(ageField);
+
+    KDbQuerySchema query(personsTable);
+    {
+        KDbParallelScan scan(conn, &query);
+        KDB_VERIFY(&scan, scan.start(), "Failed to start scan of ungrouped query");
+        QVERIFY(scan.waitForFinished());
+        QCOMPARE(takeColumn(scan.takeRecords()), personIds);
+    }
+
+    // each partition would compute its own groups
+    QVERIFY(query.addToGroupBy(ageField));
+    QVERIFY(query.isGrouped());
+    KDbParallelScan scan(conn, &query);
+    KDB_EXPECT_FAIL(&scan, scan.start(), ERR_OTHER, "Grouped query should not be scanned");
+    QCOMPARE(scan.startedPartitionCount(), 0);
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void BackgroundTasksTest::testTableCopy()
+{
+    QVERIFY(utils.testCreateDbWithTables("BackgroundTasksTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+
+    KDbTestUtils destinationUtils;
+    QVERIFY(destinationUtils.testCreateDb("BackgroundTasksTestCopy"));
+    KDbConnection *destination = destinationUtils.connection();
+    KDB_VERIFY(destination, destination->useDatabase(), "Failed to use destination database");
+    KDbTableSchema *copyTable = new KDbTableSchema("persons_copy");
+    copyTable->addField(new KDbField("id", KDbField::Integer, KDbField::PrimaryKey));
+    copyTable->addField(new KDbField("age", KDbField::Integer));
+    copyTable->addField(new KDbField("name", KDbField::Text));
+    copyTable->addField(new KDbField("surname", KDbField::Text));
+    KDB_VERIFY(destination, destination->createTable(copyTable), "Failed to create table");
+
+    {
+        KDbTableCopy copy(conn, personsTable, conn, copyTable);
+        KDB_EXPECT_FAIL(&copy, copy.start(), ERR_OTHER, "Copying within one connection should fail");
+    }
+
+    KDbTableCopy copy(conn, personsTable, destination, copyTable);
+    copy.setBatchSize(3);
+    QSignalSpy progressSpy(&copy, &KDbTableCopy::progress);
+    QSignalSpy finishedSpy(&copy, &KDbTableCopy::finished);
+    KDB_VERIFY(&copy, copy.start(), "Failed to start copying");
+    QVERIFY(copy.waitForFinished());
+    QVERIFY(copy.isFinished());
+    QVERIFY(finishedSpy.count() == 1 || finishedSpy.wait());
+    QVERIFY(!copy.result().isError());
+    QCOMPARE(copy.copiedRecordCount(), qint64(4));
+    QCOMPARE(progressSpy.count(), 2); // batches of 3 and 1 records
+    QCOMPARE(progressSpy.last().at(0).toLongLong(), qint64(4));
+
+    KDbRecordData record;
+    QVERIFY(true == destination->querySingleRecord(
+                KDbEscapedString("SELECT COUNT(*), MAX(surname) FROM persons_copy"), &record));
+    QCOMPARE(record.at(0).toInt(), 4);
+    QCOMPARE(record.at(1).toString(), QString("Walesa"));
+
+    QVERIFY(destinationUtils.testDisconnectAndDropDb());
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void BackgroundTasksTest::cleanupTestCase()
+{
+}
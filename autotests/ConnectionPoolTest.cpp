@@ -0,0 +1,249 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "ConnectionPoolTest.h"
+
+#include <KDbConnection>
+#include <KDbConnectionPool>
+
+#include <QTest>
+#include <QThread>
+
+QTEST_GUILESS_MAIN(ConnectionPoolTest)
+
+//! Acquires connection from a pool in a separate thread and counts persons using it
+class PoolClientThread : public QThread
+{
+public:
+    PoolClientThread(KDbConnectionPool *pool, int timeout)
+        : m_pool(pool), m_timeout(timeout)
+    {
+    }
+
+    void run() override
+    {
+        connection = m_pool->acquire(m_timeout);
+        if (!connection) {
+            return;
+        }
+        if (true != connection->querySingleNumber(
+                KDbEscapedString("SELECT COUNT(*) FROM persons"), &personCount))
+        {
+            personCount = -1;
+        }
+        m_pool->release(connection);
+    }
+
+    KDbConnection *connection = nullptr;
+    int personCount = 0;
+
+private:
+    KDbConnectionPool * const m_pool;
+    const int m_timeout;
+};
+
+//! @return number of persons counted using @a conn or -1 on failure
+static int personCount(KDbConnection *conn)
+{
+    int count;
+    if (true != conn->querySingleNumber(KDbEscapedString("SELECT COUNT(*) FROM persons"), &count)) {
+        return -1;
+    }
+    return count;
+}
+
+void ConnectionPoolTest::initTestCase()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionPoolTest"));
+}
+
+void ConnectionPoolTest::testAcquireRelease()
+{
+    KDbConnectionPool pool(utils.connection()->data());
+    QVERIFY(!pool.result().isError());
+    QCOMPARE(pool.databaseName(), utils.connection()->data().databaseName());
+    QCOMPARE(pool.connectionCount(), 0);
+
+    KDbConnection *conn = pool.acquire();
+    QVERIFY(conn);
+    QVERIFY(conn != utils.connection());
+    QVERIFY(conn->isConnected());
+    QVERIFY(conn->isDatabaseUsed());
+    QCOMPARE(personCount(conn), 4);
+    QCOMPARE(pool.connectionCount(), 1);
+    QCOMPARE(pool.idleConnectionCount(), 0);
+
+    // nested acquire() in the same thread returns the same connection
+    QCOMPARE(pool.acquire(), conn);
+    QCOMPARE(pool.connectionCount(), 1);
+    pool.release(conn);
+    QCOMPARE(pool.idleConnectionCount(), 0);
+    pool.release(conn);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    // idle connection is reused
+    QCOMPARE(pool.acquire(), conn);
+    QCOMPARE(pool.connectionCount(), 1);
+    QCOMPARE(pool.idleConnectionCount(), 0);
+    pool.release(conn);
+    QCOMPARE(pool.connectionCount(), 1);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    // connections that are not acquired are ignored
+    pool.release(utils.connection());
+    QCOMPARE(pool.idleConnectionCount(), 1);
+}
+
+void ConnectionPoolTest::testGuard()
+{
+    KDbConnectionPool pool(utils.connection()->data());
+    KDbConnection *conn;
+    {
+        KDbConnectionPoolGuard guard(&pool);
+        conn = guard.connection();
+        QVERIFY(conn);
+        QCOMPARE(guard.operator->(), conn);
+        QCOMPARE(personCount(guard.connection()), 4);
+        QCOMPARE(pool.idleConnectionCount(), 0);
+    }
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    KDbConnectionPoolGuard guard(&pool);
+    QCOMPARE(guard.connection(), conn);
+    guard.release();
+    QVERIFY(!guard.connection());
+    QCOMPARE(pool.idleConnectionCount(), 1);
+}
+
+void ConnectionPoolTest::testSizeLimit()
+{
+    KDbConnectionPool pool(utils.connection()->data());
+    QCOMPARE(pool.maximumConnectionCount(), 16);
+    pool.setMaximumConnectionCount(1);
+    QCOMPARE(pool.maximumConnectionCount(), 1);
+
+    KDbConnection *conn = pool.acquire();
+    QVERIFY(conn);
+
+    // other threads time out while the only connection is in use
+    PoolClientThread client(&pool, 100);
+    client.start();
+    QVERIFY(client.wait(10000));
+    QVERIFY(!client.connection);
+    QCOMPARE(pool.result().code(), ERR_OTHER);
+    QCOMPARE(pool.connectionCount(), 1);
+
+    // a waiting thread gets the connection as soon as it is released
+    PoolClientThread waitingClient(&pool, -1);
+    waitingClient.start();
+    QTest::qSleep(100);
+    QVERIFY(!waitingClient.isFinished());
+    pool.release(conn);
+    QVERIFY(waitingClient.wait(10000));
+    QCOMPARE(waitingClient.connection, conn);
+    QCOMPARE(waitingClient.personCount, 4);
+    QCOMPARE(pool.connectionCount(), 1);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+}
+
+void ConnectionPoolTest::testThreads()
+{
+    KDbConnectionPool pool(utils.connection()->data());
+    KDbConnection *conn = pool.acquire();
+    QVERIFY(conn);
+
+    // another thread gets its own connection
+    PoolClientThread client(&pool, 10000);
+    client.start();
+    QVERIFY(client.wait(10000));
+    QVERIFY(client.connection);
+    QVERIFY(client.connection != conn);
+    QCOMPARE(client.personCount, 4);
+    QCOMPARE(pool.connectionCount(), 2);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    // the connection released by the thread is reused by the next one
+    PoolClientThread nextClient(&pool, 10000);
+    nextClient.start();
+    QVERIFY(nextClient.wait(10000));
+    QCOMPARE(nextClient.connection, client.connection);
+    QCOMPARE(pool.connectionCount(), 2);
+
+    pool.release(conn);
+    QCOMPARE(pool.idleConnectionCount(), 2);
+}
+
+void ConnectionPoolTest::testIdleConnections()
+{
+    KDbConnectionPool pool(utils.connection()->data());
+    KDbConnection *conn = pool.acquire();
+    QVERIFY(conn);
+    pool.release(conn);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    pool.clear();
+    QCOMPARE(pool.connectionCount(), 0);
+
+    conn = pool.acquire();
+    QVERIFY(conn);
+    pool.setMaximumIdleTime(10);
+    QCOMPARE(pool.maximumIdleTime(), 10);
+    QTest::qSleep(50); // busy connections are not closed
+    pool.evictIdleConnections();
+    QCOMPARE(pool.connectionCount(), 1);
+    pool.release(conn);
+    QCOMPARE(pool.idleConnectionCount(), 1);
+
+    QTest::qSleep(50);
+    pool.evictIdleConnections();
+    QCOMPARE(pool.connectionCount(), 0);
+}
+
+void ConnectionPoolTest::testBrokenConnection()
+{
+    KDbConnectionPool pool(utils.connection()->data());
+    pool.setHealthCheckInterval(0);
+    QCOMPARE(pool.healthCheckInterval(), 0);
+    KDbConnection *conn = pool.acquire();
+    QVERIFY(conn);
+    pool.release(conn);
+    QVERIFY(conn->closeDatabase());
+
+    // the broken connection is closed and a new one is created instead
+    conn = pool.acquire();
+    QVERIFY(conn);
+    QVERIFY(conn->isDatabaseUsed());
+    QCOMPARE(personCount(conn), 4);
+    QCOMPARE(pool.connectionCount(), 1);
+    pool.release(conn);
+}
+
+void ConnectionPoolTest::testMissingDatabase()
+{
+    KDbConnectionPool pool(utils.connection()->data(), "ConnectionPoolTest-missing.kexi");
+    QCOMPARE(pool.databaseName(), QString("ConnectionPoolTest-missing.kexi"));
+    QVERIFY(!pool.acquire());
+    QVERIFY(pool.result().isError());
+    QCOMPARE(pool.connectionCount(), 0);
+}
+
+void ConnectionPoolTest::cleanupTestCase()
+{
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
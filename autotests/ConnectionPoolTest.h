@@ -0,0 +1,44 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_CONNECTIONPOOLTEST_H
+#define KDB_CONNECTIONPOOLTEST_H
+
+#include "KDbTestUtils.h"
+
+//! Tests for KDbConnectionPool
+class ConnectionPoolTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testAcquireRelease();
+    void testGuard();
+    void testSizeLimit();
+    void testThreads();
+    void testIdleConnections();
+    void testBrokenConnection();
+    void testMissingDatabase();
+    void cleanupTestCase();
+
+private:
+    KDbTestUtils utils;
+};
+
+#endif
@@ -19,9 +19,21 @@
 
 #include "ConnectionTest.h"
 
+#include <KDbBlobStream>
 #include <KDbConnectionData>
+#include <KDbCursor>
+#include <KDbDriver>
+#include <KDbDriverBehavior>
 #include <KDbDriverManager>
 #include <KDbDriverMetaData>
+#include <KDbExpression>
+#include <KDbIndexSchema>
+#include <KDbLookupFieldSchema>
+#include <KDbOrderByColumn>
+#include <KDbPreparedStatement>
+#include <KDbQuerySchema>
+#include <KDbRecordData>
+#include <KDbRecordEditBuffer>
 
 #include <QDir>
 #include <QFile>
@@ -128,6 +140,701 @@ void ConnectionTest::testConnectToNonexistingDb()
     QVERIFY2(!utils.connection()->isConnected(), "Should not be connected");
 }
 
+//! @return number of records in table @a tableName or -1 on failure
+static int recordCount(KDbConnection *conn, const QString &tableName)
+{
+    int count;
+    if (true != conn->querySingleNumber(KDbEscapedString("SELECT COUNT(*) FROM ") + tableName, &count)) {
+        return -1;
+    }
+    return count;
+}
+
+void ConnectionTest::testWriteBehind()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    QVERIFY(conn->setAutoCommit(true));
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    QVERIFY(!conn->isWriteBehindEnabled());
+    QCOMPARE(conn->writeBehindRecordLimit(), 1000);
+    QCOMPARE(conn->writeBehindSizeLimit(), 1048576);
+    QCOMPARE(conn->writeBehindTimeLimit(), 1000);
+    QCOMPARE(conn->pendingWriteCount(), 0);
+
+    // records that are not committed yet are not visible for other connections
+    QScopedPointer<KDbConnection> otherConn(conn->driver()->createConnection(conn->data()));
+    QVERIFY(otherConn);
+    KDB_VERIFY(otherConn, otherConn->connect(), "Failed to connect");
+    KDB_VERIFY(otherConn, otherConn->useDatabase(), "Failed to use database");
+
+    KDB_VERIFY(conn, conn->setWriteBehindEnabled(true), "Failed to enable write-behind mode");
+    QVERIFY(conn->isWriteBehindEnabled());
+    conn->setWriteBehindTimeLimit(3600000);
+    QCOMPARE(conn->writeBehindTimeLimit(), 3600000);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(5), QVariant(20), QVariant("A"), QVariant("B")));
+    QCOMPARE(conn->pendingWriteCount(), 1);
+    QCOMPARE(recordCount(conn, "persons"), 5);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 4);
+    KDB_VERIFY(conn, conn->flush(), "Failed to flush");
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 5);
+    KDB_VERIFY(conn, conn->flush(), "Flushing without pending records should not fail");
+
+    // the group is committed when the record limit is reached
+    conn->setWriteBehindRecordLimit(2);
+    QCOMPARE(conn->writeBehindRecordLimit(), 2);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(6), QVariant(20), QVariant("C"), QVariant("D")));
+    QCOMPARE(conn->pendingWriteCount(), 1);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 5);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(7), QVariant(20), QVariant("E"), QVariant("F")));
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 7);
+    conn->setWriteBehindRecordLimit(1000);
+
+    // the group is committed when the size limit is reached
+    conn->setWriteBehindSizeLimit(10);
+    QCOMPARE(conn->writeBehindSizeLimit(), 10);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(8), QVariant(20), QVariant("G"), QVariant("H")));
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 8);
+    conn->setWriteBehindSizeLimit(1048576);
+
+    // failed write does not affect other records of the group
+    QVERIFY(conn->insertRecord(personsTable, QVariant(9), QVariant(20), QVariant("I"), QVariant("J")));
+    QVERIFY(!conn->insertRecord(personsTable, QVariant(1), QVariant(20), QVariant("K"), QVariant("L")));
+    QCOMPARE(conn->pendingWriteCount(), 1);
+    QVERIFY(conn->flush()); // result() may still contain error of the failed write
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 9);
+
+    // the group is committed before the caller's transaction that groups writes itself
+    QVERIFY(conn->insertRecord(personsTable, QVariant(10), QVariant(20), QVariant("M"), QVariant("N")));
+    QCOMPARE(conn->pendingWriteCount(), 1);
+    KDbTransaction trans = conn->beginTransaction();
+    QVERIFY(trans.isActive());
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 10);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(11), QVariant(20), QVariant("O"), QVariant("P")));
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QVERIFY(conn->rollbackTransaction(trans));
+    QCOMPARE(recordCount(conn, "persons"), 10);
+
+    // write-behind mode has no effect if auto commit is off
+    QVERIFY(conn->setAutoCommit(false));
+    QVERIFY(conn->insertRecord(personsTable, QVariant(11), QVariant(20), QVariant("O"), QVariant("P")));
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 11);
+    QVERIFY(conn->setAutoCommit(true));
+
+    // disabling the mode commits the group
+    QVERIFY(conn->insertRecord(personsTable, QVariant(12), QVariant(20), QVariant("R"), QVariant("S")));
+    QCOMPARE(conn->pendingWriteCount(), 1);
+    QVERIFY(conn->setWriteBehindEnabled(false));
+    QVERIFY(!conn->isWriteBehindEnabled());
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 12);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(13), QVariant(20), QVariant("T"), QVariant("U")));
+    QCOMPARE(conn->pendingWriteCount(), 0);
+    QCOMPARE(recordCount(otherConn.data(), "persons"), 13);
+
+    KDB_VERIFY(otherConn, otherConn->disconnect(), "Failed to disconnect");
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+//! @return number of indices named @a name existing in the SQLite database or -1 on failure
+static int sqliteIndexCount(KDbConnection *conn, const QString &name)
+{
+    return recordCount(conn, QString("sqlite_master WHERE type='index' AND name='%1'").arg(name));
+}
+
+void ConnectionTest::testIndices()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+
+    // indexed fields and explicitly defined indices are created with the table
+    KDbTableSchema *orders = new KDbTableSchema("orders");
+    QVERIFY(orders->addField(new KDbField("id", KDbField::Integer, KDbField::PrimaryKey)));
+    KDbField *personField = new KDbField("person", KDbField::Integer, KDbField::Indexed);
+    QVERIFY(orders->addField(personField));
+    KDbField *codeField = new KDbField("code", KDbField::Text);
+    QVERIFY(orders->addField(codeField));
+    KDbField *amountField = new KDbField("amount", KDbField::Integer);
+    QVERIFY(orders->addField(amountField));
+    KDbIndexSchema *codeIndex = new KDbIndexSchema;
+    QVERIFY(orders->addIndex(codeIndex));
+    QVERIFY(codeIndex->addField(codeField));
+    QVERIFY(codeIndex->addField(amountField));
+    codeIndex->setUnique(true);
+    KDB_VERIFY(conn, conn->createTable(orders), "Failed to create table with indices");
+    QCOMPARE(sqliteIndexCount(conn, "orders_person_idx"), 1);
+    QCOMPARE(sqliteIndexCount(conn, "orders_code_amount_idx"), 1);
+    QVERIFY(conn->insertRecord(orders, QVariant(1), QVariant(1), QVariant("A"), QVariant(10)));
+    QVERIFY(!conn->insertRecord(orders, QVariant(2), QVariant(1), QVariant("A"), QVariant(10)));
+
+    // dropping index removes it from the database and from the table schema
+    const int indexCount = orders->indices()->count();
+    KDB_VERIFY(conn, conn->dropIndex(codeIndex), "Failed to drop index");
+    QCOMPARE(sqliteIndexCount(conn, "orders_code_amount_idx"), 0);
+    QCOMPARE(orders->indices()->count(), indexCount - 1);
+    QVERIFY(conn->insertRecord(orders, QVariant(2), QVariant(1), QVariant("A"), QVariant(10)));
+
+    // index added to an existing table
+    KDbIndexSchema *amountIndex = new KDbIndexSchema;
+    amountIndex->setName("orders_by_amount");
+    QVERIFY(orders->addIndex(amountIndex));
+    QVERIFY(amountIndex->addField(amountField));
+    KDB_VERIFY(conn, conn->createIndex(amountIndex), "Failed to create index");
+    QCOMPARE(sqliteIndexCount(conn, "orders_by_amount"), 1);
+    KDB_VERIFY(conn, conn->dropIndex(amountIndex), "Failed to drop index");
+    QCOMPARE(sqliteIndexCount(conn, "orders_by_amount"), 0);
+
+    // primary keys are part of the table
+    QVERIFY(orders->primaryKey());
+    KDB_EXPECT_FAIL(conn, conn->createIndex(orders->primaryKey()), ERR_OTHER,
+                    "Creating index for primary key should fail");
+    KDB_EXPECT_FAIL(conn, conn->dropIndex(orders->primaryKey()), ERR_OTHER,
+                    "Dropping primary key index should fail");
+
+    // indices of tables created with SkipIndices are created on demand; lookup fields
+    // are indexed on request
+    KDbTableSchema *cars2 = new KDbTableSchema("cars2");
+    QVERIFY(cars2->addField(new KDbField("id", KDbField::Integer, KDbField::PrimaryKey)));
+    KDbField *ownerField = new KDbField("owner", KDbField::Integer);
+    QVERIFY(cars2->addField(ownerField));
+    KDbLookupFieldSchemaRecordSource recordSource;
+    recordSource.setType(KDbLookupFieldSchemaRecordSource::Type::Table);
+    recordSource.setName("persons");
+    KDbLookupFieldSchema *lookupFieldSchema = new KDbLookupFieldSchema;
+    lookupFieldSchema->setRecordSource(recordSource);
+    lookupFieldSchema->setBoundColumn(0);
+    lookupFieldSchema->setVisibleColumns(QList<int>() << 2);
+    QVERIFY(cars2->setLookupFieldSchema("owner", lookupFieldSchema));
+    KDB_VERIFY(conn, conn->createTable(cars2, KDbConnection::CreateTableOption::SkipIndices),
+               "Failed to create table without indices");
+    QVERIFY(!ownerField->isIndexed());
+    QCOMPARE(sqliteIndexCount(conn, "cars2_owner_idx"), 0);
+    KDB_VERIFY(conn, conn->createIndices(cars2, KDbConnection::CreateTableOption::IndexLookupFields),
+               "Failed to create indices");
+    QVERIFY(!ownerField->isIndexed()); // the field definition is not altered
+    QCOMPARE(sqliteIndexCount(conn, "cars2_owner_idx"), 1);
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+//! Reads all records of @a cursor and checks they are numbered 0..count-1 like records
+//! inserted by testReadAheadCursor()
+//! @return number of records read or -1 on failure
+static int readNumbers(KDbCursor *cursor)
+{
+    int count = 0;
+    for (bool ok = cursor->moveFirst(); ok; ok = cursor->moveNext(), ++count) {
+        KDbRecordData record;
+        if (cursor->value(0).toInt() != count
+            || cursor->value(1).toString() != QString::fromUtf8("Number ąę %1").arg(count)
+            || !cursor->storeCurrentRecord(&record) || record.count() != 3
+            || record.at(0).toInt() != count || record.at(2).toByteArray() != QByteArray(count % 100, 'x'))
+        {
+            qWarning() << "Unexpected record" << count << cursor->value(0) << cursor->value(1);
+            return -1;
+        }
+    }
+    if (cursor->result().isError() || !cursor->eof()) {
+        qWarning() << cursor->result();
+        return -1;
+    }
+    return count;
+}
+
+void ConnectionTest::testReadAheadCursor()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *numbers = new KDbTableSchema("numbers");
+    QVERIFY(numbers->addField(new KDbField("id", KDbField::Integer, KDbField::PrimaryKey)));
+    QVERIFY(numbers->addField(new KDbField("label", KDbField::Text)));
+    QVERIFY(numbers->addField(new KDbField("data", KDbField::BLOB)));
+    KDB_VERIFY(conn, conn->createTable(numbers), "Failed to create table");
+    // more records than fit in the read-ahead buffer
+    const int count = 1000;
+    KDbTransaction trans = conn->beginTransaction();
+    KDB_VERIFY(conn, trans.isActive(), "Failed to begin transaction");
+    for (int i = 0; i < count; ++i) {
+        QVERIFY(conn->insertRecord(numbers, QVariant(i), QVariant(QString::fromUtf8("Number ąę %1").arg(i)),
+                                   QVariant(QByteArray(i % 100, 'x'))));
+    }
+    KDB_VERIFY(conn, conn->commitTransaction(trans), "Failed to commit transaction");
+    KDbQuerySchema query(numbers);
+    QVERIFY(query.orderByColumnList()->appendField(conn, &query, "id"));
+
+    // the same records are returned with and without reading ahead
+    KDbCursor *cursor = conn->executeQuery(&query);
+    QVERIFY(cursor);
+    QCOMPARE(readNumbers(cursor), count);
+    QVERIFY(conn->deleteCursor(cursor));
+    cursor = conn->executeQuery(&query, KDbCursor::Option::ReadAhead);
+    QVERIFY(cursor);
+    QVERIFY(cursor->options() & KDbCursor::Option::ReadAhead);
+    QCOMPARE(readNumbers(cursor), count);
+
+    // the cursor can be reopened
+    QVERIFY(cursor->reopen());
+    QCOMPARE(readNumbers(cursor), count);
+    QVERIFY(conn->deleteCursor(cursor));
+
+    // the connection can be used while records are read ahead
+    cursor = conn->executeQuery(&query, KDbCursor::Option::ReadAhead);
+    QVERIFY(cursor);
+    QVERIFY(cursor->moveFirst());
+    QVERIFY(cursor->moveNext());
+    QCOMPARE(cursor->value(0).toInt(), 1);
+    QCOMPARE(recordCount(conn, "numbers"), count);
+    QCOMPARE(recordCount(conn, "persons"), 4);
+    QVERIFY(cursor->moveNext());
+    QCOMPARE(cursor->value(0).toInt(), 2);
+
+    // closing the cursor stops reading ahead even if the buffer is full
+    QTest::qSleep(100);
+    QVERIFY(conn->deleteCursor(cursor));
+
+    // empty result
+    KDbEscapedString sql("SELECT id, label, data FROM numbers WHERE id < 0");
+    cursor = conn->executeQuery(sql, KDbCursor::Option::ReadAhead);
+    QVERIFY(cursor);
+    QVERIFY(!cursor->moveFirst());
+    QVERIFY(cursor->eof());
+    QVERIFY(!cursor->result().isError());
+    QVERIFY(conn->deleteCursor(cursor));
+
+    // buffered cursors ignore the option
+    cursor = conn->executeQuery(&query, KDbCursor::Option::ReadAhead | KDbCursor::Option::Buffered);
+    QVERIFY(cursor);
+    QCOMPARE(readNumbers(cursor), count);
+    QVERIFY(cursor->moveLast());
+    QCOMPARE(cursor->value(0).toInt(), count - 1);
+    QVERIFY(cursor->movePrev());
+    QCOMPARE(cursor->value(0).toInt(), count - 2);
+    QVERIFY(conn->deleteCursor(cursor));
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+//! @return value of the "data" field of record @a id of table "blobs" as stored in the database
+static QByteArray blobValue(KDbConnection *conn, int id)
+{
+    KDbRecordData record;
+    if (true != conn->querySingleRecord(
+            KDbEscapedString("SELECT data FROM blobs WHERE id=%1").arg(id), &record))
+    {
+        qWarning() << conn->result();
+        return QByteArray();
+    }
+    return record.at(0).toByteArray();
+}
+
+void ConnectionTest::testBlobStream()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *blobs = new KDbTableSchema("blobs");
+    QVERIFY(blobs->addField(new KDbField("id", KDbField::Integer, KDbField::PrimaryKey)));
+    QVERIFY(blobs->addField(new KDbField("name", KDbField::Text)));
+    QVERIFY(blobs->addField(new KDbField("data", KDbField::BLOB)));
+    KDB_VERIFY(conn, conn->createTable(blobs), "Failed to create table");
+    QVERIFY(conn->insertRecord(blobs, QVariant(1), QVariant("abc"), QVariant(QByteArray("0123456789"))));
+    QVERIFY(conn->insertRecord(blobs, QVariant(2), QVariant("null"), QVariant()));
+
+    // reading
+    QScopedPointer<KDbBlobStream> stream(conn->openBlob(blobs, "data", QVariant(1), QIODevice::ReadOnly));
+    KDB_VERIFY(conn, stream, "Failed to open BLOB");
+    QVERIFY(stream->isOpen());
+    QVERIFY(stream->isReadable());
+    QVERIFY(!stream->isWritable());
+    QVERIFY(!stream->isSequential());
+    QCOMPARE(stream->size(), qint64(10));
+    QCOMPARE(stream->read(4), QByteArray("0123"));
+    QVERIFY(stream->seek(7));
+    QCOMPARE(stream->readAll(), QByteArray("789"));
+    QVERIFY(stream->atEnd());
+    QVERIFY(stream->seek(2));
+    QCOMPARE(stream->read(3), QByteArray("234"));
+    // read-only stream cannot be altered
+    QCOMPARE(stream->write("x"), qint64(-1));
+    QVERIFY(!stream->resize(5));
+    stream.reset();
+    QCOMPARE(blobValue(conn, 1), QByteArray("0123456789"));
+
+    // writing within and past the end of the value
+    stream.reset(conn->openBlob(blobs, "data", QVariant(1), QIODevice::ReadWrite));
+    KDB_VERIFY(conn, stream, "Failed to open BLOB for writing");
+    QVERIFY(stream->isWritable());
+    QVERIFY(stream->seek(3));
+    QCOMPARE(stream->write("xyz"), qint64(3));
+    QCOMPARE(stream->pos(), qint64(6));
+    QCOMPARE(blobValue(conn, 1), QByteArray("012xyz6789"));
+    QVERIFY(stream->seek(8));
+    QCOMPARE(stream->write("ABCD"), qint64(4));
+    QCOMPARE(stream->size(), qint64(12));
+    QCOMPARE(blobValue(conn, 1), QByteArray("012xyz67ABCD"));
+    QVERIFY(stream->seek(0));
+    QCOMPARE(stream->readAll(), QByteArray("012xyz67ABCD"));
+
+    // resizing keeps position and existing bytes, new bytes are zero
+    QVERIFY(stream->seek(2));
+    QVERIFY(stream->resize(4));
+    QCOMPARE(stream->size(), qint64(4));
+    QCOMPARE(stream->pos(), qint64(2));
+    QCOMPARE(blobValue(conn, 1), QByteArray("012x"));
+    QVERIFY(stream->resize(6));
+    QCOMPARE(blobValue(conn, 1), QByteArray("012x\0\0", 6));
+    QVERIFY(stream->resize(0));
+    QCOMPARE(stream->size(), qint64(0));
+    QCOMPARE(blobValue(conn, 1), QByteArray());
+    stream.reset();
+
+    // other fields are not affected
+    QString name;
+    QVERIFY(true == conn->querySingleString(KDbEscapedString("SELECT name FROM blobs WHERE id=1"), &name));
+    QCOMPARE(name, QString("abc"));
+
+    // NULL is empty and can be written
+    stream.reset(conn->openBlob(blobs, "data", QList<QVariant>() << 2, QIODevice::ReadWrite));
+    KDB_VERIFY(conn, stream, "Failed to open NULL BLOB");
+    QCOMPARE(stream->size(), qint64(0));
+    QVERIFY(stream->readAll().isEmpty());
+    QCOMPARE(stream->write("new"), qint64(3));
+    QCOMPARE(stream->size(), qint64(3));
+    stream.reset();
+    QCOMPARE(blobValue(conn, 2), QByteArray("new"));
+
+    // errors
+    KDB_EXPECT_FAIL(conn, conn->openBlob(blobs, "data", QVariant(3), QIODevice::ReadOnly),
+                    ERR_OBJECT_NOT_FOUND, "Opened BLOB of nonexisting record");
+    KDB_EXPECT_FAIL(conn, conn->openBlob(blobs, "name", QVariant(1), QIODevice::ReadOnly),
+                    ERR_OBJECT_NOT_FOUND, "Opened BLOB of non-BLOB field");
+    KDB_EXPECT_FAIL(conn, conn->openBlob(blobs, "foo", QVariant(1), QIODevice::ReadOnly),
+                    ERR_OBJECT_NOT_FOUND, "Opened BLOB of nonexisting field");
+    KDB_EXPECT_FAIL(conn, conn->openBlob(blobs, "data", QList<QVariant>() << 1 << 2,
+                                         QIODevice::ReadOnly),
+                    ERR_UPDATE_NO_ENTIRE_MASTER_TABLES_PKEY, "Opened BLOB using too many values");
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+//! @return visible value of the first lookup column of the first record of @a query,
+//! taken from the lookup value cache of the connection
+static QVariant firstClientSideLookupValue(KDbConnection *conn, KDbQuerySchema *query)
+{
+    KDbCursor *cursor = conn->executeQuery(query, KDbCursor::Option::ClientSideLookup);
+    if (!cursor) {
+        return QVariant();
+    }
+    QVariant value;
+    KDbRecordData data;
+    if (cursor->moveFirst() && cursor->storeCurrentRecord(&data)) {
+        value = data.value(query->fieldCount()); // lookup columns follow logical columns
+    }
+    conn->deleteCursor(cursor);
+    return value;
+}
+
+void ConnectionTest::testLookupValuesAfterUpdate()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    KDbTableSchema *carsTable = conn->tableSchema("cars");
+    QVERIFY(carsTable);
+    KDbLookupFieldSchemaRecordSource recordSource;
+    recordSource.setType(KDbLookupFieldSchemaRecordSource::Type::Table);
+    recordSource.setName("persons");
+    KDbLookupFieldSchema *lookupFieldSchema = new KDbLookupFieldSchema;
+    lookupFieldSchema->setRecordSource(recordSource);
+    lookupFieldSchema->setBoundColumn(0); // id
+    lookupFieldSchema->setVisibleColumns(QList<int>() << 2); // name
+    QVERIFY(carsTable->setLookupFieldSchema("owner", lookupFieldSchema));
+
+    // car #1 is owned by person #1
+    KDbQuerySchema carsQuery(carsTable);
+    QVERIFY(carsQuery.setWhereExpression(KDbBinaryExpression(
+        KDbVariableExpression("id"), '=', KDbConstExpression(KDbToken::INTEGER_CONST, 1))));
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jaroslaw"));
+
+    // update the lookup source record, value cached by the connection has to be reloaded
+    KDbQuerySchema personsQuery(personsTable);
+    KDbCursor *cursor = conn->executeQuery(&personsQuery);
+    QVERIFY(cursor);
+    QVERIFY(cursor->moveFirst());
+    KDbRecordData data;
+    QVERIFY(cursor->storeCurrentRecord(&data));
+    QVERIFY(conn->deleteCursor(cursor));
+    QCOMPARE(data.at(0), QVariant(1));
+    KDbRecordEditBuffer buf(true);
+    buf.insert(personsQuery.fieldsExpanded(conn).at(2), "Jarek");
+    KDB_VERIFY(conn, conn->updateRecord(&personsQuery, &data, &buf), "Failed to update record");
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jarek"));
+
+    // deleted record has no visible value
+    KDB_VERIFY(conn, conn->deleteRecord(&personsQuery, &data), "Failed to delete record");
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant());
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void ConnectionTest::testLookupValuesOfModifiedQuery()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    // "owners" query used as record source for cars.owner
+    KDbQuerySchema ownersQueryObject;
+    ownersQueryObject.setName("owners");
+    KDB_VERIFY(conn, conn->storeNewObjectData(&ownersQueryObject), "Failed to store query object");
+    KDB_VERIFY(conn, conn->storeDataBlock(ownersQueryObject.id(), "SELECT id, name FROM persons", "sql"),
+               "Failed to store query definition");
+    KDbQuerySchema *ownersQuery = conn->querySchema("owners");
+    QVERIFY(ownersQuery);
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    KDbTableSchema *carsTable = conn->tableSchema("cars");
+    QVERIFY(carsTable);
+    KDbLookupFieldSchemaRecordSource recordSource;
+    recordSource.setType(KDbLookupFieldSchemaRecordSource::Type::Query);
+    recordSource.setName("owners");
+    KDbLookupFieldSchema *lookupFieldSchema = new KDbLookupFieldSchema;
+    lookupFieldSchema->setRecordSource(recordSource);
+    lookupFieldSchema->setBoundColumn(0); // id
+    lookupFieldSchema->setVisibleColumns(QList<int>() << 1);
+    QVERIFY(carsTable->setLookupFieldSchema("owner", lookupFieldSchema));
+
+    KDbQuerySchema carsQuery(carsTable);
+    QVERIFY(carsQuery.setWhereExpression(KDbBinaryExpression(
+        KDbVariableExpression("id"), '=', KDbConstExpression(KDbToken::INTEGER_CONST, 1))));
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jaroslaw"));
+
+    // the record source query is modified in place: "SELECT id, surname, name FROM persons"
+    QVERIFY(ownersQuery->insertField(1, personsTable->field("surname")));
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Staniek"));
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void ConnectionTest::testNestedTransactions()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    QVERIFY(conn->driver()->behavior()->features & KDbDriver::NestedTransactions);
+    QVERIFY(!conn->driver()->behavior()->DDL_COMMITS_TRANSACTION);
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    QCOMPARE(recordCount(conn, "persons"), 4);
+
+    KDbTransaction trans = conn->beginTransaction();
+    KDB_VERIFY(conn, trans.isActive(), "Failed to begin transaction");
+    QVERIFY(!trans.isNested());
+    QCOMPARE(conn->defaultTransaction(), trans);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(5), QVariant(20), QVariant("A"), QVariant("B")));
+
+    // rolled back nested transaction undoes only its changes
+    KDbTransaction nested = conn->beginTransaction();
+    KDB_VERIFY(conn, nested.isActive(), "Failed to begin nested transaction");
+    QVERIFY(nested.isNested());
+    QCOMPARE(conn->defaultTransaction(), trans);
+    QVERIFY(conn->insertRecord(personsTable, QVariant(6), QVariant(20), QVariant("C"), QVariant("D")));
+    QCOMPARE(recordCount(conn, "persons"), 6);
+    KDB_VERIFY(conn, conn->rollbackTransaction(nested), "Failed to roll back nested transaction");
+    QVERIFY(!nested.isActive());
+    QVERIFY(trans.isActive());
+    QCOMPARE(recordCount(conn, "persons"), 5);
+
+    // committed nested transaction becomes part of the enclosing one
+    nested = conn->beginTransaction();
+    KDB_VERIFY(conn, nested.isActive(), "Failed to begin nested transaction");
+    QVERIFY(conn->insertRecord(personsTable, QVariant(7), QVariant(20), QVariant("E"), QVariant("F")));
+    KDB_VERIFY(conn, conn->commitTransaction(nested), "Failed to commit nested transaction");
+    QVERIFY(!nested.isActive());
+    QVERIFY(trans.isActive());
+    QCOMPARE(recordCount(conn, "persons"), 6);
+
+    // ending the enclosing transaction ends nested ones
+    KDbTransaction nested2 = conn->beginTransaction();
+    KDB_VERIFY(conn, nested2.isActive(), "Failed to begin nested transaction");
+    KDbTransaction nested3 = conn->beginTransaction();
+    KDB_VERIFY(conn, nested3.isActive(), "Failed to begin second level of nested transaction");
+    QVERIFY(conn->insertRecord(personsTable, QVariant(8), QVariant(20), QVariant("G"), QVariant("H")));
+    KDB_VERIFY(conn, conn->rollbackTransaction(trans), "Failed to roll back transaction");
+    QVERIFY(!trans.isActive());
+    QVERIFY(!nested2.isActive());
+    QVERIFY(!nested3.isActive());
+    QCOMPARE(recordCount(conn, "persons"), 4);
+
+    // schema changes join the caller's transaction using nested transactions
+    conn->setAutoCommit(true);
+    trans = conn->beginTransaction();
+    KDB_VERIFY(conn, trans.isActive(), "Failed to begin transaction");
+    KDbTableSchema *table = new KDbTableSchema("savepoints");
+    table->addField(new KDbField("id", KDbField::Integer, KDbField::PrimaryKey));
+    KDB_VERIFY(conn, conn->createTable(table), "Failed to create table within transaction");
+    QVERIFY(trans.isActive());
+    QCOMPARE(conn->defaultTransaction(), trans);
+    KDB_VERIFY(conn, conn->commitTransaction(trans), "Failed to commit transaction");
+    QVERIFY(true == conn->containsTable("savepoints"));
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void ConnectionTest::testPreparedStatementBatch()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    KDbTableSchema *carsTable = conn->tableSchema("cars");
+    QVERIFY(carsTable);
+    qint64 affected;
+    int failed;
+
+    KDbPreparedStatement insert = conn->prepareStatement(KDbPreparedStatement::InsertStatement,
+                                                         personsTable);
+    QVERIFY(insert.isValid());
+    KDbPreparedStatementColumns columns;
+    columns << (QList<QVariant>() << 5 << 6 << 7)
+            << (QList<QVariant>() << 20 << 30) // missing value is NULL
+            << (QList<QVariant>() << "A" << "B" << "C")
+            << (QList<QVariant>() << "D" << "E" << "F");
+    KDB_VERIFY(&insert, insert.executeBatch(columns, &affected, &failed), "Failed to insert batch");
+    QCOMPARE(affected, qint64(3));
+    QCOMPARE(failed, -1);
+    QCOMPARE(recordCount(conn, "persons"), 7);
+    QCOMPARE(recordCount(conn, "persons WHERE age IS NULL"), 1);
+
+    // records preceding the failing one are kept, following ones are not executed
+    columns.clear();
+    columns << (QList<QVariant>() << 8 << 1 << 9); // 1 already exists
+    KDB_EXPECT_FAIL(&insert, insert.executeBatch(columns, &affected, &failed), ERR_OTHER,
+                    "Batch with duplicated primary key should fail");
+    QCOMPARE(affected, qint64(1));
+    QCOMPARE(failed, 1);
+    QCOMPARE(recordCount(conn, "persons"), 8);
+    QCOMPARE(recordCount(conn, "persons WHERE id=9"), 0);
+
+    // owner of car #1 is visible through cached lookup values
+    KDbLookupFieldSchemaRecordSource recordSource;
+    recordSource.setType(KDbLookupFieldSchemaRecordSource::Type::Table);
+    recordSource.setName("persons");
+    KDbLookupFieldSchema *lookupFieldSchema = new KDbLookupFieldSchema;
+    lookupFieldSchema->setRecordSource(recordSource);
+    lookupFieldSchema->setBoundColumn(0); // id
+    lookupFieldSchema->setVisibleColumns(QList<int>() << 2); // name
+    QVERIFY(carsTable->setLookupFieldSchema("owner", lookupFieldSchema));
+    KDbQuerySchema carsQuery(carsTable);
+    QVERIFY(carsQuery.setWhereExpression(KDbBinaryExpression(
+        KDbVariableExpression("id"), '=', KDbConstExpression(KDbToken::INTEGER_CONST, 1))));
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jaroslaw"));
+
+    KDbFieldList updateFields;
+    QVERIFY(updateFields.addField(personsTable->field("name")));
+    KDbPreparedStatement update = conn->prepareStatement(KDbPreparedStatement::UpdateStatement,
+                                                         &updateFields, QStringList() << "id");
+    QVERIFY(update.isValid());
+    columns.clear();
+    columns << (QList<QVariant>() << "Jarek" << "Leszek" << "Nobody")
+            << (QList<QVariant>() << 1 << 2 << 100); // there is no record #100
+    KDB_VERIFY(&update, update.executeBatch(columns, &affected, &failed), "Failed to update batch");
+    QCOMPARE(affected, qint64(2));
+    QCOMPARE(recordCount(conn, "persons WHERE name='Leszek'"), 1);
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jarek"));
+
+    KDbPreparedStatement del = conn->prepareStatement(KDbPreparedStatement::DeleteStatement,
+                                                      personsTable, QStringList() << "id");
+    QVERIFY(del.isValid());
+    columns.clear();
+    columns << (QList<QVariant>() << 1 << 5 << 6 << 7 << 100);
+    KDB_VERIFY(&del, del.executeBatch(columns, &affected, &failed), "Failed to delete batch");
+    QCOMPARE(affected, qint64(4));
+    QCOMPARE(recordCount(conn, "persons"), 4);
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant());
+
+    // SELECT statements are not supported
+    KDbPreparedStatement select = conn->prepareStatement(KDbPreparedStatement::SelectStatement,
+                                                         personsTable, QStringList() << "id");
+    KDB_EXPECT_FAIL(&select, select.executeBatch(columns), ERR_UNSUPPORTED_DRV_FEATURE,
+                    "Batch execution of SELECT should fail");
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void ConnectionTest::testPreparedStatementExecute()
+{
+    QVERIFY(utils.testCreateDbWithTables("ConnectionTest"));
+    KDbConnection *conn = utils.connection();
+    QVERIFY(conn->setAutoCommit(true));
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    KDbTableSchema *carsTable = conn->tableSchema("cars");
+    QVERIFY(carsTable);
+
+    // owner of car #1 is visible through cached lookup values
+    KDbLookupFieldSchemaRecordSource recordSource;
+    recordSource.setType(KDbLookupFieldSchemaRecordSource::Type::Table);
+    recordSource.setName("persons");
+    KDbLookupFieldSchema *lookupFieldSchema = new KDbLookupFieldSchema;
+    lookupFieldSchema->setRecordSource(recordSource);
+    lookupFieldSchema->setBoundColumn(0); // id
+    lookupFieldSchema->setVisibleColumns(QList<int>() << 2); // name
+    QVERIFY(carsTable->setLookupFieldSchema("owner", lookupFieldSchema));
+    KDbQuerySchema carsQuery(carsTable);
+    QVERIFY(carsQuery.setWhereExpression(KDbBinaryExpression(
+        KDbVariableExpression("id"), '=', KDbConstExpression(KDbToken::INTEGER_CONST, 1))));
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jaroslaw"));
+
+    // single executions are writes of the write-behind group
+    KDB_VERIFY(conn, conn->setWriteBehindEnabled(true), "Failed to enable write-behind mode");
+    conn->setWriteBehindTimeLimit(3600000);
+    KDbPreparedStatement insert = conn->prepareStatement(KDbPreparedStatement::InsertStatement,
+                                                         personsTable);
+    QVERIFY(insert.isValid());
+    KDB_VERIFY(&insert, insert.execute(KDbPreparedStatementParameters() << 5 << 20 << "A" << "B"),
+               "Failed to insert record");
+    QCOMPARE(conn->pendingWriteCount(), 1);
+
+    // lookup values are reloaded after single UPDATE and DELETE statements
+    KDbFieldList updateFields;
+    QVERIFY(updateFields.addField(personsTable->field("name")));
+    KDbPreparedStatement update = conn->prepareStatement(KDbPreparedStatement::UpdateStatement,
+                                                         &updateFields, QStringList() << "id");
+    QVERIFY(update.isValid());
+    KDB_VERIFY(&update, update.execute(KDbPreparedStatementParameters() << "Jarek" << 1),
+               "Failed to update record");
+    QCOMPARE(conn->pendingWriteCount(), 2);
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant("Jarek"));
+
+    KDbPreparedStatement del = conn->prepareStatement(KDbPreparedStatement::DeleteStatement,
+                                                      personsTable, QStringList() << "id");
+    QVERIFY(del.isValid());
+    KDB_VERIFY(&del, del.execute(KDbPreparedStatementParameters() << 1), "Failed to delete record");
+    QCOMPARE(conn->pendingWriteCount(), 3);
+    QCOMPARE(firstClientSideLookupValue(conn, &carsQuery), QVariant());
+
+    // prepared statement executed by updateRecord() is a part of the same write
+    KDbQuerySchema personsQuery(personsTable);
+    KDbCursor *cursor = conn->executeQuery(&personsQuery);
+    QVERIFY(cursor);
+    QVERIFY(cursor->moveFirst());
+    KDbRecordData data;
+    QVERIFY(cursor->storeCurrentRecord(&data));
+    QVERIFY(conn->deleteCursor(cursor));
+    KDbRecordEditBuffer buf(true);
+    buf.insert(personsQuery.fieldsExpanded(conn).at(2), "Leszek");
+    KDB_VERIFY(conn, conn->updateRecord(&personsQuery, &data, &buf), "Failed to update record");
+    QCOMPARE(conn->pendingWriteCount(), 4);
+    KDB_VERIFY(conn, conn->flush(), "Failed to flush");
+    QCOMPARE(recordCount(conn, "persons WHERE name='Leszek'"), 1);
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
 void ConnectionTest::cleanupTestCase()
 {
 }
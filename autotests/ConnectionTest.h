@@ -30,6 +30,15 @@ private Q_SLOTS:
     void testConnectionData();
     void testCreateDb();
     void testConnectToNonexistingDb();
+    void testWriteBehind();
+    void testIndices();
+    void testReadAheadCursor();
+    void testBlobStream();
+    void testLookupValuesAfterUpdate();
+    void testLookupValuesOfModifiedQuery();
+    void testNestedTransactions();
+    void testPreparedStatementBatch();
+    void testPreparedStatementExecute();
     void cleanupTestCase();
 
 private:
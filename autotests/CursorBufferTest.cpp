@@ -0,0 +1,193 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "CursorBufferTest.h"
+
+#include <KDbCursor>
+#include <KDbRecordData>
+#include <KDbCursor_p.h>
+
+#include <QTest>
+
+QTEST_GUILESS_MAIN(CursorBufferTest)
+
+//! @return record with integer @a id, text and BLOB of @a blobSize bytes
+static KDbRecordData testRecord(int id, int blobSize = 16)
+{
+    KDbRecordData record(4);
+    record[0] = id;
+    record[1] = QString::fromUtf8("Record ąę #%1").arg(id);
+    record[2] = QByteArray(blobSize, char('a' + id % 26));
+    record[3] = QVariant(); // NULL
+    return record;
+}
+
+//! Verifies that record @a index of @a buffer equals testRecord(index, blobSize)
+static bool verifyRecord(KDbCursorBuffer *buffer, int index, int blobSize = 16)
+{
+    KDbRecordData record;
+    if (!buffer->load(index, &record)) {
+        qWarning() << "Could not load record" << index;
+        return false;
+    }
+    const KDbRecordData expected(testRecord(index, blobSize));
+    if (record.count() != expected.count()) {
+        qWarning() << "Record" << index << "has" << record.count() << "values";
+        return false;
+    }
+    for (int i = 0; i < expected.count(); ++i) {
+        if (record.at(i) != expected.at(i) || record.at(i).isNull() != expected.at(i).isNull()) {
+            qWarning() << "Record" << index << "value" << i << record.at(i) << "expected"
+                       << expected.at(i);
+            return false;
+        }
+    }
+    return true;
+}
+
+void CursorBufferTest::initTestCase()
+{
+}
+
+void CursorBufferTest::testInMemory()
+{
+    KDbCursorBuffer buffer(1024 * 1024);
+    QCOMPARE(buffer.count(), qint64(0));
+    QVERIFY(!buffer.isSpilled());
+    for (int i = 0; i < 100; ++i) {
+        QVERIFY(buffer.append(testRecord(i)));
+    }
+    QCOMPARE(buffer.count(), qint64(100));
+    QVERIFY(!buffer.isSpilled());
+    for (int i = 99; i >= 0; --i) {
+        QVERIFY(verifyRecord(&buffer, i));
+    }
+    KDbRecordData record;
+    QVERIFY(!buffer.load(-1, &record));
+    QVERIFY(!buffer.load(100, &record));
+}
+
+void CursorBufferTest::testSpill()
+{
+    // about ten records fit in memory, the rest is written to the temporary file
+    KDbCursorBuffer buffer(1000);
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(buffer.append(testRecord(i)));
+    }
+    QCOMPARE(buffer.count(), qint64(1000));
+    QVERIFY(buffer.isSpilled());
+    // seek in both directions and between memory and file
+    const QList<int> indices { 999, 0, 500, 1, 998, 5, 250, 750, 20, 10 };
+    for (int i : indices) {
+        QVERIFY(verifyRecord(&buffer, i));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        QVERIFY(verifyRecord(&buffer, i));
+    }
+    // records appended after reading are readable too
+    QVERIFY(buffer.append(testRecord(1000)));
+    QVERIFY(verifyRecord(&buffer, 1000));
+    QVERIFY(verifyRecord(&buffer, 0));
+}
+
+void CursorBufferTest::testPageReload()
+{
+    // no records are kept in memory, each of them takes part of the page read from the file
+    const int blobSize = 10 * 1024;
+    KDbCursorBuffer buffer(0);
+    for (int i = 0; i < 50; ++i) {
+        QVERIFY(buffer.append(testRecord(i, blobSize)));
+    }
+    QVERIFY(buffer.isSpilled());
+    QVERIFY(verifyRecord(&buffer, 0, blobSize));
+    QVERIFY(verifyRecord(&buffer, 1, blobSize)); // same page
+    QVERIFY(verifyRecord(&buffer, 49, blobSize)); // page reloaded
+    QVERIFY(verifyRecord(&buffer, 2, blobSize)); // page reloaded backwards
+    QVERIFY(verifyRecord(&buffer, 25, blobSize));
+
+    // records larger than the page
+    const int largeBlobSize = 200 * 1024;
+    KDbCursorBuffer largeBuffer(0);
+    for (int i = 0; i < 3; ++i) {
+        QVERIFY(largeBuffer.append(testRecord(i, largeBlobSize)));
+    }
+    QVERIFY(verifyRecord(&largeBuffer, 2, largeBlobSize));
+    QVERIFY(verifyRecord(&largeBuffer, 0, largeBlobSize));
+    QVERIFY(verifyRecord(&largeBuffer, 1, largeBlobSize));
+}
+
+void CursorBufferTest::testClear()
+{
+    KDbCursorBuffer buffer(100);
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(buffer.append(testRecord(i)));
+    }
+    QVERIFY(buffer.isSpilled());
+    buffer.clear();
+    QCOMPARE(buffer.count(), qint64(0));
+    QVERIFY(!buffer.isSpilled());
+    KDbRecordData record;
+    QVERIFY(!buffer.load(0, &record));
+    // the buffer is reusable
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(buffer.append(testRecord(i)));
+    }
+    QVERIFY(buffer.isSpilled());
+    for (int i = 0; i < 10; ++i) {
+        QVERIFY(verifyRecord(&buffer, i));
+    }
+}
+
+void CursorBufferTest::testCursorWithMemoryBudget()
+{
+    QVERIFY(utils.testCreateDbWithTables("CursorBufferTest"));
+    KDbConnection *conn = utils.connection();
+    QCOMPARE(conn->cursorMemoryBudget(), qint64(0));
+    conn->setCursorMemoryBudget(1); // every record goes to the temporary file
+    KDbCursor *cursor = conn->executeQuery(
+        KDbEscapedString("SELECT id, name FROM persons ORDER BY id"), KDbCursor::Option::Buffered);
+    QVERIFY(cursor);
+    QCOMPARE(cursor->memoryBudget(), qint64(1));
+
+    QList<QVariant> ids;
+    for (cursor->moveFirst(); !cursor->eof(); cursor->moveNext()) {
+        ids.append(cursor->value(0));
+    }
+    QCOMPARE(ids, QList<QVariant>() << 1 << 2 << 3 << 4);
+    // records are read back from the buffer
+    QVERIFY(cursor->moveLast());
+    QCOMPARE(cursor->value(0), QVariant(4));
+    QCOMPARE(cursor->value(1), QVariant("John"));
+    QVERIFY(cursor->movePrev());
+    QCOMPARE(cursor->value(0), QVariant(3));
+    QVERIFY(cursor->moveFirst());
+    QCOMPARE(cursor->value(0), QVariant(1));
+    QCOMPARE(cursor->value(1), QVariant("Jaroslaw"));
+    KDbRecordData record;
+    QVERIFY(cursor->storeCurrentRecord(&record));
+    QCOMPARE(record.at(1), QVariant("Jaroslaw"));
+    QVERIFY(conn->deleteCursor(cursor));
+    conn->setCursorMemoryBudget(0);
+
+    QVERIFY(utils.testDisconnectAndDropDb());
+}
+
+void CursorBufferTest::cleanupTestCase()
+{
+}
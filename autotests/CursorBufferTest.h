@@ -0,0 +1,42 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_CURSORBUFFERTEST_H
+#define KDB_CURSORBUFFERTEST_H
+
+#include "KDbTestUtils.h"
+
+//! Tests for buffering records of cursors within a memory budget
+class CursorBufferTest : public QObject
+{
+    Q_OBJECT
+private Q_SLOTS:
+    void initTestCase();
+    void testInMemory();
+    void testSpill();
+    void testPageReload();
+    void testClear();
+    void testCursorWithMemoryBudget();
+    void cleanupTestCase();
+
+private:
+    KDbTestUtils utils;
+};
+
+#endif
@@ -884,15 +884,26 @@ void KDbTest::testCstringToVariant_data()
     QTest::newRow("bool true") << "true" << KDbField::Boolean << -1 << QVariant(true) << KDb::Signed << true;
     QTest::newRow("bool no") << "no" << KDbField::Boolean << -1 << QVariant(true) << KDb::Signed << true; // surprised? See docs for QVariant::toBool().
     ++c;
-    //! @todo support Date
+    QTest::newRow("date1") << "2017-03-04" << KDbField::Date << -1 << QVariant(QDate(2017, 3, 4)) << KDb::Signed << true;
+    QTest::newRow("date2") << "2017-02-30" << KDbField::Date << -1 << QVariant() << KDb::Signed << false;
     ++c;
-    //! @todo support DateTime
+    QTest::newRow("datetime1") << "2017-03-04T10:11:12" << KDbField::DateTime << -1
+        << QVariant(QDateTime(QDate(2017, 3, 4), QTime(10, 11, 12))) << KDb::Signed << true;
+    QTest::newRow("datetime2") << "2017-03-04 10:11:12.345" << KDbField::DateTime << -1
+        << QVariant(QDateTime(QDate(2017, 3, 4), QTime(10, 11, 12, 345))) << KDb::Signed << true;
+    QTest::newRow("datetime3") << "2017-03-04 10:11" << KDbField::DateTime << -1
+        << QVariant(QDateTime(QDate(2017, 3, 4), QTime(10, 11))) << KDb::Signed << true;
+    QTest::newRow("datetime4") << "2017-03-04 10" << KDbField::DateTime << -1 << QVariant() << KDb::Signed << false;
     ++c;
-    //! @todo support Time
+    QTest::newRow("time1") << "10:11:12" << KDbField::Time << -1 << QVariant(QTime(10, 11, 12)) << KDb::Signed << true;
+    QTest::newRow("time2") << "10:11:12.5" << KDbField::Time << -1 << QVariant(QTime(10, 11, 12, 500)) << KDb::Signed << true;
+    QTest::newRow("time3") << "24:11:12" << KDbField::Time << -1 << QVariant() << KDb::Signed << false;
     ++c;
-    //! @todo support Float
+    QTest::newRow("float1") << "1.5" << KDbField::Float << -1 << QVariant(1.5) << KDb::Signed << true;
+    QTest::newRow("float2") << "1.5x" << KDbField::Float << -1 << QVariant() << KDb::Signed << false;
     ++c;
-    //! @todo support Double
+    QTest::newRow("double1") << "-1.25e3" << KDbField::Double << -1 << QVariant(-1250.0) << KDb::Signed << true;
+    QTest::newRow("double2") << "42" << KDbField::Double << -1 << QVariant(42.0) << KDb::Signed << true;
     ++c;
     //! @todo support Text
     ++c;
@@ -21,6 +21,10 @@
 
 #include <KDb>
 #include <KDbConnectionData>
+#include <KDbExpression>
+#include <KDbLookupFieldSchema>
+#include <KDbNativeStatementBuilder>
+#include <KDbOrderByColumn>
 #include <KDbQueryAsterisk>
 #include <KDbQuerySchema>
 #include <KDbVersionInfo>
@@ -60,6 +64,233 @@ void QuerySchemaTest::testCaching()
     const KDbQueryColumnInfo::Vector expandedUnique2
         = query.fieldsExpanded(utils.connection(), KDbQuerySchema::FieldsExpandedMode::Unique);
     QCOMPARE(expandedUnique2.count(), 1);
+
+    // native statements are cached and updated when the query changes
+    KDbEscapedString sql1;
+    KDbEscapedString sql2;
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql1, &query));
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql2, &query));
+    QCOMPARE(sql1, sql2);
+    QVERIFY(!sql1.toString().contains("[model]"));
+    KDbField *modelField = carsTable->field("model");
+    QVERIFY(modelField);
+    query.addField(modelField); // -> "SELECT id, model from cars"
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql2, &query));
+    QVERIFY(sql2.toString().contains("[model]"));
+    QVERIFY(query.addToWhereExpression(idField, 1));
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql1, &query));
+    QVERIFY(sql1.toString().contains("WHERE"));
+    query.orderByColumnList()->appendField(modelField);
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql2, &query));
+    QVERIFY(sql2.toString().contains("ORDER BY [model]"));
+    // iterating over ORDER BY columns does not modify them
+    for (KDbOrderByColumn *column : *query.orderByColumnList()) {
+        QVERIFY(column);
+    }
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql1, &query));
+    QCOMPARE(sql1, sql2);
+    *query.orderByColumnList()->value(0)
+        = KDbOrderByColumn(modelField, KDbOrderByColumn::SortOrder::Descending);
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql2, &query));
+    QVERIFY2(sql2.toString().contains("ORDER BY [model] DESC"), sql2.constData());
+}
+
+void QuerySchemaTest::testCachingWithLookupQuery()
+{
+    QVERIFY(utils.testCreateDbWithTables("QuerySchemaTest"));
+    KDbConnection *conn = utils.connection();
+    // "owners" query used as record source for cars.owner
+    KDbQuerySchema ownersQueryObject;
+    ownersQueryObject.setName("owners");
+    KDB_VERIFY(conn, conn->storeNewObjectData(&ownersQueryObject), "Failed to store query object");
+    KDB_VERIFY(conn, conn->storeDataBlock(ownersQueryObject.id(), "SELECT id, name FROM persons", "sql"),
+               "Failed to store query definition");
+    KDbQuerySchema *ownersQuery = conn->querySchema("owners");
+    QVERIFY(ownersQuery);
+    KDbTableSchema *carsTable = conn->tableSchema("cars");
+    QVERIFY(carsTable);
+    KDbLookupFieldSchemaRecordSource recordSource;
+    recordSource.setType(KDbLookupFieldSchemaRecordSource::Type::Query);
+    recordSource.setName("owners");
+    KDbLookupFieldSchema *lookupFieldSchema = new KDbLookupFieldSchema;
+    lookupFieldSchema->setRecordSource(recordSource);
+    lookupFieldSchema->setBoundColumn(0);
+    lookupFieldSchema->setVisibleColumns(QList<int>() << 1);
+    QVERIFY(carsTable->setLookupFieldSchema("owner", lookupFieldSchema));
+
+    KDbQuerySchema query;
+    query.addTable(carsTable);
+    query.addField(carsTable->field("owner"));
+    KDbEscapedString sql1;
+    KDbEscapedString sql2;
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql1, &query));
+    QVERIFY2(sql1.toString().contains("[name]"), sql1.constData());
+    QVERIFY(!sql1.toString().contains("[surname]"));
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql2, &query));
+    QCOMPARE(sql1, sql2);
+
+    // the lookup query is modified in place: "SELECT id, name, surname FROM persons"
+    KDbTableSchema *personsTable = conn->tableSchema("persons");
+    QVERIFY(personsTable);
+    QVERIFY(ownersQuery->addField(personsTable->field("surname")));
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql2, &query));
+    QVERIFY2(sql2.toString().contains("[surname]"), sql2.constData());
+}
+
+void QuerySchemaTest::testLimitAndOffset()
+{
+    QVERIFY(utils.testCreateDbWithTables("QuerySchemaTest"));
+    KDbQuerySchema query;
+    KDbTableSchema *carsTable = utils.connection()->tableSchema("cars");
+    QVERIFY(carsTable);
+    query.addTable(carsTable);
+    query.addAsterisk(new KDbQueryAsterisk(&query));
+    QCOMPARE(query.limit(), qint64(-1));
+    QCOMPARE(query.offset(), qint64(0));
+
+    KDbEscapedString sql;
+    query.setLimit(10);
+    QCOMPARE(query.limit(), qint64(10));
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars LIMIT 10");
+    query.setOffset(20);
+    QCOMPARE(query.offset(), qint64(20));
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars LIMIT 10 OFFSET 20");
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql, &query));
+    QVERIFY2(sql.toString().endsWith(" LIMIT 10 OFFSET 20"), sql.constData());
+
+    // offset without limit
+    query.setLimit(-5);
+    QCOMPARE(query.limit(), qint64(-1));
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars OFFSET 20");
+    QVERIFY(utils.driverBuilder()->generateSelectStatement(&sql, &query));
+    QVERIFY2(sql.toString().endsWith(" LIMIT -1 OFFSET 20"), sql.constData()); // SQLite
+
+    query.setOffset(-1);
+    QCOMPARE(query.offset(), qint64(0));
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars");
+}
+
+void QuerySchemaTest::testSeekAfter()
+{
+    QVERIFY(utils.testCreateDbWithTables("QuerySchemaTest"));
+    KDbQuerySchema query;
+    KDbTableSchema *carsTable = utils.connection()->tableSchema("cars");
+    QVERIFY(carsTable);
+    query.addTable(carsTable);
+    query.addAsterisk(new KDbQueryAsterisk(&query));
+    KDbField *ownerField = carsTable->field("owner");
+    QVERIFY(ownerField);
+    KDbField *idField = carsTable->field("id");
+    QVERIFY(idField);
+    query.orderByColumnList()->appendField(ownerField);
+    query.orderByColumnList()->appendField(idField, KDbOrderByColumn::SortOrder::Descending);
+
+    KDbEscapedString sql;
+    query.setSeekAfterValues(QList<QVariant>() << 7);
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars WHERE owner > 7 ORDER BY owner, id DESC");
+
+    query.setSeekAfterValues(QList<QVariant>() << 7 << 100);
+    QCOMPARE(query.seekAfterValues(), QList<QVariant>() << 7 << 100);
+    query.setLimit(5);
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars WHERE (owner > 7 OR (owner = 7 AND id < 100)) "
+                  "ORDER BY owner, id DESC LIMIT 5");
+    QVERIFY(query.validate());
+
+    // too many values
+    query.setSeekAfterValues(QList<QVariant>() << 7 << 100 << 1);
+    QVERIFY(!query.validate());
+    QVERIFY(!utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+
+    query.setSeekAfterValues(QList<QVariant>());
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT cars.* FROM cars ORDER BY owner, id DESC LIMIT 5");
+}
+
+void QuerySchemaTest::testGrouping()
+{
+    QVERIFY(utils.testCreateDbWithTables("QuerySchemaTest"));
+    KDbQuerySchema query;
+    KDbTableSchema *carsTable = utils.connection()->tableSchema("cars");
+    QVERIFY(carsTable);
+    query.addTable(carsTable);
+    KDbField *ownerField = carsTable->field("owner");
+    QVERIFY(ownerField);
+    query.addField(ownerField);
+    QVERIFY(!query.isGrouped());
+    QCOMPARE(query.masterTable(), carsTable);
+
+    KDbNArgExpression sumArgs(KDb::ArgumentListExpression, ',');
+    sumArgs.append(KDbVariableExpression("id"));
+    const KDbFunctionExpression sum("SUM", sumArgs);
+    QVERIFY(sum.containsAggregate());
+    QVERIFY(query.addExpression(sum.clone()));
+    QVERIFY(query.isGrouped());
+    QCOMPARE(query.masterTable(), carsTable); // unchanged, grouped queries are read-only though
+    QVERIFY(query.pkeyFieldsOrder(utils.connection()).isEmpty());
+    QVERIFY(!query.validate()); // "owner" is neither aggregated nor grouped
+
+    QVERIFY(query.addToGroupBy(ownerField));
+    QCOMPARE(query.groupByExpressions().count(), 1);
+    QVERIFY(query.validate());
+    KDbEscapedString sql;
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT owner, SUM(id) AS expr1 FROM cars GROUP BY cars.owner");
+
+    // aggregates are allowed in HAVING but not in WHERE nor in GROUP BY
+    const KDbBinaryExpression condition(sum.clone(), '>',
+                                        KDbConstExpression(KDbToken::INTEGER_CONST, 10));
+    QString errorMessage;
+    QVERIFY(!query.setWhereExpression(condition, &errorMessage));
+    QVERIFY(!errorMessage.isEmpty());
+    QVERIFY(!query.setGroupByExpressions(QList<KDbExpression>() << sum.clone()));
+    QCOMPARE(query.groupByExpressions().count(), 1);
+    QVERIFY(query.setHavingExpression(condition));
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &query));
+    QCOMPARE(sql, "SELECT owner, SUM(id) AS expr1 FROM cars GROUP BY cars.owner "
+                  "HAVING SUM(id) > 10");
+
+    // nested aggregates
+    KDbNArgExpression maxArgs(KDb::ArgumentListExpression, ',');
+    maxArgs.append(sum.clone());
+    const KDbFunctionExpression nestedMax("MAX", maxArgs);
+    QVERIFY(!query.setHavingExpression(KDbBinaryExpression(
+        nestedMax, '>', KDbConstExpression(KDbToken::INTEGER_CONST, 10))));
+
+    // multi-argument MAX() is not an aggregate but an alias of GREATEST()
+    KDbNArgExpression greatestArgs(KDb::ArgumentListExpression, ',');
+    greatestArgs.append(KDbVariableExpression("id"));
+    greatestArgs.append(KDbConstExpression(KDbToken::INTEGER_CONST, 1));
+    QVERIFY(!KDbFunctionExpression("MAX", greatestArgs).containsAggregate());
+
+    QVERIFY(query.setHavingExpression(KDbExpression()));
+    QVERIFY(query.setGroupByExpressions(QList<KDbExpression>()));
+    QVERIFY(query.isGrouped()); // still grouped because of SUM()
+    QVERIFY(!query.validate());
+
+    // COUNT(*) is an aggregate, other functions do not accept asterisk
+    KDbNArgExpression asteriskArgs(KDb::ArgumentListExpression, ',');
+    asteriskArgs.append(KDbVariableExpression("*"));
+    const KDbFunctionExpression countAll("COUNT", asteriskArgs);
+    QVERIFY(countAll.containsAggregate());
+    KDbQuerySchema countQuery;
+    countQuery.addTable(carsTable);
+    QVERIFY(countQuery.addExpression(countAll.clone()));
+    QVERIFY(countQuery.isGrouped());
+    QVERIFY(countQuery.validate());
+    QVERIFY(utils.kdbBuilder()->generateSelectStatement(&sql, &countQuery));
+    QCOMPARE(sql, "SELECT COUNT(*) AS expr1 FROM cars");
+    KDbQuerySchema sumAllQuery;
+    sumAllQuery.addTable(carsTable);
+    KDbNArgExpression sumAllArgs(KDb::ArgumentListExpression, ',');
+    sumAllArgs.append(KDbVariableExpression("*"));
+    QVERIFY(sumAllQuery.addExpression(KDbFunctionExpression("SUM", sumAllArgs)));
+    QVERIFY(!sumAllQuery.validate());
 }
 
 void QuerySchemaTest::cleanupTestCase()
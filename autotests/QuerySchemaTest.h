@@ -28,9 +28,21 @@ class QuerySchemaTest : public QObject
 private Q_SLOTS:
     void initTestCase();
 
-    //! Tests if expanded fields cache is updated when query schema object changes
+    //! Tests if expanded fields and statement caches are updated when query schema object changes
     void testCaching();
 
+    //! Tests if cached statements are updated when a lookup query they use changes
+    void testCachingWithLookupQuery();
+
+    //! Tests generating LIMIT and OFFSET sections
+    void testLimitAndOffset();
+
+    //! Tests generating conditions for keyset pagination
+    void testSeekAfter();
+
+    //! Tests GROUP BY and HAVING sections and validation of grouped queries
+    void testGrouping();
+
     void cleanupTestCase();
 
 private:
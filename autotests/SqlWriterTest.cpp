@@ -0,0 +1,159 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "SqlWriterTest.h"
+
+#include <KDb>
+#include <KDbDriver>
+#include <KDbSqlWriter>
+
+#include <QTest>
+
+#include <limits>
+
+QTEST_GUILESS_MAIN(SqlWriterTest)
+
+void SqlWriterTest::initTestCase()
+{
+    QVERIFY(utils.testSqliteDriver());
+}
+
+void SqlWriterTest::testIdentifier_data()
+{
+    QTest::addColumn<QString>("identifier");
+
+    QTest::newRow("simple") << "persons";
+    QTest::newRow("mixed case with digits") << "Name_2";
+    QTest::newRow("underscore first") << "_id";
+    QTest::newRow("keyword") << "select";
+    QTest::newRow("uppercase keyword") << "FROM";
+    QTest::newRow("leading digit") << "1abc";
+    QTest::newRow("digits only") << "42";
+    QTest::newRow("empty") << "";
+    QTest::newRow("space") << "first name";
+    QTest::newRow("quote") << "a\"b";
+    QTest::newRow("non-ASCII") << QString::fromUtf8("żółw");
+    QTest::newRow("non-ASCII suffix") << QString::fromUtf8("name_ą");
+}
+
+void SqlWriterTest::testIdentifier()
+{
+    QFETCH(QString, identifier);
+
+    KDbSqlWriter kdbWriter;
+    kdbWriter.appendIdentifier(identifier);
+    QCOMPARE(kdbWriter.toString(), KDbEscapedString(KDb::escapeIdentifier(identifier)));
+
+    KDbSqlWriter driverWriter(utils.driver);
+    QVERIFY(driverWriter.driver() == utils.driver.data());
+    driverWriter.appendIdentifier(identifier);
+    QCOMPARE(driverWriter.toString(), KDbEscapedString(utils.driver->escapeIdentifier(identifier)));
+}
+
+void SqlWriterTest::testValue_data()
+{
+    QTest::addColumn<KDbField::Type>("type");
+    QTest::addColumn<QVariant>("value");
+
+    QTest::newRow("null") << KDbField::Integer << QVariant();
+    QTest::newRow("null type") << KDbField::Null << QVariant(1);
+    QTest::newRow("zero") << KDbField::Integer << QVariant(0);
+    QTest::newRow("positive") << KDbField::Integer << QVariant(123456);
+    QTest::newRow("negative") << KDbField::Integer << QVariant(-42);
+    QTest::newRow("negative byte") << KDbField::Byte << QVariant(-128);
+    QTest::newRow("int min") << KDbField::Integer << QVariant(std::numeric_limits<int>::min());
+    QTest::newRow("uint max") << KDbField::Integer << QVariant(std::numeric_limits<uint>::max());
+    QTest::newRow("LLONG_MIN") << KDbField::BigInteger
+                               << QVariant(std::numeric_limits<qlonglong>::min());
+    QTest::newRow("LLONG_MAX") << KDbField::BigInteger
+                               << QVariant(std::numeric_limits<qlonglong>::max());
+    QTest::newRow("ULLONG_MAX") << KDbField::BigInteger
+                                << QVariant(std::numeric_limits<qulonglong>::max());
+    QTest::newRow("integer as string") << KDbField::Integer << QVariant(QLatin1String("-7"));
+    QTest::newRow("true") << KDbField::Boolean << QVariant(true);
+    QTest::newRow("false") << KDbField::Boolean << QVariant(false);
+    QTest::newRow("boolean as integer") << KDbField::Boolean << QVariant(2);
+    QTest::newRow("double") << KDbField::Double << QVariant(-1.5);
+    QTest::newRow("text") << KDbField::Text << QVariant(QLatin1String("it's"));
+    QTest::newRow("non-ASCII text") << KDbField::LongText << QVariant(QString::fromUtf8("Wałęsa"));
+    QTest::newRow("BLOB") << KDbField::BLOB << QVariant(QByteArray("\x01\xff", 2));
+}
+
+void SqlWriterTest::testValue()
+{
+    QFETCH(KDbField::Type, type);
+    QFETCH(QVariant, value);
+
+    KDbSqlWriter kdbWriter;
+    kdbWriter.appendValue(type, value);
+    QCOMPARE(kdbWriter.toString(), KDb::valueToSql(type, value));
+
+    KDbSqlWriter driverWriter(utils.driver);
+    driverWriter.appendValue(type, value);
+    QCOMPARE(driverWriter.toString(), utils.driver->valueToSql(type, value));
+
+    KDbField field(QLatin1String("f"), type);
+    driverWriter.clear();
+    driverWriter.appendValue(&field, value);
+    QCOMPARE(driverWriter.toString(), utils.driver->valueToSql(&field, value));
+}
+
+void SqlWriterTest::testAppend()
+{
+    KDbSqlWriter writer;
+    QVERIFY(writer.isEmpty());
+    writer << "SELECT " << QString::fromUtf8("'ą'") << ',' << KDbEscapedString("1");
+    writer.append(QLatin1String(" FROM ")).appendIdentifier(QLatin1String("t"));
+    QVERIFY(!writer.isEmpty());
+    QCOMPARE(writer.toString(), KDbEscapedString(QString::fromUtf8("SELECT 'ą',1 FROM t")));
+    QCOMPARE(writer.length(), writer.toString().length());
+
+    writer.appendNumber(std::numeric_limits<qint64>::min());
+    QVERIFY(writer.toString().endsWith("t-9223372036854775808"));
+
+    writer.append(KDbEscapedString::invalid());
+    QVERIFY(!writer.toString().isValid());
+}
+
+void SqlWriterTest::testClear()
+{
+    KDbSqlWriter writer(utils.driver, 16);
+    writer << "DELETE FROM ";
+    writer.appendIdentifier(QLatin1String("persons"));
+    const KDbEscapedString first(writer.toString());
+    writer.append(KDbEscapedString::invalid());
+
+    // the string returned previously is not modified by writing the next statement
+    writer.clear();
+    QVERIFY(writer.isEmpty());
+    writer << "DELETE FROM ";
+    writer.appendIdentifier(QLatin1String("cars"));
+    QVERIFY(writer.toString().isValid());
+    QCOMPARE(first, KDbEscapedString("DELETE FROM \"persons\""));
+    QCOMPARE(writer.toString(), KDbEscapedString("DELETE FROM \"cars\""));
+
+    writer.clear();
+    writer.clear();
+    QCOMPARE(writer.length(), 0);
+    QCOMPARE(first, KDbEscapedString("DELETE FROM \"persons\""));
+}
+
+void SqlWriterTest::cleanupTestCase()
+{
+}
@@ -341,6 +341,10 @@ void SqlParserTest::testTokens()
     QCOMPARE(KDbToken::NOT_SIMILAR_TO.value(), 318);
     QCOMPARE(KDbToken::XOR.value(), 319);
     QCOMPARE(KDbToken::UMINUS.value(), 320);
+    QCOMPARE(KDbToken::LIMIT.value(), 325);
+    QCOMPARE(KDbToken::OFFSET.value(), 326);
+    QCOMPARE(KDbToken::GROUP.value(), 327);
+    QCOMPARE(KDbToken::HAVING.value(), 328);
 
     //! @todo add extra tokens: BETWEEN_AND, NOT_BETWEEN_AND
 }
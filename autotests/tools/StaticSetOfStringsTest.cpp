@@ -44,6 +44,19 @@ const char* StaticSetOfStringsTest::keywords[] = {
     nullptr
 };
 
+// generated by tools/sql_keywords_hash.awk
+static const quint16 keywordsHashSeeds[] = {
+    1, 1, 6, 23, 5,
+};
+
+static const qint16 keywordsHashSlots[] = {
+    6, 5, -1, 4, 1, 7, 12, 0, -1, 9, 3, -1, 13, 16, 8, 11, -1, 10, 14, 15, 2, -1, 17,
+};
+
+const KDbUtils::StaticSetOfStrings::HashTable StaticSetOfStringsTest::keywordsHash = {
+    StaticSetOfStringsTest::keywords, keywordsHashSeeds, keywordsHashSlots, 5, 23
+};
+
 void StaticSetOfStringsTest::initTestCase()
 {
     strings.setStrings(keywords);
@@ -58,6 +71,22 @@ void StaticSetOfStringsTest::testContains()
     QVERIFY(!strings.isEmpty());
     QVERIFY(strings.contains("ABORT")); //test start of list
     QVERIFY(strings.contains("BINARY")); //test end of list
+    QVERIFY(strings.contains("Binary")); //test case insensitivity
+    QVERIFY(!strings.contains(QByteArray("ANY\0", 4))); //test string with trailing zero
+    QVERIFY(!strings.contains(QByteArray())); //test empty string
+}
+
+void StaticSetOfStringsTest::testContainsUsingHashTable()
+{
+    const KDbUtils::StaticSetOfStrings hashedStrings(keywordsHash);
+    QVERIFY(!hashedStrings.isEmpty());
+    for (const char * const *p = keywords; *p; ++p) {
+        QVERIFY2(hashedStrings.contains(*p), *p);
+        QVERIFY2(hashedStrings.contains(QByteArray(*p).toLower()), *p);
+    }
+    QVERIFY(!hashedStrings.contains("BIGIN"));
+    QVERIFY(!hashedStrings.contains("XXXXXXXXXX"));
+    QVERIFY(!KDbUtils::StaticSetOfStrings().contains("ANY"));
 }
 
 void StaticSetOfStringsTest::cleanupTestCase()
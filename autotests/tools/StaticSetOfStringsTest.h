@@ -29,10 +29,12 @@ class StaticSetOfStringsTest : public QObject
 private Q_SLOTS:
     void initTestCase();
     void testContains();
+    void testContainsUsingHashTable();
     void cleanupTestCase();
 
 private:
     static const char *keywords[];
+    static const KDbUtils::StaticSetOfStrings::HashTable keywordsHash;
     KDbUtils::StaticSetOfStrings strings;
 };
 
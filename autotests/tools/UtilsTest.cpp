@@ -46,6 +46,11 @@ private Q_SLOTS:
     void testDateTimeToISODateStringAndFromStringWithMs_data();
     void testDateTimeToISODateStringAndFromStringWithMs();
 
+    //! QDate dateFromISODateString(const char *data, int length);
+    //! QDateTime dateTimeFromISODateStringWithMs(const char *data, int length);
+    void testDateTimeFromISODateCString_data();
+    void testDateTimeFromISODateCString();
+
 //    KDB_EXPORT QDateTime stringToHackedQTime(const QString& s);
 //    KDB_EXPORT void serializeMap(const QMap<QString, QString>& map, QByteArray *array);
 //    KDB_EXPORT void serializeMap(const QMap<QString, QString>& map, QString *string);
@@ -131,6 +136,8 @@ void UtilsTest::testTimeToISODateStringAndFromStringWithMs()
     qDebug() << string << time;
     QCOMPARE(KDbUtils::toISODateStringWithMs(time), string);
     QCOMPARE(KDbUtils::timeFromISODateStringWithMs(string), time);
+    const QByteArray data(string.toLatin1());
+    QCOMPARE(KDbUtils::timeFromISODateStringWithMs(data.constData(), data.length()), time);
 }
 
 void UtilsTest::testDateTimeToISODateStringAndFromStringWithMs_data()
@@ -154,6 +161,51 @@ void UtilsTest::testDateTimeToISODateStringAndFromStringWithMs()
     qDebug() << string << dateTime << KDbUtils::dateTimeFromISODateStringWithMs(string);
     QCOMPARE(KDbUtils::toISODateStringWithMs(dateTime), string);
     QCOMPARE(KDbUtils::dateTimeFromISODateStringWithMs(string), dateTime);
+    const QByteArray data(string.toLatin1());
+    QCOMPARE(KDbUtils::dateTimeFromISODateStringWithMs(data.constData(), data.length()), dateTime);
+}
+
+void UtilsTest::testDateTimeFromISODateCString_data()
+{
+    QTest::addColumn<QByteArray>("data");
+    QTest::addColumn<QDateTime>("dateTime");
+
+    QTest::newRow("null") << QByteArray() << QDateTime();
+    QTest::newRow("empty") << QByteArray("") << QDateTime();
+    QTest::newRow("date") << QByteArray("1999-12-04") << QDateTime(QDate(1999, 12, 4), QTime(0, 0));
+    QTest::newRow("invalid date") << QByteArray("1999-13-04") << QDateTime();
+    QTest::newRow("short date") << QByteArray("1999-12-4") << QDateTime();
+    QTest::newRow("space") << QByteArray("1999-12-04 21:12:13") << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13));
+    QTest::newRow("no seconds") << QByteArray("1999-12-04T21:12") << QDateTime(QDate(1999, 12, 4), QTime(21, 12));
+    QTest::newRow("us") << QByteArray("1999-12-04 21:12:13.123456") << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13, 123));
+    QTest::newRow("round ms") << QByteArray("1999-12-04 21:12:13.9996") << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13, 999));
+    QTest::newRow("short ms") << QByteArray("1999-12-04 21:12:13.08") << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13, 80));
+    QTest::newRow("no ms") << QByteArray("1999-12-04 21:12:13.") << QDateTime();
+    QTest::newRow("utc") << QByteArray("1999-12-04T21:12:13Z") << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13), Qt::UTC);
+    QTest::newRow("offset") << QByteArray("1999-12-04T21:12:13+02:30")
+        << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13), Qt::OffsetFromUTC, 2 * 3600 + 30 * 60);
+    QTest::newRow("negative offset") << QByteArray("1999-12-04T21:12:13-02")
+        << QDateTime(QDate(1999, 12, 4), QTime(21, 12, 13), Qt::OffsetFromUTC, -2 * 3600);
+    QTest::newRow("garbage") << QByteArray("1999-12-04T21:12:13x") << QDateTime();
+    QTest::newRow("invalid time") << QByteArray("1999-12-04T25:12:13") << QDateTime();
+}
+
+void UtilsTest::testDateTimeFromISODateCString()
+{
+    QFETCH(QByteArray, data);
+    QFETCH(QDateTime, dateTime);
+
+    const char *rawData = data.isNull() ? nullptr : data.constData();
+    QCOMPARE(KDbUtils::dateTimeFromISODateStringWithMs(rawData, data.length()), dateTime);
+    QCOMPARE(KDbUtils::dateTimeFromISODateStringWithMs(rawData), dateTime); // null-terminated
+    if (rawData) {
+        // not null-terminated
+        const QByteArray padded(data + "9");
+        QCOMPARE(KDbUtils::dateTimeFromISODateStringWithMs(padded.constData(), data.length()), dateTime);
+    }
+    if (data.length() == 10) {
+        QCOMPARE(KDbUtils::dateFromISODateString(rawData, data.length()), dateTime.date());
+    }
 }
 
 void UtilsTest::cleanupTestCase()
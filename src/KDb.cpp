@@ -54,6 +54,7 @@
 #include <QProcess>
 #include <QtDebug>
 
+#include <cctype>
 #include <limits>
 #include <memory>
 
@@ -1969,16 +1970,60 @@ QString KDb::defaultFileBasedDriverId()
     return QLatin1String("org.kde.kdb.sqlite");
 }
 
-// Try to convert from string to type T
-template <typename T>
-QVariant convert(T (QString::*ConvertToT)(bool*,int) const, const char *data, int size,
-                 qlonglong minValue, qlonglong maxValue, bool *ok)
+//! Decodes decimal integer like QString::toLongLong(ok, 10) but without allocations
+static bool cstringToLongLong(const char *data, int length, qlonglong *value)
 {
-    T v = (QString::fromLatin1(data, size).*ConvertToT)(ok, 10);
-    if (*ok) {
-        *ok = minValue <= v && v <= maxValue;
+    int pos = 0;
+    while (pos < length && isspace(uchar(data[pos]))) {
+        ++pos;
+    }
+    while (length > pos && isspace(uchar(data[length - 1]))) {
+        --length;
+    }
+    bool negative = false;
+    if (pos < length && (data[pos] == '-' || data[pos] == '+')) {
+        negative = data[pos] == '-';
+        ++pos;
+    }
+    if (pos == length) {
+        return false;
+    }
+    const qulonglong limit = negative ? qulonglong(std::numeric_limits<qlonglong>::max()) + 1
+                                      : qulonglong(std::numeric_limits<qlonglong>::max());
+    qulonglong result = 0;
+    for (; pos < length; ++pos) {
+        const char c = data[pos];
+        if (c < '0' || c > '9') {
+            return false;
+        }
+        const uint digit = c - '0';
+        if (result > (limit - digit) / 10) {
+            return false;
+        }
+        result = result * 10 + digit;
+    }
+    *value = negative ? qlonglong(0 - result) : qlonglong(result);
+    return true;
+}
+
+// Try to convert from string to integer within limits
+static QVariant convertToInteger(const char *data, int size, KDbField::Type type,
+                                 qlonglong minValue, qlonglong maxValue, bool isUnsigned, bool *ok)
+{
+    qlonglong v = 0;
+    *ok = cstringToLongLong(data, size, &v) && minValue <= v && v <= maxValue;
+    if (!*ok) {
+        return QVariant();
+    }
+    switch (type) {
+    case KDbField::Byte:
+    case KDbField::ShortInteger:
+        return QVariant(int(v));
+    case KDbField::Integer:
+        return isUnsigned ? QVariant(uint(v)) : QVariant(int(v));
+    default:
+        return QVariant(v);
     }
-    return KDb::iif(*ok, QVariant(v));
 }
 
 QVariant KDb::cstringToVariant(const char* data, KDbField::Type type, bool *ok, int length,
@@ -2001,36 +2046,40 @@ QVariant KDb::cstringToVariant(const char* data, KDbField::Type type, bool *ok,
         //! @todo use KDbDriverBehavior::TEXT_TYPE_MAX_LENGTH for Text type?
         return QString::fromUtf8(data, length);
     }
+    if (length < 0 && type != KDbField::BLOB) {
+        length = int(qstrlen(data));
+    }
     if (KDbField::isIntegerType(type)) {
         qlonglong minValue, maxValue;
-        const bool isUnsigned = signedness == KDb::Unsigned;
         KDb::getLimitsForFieldType(type, &minValue, &maxValue, signedness);
-        switch (type) {
-        case KDbField::Byte: // Byte here too, minValue/maxValue will take care of limits
-        case KDbField::ShortInteger:
-            return isUnsigned ?
-                convert(&QString::toUShort, data, length, minValue, maxValue, thisOk)
-                : convert(&QString::toShort, data, length, minValue, maxValue, thisOk);
-        case KDbField::Integer:
-            return isUnsigned ?
-                convert(&QString::toUInt, data, length, minValue, maxValue, thisOk)
-                : convert(&QString::toInt, data, length, minValue, maxValue, thisOk);
-        case KDbField::BigInteger:
-            return convert(&QString::toLongLong, data, length, minValue, maxValue, thisOk);
-        default:
-            qFatal("Unsupported integer type %d", type);
-        }
+        return convertToInteger(data, length, type, minValue, maxValue,
+                                signedness == KDb::Unsigned, thisOk);
     }
     if (KDbField::isFPNumericType(type)) {
-        const QVariant result(QString::fromLatin1(data, length).toDouble(thisOk));
+        // C locale, no conversion to QString
+        const QVariant result(QByteArray::fromRawData(data, length).toDouble(thisOk));
         return KDb::iif(*thisOk, result);
     }
+    if (type == KDbField::Date) {
+        const QDate result(KDbUtils::dateFromISODateString(data, length));
+        *thisOk = result.isValid();
+        return KDb::iif(*thisOk, QVariant(result));
+    }
+    if (type == KDbField::DateTime) {
+        const QDateTime result(KDbUtils::dateTimeFromISODateStringWithMs(data, length));
+        *thisOk = result.isValid();
+        return KDb::iif(*thisOk, QVariant(result));
+    }
+    if (type == KDbField::Time) {
+        const QTime result(KDbUtils::timeFromISODateStringWithMs(data, length));
+        *thisOk = result.isValid();
+        return KDb::iif(*thisOk, QVariant(result));
+    }
     if (type == KDbField::BLOB) {
         *thisOk = length >= 0;
         return *thisOk ? QVariant(QByteArray(data, length)) : QVariant();
     }
     // the default
-//! @todo date/time?
     QVariant result(QString::fromUtf8(data, length));
     if (!result.convert(KDbField::variantType(type))) {
         *thisOk = false;
@@ -420,6 +420,7 @@ KDB_EXPORT QVariant emptyValueForFieldType(KDbField::Type type);
 KDB_EXPORT QVariant notEmptyValueForFieldType(KDbField::Type type);
 
 /*! @return true if the @a word is an reserved KDBSQL keyword
+ Comparison is case insensitive. The function is thread-safe.
  See generated/sqlkeywords.cpp.
  @todo add function returning list of keywords. */
 KDB_EXPORT bool isKDbSqlKeyword(const QByteArray& word);
@@ -643,9 +644,10 @@ KDB_EXPORT KDbField::Type maximumForIntegerFieldTypes(KDbField::Type t1, KDbFiel
  limited to unsigned or not.
  If @a ok is not 0 *ok is set to false on failure and to true on success. On failure a null
  QVariant is returned. The function fails if @a data is 0.
- For rules of conversion to the boolean type see the documentation of @ref QVariant::toBool(),
- QVariant::toDate() for date type, QVariant::toDateTime() for date+time type,
- QVariant::toTime() for time type. */
+ For rules of conversion to the boolean type see the documentation of @ref QVariant::toBool().
+ Numbers, dates and times are decoded directly from @a data without conversion to QString;
+ see KDbUtils::dateFromISODateString(), KDbUtils::timeFromISODateStringWithMs() and
+ KDbUtils::dateTimeFromISODateStringWithMs() for accepted date and time formats. */
 KDB_EXPORT QVariant cstringToVariant(const char* data, KDbField::Type type, bool *ok, int length = -1,
                                      KDb::Signedness signedness = KDb::Signed);
 
@@ -19,8 +19,12 @@
 
 #include "KDbAlter.h"
 #include "KDb.h"
+#include "KDbAlterTableInterface.h"
 #include "KDbConnection.h"
+#include "KDbConnection_p.h"
 #include "KDbConnectionOptions.h"
+#include "KDbSqlWriter.h"
+#include "KDbTransactionGuard.h"
 #include "kdb_debug.h"
 
 #include <QMap>
@@ -729,8 +733,9 @@ KDbAlterTableHandler::MoveFieldPositionAction::~MoveFieldPositionAction()
 
 void KDbAlterTableHandler::MoveFieldPositionAction::updateAlteringRequirements()
 {
-    setAlteringRequirements(MainSchemaAlteringRequired);
-    //! @todo
+    // physical order of columns has to follow the order of fields,
+    // e.g. for INSERT INTO ... SELECT * FROM ... used in KDbConnection::copyTable()
+    setAlteringRequirements(PhysicalAlteringRequired | MainSchemaAlteringRequired);
 }
 
 QString KDbAlterTableHandler::MoveFieldPositionAction::debugString(const DebugOptions& debugOptions)
@@ -743,10 +748,41 @@ QString KDbAlterTableHandler::MoveFieldPositionAction::debugString(const DebugOp
     return s;
 }
 
+/*!
+ Legend: A,B==fields, [....]==action.
+ Case 1. when new action=[move A] and exists=[remove A]
+    => do not add [move A] because the field will be removed anyway
+ Otherwise all moves are kept because each of them depends on positions of other fields
+ at the time it is performed.
+*/
 void KDbAlterTableHandler::MoveFieldPositionAction::simplifyActions(ActionDictDict *fieldActions)
 {
-    Q_UNUSED(fieldActions);
-    //! @todo
+    ActionDict *actionsLikeThis = fieldActions->value(uid());
+    if (actionsLikeThis && actionsLikeThis->value(":remove:")) {
+        return;
+    }
+    if (!actionsLikeThis)
+        actionsLikeThis = createActionDict(fieldActions, uid());
+    int number = 0;
+    while (actionsLikeThis->contains(":move:" + QByteArray::number(number))) {
+        ++number;
+    }
+    actionsLikeThis->insert(":move:" + QByteArray::number(number),
+                            new KDbAlterTableHandler::MoveFieldPositionAction(*this));
+}
+
+tristate KDbAlterTableHandler::MoveFieldPositionAction::updateTableSchema(KDbTableSchema* table, KDbField* field,
+        QHash<QString, QString>* fieldHash)
+{
+    Q_UNUSED(fieldHash);
+    if (!table->moveField(field, m_index)) {
+        return false;
+    }
+    //update order of all fields
+    for (int i = 0; i < table->fieldCount(); i++) {
+        table->field(i)->setOrder(i);
+    }
+    return true;
 }
 
 tristate KDbAlterTableHandler::MoveFieldPositionAction::execute(KDbConnection* conn, KDbTableSchema* table)
@@ -810,6 +846,117 @@ void KDbAlterTableHandler::debug()
     }
 }
 
+KDbAlterTableInterface::~KDbAlterTableInterface()
+{
+}
+
+//! @return true if @a field of @a table is a member of an index created by a separate
+//! CREATE INDEX statement; such indices are not altered together with the field and their
+//! names are generated from field names, see KDbConnection::createIndices()
+static bool isFieldInSeparateIndex(const KDbTableSchema &table, const KDbField &field)
+{
+    if (field.isIndexed() && !field.isPrimaryKey() && !field.isUniqueKey()) {
+        return true;
+    }
+    for (const KDbIndexSchema *index : *table.indices()) {
+        if (!index->isAutoGenerated() && !index->isPrimaryKey()
+            && index->fields()->contains(const_cast<KDbField*>(&field)))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+tristate KDbAlterTableHandler::updateTableSchema(KDbTableSchema *table, const ActionsVector &actions,
+                                                 int count, QHash<QString, QString> *fieldHash,
+                                                 QList<KDbEscapedString> *statements)
+{
+    KDbAlterTableInterface *alterInterface = nullptr;
+    if (statements) {
+        alterInterface = dynamic_cast<KDbAlterTableInterface*>(d->conn);
+        if (!alterInterface) {
+            return cancelled; // the driver can only recreate tables
+        }
+    }
+    int lastUID = -1;
+    KDbField *currentField = nullptr;
+    for (int i = 0; i < count; i++) {
+        ActionBase *action = actions.at(i);
+        if (!action)
+            continue;
+        //remember the current KDbField object because soon we may be unable to find it by name:
+        FieldActionBase *fieldAction = dynamic_cast<FieldActionBase*>(action);
+        if (!fieldAction) {
+            currentField = nullptr;
+        } else {
+            if (lastUID != fieldAction->uid()) {
+                currentField = table->field(fieldAction->fieldName());
+                lastUID = currentField ? fieldAction->uid() : -1;
+            }
+            InsertFieldAction *insertFieldAction = dynamic_cast<InsertFieldAction*>(action);
+            if (insertFieldAction && insertFieldAction->index() > table->fieldCount()) {
+                //update index: there can be empty rows
+                insertFieldAction->setIndex(table->fieldCount());
+            }
+        }
+        if (statements && (action->alteringRequirements() & PhysicalAlteringRequired)) {
+            // ask the driver for statements performing the action on the current table
+            tristate res = cancelled;
+            if (ChangeFieldPropertyAction *changeAction = dynamic_cast<ChangeFieldPropertyAction*>(action)) {
+                const QString propertyName(changeAction->propertyName());
+                if (currentField && propertyName == QLatin1String("name")) {
+                    if (!isFieldInSeparateIndex(*table, *currentField)) {
+                        res = alterInterface->drv_renameFieldStatements(
+                            table, currentField, changeAction->newValue().toString(), statements);
+                    }
+                } else if (currentField && propertyName == QLatin1String("allowEmpty")) {
+                    res = true; // only stored in KDb schema
+                } else if (currentField) {
+                    res = alterInterface->drv_changeFieldPropertyStatements(
+                        table, currentField, propertyName, changeAction->newValue(), statements);
+                }
+            } else if (dynamic_cast<RemoveFieldAction*>(action)) {
+                if (currentField && table->fieldCount() > 1 && !currentField->isPrimaryKey()
+                    && !currentField->isUniqueKey() && !currentField->isForeignKey()
+                    && !isFieldInSeparateIndex(*table, *currentField))
+                {
+                    res = alterInterface->drv_removeFieldStatements(table, currentField, statements);
+                }
+            } else if (InsertFieldAction *insertAction = dynamic_cast<InsertFieldAction*>(action)) {
+                const KDbField *newField = insertAction->field();
+                // new keys and indices and new NOT NULL fields without default values
+                // that have to be filled with values are created by recreating the table
+                if (!newField->isPrimaryKey() && !newField->isUniqueKey()
+                    && !newField->isAutoIncrement() && !newField->isIndexed()
+                    && !newField->isForeignKey()
+                    && !((newField->isNotNull() || newField->isNotEmpty())
+                         && newField->defaultValue().isNull()))
+                {
+                    res = alterInterface->drv_insertFieldStatements(
+                        table, newField, insertAction->index(), statements);
+                }
+            } else if (MoveFieldPositionAction *moveAction = dynamic_cast<MoveFieldPositionAction*>(action)) {
+                if (currentField) {
+                    res = alterInterface->drv_moveFieldStatements(
+                        table, currentField, moveAction->index(), statements);
+                }
+            }
+            if (res != true) {
+                if (res == false) {
+                    m_result = d->conn->result();
+                }
+                return res;
+            }
+        }
+        const tristate res = action->updateTableSchema(table, currentField, fieldHash);
+        if (res != true) {
+            return res;
+        }
+    }
+    return true;
+}
+
 KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, ExecutionArguments* args)
 {
     args->result = false;
@@ -874,7 +1021,6 @@ KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, Executio
 
     // Fields-related actions.
     ActionDictDict fieldActions;
-    ActionBase* action;
     for (int i = d->actions.count() - 1; i >= 0; i--) {
         d->actions[i]->simplifyActions(&fieldActions);
     }
@@ -915,8 +1061,6 @@ KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, Executio
         return nullptr;
     }
 
-    const bool recreateTable = (args->requirements & PhysicalAlteringRequired);
-
 #ifdef KDB_DEBUG_GUI
     if (args->simulate)
         KDb::alterTableActionDebugGUI(dbg, 0);
@@ -933,14 +1077,78 @@ KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, Executio
                     QString::fromLatin1("%1: ").arg(i + 1), args->debugString);
     }
 
+    args->method = AlteringMethod::None;
+    args->statements.clear();
     if (args->requirements == 0) {//nothing to do
         args->result = true;
         return oldTable;
     }
+
+    // Physical altering: try to alter the table in place using native statements,
+    // recreate the table only if the driver cannot perform some of the actions this way
+    bool recreateTable = false;
+    KDbTableSchema *alteredTable = nullptr;
+    if (args->requirements & PhysicalAlteringRequired) {
+        alteredTable = new KDbTableSchema(*oldTable, true/*copy id*/);
+        QHash<QString, QString> fieldHash;
+        foreach(KDbField* f, *alteredTable->fields()) {
+            fieldHash.insert(f->name(), f->name());
+        }
+        const tristate inPlace = updateTableSchema(alteredTable, actionsVector, allActionsCount,
+                                                   &fieldHash, &args->statements);
+        if (inPlace != true) {
+            delete alteredTable;
+            alteredTable = nullptr;
+            args->statements.clear();
+            if (inPlace == false) {
+                args->result = false;
+                return nullptr;
+            }
+            recreateTable = true;
+        }
+        args->method = recreateTable ? AlteringMethod::Recreate : AlteringMethod::InPlace;
+        dbg = recreateTable ? QString::fromLatin1("** Altering method: recreating the table")
+                            : QString::fromLatin1("** Altering method: in place (%1 statements)")
+                                  .arg(args->statements.count());
+        kdbDebug() << dbg;
+        for (const KDbEscapedString &sql : qAsConst(args->statements)) {
+            kdbDebug() << " ** " << sql;
+        }
+#ifdef KDB_DEBUG_GUI
+        if (args->simulate)
+            KDb::alterTableActionDebugGUI(dbg, 0);
+#endif
+    }
+
     if (args->simulate) {//do not execute
+        delete alteredTable;
         args->result = true;
         return oldTable;
     }
+
+    if (alteredTable) {
+        KDbTransactionGuard tg;
+        bool ok = d->conn->beginAutoCommitTransaction(&tg);
+        for (int i = 0; ok && i < args->statements.count(); ++i) {
+            ok = d->conn->executeSql(args->statements.at(i));
+        }
+        ok = ok && d->conn->storeMainFieldsSchema(alteredTable)
+                && d->conn->storeExtendedTableSchemaData(alteredTable)
+                && d->conn->commitAutoCommitTransaction(tg.transaction());
+        if (!ok) {
+            m_result = d->conn->result();
+            d->conn->rollbackAutoCommitTransaction(tg.transaction());
+            delete alteredTable;
+            args->result = false;
+            return nullptr;
+        }
+        // Replace the old table schema with the altered one (oldTable will be destroyed)
+        d->conn->d->removeTable(oldTable->id());
+        d->conn->d->insertTable(alteredTable);
+        alteredTable->setConnection(d->conn);
+        args->result = true;
+        return alteredTable;
+    }
 //! @todo transaction!
 
     // Create a new KDbTableSchema
@@ -956,44 +1164,20 @@ KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, Executio
     }
 
     // Update table schema in memory ----
-    int lastUID = -1;
-    KDbField *currentField = nullptr;
     QHash<QString, QString> fieldHash; // a map from new value to old value
     foreach(KDbField* f, *newTable->fields()) {
         fieldHash.insert(f->name(), f->name());
     }
-    for (int i = 0; i < allActionsCount; i++) {
-        action = actionsVector.at(i);
-        if (!action)
-            continue;
-        //remember the current KDbField object because soon we may be unable to find it by name:
-        FieldActionBase *fieldAction = dynamic_cast<FieldActionBase*>(action);
-        if (!fieldAction) {
-            currentField = nullptr;
-        } else {
-            if (lastUID != fieldAction->uid()) {
-                currentField = newTable->field(fieldAction->fieldName());
-                lastUID = currentField ? fieldAction->uid() : -1;
-            }
-            InsertFieldAction *insertFieldAction = dynamic_cast<InsertFieldAction*>(action);
-            if (insertFieldAction && insertFieldAction->index() > newTable->fieldCount()) {
-                //update index: there can be empty rows
-                insertFieldAction->setIndex(newTable->fieldCount());
-            }
-        }
-        args->result = action->updateTableSchema(newTable, currentField, &fieldHash);
-        if (args->result != true) {
-            if (recreateTable)
-                delete newTable;
-            return nullptr;
-        }
+    args->result = updateTableSchema(newTable, actionsVector, allActionsCount, &fieldHash, nullptr);
+    if (args->result != true) {
+        if (recreateTable)
+            delete newTable;
+        return nullptr;
     }
-
     if (recreateTable) {
-        // Create the destination table with temporary name
-        if (!d->conn->createTable(newTable,
-          KDbConnection::CreateTableOptions(KDbConnection::CreateTableOption::Default)
-              & ~KDbConnection::CreateTableOptions(KDbConnection::CreateTableOption::DropDestination)))
+        // Create the destination table with temporary name; indices are created after renaming
+        // because index names are based on table name and have to be unique
+        if (!d->conn->createTable(newTable, KDbConnection::CreateTableOption::SkipIndices))
         {
             m_result = d->conn->result();
             delete newTable;
@@ -1035,47 +1219,52 @@ KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, Executio
         // -Some source fields can be skipped in case when there are deleted fields.
         // -Some destination fields can be skipped in case when there
         //  are new empty fields without fixed/default value.
-        KDbEscapedString sql = KDbEscapedString("INSERT INTO %1 (").arg(d->conn->escapeIdentifier(newTable->name()));
+        KDbSqlWriter writer(d->conn->driver(), 1024);
+        writer << "INSERT INTO ";
+        writer.appendIdentifier(newTable->name()) << " (";
         //insert list of dest. fields
         bool first = true;
-        KDbEscapedString sourceFields;
+        KDbSqlWriter sourceFields(d->conn->driver(), 1024);
         foreach(KDbField* f, *newTable->fields()) {
-            QString renamedFieldName(fieldHash.value(f->name()));
-            KDbEscapedString sourceSqlString;
+            const QString renamedFieldName(fieldHash.value(f->name()));
             const KDbField::Type type = f->type(); // cache: evaluating type of expressions can be expensive
+            QVariant sourceValue;
             if (!renamedFieldName.isEmpty()) {
                 //this field should be renamed
-                sourceSqlString = KDbEscapedString(d->conn->escapeIdentifier(renamedFieldName));
             } else if (!f->defaultValue().isNull()) {
                 //this field has a default value defined
 //! @todo support expressions (eg. TODAY()) as a default value
 //! @todo this field can be notNull or notEmpty - check whether the default is ok
 //!       (or do this checking also in the Table Designer?)
-                sourceSqlString = d->conn->driver()->valueToSql(type, f->defaultValue());
+                sourceValue = f->defaultValue();
             } else if (f->isNotNull()) {
                 //this field cannot be null
-                sourceSqlString = d->conn->driver()->valueToSql(
-                                      type, KDb::emptyValueForFieldType(type));
+                sourceValue = KDb::emptyValueForFieldType(type);
             } else if (f->isNotEmpty()) {
                 //this field cannot be empty - use any nonempty value..., e.g. " " for text or 0 for number
-                sourceSqlString = d->conn->driver()->valueToSql(
-                                      type, KDb::notEmptyValueForFieldType(type));
+                sourceValue = KDb::notEmptyValueForFieldType(type);
+            } else {
+                continue;
             }
 //! @todo support unique, validatationRule, unsigned flags...
 //! @todo check for foreignKey values...
 
-            if (!sourceSqlString.isEmpty()) {
-                if (first) {
-                    first = false;
-                } else {
-                    sql.append(", ");
-                    sourceFields.append(", ");
-                }
-                sql += d->conn->escapeIdentifier(f->name());
-                sourceFields.append(sourceSqlString);
+            if (first) {
+                first = false;
+            } else {
+                writer << ", ";
+                sourceFields << ", ";
+            }
+            writer.appendIdentifier(f->name());
+            if (renamedFieldName.isEmpty()) {
+                sourceFields.appendValue(type, sourceValue);
+            } else {
+                sourceFields.appendIdentifier(renamedFieldName);
             }
         }
-        sql += (") SELECT " + sourceFields + " FROM " + oldTable->name());
+        writer << ") SELECT " << sourceFields.toString() << " FROM ";
+        writer.appendIdentifier(oldTable->name());
+        const KDbEscapedString sql(writer.toString());
         kdbDebug() << " ** " << sql;
         if (!d->conn->executeSql(sql)) {
             m_result = d->conn->result();
@@ -1103,6 +1292,11 @@ KDbTableSchema* KDbAlterTableHandler::execute(const QString& tableName, Executio
             return nullptr;
         }
         oldTable = nullptr;
+        if (!d->conn->createIndices(newTable)) {
+            m_result = d->conn->result();
+            args->result = false;
+            return nullptr;
+        }
     }
 
     if (!recreateTable) {
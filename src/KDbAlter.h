@@ -21,6 +21,7 @@
 #define KDB_ALTER_H
 
 #include "KDbUtils.h"
+#include "KDbEscapedString.h"
 #include "KDbResult.h"
 #include "KDbTristate.h"
 #include "KDbTableSchema.h"
@@ -138,6 +139,14 @@ public:
         SchemaAlteringRequired = ExtendedSchemaAlteringRequired | MainSchemaAlteringRequired
     };
 
+    //! Defines methods of applying physical changes to the table.
+    //! @since 3.3
+    enum class AlteringMethod {
+        None,     //!< No physical changes are needed
+        InPlace,  //!< The table is altered in place using native statements, e.g. ALTER TABLE
+        Recreate  //!< The table is recreated with the new schema and its records are copied
+    };
+
     class ActionBase;
     //! For collecting actions related to a single field
     typedef KDbUtils::AutodeletedHash<QByteArray, ActionBase*> ActionDict;
@@ -403,7 +412,12 @@ public:
     };
 
     /*! Defines an action for moving a single table field to a different
-     position within table schema. */
+     position within table schema.
+
+     Physical order of columns follows order of fields, so since KDb 3.3 moving a field
+     requires physical altering of the table. Drivers that cannot reorder columns in place,
+     e.g. SQLite and PostgreSQL, recreate the table and copy its records; MySQL moves
+     the column in place. */
     class KDB_EXPORT MoveFieldPositionAction : public FieldActionBase
     {
     public:
@@ -418,6 +432,9 @@ public:
 
         void simplifyActions(ActionDictDict *fieldActions) override;
 
+        tristate updateTableSchema(KDbTableSchema *table, KDbField *field,
+                                   QHash<QString, QString> *fieldHash) override;
+
     protected:
         //! @internal, used for constructing null action
         explicit MoveFieldPositionAction(bool null);
@@ -463,7 +480,8 @@ public:
                 , requirements(0)
                 , result(false)
                 , simulate(false)
-                , onlyComputeRequirements(false) {
+                , onlyComputeRequirements(false)
+                , method(AlteringMethod::None) {
         }
         /*! If not 0, debug is directed here. Used only in the alter table test suite. */
         QString* debugString;
@@ -476,6 +494,12 @@ public:
         /*! Set to true if requirements should be computed
          and the execute() method should return afterwards. */
         bool onlyComputeRequirements;
+        /*! Set to the method of applying physical changes, also when execution is simulated.
+         @since 3.3 */
+        AlteringMethod method;
+        /*! Native statements altering the table in place if method is AlteringMethod::InPlace.
+         @since 3.3 */
+        QList<KDbEscapedString> statements;
     private:
         Q_DISABLE_COPY(ExecutionArguments)
     };
@@ -488,6 +512,11 @@ public:
      like for regular execution but no changes are performed physically.
      This mode is used only for debugging purposes.
 
+     If physical altering is required, the driver is asked to translate the actions into native
+     statements altering the table in place (see args.method and args.statements). Only if some
+     of the actions cannot be performed this way, the table is recreated and its records
+     are copied.
+
     @todo For some cases, table schema can completely change, so it will be needed
      to refresh all objects depending on it.
      Implement this!
@@ -517,6 +546,13 @@ public:
     static int alteringTypeForProperty(const QByteArray& propertyName);
 
 private:
+    /*! @internal Applies the first @a count of @a actions to @a table in memory.
+     If @a statements is not @c nullptr, native statements altering the table in place are
+     appended to it; cancelled is returned if any action cannot be performed in place. */
+    tristate updateTableSchema(KDbTableSchema *table, const ActionsVector &actions, int count,
+                               QHash<QString, QString> *fieldHash,
+                               QList<KDbEscapedString> *statements);
+
     Q_DISABLE_COPY(KDbAlterTableHandler)
     class Private;
     Private * const d;
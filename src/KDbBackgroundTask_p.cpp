@@ -0,0 +1,93 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this library; see the file COPYING.LIB.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbBackgroundTask_p.h"
+
+#include <QCoreApplication>
+
+KDbBackgroundEvent::KDbBackgroundEvent(Kind kind, qint64 value)
+    : QEvent(eventType()), m_kind(kind), m_value(value)
+{
+}
+
+KDbBackgroundEvent::~KDbBackgroundEvent()
+{
+}
+
+QEvent::Type KDbBackgroundEvent::eventType()
+{
+    static const QEvent::Type type = QEvent::Type(QEvent::registerEventType());
+    return type;
+}
+
+const KDbBackgroundEvent* KDbBackgroundEvent::cast(const QEvent *event)
+{
+    return event->type() == eventType() ? static_cast<const KDbBackgroundEvent*>(event)
+                                        : nullptr;
+}
+
+//---------------------------------
+
+KDbBackgroundTaskShared::KDbBackgroundTaskShared()
+{
+}
+
+KDbBackgroundTaskShared::~KDbBackgroundTaskShared()
+{
+}
+
+bool KDbBackgroundTaskShared::isCancelRequested()
+{
+    QMutexLocker locker(&mutex);
+    return cancelRequested;
+}
+
+void KDbBackgroundTaskShared::post(KDbBackgroundEvent::Kind kind, qint64 value)
+{
+    // events posted to an object are discarded when it is deleted
+    QCoreApplication::postEvent(owner, new KDbBackgroundEvent(kind, value));
+}
+
+void KDbBackgroundTaskShared::setFailure(const KDbResult &failure)
+{
+    if (!cancelRequested && !result.isError()) {
+        result = failure;
+    }
+    cancelRequested = true;
+}
+
+void KDbBackgroundTaskShared::threadDone()
+{
+    if (--running == 0) {
+        post(KDbBackgroundEvent::Kind::Finished);
+    }
+    threadFinished.wakeAll();
+}
+
+bool KDbBackgroundTaskShared::waitForFinished(int timeout)
+{
+    QMutexLocker locker(&mutex);
+    return kdbWaitUntil(&threadFinished, &mutex, timeout, [this]() { return running == 0; });
+}
+
+KDbResult KDbBackgroundTaskShared::failure()
+{
+    QMutexLocker locker(&mutex);
+    return result;
+}
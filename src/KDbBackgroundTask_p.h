@@ -0,0 +1,122 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This library is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This library is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this library; see the file COPYING.LIB.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_BACKGROUNDTASK_P_H
+#define KDB_BACKGROUNDTASK_P_H
+
+#include "KDbResult.h"
+
+#include <QElapsedTimer>
+#include <QEvent>
+#include <QMutex>
+#include <QWaitCondition>
+
+/*! @internal Event used to emit signals of objects controlling background threads,
+ such as KDbConnectionWorker, KDbParallelScan and KDbTableCopy, in the objects' thread. */
+class KDbBackgroundEvent : public QEvent
+{
+public:
+    enum class Kind {
+        Progress, //!< new records are available or have been processed
+        Finished
+    };
+
+    explicit KDbBackgroundEvent(Kind kind, qint64 value = 0);
+
+    ~KDbBackgroundEvent() override;
+
+    inline Kind kind() const { return m_kind; }
+
+    //! @return value specific to the receiver, e.g. number of copied records
+    inline qint64 value() const { return m_value; }
+
+    static QEvent::Type eventType();
+
+    //! @return @a event casted to KDbBackgroundEvent or @c nullptr if it has other type
+    static const KDbBackgroundEvent* cast(const QEvent *event);
+
+private:
+    const Kind m_kind;
+    const qint64 m_value;
+};
+
+/*! @internal Waits on @a condition until @a isDone returns @c true or @a timeout milliseconds
+ pass. Negative @a timeout means no timeout. Has to be called with @a mutex locked.
+ @return @c true if @a isDone returned @c true. */
+template <typename Predicate>
+bool kdbWaitUntil(QWaitCondition *condition, QMutex *mutex, int timeout, Predicate isDone)
+{
+    QElapsedTimer timer;
+    timer.start();
+    while (!isDone()) {
+        if (timeout < 0) {
+            condition->wait(mutex);
+            continue;
+        }
+        const qint64 remaining = timeout - timer.elapsed();
+        if (remaining <= 0) {
+            return false;
+        }
+        condition->wait(mutex, ulong(remaining));
+    }
+    return true;
+}
+
+/*! @internal State shared by an object and the threads it runs in background.
+ The object receives KDbBackgroundEvent events posted by the threads. */
+class KDbBackgroundTaskShared
+{
+public:
+    KDbBackgroundTaskShared();
+
+    ~KDbBackgroundTaskShared();
+
+    //! @return true if cancel has been requested or a thread has failed
+    bool isCancelRequested();
+
+    //! Posts event of @a kind with @a value to the owner
+    void post(KDbBackgroundEvent::Kind kind, qint64 value = 0);
+
+    //! Stores @a failure if it is the first error and requests cancelling of all threads.
+    //! Has to be called with mutex locked.
+    void setFailure(const KDbResult &failure);
+
+    //! Called at the end of each thread, posts the Finished event after the last one.
+    //! Has to be called with mutex locked.
+    void threadDone();
+
+    //! Waits until all threads finish, up to @a timeout milliseconds
+    bool waitForFinished(int timeout);
+
+    //! @return result of the first failed thread
+    KDbResult failure();
+
+    //! Guards members below and members of structures derived from this one
+    QMutex mutex;
+    QWaitCondition threadFinished;
+    QObject *owner = nullptr;
+    int running = 0;
+    bool cancelRequested = false;
+    KDbResult result; //!< result of the first failed thread
+
+private:
+    Q_DISABLE_COPY(KDbBackgroundTaskShared)
+};
+
+#endif
@@ -0,0 +1,108 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbBlobStream.h"
+#include "KDbBlobInterface.h"
+
+class Q_DECL_HIDDEN KDbBlobStream::Private
+{
+public:
+    Private(KDbBlobInterface *i, qint64 s) : iface(i), size(s) {}
+    ~Private() { delete iface; }
+
+    KDbBlobInterface * const iface;
+    qint64 size; //!< cached size of the value
+};
+
+KDbBlobInterfaceFactory::~KDbBlobInterfaceFactory()
+{
+}
+
+KDbBlobStream::KDbBlobStream(KDbBlobInterface *iface, qint64 size, QIODevice::OpenMode mode)
+    : d(new Private(iface, size))
+{
+    // data is never buffered by QIODevice because reads and writes may be mixed
+    open(mode | QIODevice::Unbuffered);
+}
+
+KDbBlobStream::~KDbBlobStream()
+{
+    delete d;
+}
+
+bool KDbBlobStream::isSequential() const
+{
+    return false;
+}
+
+qint64 KDbBlobStream::size() const
+{
+    return d->size;
+}
+
+bool KDbBlobStream::resize(qint64 size)
+{
+    clearResult();
+    if (!isWritable() || size < 0) {
+        return false;
+    }
+    if (size == d->size) {
+        return true;
+    }
+    if (!d->iface->resize(size)) {
+        setInterfaceError();
+        return false;
+    }
+    d->size = size;
+    return true;
+}
+
+void KDbBlobStream::setInterfaceError()
+{
+    m_result = d->iface->result();
+    setErrorString(m_result.message().isEmpty() ? m_result.serverMessage() : m_result.message());
+}
+
+qint64 KDbBlobStream::readData(char *data, qint64 maxSize)
+{
+    const qint64 offset = pos();
+    if (offset >= d->size) {
+        return 0; // end of data
+    }
+    const qint64 count = d->iface->read(offset, data, qMin(maxSize, d->size - offset));
+    if (count < 0) {
+        setInterfaceError();
+    }
+    return count;
+}
+
+qint64 KDbBlobStream::writeData(const char *data, qint64 maxSize)
+{
+    clearResult();
+    const qint64 offset = pos();
+    if (offset > d->size && !resize(offset)) { // fill the gap with zeros
+        return -1;
+    }
+    if (!d->iface->write(offset, data, maxSize)) {
+        setInterfaceError();
+        return -1;
+    }
+    d->size = qMax(d->size, offset + maxSize);
+    return maxSize;
+}
@@ -0,0 +1,95 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_BLOBSTREAM_H
+#define KDB_BLOBSTREAM_H
+
+#include <QIODevice>
+
+#include "KDbResult.h"
+
+class KDbBlobInterface;
+
+/**
+ * @brief Random-access device for incremental reading and writing of a BLOB value
+ *
+ * The device is created by KDbConnection::openBlob() for a single field of a single record.
+ * Ranges of the value are transferred directly from and to the database, so the value
+ * never has to be loaded into memory as a whole. Depending on the driver, SQLite
+ * incremental BLOB I/O, ranges of PostgreSQL bytea values or chunked MySQL statements
+ * are used.
+ *
+ * Use seek() to select position of the next read or write operation. Writing past the end
+ * enlarges the value, and when position is after the end the gap is filled with zeros.
+ * Changing size of a SQLite value requires rewriting it, so when a large value is written
+ * in parts call resize() with the final size first.
+ *
+ * Every write is executed immediately, in auto-commit mode it is committed separately.
+ * The device should be deleted before the database is closed.
+ *
+ * Example usage:
+ * <code>
+ *  QScopedPointer<KDbBlobStream> blob(connection->openBlob(table, "image", id, QIODevice::WriteOnly));
+ *  if (blob && blob->resize(file.size())) {
+ *      while (!file.atEnd()) {
+ *          if (blob->write(file.read(1024 * 1024)) < 0) {
+ *              qWarning() << blob->result();
+ *              break;
+ *          }
+ *      }
+ *  }
+ * </code>
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbBlobStream : public QIODevice, public KDbResultable
+{
+    Q_OBJECT
+public:
+    ~KDbBlobStream() override;
+
+    //! @return false, the device is random-access
+    bool isSequential() const override;
+
+    //! @return size of the value in bytes, 0 for NULL
+    qint64 size() const override;
+
+    /*! Changes size of the value to @a size bytes. Existing bytes within the new size are kept,
+     new bytes are zero. Position of the device is not changed.
+     @return false on failure or if the device is not writable. */
+    bool resize(qint64 size);
+
+protected:
+    qint64 readData(char *data, qint64 maxSize) override;
+    qint64 writeData(const char *data, qint64 maxSize) override;
+
+private:
+    //! Creates device for @a iface opened in @a mode, takes ownership of @a iface
+    KDbBlobStream(KDbBlobInterface *iface, qint64 size, QIODevice::OpenMode mode);
+
+    //! Sets error string of the device and result from the interface
+    void setInterfaceError();
+
+    friend class KDbConnection;
+    Q_DISABLE_COPY(KDbBlobStream)
+    class Private;
+    Private * const d;
+};
+
+#endif
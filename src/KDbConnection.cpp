@@ -19,6 +19,9 @@
 
 #include "KDbConnection.h"
 #include "KDbConnection_p.h"
+#include "KDbBlobInterface.h"
+#include "KDbBlobStream.h"
+#include "KDbCancelQueryInterface.h"
 #include "KDbCursor.h"
 #include "KDbDriverBehavior.h"
 #include "KDbDriverMetaData.h"
@@ -38,6 +41,7 @@
 #include "KDbTransactionGuard.h"
 #include "kdb_debug.h"
 
+#include <QAtomicInteger>
 #include <QDir>
 #include <QFileInfo>
 #include <QDomDocument>
@@ -172,12 +176,17 @@ void KDbConnectionOptions::setConnection(KDbConnection *connection)
 
 //================================================
 
+//! Last value of KDbConnectionPrivate::id
+static QBasicAtomicInteger<quint64> g_lastConnectionId = Q_BASIC_ATOMIC_INITIALIZER(0);
+
 KDbConnectionPrivate::KDbConnectionPrivate(KDbConnection* const conn, KDbDriver *drv, const KDbConnectionData& _connData,
                   const KDbConnectionOptions &_options)
         : conn(conn)
+        , id(g_lastConnectionId.fetchAndAddRelaxed(1) + 1)
         , connData(_connData)
         , options(_options)
         , driver(drv)
+        , sqlWriter(drv, 4096)
         , dbProperties(conn)
 {
     options.setConnection(conn);
@@ -263,6 +272,7 @@ void KDbConnectionPrivate::setupKDbSystemSchema()
 
 void KDbConnectionPrivate::insertTable(KDbTableSchema* tableSchema)
 {
+    ++schemaRevision;
     KDbInternalTableSchema* internalTable = dynamic_cast<KDbInternalTableSchema*>(tableSchema);
     if (internalTable) {
         m_internalKDbTables.insert(internalTable);
@@ -274,6 +284,7 @@ void KDbConnectionPrivate::insertTable(KDbTableSchema* tableSchema)
 
 void KDbConnectionPrivate::removeTable(int id)
 {
+    ++schemaRevision;
     QScopedPointer<KDbTableSchema> toDelete(m_tables.take(id));
     if (!toDelete) {
         kdbWarning() << "Could not find table to delete with id=" << id;
@@ -286,6 +297,7 @@ void KDbConnectionPrivate::removeTable(int id)
 
 void KDbConnectionPrivate::takeTable(KDbTableSchema* tableSchema)
 {
+    ++schemaRevision;
     if (m_tables.isEmpty()) {
         return;
     }
@@ -295,6 +307,7 @@ void KDbConnectionPrivate::takeTable(KDbTableSchema* tableSchema)
 
 void KDbConnectionPrivate::renameTable(KDbTableSchema* tableSchema, const QString& newName)
 {
+    ++schemaRevision;
     m_tablesByName.take(tableSchema->name());
     tableSchema->setName(newName);
     m_tablesByName.insert(tableSchema->name(), tableSchema);
@@ -302,12 +315,14 @@ void KDbConnectionPrivate::renameTable(KDbTableSchema* tableSchema, const QStrin
 
 void KDbConnectionPrivate::changeTableId(KDbTableSchema* tableSchema, int newId)
 {
+    ++schemaRevision;
     m_tables.take(tableSchema->id());
     m_tables.insert(newId, tableSchema);
 }
 
 void KDbConnectionPrivate::clearTables()
 {
+    ++schemaRevision;
     m_tablesByName.clear();
     qDeleteAll(m_internalKDbTables);
     m_internalKDbTables.clear();
@@ -318,12 +333,14 @@ void KDbConnectionPrivate::clearTables()
 
 void KDbConnectionPrivate::insertQuery(KDbQuerySchema* query)
 {
+    ++schemaRevision;
     m_queries.insert(query->id(), query);
     m_queriesByName.insert(query->name(), query);
 }
 
 void KDbConnectionPrivate::removeQuery(KDbQuerySchema* querySchema)
 {
+    ++schemaRevision;
     m_queriesByName.remove(querySchema->name());
     m_queries.remove(querySchema->id());
     delete querySchema;
@@ -331,6 +348,7 @@ void KDbConnectionPrivate::removeQuery(KDbQuerySchema* querySchema)
 
 void KDbConnectionPrivate::setQueryObsolete(KDbQuerySchema* query)
 {
+    ++schemaRevision;
     obsoleteQueries.insert(query);
     m_queriesByName.take(query->name());
     m_queries.take(query->id());
@@ -338,10 +356,294 @@ void KDbConnectionPrivate::setQueryObsolete(KDbQuerySchema* query)
 
 void KDbConnectionPrivate::clearQueries()
 {
+    ++schemaRevision;
     qDeleteAll(m_queries);
     m_queries.clear();
 }
 
+KDbConnectionPrivate::LookupValues KDbConnectionPrivate::lookupValues(
+    const KDbLookupFieldSchema &lookupFieldSchema)
+{
+    const KDbLookupFieldSchemaRecordSource recordSource(lookupFieldSchema.recordSource());
+    const QList<int> visibleColumns(lookupFieldSchema.visibleColumns());
+    QString key(recordSource.typeName() + QLatin1Char(':') + recordSource.name()
+                + QLatin1Char(':') + QString::number(lookupFieldSchema.boundColumn()));
+    for (int visibleColumn : visibleColumns) {
+        key += QLatin1Char(',') + QString::number(visibleColumn);
+    }
+    KDbQuerySchema *query;
+    if (recordSource.type() == KDbLookupFieldSchemaRecordSource::Type::Table) {
+        KDbTableSchema *table = conn->tableSchema(recordSource.name());
+        query = table ? table->query() : nullptr;
+    } else if (recordSource.type() == KDbLookupFieldSchemaRecordSource::Type::Query) {
+        query = conn->querySchema(recordSource.name());
+    } else {
+        kdbWarning() << "unsupported record source type" << recordSource.typeName();
+        return LookupValues();
+    }
+    if (!query || visibleColumns.isEmpty()) {
+        return LookupValues();
+    }
+    // the record source query can be modified without changing schema of the connection
+    const quint64 queryRevision = KDbQuerySchemaPrivate::revision(query);
+    const auto cachedIt = m_lookupValues.constFind(key);
+    if (cachedIt != m_lookupValues.constEnd() && cachedIt.value().schemaRevision == schemaRevision
+            && cachedIt.value().queryRevision == queryRevision)
+    {
+        return cachedIt.value().values;
+    }
+    // Column indices of the lookup field schema refer to expanded fields,
+    // cursor's values refer to visible expanded fields.
+    const KDbQueryColumnInfo::Vector fieldsExpanded(query->fieldsExpanded(conn));
+    const KDbQueryColumnInfo::Vector visibleFieldsExpanded(query->visibleFieldsExpanded(conn));
+    const int boundPosition = visibleFieldsExpanded.indexOf(
+        fieldsExpanded.value(lookupFieldSchema.boundColumn()));
+    QVector<int> visiblePositions;
+    for (int visibleColumn : visibleColumns) {
+        visiblePositions.append(visibleFieldsExpanded.indexOf(fieldsExpanded.value(visibleColumn)));
+    }
+    if (boundPosition < 0 || visiblePositions.contains(-1)) {
+        kdbWarning() << "invalid bound or visible columns of lookup field for" << recordSource.name();
+        return LookupValues();
+    }
+    KDbCursor *cursor = conn->executeQuery(query);
+    if (!cursor) {
+        return LookupValues();
+    }
+    QSharedPointer<QHash<QString, QVariant>> values(new QHash<QString, QVariant>);
+    for (cursor->moveFirst(); !cursor->eof(); cursor->moveNext()) {
+        const QVariant boundValue(cursor->value(boundPosition));
+        if (boundValue.isNull()) {
+            continue;
+        }
+        QVariant visibleValue;
+        if (visiblePositions.count() == 1) {
+            visibleValue = cursor->value(visiblePositions.first());
+        } else {
+            // the same as "v1 || ' ' || v2" used for joins: NULL if any value is NULL
+            QStringList strings;
+            for (int position : qAsConst(visiblePositions)) {
+                const QVariant value(cursor->value(position));
+                if (value.isNull()) {
+                    strings.clear();
+                    break;
+                }
+                strings.append(value.toString());
+            }
+            if (!strings.isEmpty()) {
+                visibleValue = strings.join(QLatin1Char(' '));
+            }
+        }
+        values->insert(boundValue.toString(), visibleValue);
+    }
+    const bool ok = !cursor->result().isError();
+    conn->deleteCursor(cursor);
+    if (!ok) {
+        return LookupValues();
+    }
+    CachedLookupValues cached;
+    cached.values = values;
+    for (const KDbTableSchema *table : qAsConst(*query->tables())) {
+        cached.tableNames.insert(table->name());
+    }
+    cached.schemaRevision = schemaRevision;
+    cached.queryRevision = queryRevision;
+    m_lookupValues.insert(key, cached);
+    return cached.values;
+}
+
+void KDbConnectionPrivate::invalidateLookupValues(const QString &tableName)
+{
+    if (tableName.isEmpty()) {
+        m_lookupValues.clear();
+        return;
+    }
+    for (auto it = m_lookupValues.begin(); it != m_lookupValues.end();) {
+        if (it.value().tableNames.contains(tableName)) {
+            it = m_lookupValues.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+KDbPreparedStatement* KDbConnectionPrivate::recordStatement(KDbPreparedStatement::Type type,
+                                                           KDbTableSchema *table,
+                                                           const KDbField::List &fields,
+                                                           const QStringList &whereFieldNames)
+{
+    if (m_recordStatementsRevision != schemaRevision) { // field objects could be deleted
+        clearRecordStatements();
+        m_recordStatementsRevision = schemaRevision;
+    }
+    QString key(QString::number(type) + QLatin1Char(':') + table->name());
+    for (const KDbField *f : fields) {
+        key += QLatin1Char(':') + f->name();
+    }
+    key += QLatin1String(":WHERE:") + whereFieldNames.join(QLatin1Char(':'));
+    CachedRecordStatement *cached = m_recordStatements.value(key);
+    if (cached) {
+        return &cached->statement;
+    }
+    if (m_recordStatements.count() >= 64) { // e.g. many combinations of updated fields
+        clearRecordStatements();
+    }
+    QScopedPointer<CachedRecordStatement> newCached(new CachedRecordStatement);
+    for (KDbField *f : fields) {
+        if (!newCached->fields.addField(f)) {
+            return nullptr;
+        }
+    }
+    // DELETE only needs the table
+    newCached->statement = conn->prepareStatement(
+        type, type == KDbPreparedStatement::DeleteStatement ? table : &newCached->fields,
+        whereFieldNames);
+    if (!newCached->statement.isValid()) {
+        return nullptr;
+    }
+    cached = newCached.take();
+    m_recordStatements.insert(key, cached);
+    return &cached->statement;
+}
+
+void KDbConnectionPrivate::clearRecordStatements()
+{
+    m_recordStatements.clear();
+}
+
+bool KDbConnectionPrivate::executeRecordStatement(KDbPreparedStatement::Type type,
+                                                  KDbTableSchema *table,
+                                                  const KDbField::List &fields,
+                                                  KDbIndexSchema *pkey,
+                                                  const KDbPreparedStatementParameters &parameters,
+                                                  qint64 *size)
+{
+    *size = 32; // rough size of the statement itself
+    for (const QVariant &value : parameters) {
+        *size += value.type() == QVariant::ByteArray ? value.toByteArray().size()
+                                                     : value.toString().length();
+    }
+    KDbPreparedStatement *statement = recordStatement(type, table, fields, pkey->names());
+    if (!statement) {
+        if (!conn->result().isError()) {
+            conn->m_result = KDbResult(ERR_OTHER,
+                                       KDbConnection::tr("Could not prepare statement for table \"%1\".")
+                                       .arg(table->name()));
+        }
+        return false;
+    }
+    if (!statement->execute(parameters)) { // also invalidates lookup values of the table
+        conn->m_result = statement->result();
+        return false;
+    }
+    return true;
+}
+
+KDbEscapedString KDbConnectionPrivate::savepointName(int level)
+{
+    return KDbEscapedString("kdb_savepoint_%1").arg(level);
+}
+
+void KDbConnectionPrivate::deactivateNestedTransactions(int level)
+{
+    while (!nestedTransactions.isEmpty() && nestedTransactions.count() >= level) {
+        const KDbTransaction trans = nestedTransactions.takeLast();
+        trans.m_data->setActive(false);
+    }
+}
+
+bool KDbConnectionPrivate::beginWriteBehindStatement()
+{
+    const int features = driver->behavior()->features;
+    if (!writeBehind.enabled || !autoCommit || (features & KDbDriver::IgnoreTransactions)
+            || !driver->transactionsSupported() || writeBehind.statement) {
+        return false;
+    }
+    if (!writeBehind.transaction.isActive()) {
+        // the group has been committed or rolled back by the caller in the meantime
+        writeBehind.transaction = KDbTransaction();
+        writeBehind.recordCount = 0;
+        writeBehind.size = 0;
+        if (!transactions.isEmpty()) {
+            return false; // writes are grouped by the caller's transaction
+        }
+        const KDbResult prevResult = conn->result();
+        writeBehind.beginning = true;
+        const KDbTransaction trans = conn->beginTransaction();
+        writeBehind.beginning = false;
+        conn->m_result = prevResult;
+        if (!trans.isActive()) {
+            kdbWarning() << "Could not start write-behind transaction, falling back to auto commit";
+            return false;
+        }
+        writeBehind.transaction = trans;
+        writeBehind.timer.start();
+    }
+    if (driver->behavior()->FAILED_STATEMENT_ABORTS_TRANSACTION
+            && !conn->drv_executeSql(KDbEscapedString("SAVEPOINT kdb_write_behind")))
+    {
+        return false; // the statement will fail too since the transaction is aborted
+    }
+    writeBehind.statement = true;
+    return true;
+}
+
+bool KDbConnectionPrivate::endWriteBehindStatement(bool grouped, bool *ok, qint64 size,
+                                                   int recordCount)
+{
+    if (!grouped) {
+        return true;
+    }
+    writeBehind.statement = false;
+    if (driver->behavior()->FAILED_STATEMENT_ABORTS_TRANSACTION) {
+        const KDbResult prevResult = conn->result();
+        if (*ok && !conn->drv_executeSql(KDbEscapedString("RELEASE SAVEPOINT kdb_write_behind"))) {
+            *ok = false;
+        }
+        if (!*ok) {
+            // undo the statement only, so the group can be still committed
+            conn->drv_executeSql(KDbEscapedString("ROLLBACK TO SAVEPOINT kdb_write_behind"));
+            conn->drv_executeSql(KDbEscapedString("RELEASE SAVEPOINT kdb_write_behind"));
+            if (prevResult.isError()) {
+                conn->m_result = prevResult;
+            }
+        }
+    }
+    if (!*ok) {
+        return true;
+    }
+    writeBehind.recordCount += recordCount;
+    writeBehind.size += size;
+    if (writeBehind.recordCount >= writeBehind.recordLimit
+            || writeBehind.size >= writeBehind.sizeLimit
+            || writeBehind.timer.hasExpired(writeBehind.timeLimit))
+    {
+        return flushWriteBehind();
+    }
+    return true;
+}
+
+bool KDbConnectionPrivate::flushWriteBehind()
+{
+    const KDbTransaction trans = writeBehind.transaction;
+    const int count = writeBehind.recordCount;
+    writeBehind.transaction = KDbTransaction();
+    writeBehind.recordCount = 0;
+    writeBehind.size = 0;
+    if (!trans.isActive()) {
+        return true;
+    }
+    if (conn->commitTransaction(trans)) {
+        return true;
+    }
+    const KDbResult result = conn->result();
+    conn->rollbackTransaction(trans, KDbTransaction::CommitOption::IgnoreInactive);
+    conn->m_result = result;
+    conn->m_result.prependMessage(ERR_ROLLBACK_OR_COMMIT_TRANSACTION,
+        KDbConnection::tr("Could not commit %n record(s) written in write-behind mode.", "", count));
+    return false;
+}
+
 KDbTableSchema* KDbConnectionPrivate::setupTableSchema(KDbTableSchema *table)
 {
     Q_ASSERT(table);
@@ -858,6 +1160,12 @@ bool KDbConnection::closeDatabase()
 
     bool ret = true;
 
+    // records written in write-behind mode are not meant to be discarded
+    if (!d->flushWriteBehind()) {
+        kdbWarning() << m_result;
+        ret = false;
+    }
+
     /*! @todo (js) add CLEVER algorithm here for nested transactions */
     if (d->driver->transactionsSupported()) {
         //rollback all transactions
@@ -876,11 +1184,13 @@ bool KDbConnection::closeDatabase()
         d->transactions.clear(); //free trans. data
     }
 
-    //delete own cursors:
+    //delete own cursors and statements:
     d->deleteAllCursors();
+    d->clearRecordStatements();
     //delete own schemas
     d->clearTables();
     d->clearQueries();
+    d->invalidateLookupValues();
 
     if (!drv_closeDatabase())
         return false;
@@ -1108,9 +1418,9 @@ QList<int> KDbConnection::objectIds(int objectType, bool* ok)
 //yeah, it is very efficient:
 #define C_A(a) , const QVariant& c ## a
 
-#define V_A0 d->driver->valueToSql( tableSchema->field(0), c0 )
-#define V_A(a) + ',' + d->driver->valueToSql( \
-        tableSchema->field(a) ? tableSchema->field(a)->type() : KDbField::Text, c ## a )
+#define V_A0 d->sqlWriter.appendValue( tableSchema->field(0), c0 );
+#define V_A(a) d->sqlWriter.append(',').appendValue( \
+        tableSchema->field(a) ? tableSchema->field(a)->type() : KDbField::Text, c ## a );
 
 //  kdbDebug() << "******** " << QString("INSERT INTO ") +
 //   escapeIdentifier(tableSchema->name()) +
@@ -1121,25 +1431,22 @@ QSharedPointer<KDbSqlResult> KDbConnection::insertRecordInternal(const QString &
                                                                  const KDbEscapedString &sql)
 {
     QSharedPointer<KDbSqlResult> res;
-    if (!drv_beforeInsert(tableSchemaName,fields )) {
-        return res;
-    }
-    res = prepareSql(sql);
-    if (!res || res->lastResult().isError()) {
-        res.clear();
-        return res;
-    }
-    if (!drv_afterInsert(tableSchemaName, fields)) {
-        res.clear();
-        return res;
-    }
-    {
-        // Fetching is needed to perform real execution at least for some backends.
-        // Also we are not expecting record but let's delete if there's any.
-        QSharedPointer<KDbSqlRecord> record = res->fetchRecord();
-        Q_UNUSED(record)
+    bool ok = false;
+    const bool grouped = d->beginWriteBehindStatement();
+    if (drv_beforeInsert(tableSchemaName, fields)) {
+        res = prepareSql(sql);
+        if (res && !res->lastResult().isError()) {
+            d->invalidateLookupValues(tableSchemaName);
+            if (drv_afterInsert(tableSchemaName, fields)) {
+                // Fetching is needed to perform real execution at least for some backends.
+                // Also we are not expecting record but let's delete if there's any.
+                QSharedPointer<KDbSqlRecord> record = res->fetchRecord();
+                Q_UNUSED(record)
+                ok = !res->lastResult().isError();
+            }
+        }
     }
-    if (res->lastResult().isError()) {
+    if (!d->endWriteBehindStatement(grouped, &ok, sql.length()) || !ok) {
         res.clear();
     }
     return res;
@@ -1147,11 +1454,13 @@ QSharedPointer<KDbSqlResult> KDbConnection::insertRecordInternal(const QString &
 
 #define C_INS_REC(args, vals) \
     QSharedPointer<KDbSqlResult> KDbConnection::insertRecord(KDbTableSchema* tableSchema args) { \
-        return insertRecordInternal(tableSchema->name(), tableSchema, \
-                   KDbEscapedString("INSERT INTO ") + escapeIdentifier(tableSchema->name()) \
-                       + " (" \
-                       + tableSchema->sqlFieldsList(this) \
-                       + ") VALUES (" + vals + ')'); \
+        d->sqlWriter.clear(); \
+        d->sqlWriter << "INSERT INTO "; \
+        d->sqlWriter.appendIdentifier(tableSchema->name()) \
+            << " (" << tableSchema->sqlFieldsList(this) << ") VALUES ("; \
+        vals \
+        d->sqlWriter << ')'; \
+        return insertRecordInternal(tableSchema->name(), tableSchema, d->sqlWriter.toString()); \
     }
 
 #define C_INS_REC_ALL \
@@ -1170,22 +1479,22 @@ C_INS_REC_ALL
 #undef V_A
 #undef C_INS_REC
 
-#define V_A0 value += d->driver->valueToSql( it.next(), c0 );
-#define V_A( a ) value += (',' + d->driver->valueToSql( it.next(), c ## a ));
+#define V_A0 d->sqlWriter.appendValue( it.next(), c0 );
+#define V_A( a ) d->sqlWriter.append(',').appendValue( it.next(), c ## a );
 
 #define C_INS_REC(args, vals) \
     QSharedPointer<KDbSqlResult> KDbConnection::insertRecord(KDbFieldList* fields args) \
     { \
-        KDbEscapedString value; \
         const KDbField::List *flist = fields->fields(); \
         QListIterator<KDbField*> it(*flist); \
+        QString tableName((it.hasNext() && it.peekNext()->table()) ? it.peekNext()->table()->name() : QLatin1String("??")); \
+        d->sqlWriter.clear(); \
+        d->sqlWriter << "INSERT INTO "; \
+        d->sqlWriter.appendIdentifier(tableName) \
+            << " (" << fields->sqlFieldsList(this) << ") VALUES ("; \
         vals \
-        it.toFront(); \
-        QString tableName((it.hasNext() && it.peekNext()->table()) ? it.next()->table()->name() : QLatin1String("??")); \
-        return insertRecordInternal(tableName, fields, \
-                   KDbEscapedString(QLatin1String("INSERT INTO ") + escapeIdentifier(tableName)) \
-                   + " (" + fields->sqlFieldsList(this) \
-                   + ") VALUES (" + value + ')'); \
+        d->sqlWriter << ')'; \
+        return insertRecordInternal(tableName, fields, d->sqlWriter.toString()); \
     }
 
 C_INS_REC_ALL
@@ -1207,23 +1516,23 @@ QSharedPointer<KDbSqlResult> KDbConnection::insertRecord(KDbTableSchema *tableSc
     }
     KDbField::ListIterator fieldsIt(flist->constBegin());
     QList<QVariant>::ConstIterator it = values.constBegin();
-    KDbEscapedString sql;
-    sql.reserve(4096);
+    d->sqlWriter.clear();
     while (fieldsIt != flist->constEnd() && (it != values.end())) {
         KDbField *f = *fieldsIt;
-        if (sql.isEmpty()) {
-            sql = KDbEscapedString("INSERT INTO ") + escapeIdentifier(tableSchema->name())
-                  + " VALUES (";
+        if (d->sqlWriter.isEmpty()) {
+            d->sqlWriter << "INSERT INTO ";
+            d->sqlWriter.appendIdentifier(tableSchema->name()) << " VALUES (";
         }
         else {
-            sql += ',';
+            d->sqlWriter << ',';
         }
-        sql += d->driver->valueToSql(f, *it);
+        d->sqlWriter.appendValue(f, *it);
 //  kdbDebug() << "val" << i++ << ": " << d->driver->valueToSql( f, *it );
         ++it;
         ++fieldsIt;
     }
-    sql += ')';
+    d->sqlWriter << ')';
+    const KDbEscapedString sql(d->sqlWriter.toString());
     m_result.setSql(sql);
     res = insertRecordInternal(tableSchema->name(), tableSchema, sql);
     return res;
@@ -1239,27 +1548,28 @@ QSharedPointer<KDbSqlResult> KDbConnection::insertRecord(KDbFieldList *fields,
         return res;
     }
     KDbField::ListIterator fieldsIt(flist->constBegin());
-    KDbEscapedString sql;
-    sql.reserve(4096);
+    d->sqlWriter.clear();
     QList<QVariant>::ConstIterator it = values.constBegin();
     const QString tableName(flist->first()->table()->name());
     while (fieldsIt != flist->constEnd() && it != values.constEnd()) {
         KDbField *f = *fieldsIt;
-        if (sql.isEmpty()) {
-            sql = KDbEscapedString("INSERT INTO ") + escapeIdentifier(tableName) + '(' +
-                  fields->sqlFieldsList(this) + ") VALUES (";
+        if (d->sqlWriter.isEmpty()) {
+            d->sqlWriter << "INSERT INTO ";
+            d->sqlWriter.appendIdentifier(tableName) << '(' << fields->sqlFieldsList(this)
+                                                     << ") VALUES (";
         }
         else {
-            sql += ',';
+            d->sqlWriter << ',';
         }
-        sql += d->driver->valueToSql(f, *it);
+        d->sqlWriter.appendValue(f, *it);
 //  kdbDebug() << "val" << i++ << ": " << d->driver->valueToSql( f, *it );
         ++it;
         ++fieldsIt;
         if (fieldsIt == flist->constEnd())
             break;
     }
-    sql += ')';
+    d->sqlWriter << ')';
+    const KDbEscapedString sql(d->sqlWriter.toString());
     m_result.setSql(sql);
     res = insertRecordInternal(tableName, fields, sql);
     return res;
@@ -1289,6 +1599,7 @@ bool KDbConnection::executeSql(const KDbEscapedString& sql)
     if (!checkSql(sql, &m_result)) {
         return false;
     }
+    d->invalidateLookupValues(); // any table could be modified
     if (!drv_executeSql(sql)) {
         m_result.setMessage(QString()); //clear as this could be most probably just "Unknown error" string.
         m_result.setErrorSql(sql);
@@ -1300,6 +1611,16 @@ bool KDbConnection::executeSql(const KDbEscapedString& sql)
     return true;
 }
 
+KDbCancelQueryInterface::~KDbCancelQueryInterface()
+{
+}
+
+bool KDbConnection::cancelQuery()
+{
+    KDbCancelQueryInterface *iface = dynamic_cast<KDbCancelQueryInterface*>(this);
+    return iface && isConnected() && iface->drv_cancelQuery();
+}
+
 KDbField* KDbConnection::findSystemFieldName(const KDbFieldList& fieldlist)
 {
     for (KDbField::ListIterator it(fieldlist.fieldsIterator()); it != fieldlist.fieldsIteratorConstEnd(); ++it) {
@@ -1388,6 +1709,32 @@ bool KDbConnection::storeMainFieldSchema(KDbField *field)
     return executeSql(sql);
 }
 
+bool KDbConnection::storeMainFieldsSchema(KDbTableSchema *tableSchema)
+{
+    KDbTableSchema *ts = d->table(QLatin1String("kexi__fields"));
+    if (!ts)
+        return false;
+    //remove field info (if any) for this table id
+    if (!KDb::deleteRecords(this, *ts, QLatin1String("t_id"), tableSchema->id()))
+        return false;
+
+    KDbFieldList *fl = createFieldListForKexi__Fields(ts);
+    if (!fl)
+        return false;
+
+    bool ok = true;
+    foreach(KDbField *f, *tableSchema->fields()) {
+        QList<QVariant> vals;
+        buildValuesForKexi__Fields(vals, f);
+        if (!insertRecord(fl, vals)) {
+            ok = false;
+            break;
+        }
+    }
+    delete fl;
+    return ok;
+}
+
 #define createTable_ERR \
     { kdbDebug() << "ERROR!"; \
         m_result.prependMessage(KDbConnection::tr("Creating table failed.")); \
@@ -1470,6 +1817,9 @@ bool KDbConnection::createTable(KDbTableSchema* tableSchema, CreateTableOptions
         if (!drv_createTable(*tableSchema)) {
             createTable_ERR;
         }
+        if (!(options & CreateTableOption::SkipIndices) && !createIndices(tableSchema, options)) {
+            createTable_ERR;
+        }
     }
 
     //add the object data to kexi__* tables
@@ -1478,24 +1828,8 @@ bool KDbConnection::createTable(KDbTableSchema* tableSchema, CreateTableOptions
         if (!storeNewObjectData(tableSchema))
             createTable_ERR;
 
-        KDbTableSchema *ts = d->table(QLatin1String("kexi__fields"));
-        if (!ts)
-            return false;
-        //for sanity: remove field info (if any) for this table id
-        if (!KDb::deleteRecords(this, *ts, QLatin1String("t_id"), tableSchema->id()))
-            return false;
-
-        KDbFieldList *fl = createFieldListForKexi__Fields(ts);
-        if (!fl)
-            return false;
-
-        foreach(KDbField *f, *tableSchema->fields()) {
-            QList<QVariant> vals;
-            buildValuesForKexi__Fields(vals, f);
-            if (!insertRecord(fl, vals))
-                createTable_ERR;
-        }
-        delete fl;
+        if (!storeMainFieldsSchema(tableSchema))
+            createTable_ERR;
 
         if (!storeExtendedTableSchemaData(tableSchema))
             createTable_ERR;
@@ -1516,6 +1850,101 @@ bool KDbConnection::createTable(KDbTableSchema* tableSchema, CreateTableOptions
     return res;
 }
 
+//! Executes CREATE INDEX statement for @a index
+static bool createIndexInternal(KDbConnection *conn, const KDbIndexSchema &index)
+{
+    const KDbNativeStatementBuilder builder(conn, KDb::DriverEscaping);
+    KDbEscapedString sql;
+    if (!builder.generateCreateIndexStatement(&sql, index)) {
+        return false;
+    }
+    return conn->executeSql(sql);
+}
+
+bool KDbConnection::createIndices(KDbTableSchema *tableSchema, CreateTableOptions options)
+{
+    if (!tableSchema || !checkIsDatabaseUsed())
+        return false;
+    QSet<QString> createdNames; // avoids duplicates of indices defined both ways
+    // single-field indices; primary keys and unique fields are indexed by CREATE TABLE
+    for (KDbField *field : *tableSchema->fields()) {
+        // constraints of the caller's fields are not altered for indices requested by options
+        const bool indexed = field->isIndexed()
+            || ((options & CreateTableOption::IndexForeignKeys) && field->isForeignKey())
+            || ((options & CreateTableOption::IndexLookupFields)
+                && tableSchema->lookupFieldSchema(*field));
+        if (!indexed || field->isPrimaryKey() || field->isUniqueKey()) {
+            continue;
+        }
+        KDbIndexSchema index;
+        index.setTable(tableSchema);
+        if (!index.addField(field) || !createIndexInternal(this, index)) {
+            return false;
+        }
+        createdNames.insert(KDbNativeStatementBuilder::indexName(index));
+    }
+    // explicitly defined indices
+    for (const KDbIndexSchema *index : *tableSchema->indices()) {
+        if (index->isAutoGenerated() || index->isPrimaryKey() || index->fieldCount() == 0) {
+            continue;
+        }
+        if (index->isForeignKey()) {
+            // single-field foreign keys are indexed above
+            if (!(options & CreateTableOption::IndexForeignKeys) || index->fieldCount() == 1) {
+                continue;
+            }
+        }
+        const QString name(KDbNativeStatementBuilder::indexName(*index));
+        if (createdNames.contains(name)) {
+            continue;
+        }
+        if (!createIndexInternal(this, *index)) {
+            return false;
+        }
+        createdNames.insert(name);
+    }
+    return true;
+}
+
+bool KDbConnection::createIndex(KDbIndexSchema *index)
+{
+    if (!index || !checkIsDatabaseUsed())
+        return false;
+    clearResult();
+    const KDbTableSchema *table = index->table();
+    if (!table || table->connection() != this || index->isPrimaryKey()
+        || index->fieldCount() == 0)
+    {
+        m_result = KDbResult(ERR_OTHER, tr("Could not create index for table \"%1\".")
+                                        .arg(table ? table->name() : QString()));
+        return false;
+    }
+    return createIndexInternal(this, *index);
+}
+
+bool KDbConnection::dropIndex(KDbIndexSchema *index)
+{
+    if (!index || !checkIsDatabaseUsed())
+        return false;
+    clearResult();
+    KDbTableSchema *table = index->table();
+    if (!table || table->connection() != this || index->isPrimaryKey()
+        || index->isAutoGenerated())
+    {
+        m_result = KDbResult(ERR_OTHER, tr("Could not remove index from table \"%1\".")
+                                        .arg(table ? table->name() : QString()));
+        return false;
+    }
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    KDbEscapedString sql;
+    if (!builder.generateDropIndexStatement(&sql, *index) || !executeSql(sql)) {
+        return false;
+    }
+    table->removeIndex(index);
+    delete index;
+    return true;
+}
+
 KDbTableSchema *KDbConnection::copyTable(const KDbTableSchema &tableSchema, const KDbObject &newData)
 {
     clearResult();
@@ -1892,6 +2321,10 @@ bool KDbConnection::drv_createTable(const QString& tableName)
 
 bool KDbConnection::beginAutoCommitTransaction(KDbTransactionGuard* tg)
 {
+    if (!d->flushWriteBehind()) {
+        tg->setTransaction(KDbTransaction());
+        return false;
+    }
     if ((d->driver->behavior()->features & KDbDriver::IgnoreTransactions)
             || !d->autoCommit) {
         tg->setTransaction(KDbTransaction());
@@ -1908,6 +2341,15 @@ bool KDbConnection::beginAutoCommitTransaction(KDbTransactionGuard* tg)
             }
 
         d->defaultTransactionStartedInside = d->default_trans.isNull();
+        if (!d->defaultTransactionStartedInside && d->default_trans.isActive()
+                && (d->driver->behavior()->features & KDbDriver::NestedTransactions)
+                && !d->driver->behavior()->DDL_COMMITS_TRANSACTION)
+        {
+            // join externally started transaction; nested transaction allows to undo
+            // just this operation on failure
+            tg->setTransaction(beginTransaction());
+            return !m_result.isError();
+        }
         if (!d->defaultTransactionStartedInside) {
             tg->setTransaction(d->default_trans);
             tg->doNothing();
@@ -1928,7 +2370,8 @@ bool KDbConnection::commitAutoCommitTransaction(const KDbTransaction& trans)
     if (trans.isNull() || !d->driver->transactionsSupported())
         return true;
     if (d->driver->behavior()->features & KDbDriver::SingleTransactions) {
-        if (!d->defaultTransactionStartedInside) //only commit internally started transaction
+        //only commit internally started transaction or nested one
+        if (!d->defaultTransactionStartedInside && !trans.isNested())
             return true; //give up
     }
     return commitTransaction(trans, KDbTransaction::CommitOption::IgnoreInactive);
@@ -1954,6 +2397,8 @@ KDbTransaction KDbConnection::beginTransaction()
 {
     if (!checkIsDatabaseUsed())
         return KDbTransaction();
+    if (!d->writeBehind.beginning && !d->flushWriteBehind())
+        return KDbTransaction();
     KDbTransaction trans;
     if (d->driver->behavior()->features & KDbDriver::IgnoreTransactions) {
         //we're creating dummy transaction data here,
@@ -1963,6 +2408,19 @@ KDbTransaction KDbConnection::beginTransaction()
         return trans;
     }
     if (d->driver->behavior()->features & KDbDriver::SingleTransactions) {
+        if (d->default_trans.isActive()
+                && (d->driver->behavior()->features & KDbDriver::NestedTransactions))
+        {
+            const int level = d->nestedTransactions.count() + 1;
+            if (!executeSql(KDbEscapedString("SAVEPOINT ") + KDbConnectionPrivate::savepointName(level))) {
+                SET_BEGIN_TR_ERROR;
+                return KDbTransaction();
+            }
+            trans.m_data = new KDbTransactionData(this);
+            trans.m_data->setNestingLevel(level);
+            d->nestedTransactions.append(trans);
+            return trans;
+        }
         if (d->default_trans.isActive()) {
             m_result = KDbResult(ERR_TRANSACTION_ACTIVE,
                                  tr("Transaction already started."));
@@ -1999,6 +2457,15 @@ bool KDbConnection::commitTransaction(const KDbTransaction trans,
         SET_ERR_TRANS_NOT_SUPP;
         return false;
     }
+    if (trans.isNested() && !trans.isActive()) { // already ended with its enclosing transaction
+        if (options & KDbTransaction::CommitOption::IgnoreInactive) {
+            return true;
+        }
+        clearResult();
+        m_result = KDbResult(ERR_NO_TRANSACTION_ACTIVE,
+                             tr("Transaction not started."));
+        return false;
+    }
     KDbTransaction t = trans;
     if (!t.isActive()) { //try default tr.
         if (!d->default_trans.isActive()) {
@@ -2013,9 +2480,21 @@ bool KDbConnection::commitTransaction(const KDbTransaction trans,
         t = d->default_trans;
         d->default_trans = KDbTransaction(); //now: no default tr.
     }
+    if (t.isNested()) {
+        // releasing a savepoint also releases savepoints of transactions nested in it
+        const int level = t.m_data->nestingLevel();
+        const bool ret = executeSql(KDbEscapedString("RELEASE SAVEPOINT ")
+                                    + KDbConnectionPrivate::savepointName(level));
+        d->deactivateNestedTransactions(level);
+        if (!ret && !m_result.isError())
+            m_result = KDbResult(ERR_ROLLBACK_OR_COMMIT_TRANSACTION,
+                                 tr("Error on commit transaction."));
+        return ret;
+    }
     bool ret = true;
     if (!(d->driver->behavior()->features & KDbDriver::IgnoreTransactions))
         ret = drv_commitTransaction(t.m_data);
+    d->deactivateNestedTransactions(1);
     if (t.m_data)
         t.m_data->setActive(false); //now this transaction if inactive
     if (!d->dontRemoveTransactions) //true=transaction obj will be later removed from list
@@ -2036,6 +2515,15 @@ bool KDbConnection::rollbackTransaction(const KDbTransaction trans,
         SET_ERR_TRANS_NOT_SUPP;
         return false;
     }
+    if (trans.isNested() && !trans.isActive()) { // already ended with its enclosing transaction
+        if (options & KDbTransaction::CommitOption::IgnoreInactive) {
+            return true;
+        }
+        clearResult();
+        m_result = KDbResult(ERR_NO_TRANSACTION_ACTIVE,
+                             tr("Transaction not started."));
+        return false;
+    }
     KDbTransaction t = trans;
     if (!t.isActive()) { //try default tr.
         if (!d->default_trans.isActive()) {
@@ -2050,9 +2538,23 @@ bool KDbConnection::rollbackTransaction(const KDbTransaction trans,
         t = d->default_trans;
         d->default_trans = KDbTransaction(); //now: no default tr.
     }
+    d->invalidateLookupValues(); // cached values could come from rolled back changes
+    if (t.isNested()) {
+        // undo changes made since the savepoint, then remove it
+        const int level = t.m_data->nestingLevel();
+        const KDbEscapedString name(KDbConnectionPrivate::savepointName(level));
+        const bool ret = executeSql(KDbEscapedString("ROLLBACK TO SAVEPOINT ") + name)
+                && executeSql(KDbEscapedString("RELEASE SAVEPOINT ") + name);
+        d->deactivateNestedTransactions(level);
+        if (!ret && !m_result.isError())
+            m_result = KDbResult(ERR_ROLLBACK_OR_COMMIT_TRANSACTION,
+                                 tr("Error on rollback transaction."));
+        return ret;
+    }
     bool ret = true;
     if (!(d->driver->behavior()->features & KDbDriver::IgnoreTransactions))
         ret = drv_rollbackTransaction(t.m_data);
+    d->deactivateNestedTransactions(1);
     if (t.m_data)
         t.m_data->setActive(false); //now this transaction if inactive
     if (!d->dontRemoveTransactions) //true=transaction obj will be later removed from list
@@ -2101,6 +2603,8 @@ bool KDbConnection::setAutoCommit(bool on)
 {
     if (d->autoCommit == on || d->driver->behavior()->features & KDbDriver::IgnoreTransactions)
         return true;
+    if (!on && !d->flushWriteBehind())
+        return false;
     if (!drv_setAutoCommit(on))
         return false;
     d->autoCommit = on;
@@ -2124,6 +2628,67 @@ bool KDbConnection::drv_rollbackTransaction(KDbTransactionData *)
     return executeSql(KDbEscapedString("ROLLBACK"));
 }
 
+bool KDbConnection::isWriteBehindEnabled() const
+{
+    return d->writeBehind.enabled;
+}
+
+bool KDbConnection::setWriteBehindEnabled(bool set)
+{
+    d->writeBehind.enabled = set;
+    return set || d->flushWriteBehind();
+}
+
+int KDbConnection::writeBehindRecordLimit() const
+{
+    return d->writeBehind.recordLimit;
+}
+
+void KDbConnection::setWriteBehindRecordLimit(int count)
+{
+    d->writeBehind.recordLimit = qMax(1, count);
+}
+
+int KDbConnection::writeBehindSizeLimit() const
+{
+    return d->writeBehind.sizeLimit;
+}
+
+void KDbConnection::setWriteBehindSizeLimit(int bytes)
+{
+    d->writeBehind.sizeLimit = qMax(1, bytes);
+}
+
+int KDbConnection::writeBehindTimeLimit() const
+{
+    return d->writeBehind.timeLimit;
+}
+
+void KDbConnection::setWriteBehindTimeLimit(int msec)
+{
+    d->writeBehind.timeLimit = qMax(0, msec);
+}
+
+int KDbConnection::pendingWriteCount() const
+{
+    return d->writeBehind.transaction.isActive() ? d->writeBehind.recordCount : 0;
+}
+
+bool KDbConnection::flush()
+{
+    return d->flushWriteBehind();
+}
+
+qint64 KDbConnection::cursorMemoryBudget() const
+{
+    return d->cursorMemoryBudget;
+}
+
+void KDbConnection::setCursorMemoryBudget(qint64 bytes)
+{
+    d->cursorMemoryBudget = qMax(qint64(0), bytes);
+}
+
 bool KDbConnection::drv_setAutoCommit(bool /*on*/)
 {
     return true;
@@ -3106,6 +3671,12 @@ bool KDbConnection::updateRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
         kdbDebug() << " -- NO CHANGES DATA!";
         return true;
     }
+    if (query->isGrouped()) {
+        kdbWarning() << " -- GROUPED QUERY!";
+        m_result = KDbResult(ERR_UPDATE_NO_MASTER_TABLE,
+                             tr("Could not update record because records of grouped query cannot be modified."));
+        return false;
+    }
     KDbTableSchema *mt = query->masterTable();
     if (!mt) {
         kdbWarning() << " -- NO MASTER TABLE!";
@@ -3123,25 +3694,19 @@ bool KDbConnection::updateRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
     }
     //update the record:
     KDbEscapedString sql;
-    sql.reserve(4096);
-    sql = KDbEscapedString("UPDATE ") + escapeIdentifier(mt->name()) + " SET ";
-    KDbEscapedString sqlset, sqlwhere;
-    sqlset.reserve(1024);
-    sqlwhere.reserve(1024);
     KDbRecordEditBuffer::DbHash b = buf->dbBuffer();
+    // parameters for prepared statement: values to set followed by primary key values
+    KDbPreparedStatementParameters parameters;
 
     //gather the fields which are updated ( have values in KDbRecordEditBuffer)
     KDbFieldList affectedFields;
     for (KDbRecordEditBuffer::DbHash::ConstIterator it = b.constBegin();it != b.constEnd();++it) {
         if (it.key()->field()->table() != mt)
             continue; // skip values for fields outside of the master table (e.g. a "visible value" of the lookup field)
-        if (!sqlset.isEmpty())
-            sqlset += ',';
         KDbField* currentField = it.key()->field();
         const bool affectedFieldsAddOk = affectedFields.addField(currentField);
         Q_ASSERT(affectedFieldsAddOk);
-        sqlset += KDbEscapedString(escapeIdentifier(currentField->name())) + '=' +
-                  d->driver->valueToSql(currentField, it.value());
+        parameters.append(it.value());
     }
     if (pkey) {
         //kdbDebug() << pkey->fieldCount() << " ? " << query->pkeyFieldCount();
@@ -3155,8 +3720,6 @@ bool KDbConnection::updateRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
             int i = 0;
             const QVector<int> pkeyFieldsOrder(query->pkeyFieldsOrder(this));
             for (KDbField *f : qAsConst(*pkey->fields())) {
-                if (!sqlwhere.isEmpty())
-                    sqlwhere += " AND ";
                 const QVariant val(data->at(pkeyFieldsOrder.at(i)));
                 if (val.isNull() || !val.isValid()) {
                     m_result = KDbResult(ERR_UPDATE_NULL_PKEY_FIELD,
@@ -3164,23 +3727,44 @@ bool KDbConnection::updateRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
                     //js todo: pass the field's name somewhere!
                     return false;
                 }
-                sqlwhere += KDbEscapedString(escapeIdentifier(f->name())) + '=' +
-                            d->driver->valueToSql(f, val);
+                parameters.append(val);
                 i++;
             }
         }
-    } else { //use RecordId
-        sqlwhere = KDbEscapedString(escapeIdentifier(d->driver->behavior()->ROW_ID_FIELD_NAME)) + '='
-                   + d->driver->valueToSql(KDbField::BigInteger, (*data)[data->size() - 1]);
+    } else { //use RecordId: it is not a field so the statement can't be prepared
+        d->sqlWriter.clear();
+        d->sqlWriter << "UPDATE ";
+        d->sqlWriter.appendIdentifier(mt->name()) << " SET ";
+        int i = 0;
+        for (const KDbField *f : *affectedFields.fields()) {
+            if (i > 0)
+                d->sqlWriter << ',';
+            d->sqlWriter.appendIdentifier(f->name()) << '=';
+            d->sqlWriter.appendValue(f, parameters.at(i));
+            i++;
+        }
+        d->sqlWriter << " WHERE ";
+        d->sqlWriter.appendIdentifier(d->driver->behavior()->ROW_ID_FIELD_NAME) << '=';
+        d->sqlWriter.appendValue(KDbField::BigInteger, (*data)[data->size() - 1]);
+        sql = d->sqlWriter.toString();
     }
-    sql += (sqlset + " WHERE " + sqlwhere);
     //kdbDebug() << " -- SQL == " << ((sql.length() > 400) ? (sql.left(400) + "[.....]") : sql);
 
     // preprocessing before update
     if (!drv_beforeUpdate(mt->name(), &affectedFields))
         return false;
 
-    bool res = executeSql(sql);
+    const bool grouped = d->beginWriteBehindStatement();
+    bool res;
+    qint64 size;
+    if (pkey) {
+        res = d->executeRecordStatement(KDbPreparedStatement::UpdateStatement, mt,
+                                        *affectedFields.fields(), pkey, parameters, &size);
+    } else {
+        res = executeSql(sql);
+        size = sql.length();
+    }
+    const bool committed = d->endWriteBehindStatement(grouped, &res, size);
 
     // postprocessing after update
     if (!drv_afterUpdate(mt->name(), &affectedFields))
@@ -3191,6 +3775,9 @@ bool KDbConnection::updateRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
                              tr("Record updating on the server failed."));
         return false;
     }
+    if (!committed) { // result describes failed commit of write-behind group
+        return false;
+    }
     //success: now also assign new values in memory:
     QHash<KDbQueryColumnInfo*, int> columnsOrderExpanded;
     updateRecordDataWithNewValues(this, query, data, b, &columnsOrderExpanded);
@@ -3206,6 +3793,12 @@ bool KDbConnection::insertRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
     if (buf.dbBuffer().isEmpty()) {
       kdbDebug() << " -- NO CHANGES DATA!";
       return true; }*/
+    if (query->isGrouped()) {
+        kdbWarning() << " -- GROUPED QUERY!";
+        m_result = KDbResult(ERR_INSERT_NO_MASTER_TABLE,
+                             tr("Could not insert record because records of grouped query cannot be modified."));
+        return false;
+    }
     KDbTableSchema *mt = query->masterTable();
     if (!mt) {
         kdbWarning() << " -- NO MASTER TABLE!";
@@ -3219,14 +3812,7 @@ bool KDbConnection::insertRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
         kdbWarning() << " -- WARNING: NO MASTER TABLE's PKEY";
     }
 
-    KDbEscapedString sqlcols, sqlvals;
-    sqlcols.reserve(1024);
-    sqlvals.reserve(1024);
-
     //insert the record:
-    KDbEscapedString sql;
-    sql.reserve(4096);
-    sql = KDbEscapedString("INSERT INTO ") + escapeIdentifier(mt->name()) + " (";
     KDbRecordEditBuffer::DbHash b = buf->dbBuffer();
 
     // add default values, if available (for any column without value explicitly set)
@@ -3277,8 +3863,6 @@ bool KDbConnection::insertRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
                 anyField = pkey->fields()->first();
             }
         }
-        sqlcols += escapeIdentifier(anyField->name());
-        sqlvals += d->driver->valueToSql(anyField, QVariant()/*NULL*/);
         const bool affectedFieldsAddOk = affectedFields.addField(anyField);
         Q_ASSERT(affectedFieldsAddOk);
     } else {
@@ -3286,25 +3870,42 @@ bool KDbConnection::insertRecord(KDbQuerySchema* query, KDbRecordData* data, KDb
         for (KDbRecordEditBuffer::DbHash::ConstIterator it = b.constBegin();it != b.constEnd();++it) {
             if (it.key()->field()->table() != mt)
                 continue; // skip values for fields outside of the master table (e.g. a "visible value" of the lookup field)
-            if (!sqlcols.isEmpty()) {
-                sqlcols += ',';
-                sqlvals += ',';
-            }
             KDbField* currentField = it.key()->field();
             const bool affectedFieldsAddOk = affectedFields.addField(currentField);
             Q_ASSERT(affectedFieldsAddOk);
-            sqlcols += escapeIdentifier(currentField->name());
-            sqlvals += d->driver->valueToSql(currentField, it.value());
         }
     }
-    sql += (sqlcols + ") VALUES (" + sqlvals + ')');
+    // columns and values are written in order of affectedFields
+    d->sqlWriter.clear();
+    d->sqlWriter << "INSERT INTO ";
+    d->sqlWriter.appendIdentifier(mt->name()) << " (";
+    d->sqlWriter.appendFieldNames(*affectedFields.fields()) << ") VALUES (";
+    if (b.isEmpty()) {
+        d->sqlWriter.appendValue(affectedFields.field(0), QVariant()/*NULL*/);
+    } else {
+        bool first = true;
+        for (KDbRecordEditBuffer::DbHash::ConstIterator it = b.constBegin();it != b.constEnd();++it) {
+            if (it.key()->field()->table() != mt)
+                continue;
+            if (!first) {
+                d->sqlWriter << ',';
+            }
+            first = false;
+            d->sqlWriter.appendValue(it.key()->field(), it.value());
+        }
+    }
+    d->sqlWriter << ')';
+    const KDbEscapedString sql(d->sqlWriter.toString());
 // kdbDebug() << " -- SQL == " << sql;
 
     // low-level insert
     QSharedPointer<KDbSqlResult> result = insertRecordInternal(mt->name(), &affectedFields, sql);
     if (!result) {
-        m_result = KDbResult(ERR_INSERT_SERVER_ERROR,
-                             tr("Record inserting on the server failed."));
+        // keep result of failed commit of write-behind group
+        if (m_result.code() != ERR_ROLLBACK_OR_COMMIT_TRANSACTION) {
+            m_result = KDbResult(ERR_INSERT_SERVER_ERROR,
+                                 tr("Record inserting on the server failed."));
+        }
         return false;
     }
     //success: now also assign a new value in memory:
@@ -3364,6 +3965,12 @@ bool KDbConnection::deleteRecord(KDbQuerySchema* query, KDbRecordData* data, boo
 {
 // Each SQL identifier needs to be escaped in the generated query.
     clearResult();
+    if (query->isGrouped()) {
+        kdbWarning() << " -- GROUPED QUERY!";
+        m_result = KDbResult(ERR_DELETE_NO_MASTER_TABLE,
+                             tr("Could not delete record because records of grouped query cannot be modified."));
+        return false;
+    }
     KDbTableSchema *mt = query->masterTable();
     if (!mt) {
         kdbWarning() << " -- NO MASTER TABLE!";
@@ -3381,12 +3988,9 @@ bool KDbConnection::deleteRecord(KDbQuerySchema* query, KDbRecordData* data, boo
         return false;
     }
 
-    //update the record:
+    //delete the record:
     KDbEscapedString sql;
-    sql.reserve(4096);
-    sql = KDbEscapedString("DELETE FROM ") + escapeIdentifier(mt->name()) + " WHERE ";
-    KDbEscapedString sqlwhere;
-    sqlwhere.reserve(1024);
+    KDbPreparedStatementParameters parameters; // primary key values for prepared statement
 
     if (pkey) {
         const QVector<int> pkeyFieldsOrder(query->pkeyFieldsOrder(this));
@@ -3399,8 +4003,6 @@ bool KDbConnection::deleteRecord(KDbQuerySchema* query, KDbRecordData* data, boo
         }
         int i = 0;
         foreach(KDbField *f, *pkey->fields()) {
-            if (!sqlwhere.isEmpty())
-                sqlwhere += " AND ";
             QVariant val(data->at(pkeyFieldsOrder.at(i)));
             if (val.isNull() || !val.isValid()) {
                 m_result = KDbResult(ERR_DELETE_NULL_PKEY_FIELD,
@@ -3408,30 +4010,43 @@ bool KDbConnection::deleteRecord(KDbQuerySchema* query, KDbRecordData* data, boo
 //js todo: pass the field's name somewhere!
                 return false;
             }
-            sqlwhere += KDbEscapedString(escapeIdentifier(f->name())) + '=' +
-                         d->driver->valueToSql(f, val);
+            parameters.append(val);
             i++;
         }
-    } else {//use RecordId
-        sqlwhere = KDbEscapedString(escapeIdentifier(d->driver->behavior()->ROW_ID_FIELD_NAME)) + '='
-                    + d->driver->valueToSql(KDbField::BigInteger, (*data)[data->size() - 1]);
+    } else {//use RecordId: it is not a field so the statement can't be prepared
+        d->sqlWriter.clear();
+        d->sqlWriter << "DELETE FROM ";
+        d->sqlWriter.appendIdentifier(mt->name()) << " WHERE ";
+        d->sqlWriter.appendIdentifier(d->driver->behavior()->ROW_ID_FIELD_NAME) << '=';
+        d->sqlWriter.appendValue(KDbField::BigInteger, (*data)[data->size() - 1]);
+        sql = d->sqlWriter.toString();
     }
-    sql += sqlwhere;
     //kdbDebug() << " -- SQL == " << sql;
 
-    if (!executeSql(sql)) {
+    const bool grouped = d->beginWriteBehindStatement();
+    bool res;
+    qint64 size;
+    if (pkey) {
+        res = d->executeRecordStatement(KDbPreparedStatement::DeleteStatement, mt,
+                                        KDbField::List(false), pkey, parameters, &size);
+    } else {
+        res = executeSql(sql);
+        size = sql.length();
+    }
+    const bool committed = d->endWriteBehindStatement(grouped, &res, size);
+    if (!res) {
         m_result = KDbResult(ERR_DELETE_SERVER_ERROR,
                              tr("Record deletion on the server failed."));
         return false;
     }
-    return true;
+    return committed; // if false, result describes failed commit of write-behind group
 }
 
 bool KDbConnection::deleteAllRecords(KDbQuerySchema* query)
 {
     clearResult();
     KDbTableSchema *mt = query->masterTable();
-    if (!mt) {
+    if (!mt || query->isGrouped()) {
         kdbWarning() << " -- NO MASTER TABLE!";
         return false;
     }
@@ -3439,7 +4054,10 @@ bool KDbConnection::deleteAllRecords(KDbQuerySchema* query)
     if (!pkey || pkey->fields()->isEmpty()) {
         kdbWarning() << "-- WARNING: NO MASTER TABLE's PKEY";
     }
-    KDbEscapedString sql = KDbEscapedString("DELETE FROM ") + escapeIdentifier(mt->name());
+    d->sqlWriter.clear();
+    d->sqlWriter << "DELETE FROM ";
+    d->sqlWriter.appendIdentifier(mt->name());
+    const KDbEscapedString sql(d->sqlWriter.toString());
     //kdbDebug() << "-- SQL == " << sql;
 
     if (!executeSql(sql)) {
@@ -3528,6 +4146,68 @@ KDbPreparedStatement KDbConnection::prepareStatement(KDbPreparedStatement::Type
     return KDbPreparedStatement(iface, type, fields, whereFieldNames);
 }
 
+KDbBlobStream* KDbConnection::openBlob(KDbTableSchema *table, const QString &fieldName,
+                                       const QList<QVariant> &primaryKeyValues,
+                                       QIODevice::OpenMode mode)
+{
+    clearResult();
+    if (!table || !checkIsDatabaseUsed()) {
+        return nullptr;
+    }
+    KDbField *field = table->field(fieldName);
+    if (!field || field->type() != KDbField::BLOB) {
+        m_result = KDbResult(ERR_OBJECT_NOT_FOUND,
+                             tr("Table \"%1\" has no BLOB field \"%2\".")
+                                .arg(table->name(), fieldName));
+        return nullptr;
+    }
+    KDbIndexSchema *pkey = table->primaryKey();
+    if (!pkey || pkey->fieldCount() == 0) {
+        m_result = KDbResult(ERR_UPDATE_NO_MASTER_TABLES_PKEY,
+                             tr("Table \"%1\" has no primary key.").arg(table->name()));
+        return nullptr;
+    }
+    if (pkey->fieldCount() != primaryKeyValues.count()) {
+        m_result = KDbResult(ERR_UPDATE_NO_ENTIRE_MASTER_TABLES_PKEY,
+                             tr("Values of all primary key's fields of table \"%1\" are required.")
+                                .arg(table->name()));
+        return nullptr;
+    }
+    KDbEscapedString where;
+    for (int i = 0; i < pkey->fieldCount(); ++i) {
+        const KDbField *f = pkey->field(i);
+        if (i > 0) {
+            where += " AND ";
+        }
+        where += KDbEscapedString(escapeIdentifier(f->name())) + '='
+                 + d->driver->valueToSql(f, primaryKeyValues.at(i));
+    }
+    KDbBlobInterfaceFactory *factory = dynamic_cast<KDbBlobInterfaceFactory*>(this);
+    KDbBlobInterface *iface = factory ? factory->createBlobInterface() : nullptr;
+    if (!iface) {
+        m_result = KDbResult(ERR_UNSUPPORTED_DRV_FEATURE,
+                             tr("Incremental access to BLOB values is not supported by the "
+                                "database driver."));
+        return nullptr;
+    }
+    qint64 size = -1;
+    if (iface->open(table, field, where, bool(mode & QIODevice::WriteOnly))) {
+        size = iface->size();
+    }
+    if (size < 0) {
+        m_result = iface->result();
+        delete iface;
+        return nullptr;
+    }
+    return new KDbBlobStream(iface, size, mode);
+}
+
+KDbBlobStream* KDbConnection::openBlob(KDbTableSchema *table, const QString &fieldName,
+                                       const QVariant &primaryKeyValue, QIODevice::OpenMode mode)
+{
+    return openBlob(table, fieldName, QList<QVariant>() << primaryKeyValue, mode);
+}
+
 KDbEscapedString KDbConnection::recentSqlString() const {
     return result().errorSql().isEmpty() ? m_result.sql() : result().errorSql();
 }
@@ -27,6 +27,9 @@
 #include "KDbTransaction.h"
 #include "KDbTristate.h"
 
+#include <QIODevice>
+
+class KDbBlobStream;
 class KDbConnectionData;
 class KDbConnectionOptions;
 class KDbConnectionPrivate;
@@ -265,6 +268,17 @@ public:
      * For drivers that allow multiple transactions per connection no default transaction is
      * set automatically in beginTransaction(). setDefaultTransaction() can be called by hand.
      *
+     * If the default transaction is active and the driver supports nested transactions
+     * (KDbDriver::NestedTransactions feature), a nested transaction is started using
+     * a savepoint (see KDbTransaction::isNested()). Committing a nested transaction makes its
+     * changes part of the enclosing transaction, rolling it back undoes only its changes.
+     * Committing or rolling back a transaction ends all transactions nested in it.
+     * Internal operations that need transactions, such as createTable(), use nested
+     * transactions to join the caller's transaction instead of committing it, except for
+     * drivers that commit transactions implicitly on data definition statements
+     * (see KDbDriverBehavior::DDL_COMMITS_TRANSACTION). For these drivers such statements
+     * should not be executed within nested transactions.
+     *
      * @see setDefaultTransaction(), defaultTransaction().
      */
     KDbTransaction beginTransaction();
@@ -354,7 +368,7 @@ public:
      For other drivers set this option off if you need use transaction
      for grouping more statements together.
 
-     NOTE: nested transactions are not yet implemented in KDb API.
+     @see beginTransaction() for information about nested transactions.
     */
     bool autoCommit() const;
 
@@ -363,6 +377,96 @@ public:
      @see autoCommit() */
     bool setAutoCommit(bool on);
 
+    /**
+     * @return @c true if write-behind mode is enabled for this connection
+     *
+     * In auto commit mode every record inserted, updated or deleted using insertRecord(),
+     * updateRecord() or deleteRecord() is committed separately, what costs a durable write
+     * (e.g. fsync for SQLite) per record. In write-behind mode such writes are coalesced into
+     * group transactions that are committed when writeBehindRecordLimit() records or
+     * writeBehindSizeLimit() bytes of SQL statements are collected, when a write happens
+     * later than writeBehindTimeLimit() milliseconds after the first one of the group,
+     * or when flush() is called.
+     *
+     * Each write is still executed immediately, so the call that writes a record reports
+     * its own failure and the failure does not affect other records of the group. Records
+     * become visible for other connections only after the group is committed though.
+     * If committing fails, all records of the group are lost; flush() or the write that
+     * triggered the commit then fails with ERR_ROLLBACK_OR_COMMIT_TRANSACTION error and
+     * a message containing number of the lost records.
+     *
+     * The group is also committed before beginTransaction(), before operations that change
+     * database schema, and on closing the database. Write-behind mode has no effect if auto
+     * commit is off, if a transaction has been started by the caller, or if the driver does
+     * not support transactions. It is disabled by default.
+     *
+     * @see autoCommit(), pendingWriteCount()
+     * @since 3.3
+     */
+    bool isWriteBehindEnabled() const;
+
+    /*! Enables or disables write-behind mode. Records written so far are committed when
+     the mode is disabled.
+     @return false if committing failed.
+     @see isWriteBehindEnabled()
+     @since 3.3 */
+    bool setWriteBehindEnabled(bool set);
+
+    /*! @return maximum number of records written in a write-behind group transaction,
+     1000 by default. @see isWriteBehindEnabled()
+     @since 3.3 */
+    int writeBehindRecordLimit() const;
+
+    /*! Sets maximum number of records written in a write-behind group transaction to @a count.
+     @since 3.3 */
+    void setWriteBehindRecordLimit(int count);
+
+    /*! @return maximum total size in bytes of SQL statements executed in a write-behind group
+     transaction, 1048576 by default. @see isWriteBehindEnabled()
+     @since 3.3 */
+    int writeBehindSizeLimit() const;
+
+    /*! Sets maximum total size in bytes of SQL statements executed in a write-behind group
+     transaction to @a bytes.
+     @since 3.3 */
+    void setWriteBehindSizeLimit(int bytes);
+
+    /*! @return time in milliseconds after which a write-behind group transaction is committed,
+     1000 by default. The time is checked on every write, call flush() to commit records
+     when the application becomes idle. @see isWriteBehindEnabled()
+     @since 3.3 */
+    int writeBehindTimeLimit() const;
+
+    /*! Sets time in milliseconds after which a write-behind group transaction is committed
+     to @a msec.
+     @since 3.3 */
+    void setWriteBehindTimeLimit(int msec);
+
+    /*! @return number of records written in write-behind mode that are not committed yet.
+     @see isWriteBehindEnabled()
+     @since 3.3 */
+    int pendingWriteCount() const;
+
+    /*! Commits records written in write-behind mode. Does nothing if there are no such records.
+     @return false if committing failed. result() then contains number of the lost records.
+     @see isWriteBehindEnabled()
+     @since 3.3 */
+    bool flush();
+
+    /*! @return default maximum size in bytes of records kept in memory by each buffered
+     cursor of this connection, 0 (no limit) by default. Records beyond the limit are stored
+     in a temporary file. Drivers that always buffer results (e.g. PostgreSQL and MySQL)
+     fetch records from the server one by one when the limit is set, what keeps the
+     connection busy while such cursor is open, see the note in KDbCursor::memoryBudget().
+     @see KDbCursor::memoryBudget()
+     @since 3.3 */
+    qint64 cursorMemoryBudget() const;
+
+    /*! Sets default maximum size in bytes of records kept in memory by each buffered cursor
+     to @a bytes. Affects cursors created later. 0 or negative value removes the limit.
+     @since 3.3 */
+    void setCursorMemoryBudget(qint64 bytes);
+
     /*! Connection-specific string escaping. Default implementation uses driver's escaping.
      Use KDbEscapedString::isValid() to check if escaping has been performed successfully.
      Invalid strings are set to null in addition, that is KDbEscapedString::isNull() is true,
@@ -623,7 +727,12 @@ public:
     //! @since 3.1
     enum class CreateTableOption {
         Default = 0,
-        DropDestination = 1 //!< Drop destination table if exists
+        DropDestination = 1, //!< Drop destination table if exists
+        IndexForeignKeys = 2, //!< Index foreign key fields, see createIndices() (@since 3.3)
+        IndexLookupFields = 4, //!< Index fields having lookup defined, see createIndices()
+                               //!< (@since 3.3)
+        SkipIndices = 8 //!< Do not create indices, createIndices() should be called later,
+                        //!< e.g. after the table is renamed (@since 3.3)
     };
     Q_DECLARE_FLAGS(CreateTableOptions, CreateTableOption)
 
@@ -643,6 +752,9 @@ public:
      *
      * Table and column definitions are added to "Kexi system" tables.
      *
+     * Unless @a options include the SkipIndices value, indices of the table are created as well
+     * using createIndices(@a tableSchema, @a options).
+     *
      * Prior to dropping the method checks if the table for the schema is in use, and if the new
      * schema defines at least one column.
      *
@@ -657,6 +769,54 @@ public:
     bool createTable(KDbTableSchema *tableSchema,
                      CreateTableOptions options = CreateTableOption::Default);
 
+    /**
+     * @brief Creates database indices for table @a tableSchema
+     *
+     * Primary keys and unique fields are indexed by the CREATE TABLE statement. This method
+     * creates the remaining indices:
+     * - a single-field index for every field with the Indexed constraint set (see
+     *   KDbField::isIndexed()) that is not a primary key or unique,
+     * - every index added to the table using KDbTableSchema::addIndex() that is not a primary key,
+     *   except indices of foreign keys (see KDbIndexSchema::isForeignKey()).
+     *
+     * If @a options include the IndexForeignKeys value, fields being foreign keys (see
+     * KDbField::isForeignKey()) are indexed and indices of foreign keys defined by relationships
+     * are created. If @a options include the IndexLookupFields value, fields having lookup
+     * defined (see KDbTableSchema::lookupFieldSchema()) are indexed. This speeds up lookups and
+     * joins that otherwise need to scan the whole table. The Indexed constraint of these fields
+     * is not changed, so the options have to be passed again when the table is re-created.
+     *
+     * This method is called by createTable() so it only needs to be called by hand for tables
+     * created with the SkipIndices option.
+     * @return true on success.
+     * @since 3.3
+     */
+    bool createIndices(KDbTableSchema *tableSchema,
+                       CreateTableOptions options = CreateTableOption::Default);
+
+    /**
+     * @brief Creates database index defined by @a index
+     *
+     * @a index has to be added to a table of this connection using KDbTableSchema::addIndex()
+     * and can't be a primary key. Name of the index in the database is
+     * KDbNativeStatementBuilder::indexName(*@a index).
+     * @return true on success.
+     * @since 3.3
+     */
+    bool createIndex(KDbIndexSchema *index);
+
+    /**
+     * @brief Drops database index defined by @a index
+     *
+     * On success @a index is removed from its table schema and destroyed.
+     * Primary keys and indices auto-generated for unique or indexed fields (see
+     * KDbIndexSchema::isAutoGenerated()) can't be dropped this way; alter the table using
+     * KDbAlterTableHandler instead.
+     * @return true on success.
+     * @since 3.3
+     */
+    bool dropIndex(KDbIndexSchema *index);
+
     /*! Creates a copy of table schema defined by @a tableSchema with data.
      Name, caption and description will be copied from @a newData.
      @return a table schema object. It is inserted into the KDbConnection structures
@@ -836,6 +996,23 @@ public:
      */
     bool executeSql(const KDbEscapedString& sql);
 
+    /**
+     * Requests cancellation of a statement that is being executed by this connection
+     *
+     * Unlike other methods of KDbConnection this one can be called from a thread different
+     * than the one that executes the statement. The statement then fails with an error.
+     * Nothing happens if no statement is being executed.
+     *
+     * @return @c true if the request has been delivered to the database backend, @c false if
+     * the driver does not support cancellation or the connection is not established.
+     * Result of this connection is not altered.
+     * Drivers support cancellation by implementing KDbCancelQueryInterface in their connection
+     * class.
+     * @see KDbConnectionWorker
+     * @since 3.3
+     */
+    bool cancelQuery();
+
     /*! Stores object (id, name, caption, description)
     described by @a object on the backend. It is expected that entry on the
     backend already exists, so it's updated. Changes to identifier attribute are not allowed.
@@ -898,6 +1075,28 @@ public:
     KDbPreparedStatement prepareStatement(KDbPreparedStatement::Type type,
         KDbFieldList* fields, const QStringList& whereFieldNames = QStringList());
 
+    /*! Opens value of BLOB field @a fieldName in the record of @a table identified by values
+     @a primaryKeyValues of the table's primary key, for incremental reading or writing
+     depending on @a mode. Ranges of the value are transferred directly, so the value does not
+     have to fit in memory. Writing to the device enlarges the value if needed.
+     ERR_UNSUPPORTED_DRV_FEATURE error is set if the driver does not support incremental
+     BLOB access, ERR_OBJECT_NOT_FOUND if the field or the record does not exist.
+     Drivers support it by implementing KDbBlobInterfaceFactory in their connection class.
+     @return opened device or @c nullptr on error. Ownership of the device is passed
+     to the caller.
+     @see KDbBlobStream
+     @since 3.3 */
+    Q_REQUIRED_RESULT KDbBlobStream* openBlob(KDbTableSchema *table, const QString &fieldName,
+                                             const QList<QVariant> &primaryKeyValues,
+                                             QIODevice::OpenMode mode = QIODevice::ReadOnly);
+
+    /*! @overload
+     For tables with single-field primary key with value @a primaryKeyValue.
+     @since 3.3 */
+    Q_REQUIRED_RESULT KDbBlobStream* openBlob(KDbTableSchema *table, const QString &fieldName,
+                                             const QVariant &primaryKeyValue,
+                                             QIODevice::OpenMode mode = QIODevice::ReadOnly);
+
     bool isInternalTableSchema(const QString& tableName);
 
     /**
@@ -1291,7 +1490,10 @@ protected:
      and there is already transaction started, it is committed before
      starting a new one, but only if this transaction has been started inside KDbConnection object.
      (i.e. by beginAutoCommitTransaction()). Otherwise, a new transaction will not be started,
-     but true will be returned immediately.
+     but true will be returned immediately. If the driver supports nested transactions
+     (KDbDriver::NestedTransactions), a nested transaction is started within the external
+     transaction instead, unless data definition statements of the driver commit transactions
+     implicitly (see KDbDriverBehavior::DDL_COMMITS_TRANSACTION).
     */
     bool beginAutoCommitTransaction(KDbTransactionGuard* tg);
 
@@ -1396,6 +1598,14 @@ protected:
      @return true on success and false on failure. */
     bool storeMainFieldSchema(KDbField *field);
 
+    /*! @internal
+     Stores main schema information for all fields of @a tableSchema, replacing information
+     stored previously for the table. Used when fields have been inserted, removed or renamed
+     by altering the table in place.
+     @return true on success and false on failure.
+     @since 3.3 */
+    bool storeMainFieldsSchema(KDbTableSchema *tableSchema);
+
     //- - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
 
     /*! This is a part of alter table interface implementing lower-level operations
@@ -1434,6 +1644,7 @@ private:
     friend class KDbConnectionProxy;
     friend class KDbCursor;
     friend class KDbDriver;
+    friend class KDbPreparedStatement; //!< for write-behind mode of executeBatch()
     friend class KDbProperties; //!< for setError()
     friend class KDbQuerySchema;
     friend class KDbQuerySchemaPrivate;
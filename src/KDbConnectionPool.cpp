@@ -0,0 +1,413 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbConnectionPool.h"
+#include "KDbConnection.h"
+#include "KDbDriver.h"
+#include "KDbDriverManager.h"
+#include "KDbError.h"
+#include "KDbTransaction.h"
+#include "kdb_debug.h"
+
+#include <climits>
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
+
+namespace {
+//! A connection owned by the pool
+struct PooledConnection {
+    KDbConnection *connection = nullptr;
+    int useCount = 0; //!< number of nested acquire() calls in the owning thread
+    QElapsedTimer idleTimer; //!< started when the connection becomes idle
+};
+}
+
+class Q_DECL_HIDDEN KDbConnectionPool::Private
+{
+public:
+    Private() {}
+
+    //! @return number of open connections and connections being created
+    int count() const
+    {
+        return busy.count() + idle.count() + creating;
+    }
+
+    //! Moves idle connections that exceeded maximumIdleTime from the idle list to @a expired.
+    //! Has to be called with mutex locked.
+    void takeExpired(QList<PooledConnection*> *expired)
+    {
+        if (maximumIdleTime < 0) {
+            return;
+        }
+        // the idle list is sorted by time of release, oldest first
+        while (!idle.isEmpty() && idle.first()->idleTimer.hasExpired(maximumIdleTime)) {
+            expired->append(idle.takeFirst());
+        }
+    }
+
+    //! Closes and deletes connections of @a list. Has to be called with mutex unlocked.
+    void destroy(const QList<PooledConnection*> &list)
+    {
+        for (PooledConnection *pooled : list) {
+            pooled->connection->disconnect();
+            {
+                // ~KDbConnection() unregisters the connection from the driver
+                QMutexLocker locker(&driverMutex);
+                delete pooled->connection;
+            }
+            delete pooled;
+        }
+    }
+
+    //! @return @c true if @a pooled connection is usable. The database is queried if the
+    //! connection was idle for longer than @a checkInterval. Has to be called with mutex unlocked.
+    static bool isHealthy(PooledConnection *pooled, int checkInterval)
+    {
+        KDbConnection *conn = pooled->connection;
+        if (!conn->isConnected() || !conn->isDatabaseUsed()) {
+            return false;
+        }
+        if (checkInterval > 0 && !pooled->idleTimer.hasExpired(checkInterval)) {
+            return true;
+        }
+        int number;
+        return true == conn->querySingleNumber(KDbEscapedString("SELECT 1"), &number);
+    }
+
+    KDbConnectionData data;
+    QString databaseName;
+    KDbConnectionOptions options;
+    KDbDriver *driver = nullptr;
+    int maximumConnectionCount = 16;
+    int maximumIdleTime = 300000;
+    int healthCheckInterval = 5000;
+    bool kexiCompatible = true;
+
+    //! Guards all members above and below, and the pool's result
+    mutable QMutex mutex;
+    //! Signalled when a connection is released or destroyed
+    QWaitCondition connectionAvailable;
+    //! Connections used by threads
+    QHash<QThread*, PooledConnection*> busy;
+    //! Idle connections, most recently released last
+    QList<PooledConnection*> idle;
+    //! Number of connections being created outside of the lock
+    int creating = 0;
+
+    //! Serializes creation and deletion of connections since KDbDriver is not thread-safe
+    QMutex driverMutex;
+
+private:
+    Q_DISABLE_COPY(Private)
+};
+
+KDbConnectionPool::KDbConnectionPool(const KDbConnectionData &data,
+                                     const QString &databaseName,
+                                     const KDbConnectionOptions &options)
+    : d(new Private)
+{
+    d->data = data;
+    d->databaseName = databaseName.isEmpty() ? data.databaseName() : databaseName;
+    d->options = options;
+    // drivers can only be loaded in the main thread
+    KDbDriverManager manager;
+    d->driver = manager.driver(data.driverId());
+    if (!d->driver) {
+        m_result = manager.result();
+        m_result.prependMessage(tr("Could not create pool of database connections."));
+    }
+}
+
+KDbConnectionPool::~KDbConnectionPool()
+{
+    QList<PooledConnection*> all;
+    {
+        QMutexLocker locker(&d->mutex);
+        Q_ASSERT_X(d->busy.isEmpty(), "KDbConnectionPool::~KDbConnectionPool",
+                   "Connections have to be released before destroying the pool");
+        all = d->idle + d->busy.values();
+        d->idle.clear();
+        d->busy.clear();
+    }
+    d->destroy(all);
+    delete d;
+}
+
+KDbResult KDbConnectionPool::result() const
+{
+    QMutexLocker locker(&d->mutex);
+    return m_result;
+}
+
+KDbConnectionData KDbConnectionPool::data() const
+{
+    return d->data;
+}
+
+QString KDbConnectionPool::databaseName() const
+{
+    return d->databaseName;
+}
+
+int KDbConnectionPool::maximumConnectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->maximumConnectionCount;
+}
+
+void KDbConnectionPool::setMaximumConnectionCount(int count)
+{
+    QMutexLocker locker(&d->mutex);
+    d->maximumConnectionCount = count;
+    d->connectionAvailable.wakeAll();
+}
+
+int KDbConnectionPool::maximumIdleTime() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->maximumIdleTime;
+}
+
+void KDbConnectionPool::setMaximumIdleTime(int msec)
+{
+    QMutexLocker locker(&d->mutex);
+    d->maximumIdleTime = msec;
+}
+
+int KDbConnectionPool::healthCheckInterval() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->healthCheckInterval;
+}
+
+void KDbConnectionPool::setHealthCheckInterval(int msec)
+{
+    QMutexLocker locker(&d->mutex);
+    d->healthCheckInterval = qMax(0, msec);
+}
+
+bool KDbConnectionPool::isKexiCompatible() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->kexiCompatible;
+}
+
+void KDbConnectionPool::setKexiCompatible(bool set)
+{
+    QMutexLocker locker(&d->mutex);
+    d->kexiCompatible = set;
+}
+
+KDbConnection* KDbConnectionPool::acquire(int timeout)
+{
+    QThread *thread = QThread::currentThread();
+    QElapsedTimer waitTimer;
+    waitTimer.start();
+    QList<PooledConnection*> expired;
+    QMutexLocker locker(&d->mutex);
+    if (!d->driver) {
+        return nullptr;
+    }
+    PooledConnection *pooled = d->busy.value(thread);
+    if (pooled) { // nested acquire() in the same thread
+        ++pooled->useCount;
+        return pooled->connection;
+    }
+    while (true) {
+        d->takeExpired(&expired);
+        if (!expired.isEmpty()) {
+            locker.unlock();
+            d->destroy(expired);
+            expired.clear();
+            locker.relock();
+            d->connectionAvailable.wakeAll();
+        }
+        if (!d->idle.isEmpty()) {
+            pooled = d->idle.takeLast();
+            pooled->useCount = 1;
+            d->busy.insert(thread, pooled);
+            const int checkInterval = d->healthCheckInterval;
+            locker.unlock();
+            if (Private::isHealthy(pooled, checkInterval)) {
+                return pooled->connection;
+            }
+            kdbWarning() << "Closing broken pooled connection" << pooled->connection->result();
+            locker.relock();
+            d->busy.remove(thread);
+            locker.unlock();
+            d->destroy(QList<PooledConnection*>() << pooled);
+            locker.relock();
+            d->connectionAvailable.wakeAll();
+            continue;
+        }
+        if (d->maximumConnectionCount <= 0 || d->count() < d->maximumConnectionCount) {
+            break;
+        }
+        const qint64 remaining = timeout < 0 ? -1 : timeout - waitTimer.elapsed();
+        if (timeout >= 0 && remaining <= 0) {
+            m_result = KDbResult(ERR_OTHER,
+                                 tr("Timed out waiting for a database connection from the pool."));
+            return nullptr;
+        }
+        d->connectionAvailable.wait(&d->mutex, remaining < 0 ? ULONG_MAX : ulong(remaining));
+    }
+
+    // create new connection outside of the lock, reserving a slot for it
+    ++d->creating;
+    const bool kexiCompatible = d->kexiCompatible;
+    locker.unlock();
+    KDbResult result;
+    KDbConnection *conn;
+    {
+        QMutexLocker driverLocker(&d->driverMutex);
+        conn = d->driver->createConnection(d->data, d->options);
+        if (!conn) {
+            result = d->driver->result();
+        }
+    }
+    if (conn && (!conn->connect() || !conn->useDatabase(d->databaseName, kexiCompatible))) {
+        result = conn->result();
+        conn->disconnect();
+        QMutexLocker driverLocker(&d->driverMutex);
+        delete conn;
+        conn = nullptr;
+    }
+    locker.relock();
+    --d->creating;
+    if (!conn) {
+        m_result = result;
+        m_result.prependMessage(tr("Could not create pooled database connection."));
+        d->connectionAvailable.wakeOne();
+        return nullptr;
+    }
+    pooled = new PooledConnection;
+    pooled->connection = conn;
+    pooled->useCount = 1;
+    d->busy.insert(thread, pooled);
+    return conn;
+}
+
+void KDbConnectionPool::release(KDbConnection *connection)
+{
+    if (!connection) {
+        return;
+    }
+    QThread *thread = QThread::currentThread();
+    QMutexLocker locker(&d->mutex);
+    PooledConnection *pooled = d->busy.value(thread);
+    if (!pooled || pooled->connection != connection) {
+        kdbWarning() << "Connection" << connection << "was not acquired from the pool by this thread";
+        return;
+    }
+    if (--pooled->useCount > 0) {
+        return;
+    }
+    d->busy.remove(thread);
+    locker.unlock();
+    // commit records written in write-behind mode but do not leak uncommitted changes
+    // of other transactions to the next user of the connection
+    if (!connection->flush()) {
+        kdbWarning() << connection->result();
+    }
+    const KDbTransaction trans = connection->defaultTransaction();
+    if (trans.isActive()) {
+        connection->rollbackTransaction(trans);
+    }
+    locker.relock();
+    pooled->idleTimer.start();
+    d->idle.append(pooled);
+    d->connectionAvailable.wakeOne();
+    QList<PooledConnection*> expired;
+    d->takeExpired(&expired);
+    locker.unlock();
+    d->destroy(expired);
+}
+
+int KDbConnectionPool::connectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->busy.count() + d->idle.count();
+}
+
+int KDbConnectionPool::idleConnectionCount() const
+{
+    QMutexLocker locker(&d->mutex);
+    return d->idle.count();
+}
+
+void KDbConnectionPool::evictIdleConnections()
+{
+    QList<PooledConnection*> expired;
+    {
+        QMutexLocker locker(&d->mutex);
+        d->takeExpired(&expired);
+        if (!expired.isEmpty()) {
+            d->connectionAvailable.wakeAll();
+        }
+    }
+    d->destroy(expired);
+}
+
+void KDbConnectionPool::clear()
+{
+    QList<PooledConnection*> all;
+    {
+        QMutexLocker locker(&d->mutex);
+        all = d->idle;
+        d->idle.clear();
+        d->connectionAvailable.wakeAll();
+    }
+    d->destroy(all);
+}
+
+//---------------------------------
+
+KDbConnectionPoolGuard::KDbConnectionPoolGuard(KDbConnectionPool *pool, int timeout)
+    : m_pool(pool)
+    , m_connection(pool ? pool->acquire(timeout) : nullptr)
+{
+}
+
+KDbConnectionPoolGuard::~KDbConnectionPoolGuard()
+{
+    release();
+}
+
+KDbConnection* KDbConnectionPoolGuard::connection() const
+{
+    return m_connection;
+}
+
+KDbConnection* KDbConnectionPoolGuard::operator->() const
+{
+    return m_connection;
+}
+
+void KDbConnectionPoolGuard::release()
+{
+    if (m_connection) {
+        m_pool->release(m_connection);
+        m_connection = nullptr;
+    }
+}
@@ -0,0 +1,214 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_CONNECTIONPOOL_H
+#define KDB_CONNECTIONPOOL_H
+
+#include <QCoreApplication>
+
+#include "KDbConnectionData.h"
+#include "KDbConnectionOptions.h"
+#include "KDbResult.h"
+
+class KDbConnection;
+
+/**
+ * @brief Thread-safe pool of connections to a single database
+ *
+ * KDbConnection and its cursors are not thread-safe, so every thread that accesses a database
+ * needs its own connection. Creating a connection is expensive: the driver has to connect to
+ * the server or open a file, then KDbConnection::useDatabase() reads the KDb system tables and
+ * database properties. KDbConnectionPool keeps connected connections with the database already
+ * opened and hands them out to threads on demand.
+ *
+ * A connection returned by acquire() is owned by the calling thread until it is passed back
+ * using release(). Nested acquire() calls within the same thread return the same connection;
+ * it is returned to the pool after the matching number of release() calls. This allows
+ * independent parts of code running in one thread to share a connection and its transactions.
+ *
+ * Idle connections are checked for health before they are handed out again, and are closed
+ * when they stay unused longer than maximumIdleTime(). Number of simultaneously open
+ * connections is capped by maximumConnectionCount(); acquire() waits until a connection is
+ * released when the cap is reached.
+ *
+ * Schema objects such as KDbTableSchema are owned by the connection that loaded them and must
+ * not be used with other connections of the pool. Schema metadata is not shared between pooled
+ * connections even if it does not change: each connection loads its own copy lazily, only once
+ * though, so the loading cost is paid once per connection and not once per request.
+ *
+ * The pool has to outlive all connections it hands out. Every acquired connection has to be
+ * released before the pool is destroyed, since the connections are deleted with the pool.
+ *
+ * @note For SQLite databases accessed by many threads at once consider enabling the
+ * write-ahead log (PRAGMA journal_mode=WAL), so readers do not block the writer.
+ *
+ * Example usage:
+ * <code>
+ *  KDbConnectionPool pool(connData);
+ *  // ... in any thread:
+ *  KDbConnectionPoolGuard guard(&pool);
+ *  if (!guard.connection()) {
+ *      return; // pool.result() contains the error
+ *  }
+ *  KDbCursor *cursor = guard.connection()->executeQuery(sql);
+ *  // ...
+ * </code>
+ *
+ * The pool has to be created in the main thread because database drivers can only be loaded
+ * there.
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbConnectionPool : public KDbResultable
+{
+    Q_DECLARE_TR_FUNCTIONS(KDbConnectionPool)
+public:
+    /**
+     * @brief Creates a pool of connections defined by @a data
+     *
+     * Connections are created lazily by acquire() using @a options. The database to open is
+     * specified by @a databaseName; if it is empty, KDbConnectionData::databaseName() of
+     * @a data is used. The database driver is loaded immediately; on failure result() contains
+     * the error and acquire() always returns @c nullptr.
+     */
+    explicit KDbConnectionPool(const KDbConnectionData &data,
+                               const QString &databaseName = QString(),
+                               const KDbConnectionOptions &options = KDbConnectionOptions());
+
+    //! Closes and destroys all connections of the pool.
+    //! All connections have to be released before the pool is destroyed, this is asserted.
+    ~KDbConnectionPool() override;
+
+    //! @return result of the most recent failure of the pool
+    //! Unlike KDbResultable::result() this method is thread-safe. The result is shared by all
+    //! threads, so it may describe a failure of acquire() in another thread.
+    KDbResult result() const;
+
+    //! @return connection data used by the pool
+    KDbConnectionData data() const;
+
+    //! @return name of the database opened by connections of the pool
+    QString databaseName() const;
+
+    //! @return maximum number of connections that can be open at the same time
+    //! Default value is 16. Value <= 0 means there is no limit.
+    int maximumConnectionCount() const;
+
+    //! Sets maximum number of connections that can be open at the same time to @a count.
+    //! Connections that are already open are not closed when the limit is decreased.
+    void setMaximumConnectionCount(int count);
+
+    //! @return time in milliseconds after which idle connections are closed
+    //! Default value is 300000 (5 minutes). Value < 0 means idle connections are never closed.
+    int maximumIdleTime() const;
+
+    //! Sets time in milliseconds after which idle connections are closed to @a msec.
+    void setMaximumIdleTime(int msec);
+
+    //! @return time in milliseconds a connection can stay idle before it is checked for health
+    //! Default value is 5000. Value 0 means that health is checked on every acquire().
+    int healthCheckInterval() const;
+
+    //! Sets time in milliseconds a connection can stay idle before it is checked for health
+    //! to @a msec.
+    void setHealthCheckInterval(int msec);
+
+    //! @return @c true if connections open the database in Kexi-compatible mode
+    //! Default value is @c true. @see KDbConnection::useDatabase()
+    bool isKexiCompatible() const;
+
+    //! Sets Kexi-compatible mode for databases opened by newly created connections.
+    void setKexiCompatible(bool set);
+
+    /**
+     * @brief Hands out a connection for the calling thread
+     *
+     * If the calling thread already holds a connection from this pool, the same connection is
+     * returned and its usage counter is incremented. Otherwise an idle connection is reused or
+     * a new one is created, connected and has the database opened.
+     *
+     * If maximumConnectionCount() connections are open already, the call blocks until another
+     * thread releases its connection or until @a timeout milliseconds pass. Negative @a timeout
+     * means waiting without a limit.
+     *
+     * @return the connection or @c nullptr on failure or time out; result() is then set.
+     * result() is not cleared on success since it is shared by all threads.
+     * Every successful call has to be paired with release().
+     */
+    KDbConnection* acquire(int timeout = -1);
+
+    /**
+     * @brief Returns @a connection to the pool
+     *
+     * @a connection has to be acquired by the calling thread. When the last usage of the
+     * connection in this thread is released, uncommitted default transaction of the connection
+     * is rolled back and the connection becomes idle.
+     */
+    void release(KDbConnection *connection);
+
+    //! @return number of connections currently open by the pool, both in use and idle
+    int connectionCount() const;
+
+    //! @return number of idle connections
+    int idleConnectionCount() const;
+
+    //! Closes idle connections that were not used for longer than maximumIdleTime().
+    //! This also happens on every acquire() and release() call.
+    void evictIdleConnections();
+
+    //! Closes all idle connections.
+    void clear();
+
+private:
+    Q_DISABLE_COPY(KDbConnectionPool)
+    class Private;
+    Private * const d;
+};
+
+/**
+ * @brief Acquires connection from a pool and releases it on destruction
+ *
+ * @see KDbConnectionPool
+ * @since 3.3
+ */
+class KDB_EXPORT KDbConnectionPoolGuard
+{
+public:
+    //! Acquires connection from @a pool using KDbConnectionPool::acquire(@a timeout).
+    explicit KDbConnectionPoolGuard(KDbConnectionPool *pool, int timeout = -1);
+
+    //! Releases the connection if it is acquired.
+    ~KDbConnectionPoolGuard();
+
+    //! @return the acquired connection or @c nullptr if acquiring failed
+    KDbConnection* connection() const;
+
+    //! @return the acquired connection
+    KDbConnection* operator->() const;
+
+    //! Releases the connection before destruction. connection() returns @c nullptr then.
+    void release();
+
+private:
+    Q_DISABLE_COPY(KDbConnectionPoolGuard)
+    KDbConnectionPool * const m_pool;
+    KDbConnection *m_connection;
+};
+
+#endif
@@ -443,6 +443,21 @@ bool KDbConnectionProxy::createTable(KDbTableSchema* tableSchema, CreateTableOpt
     return d->connection->createTable(tableSchema, options);
 }
 
+bool KDbConnectionProxy::createIndices(KDbTableSchema *tableSchema, CreateTableOptions options)
+{
+    return d->connection->createIndices(tableSchema, options);
+}
+
+bool KDbConnectionProxy::createIndex(KDbIndexSchema *index)
+{
+    return d->connection->createIndex(index);
+}
+
+bool KDbConnectionProxy::dropIndex(KDbIndexSchema *index)
+{
+    return d->connection->dropIndex(index);
+}
+
 KDbTableSchema *KDbConnectionProxy::copyTable(const KDbTableSchema &tableSchema, const KDbObject &newData)
 {
     return d->connection->copyTable(tableSchema, newData);
@@ -566,6 +581,20 @@ KDbPreparedStatement KDbConnectionProxy::prepareStatement(KDbPreparedStatement::
     return d->connection->prepareStatement(type, fields, whereFieldNames);
 }
 
+KDbBlobStream* KDbConnectionProxy::openBlob(KDbTableSchema *table, const QString &fieldName,
+                                            const QList<QVariant> &primaryKeyValues,
+                                            QIODevice::OpenMode mode)
+{
+    return d->connection->openBlob(table, fieldName, primaryKeyValues, mode);
+}
+
+KDbBlobStream* KDbConnectionProxy::openBlob(KDbTableSchema *table, const QString &fieldName,
+                                            const QVariant &primaryKeyValue,
+                                            QIODevice::OpenMode mode)
+{
+    return d->connection->openBlob(table, fieldName, primaryKeyValue, mode);
+}
+
 bool KDbConnectionProxy::isInternalTableSchema(const QString& tableName)
 {
     return d->connection->isInternalTableSchema(tableName);
@@ -832,3 +861,8 @@ bool KDbConnectionProxy::storeMainFieldSchema(KDbField *field)
 {
     return d->connection->storeMainFieldSchema(field);
 }
+
+bool KDbConnectionProxy::storeMainFieldsSchema(KDbTableSchema *tableSchema)
+{
+    return d->connection->storeMainFieldsSchema(tableSchema);
+}
@@ -232,6 +232,13 @@ public:
     bool createTable(KDbTableSchema *tableSchema,
                      CreateTableOptions options = CreateTableOption::Default);
 
+    bool createIndices(KDbTableSchema *tableSchema,
+                       CreateTableOptions options = CreateTableOption::Default);
+
+    bool createIndex(KDbIndexSchema *index);
+
+    bool dropIndex(KDbIndexSchema *index);
+
     KDbTableSchema *copyTable(const KDbTableSchema &tableSchema, const KDbObject &newData);
 
     KDbTableSchema *copyTable(const QString& tableName, const KDbObject &newData);
@@ -284,6 +291,14 @@ public:
     KDbPreparedStatement prepareStatement(KDbPreparedStatement::Type type,
         KDbFieldList* fields, const QStringList& whereFieldNames = QStringList());
 
+    Q_REQUIRED_RESULT KDbBlobStream* openBlob(KDbTableSchema *table, const QString &fieldName,
+                                             const QList<QVariant> &primaryKeyValues,
+                                             QIODevice::OpenMode mode = QIODevice::ReadOnly);
+
+    Q_REQUIRED_RESULT KDbBlobStream* openBlob(KDbTableSchema *table, const QString &fieldName,
+                                             const QVariant &primaryKeyValue,
+                                             QIODevice::OpenMode mode = QIODevice::ReadOnly);
+
     bool isInternalTableSchema(const QString& tableName);
 
     QString escapeIdentifier(const QString& id) const override;
@@ -400,6 +415,8 @@ public:
 
     bool storeMainFieldSchema(KDbField *field);
 
+    bool storeMainFieldsSchema(KDbTableSchema *tableSchema);
+
 private:
     Q_DISABLE_COPY(KDbConnectionProxy)
     class Private;
@@ -0,0 +1,512 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbConnectionWorker.h"
+#include "KDbBackgroundTask_p.h"
+#include "KDbConnection.h"
+#include "KDbError.h"
+#include "KDbQuerySchema.h"
+#include "KDbRecordData.h"
+#include "KDbSqlResult.h"
+#include "kdb_debug.h"
+
+#include <QCoreApplication>
+#include <QQueue>
+#include <QScopedPointer>
+#include <QSharedPointer>
+#include <QThread>
+#include <QWaitCondition>
+
+#include <limits>
+
+namespace {
+
+//! A statement queued for the worker thread
+struct WorkerJob
+{
+    enum class Type {
+        ExecuteSql,
+        ExecuteQuery,
+        ExecuteQuerySchema,
+        QuerySingleRecord,
+        InsertRecord
+    };
+
+    ~WorkerJob()
+    {
+        qDeleteAll(records);
+    }
+
+    Type type = Type::ExecuteSql;
+    KDbEscapedString sql;
+    KDbQuerySchema *query = nullptr; //!< query of the caller, copied when the job starts
+    KDbTableSchema *table = nullptr;
+    QList<QVariant> values;
+    KDbCursor::Options options = KDbCursor::Option::None;
+
+    // members below are guarded by WorkerShared::mutex
+    KDbAsyncResult *owner = nullptr; //!< nullptr after the result object is deleted
+    KDbAsyncResult::Status status = KDbAsyncResult::Status::Queued;
+    KDbResult result;
+    QList<KDbRecordData*> records;
+    quint64 lastInsertRecordId = std::numeric_limits<quint64>::max();
+    bool cancelRequested = false;
+};
+
+//! State shared by the worker, its thread and the result objects
+struct WorkerShared
+{
+    //! Guards all members and mutable members of WorkerJob
+    QMutex mutex;
+    QWaitCondition jobAvailable;
+    QWaitCondition jobFinished;
+    QQueue<QSharedPointer<WorkerJob>> queue;
+    QSharedPointer<WorkerJob> currentJob;
+    KDbConnection *connection = nullptr; //!< nullptr after the worker is deleted
+    int batchSize = 256;
+    bool quit = false;
+
+    //! Posts event of @a kind to owner of @a job. Has to be called with mutex locked.
+    static void notify(WorkerJob *job, KDbBackgroundEvent::Kind kind)
+    {
+        if (job->owner) {
+            // events posted to an object are discarded when it is deleted
+            QCoreApplication::postEvent(job->owner, new KDbBackgroundEvent(kind));
+        }
+    }
+
+    //! Sets final @a status of @a job. Has to be called with mutex locked.
+    void finish(WorkerJob *job, KDbAsyncResult::Status status)
+    {
+        job->status = status;
+        notify(job, KDbBackgroundEvent::Kind::Finished);
+        jobFinished.wakeAll();
+    }
+
+    //! Cancels @a job. Has to be called with mutex locked.
+    void cancel(const QSharedPointer<WorkerJob> job) // a copy, the job may be removed from the queue
+    {
+        if (job->status == KDbAsyncResult::Status::Queued) {
+            queue.removeOne(job);
+            finish(job.data(), KDbAsyncResult::Status::Cancelled);
+        } else if (job->status == KDbAsyncResult::Status::Running && !job->cancelRequested) {
+            job->cancelRequested = true;
+            // the job can't finish while the mutex is locked so the right statement is cancelled
+            if (connection) {
+                connection->cancelQuery();
+            }
+        }
+    }
+
+    //! @return true if no statements are queued or running. Has to be called with mutex locked.
+    bool isDone() const
+    {
+        return queue.isEmpty() && !currentJob;
+    }
+};
+
+//! Thread executing statements of the queue one by one
+class WorkerThread : public QThread
+{
+public:
+    explicit WorkerThread(const QSharedPointer<WorkerShared> &shared) : m_shared(shared) {}
+
+protected:
+    void run() override
+    {
+        QMutexLocker locker(&m_shared->mutex);
+        while (true) {
+            while (m_shared->queue.isEmpty() && !m_shared->quit) {
+                m_shared->jobAvailable.wait(&m_shared->mutex);
+            }
+            if (m_shared->quit) {
+                return;
+            }
+            const QSharedPointer<WorkerJob> job(m_shared->queue.dequeue());
+            job->status = KDbAsyncResult::Status::Running;
+            m_shared->currentJob = job;
+            KDbConnection *conn = m_shared->connection;
+            const int batchSize = m_shared->batchSize;
+            locker.unlock();
+
+            KDbResult result;
+            quint64 lastInsertRecordId = std::numeric_limits<quint64>::max();
+            const bool ok = execute(conn, job.data(), batchSize, &result, &lastInsertRecordId);
+
+            locker.relock();
+            m_shared->currentJob.clear();
+            job->result = result;
+            job->lastInsertRecordId = lastInsertRecordId;
+            m_shared->finish(job.data(), job->cancelRequested ? KDbAsyncResult::Status::Cancelled
+                                         : (ok ? KDbAsyncResult::Status::Finished
+                                               : KDbAsyncResult::Status::Failed));
+        }
+    }
+
+private:
+    bool isCancelRequested(WorkerJob *job) const
+    {
+        QMutexLocker locker(&m_shared->mutex);
+        return job->cancelRequested;
+    }
+
+    //! Passes records of @a batch to @a job
+    void deliver(WorkerJob *job, QList<KDbRecordData*> *batch)
+    {
+        if (batch->isEmpty()) {
+            return;
+        }
+        QMutexLocker locker(&m_shared->mutex);
+        job->records += *batch;
+        batch->clear();
+        WorkerShared::notify(job, KDbBackgroundEvent::Kind::Progress);
+    }
+
+    bool fetchRecords(KDbCursor *cursor, WorkerJob *job, int batchSize, KDbResult *result)
+    {
+        QList<KDbRecordData*> batch;
+        while (!cursor->eof() && !isCancelRequested(job)) {
+            KDbRecordData *record = cursor->storeCurrentRecord();
+            if (!record) {
+                break;
+            }
+            batch.append(record);
+            if (batch.count() >= batchSize) {
+                deliver(job, &batch);
+            }
+            cursor->moveNext();
+        }
+        deliver(job, &batch);
+        if (cursor->result().isError()) {
+            *result = cursor->result();
+            return false;
+        }
+        return true;
+    }
+
+    bool execute(KDbConnection *conn, WorkerJob *job, int batchSize, KDbResult *result,
+                 quint64 *lastInsertRecordId)
+    {
+        bool ok = false;
+        switch (job->type) {
+        case WorkerJob::Type::ExecuteSql:
+            ok = conn->executeSql(job->sql);
+            break;
+        case WorkerJob::Type::ExecuteQuery:
+        case WorkerJob::Type::ExecuteQuerySchema: {
+            // the copy is made and deleted by this thread, so state cached by the connection
+            // is never touched by the caller's thread, and caller's query stays unrelated to it
+            QScopedPointer<KDbQuerySchema> query;
+            if (job->type == WorkerJob::Type::ExecuteQuerySchema && job->query) {
+                query.reset(new KDbQuerySchema(*job->query, conn));
+            }
+            KDbCursor *cursor = job->type == WorkerJob::Type::ExecuteQuery
+                    ? conn->executeQuery(job->sql, job->options)
+                    : conn->executeQuery(query.data(), job->values, job->options);
+            if (cursor) {
+                ok = fetchRecords(cursor, job, batchSize, result);
+                conn->deleteCursor(cursor);
+                if (!ok) {
+                    return false;
+                }
+            }
+            break;
+        }
+        case WorkerJob::Type::QuerySingleRecord: {
+            KDbRecordData *record = new KDbRecordData;
+            const tristate res = conn->querySingleRecord(job->sql, record);
+            ok = res != false;
+            if (res == true) {
+                QList<KDbRecordData*> batch;
+                batch.append(record);
+                deliver(job, &batch);
+            } else {
+                delete record;
+            }
+            break;
+        }
+        case WorkerJob::Type::InsertRecord: {
+            const QSharedPointer<KDbSqlResult> sqlResult(conn->insertRecord(job->table, job->values));
+            ok = !sqlResult.isNull();
+            if (ok) {
+                *lastInsertRecordId = sqlResult->lastInsertRecordId();
+            }
+            break;
+        }
+        }
+        if (!ok) {
+            *result = conn->result();
+        }
+        return ok;
+    }
+
+    const QSharedPointer<WorkerShared> m_shared;
+};
+
+} // namespace
+
+class Q_DECL_HIDDEN KDbAsyncResult::Private
+{
+public:
+    Private() {}
+    QSharedPointer<WorkerShared> shared;
+    QSharedPointer<WorkerJob> job;
+private:
+    Q_DISABLE_COPY(Private)
+};
+
+KDbAsyncResult::KDbAsyncResult()
+    : d(new Private)
+{
+}
+
+KDbAsyncResult::~KDbAsyncResult()
+{
+    {
+        QMutexLocker locker(&d->shared->mutex);
+        d->job->owner = nullptr;
+        d->shared->cancel(d->job);
+    }
+    delete d;
+}
+
+KDbAsyncResult::Status KDbAsyncResult::status() const
+{
+    QMutexLocker locker(&d->shared->mutex);
+    return d->job->status;
+}
+
+bool KDbAsyncResult::isFinished() const
+{
+    const Status s = status();
+    return s != Status::Queued && s != Status::Running;
+}
+
+KDbResult KDbAsyncResult::result() const
+{
+    QMutexLocker locker(&d->shared->mutex);
+    return d->job->result;
+}
+
+QList<KDbRecordData*> KDbAsyncResult::takeRecords()
+{
+    QMutexLocker locker(&d->shared->mutex);
+    QList<KDbRecordData*> records;
+    records.swap(d->job->records);
+    return records;
+}
+
+quint64 KDbAsyncResult::lastInsertRecordId() const
+{
+    QMutexLocker locker(&d->shared->mutex);
+    return d->job->lastInsertRecordId;
+}
+
+void KDbAsyncResult::cancel()
+{
+    QMutexLocker locker(&d->shared->mutex);
+    d->shared->cancel(d->job);
+}
+
+bool KDbAsyncResult::waitForFinished(int timeout)
+{
+    QMutexLocker locker(&d->shared->mutex);
+    const WorkerJob *job = d->job.data();
+    return kdbWaitUntil(&d->shared->jobFinished, &d->shared->mutex, timeout, [job]() {
+        return job->status != Status::Queued && job->status != Status::Running;
+    });
+}
+
+bool KDbAsyncResult::event(QEvent *event)
+{
+    const KDbBackgroundEvent *resultEvent = KDbBackgroundEvent::cast(event);
+    if (resultEvent) {
+        switch (resultEvent->kind()) {
+        case KDbBackgroundEvent::Kind::Progress:
+            emit recordsAvailable();
+            break;
+        case KDbBackgroundEvent::Kind::Finished:
+            emit finished();
+            break;
+        }
+        return true;
+    }
+    return QObject::event(event);
+}
+
+//---------------------------------
+
+class Q_DECL_HIDDEN KDbConnectionWorker::Private
+{
+public:
+    Private() {}
+
+    ~Private()
+    {
+        delete thread;
+    }
+
+    //! Creates result object for @a job and queues the job
+    KDbAsyncResult* enqueue(WorkerJob *job)
+    {
+        const QSharedPointer<WorkerJob> sharedJob(job);
+        KDbAsyncResult *result = new KDbAsyncResult;
+        result->d->shared = shared;
+        result->d->job = sharedJob;
+        QMutexLocker locker(&shared->mutex);
+        job->owner = result;
+        if (shared->quit || !shared->connection) {
+            job->result = KDbResult(ERR_NO_CONNECTION, KDbConnectionWorker::tr("No connection."));
+            shared->finish(job, KDbAsyncResult::Status::Failed);
+        } else {
+            shared->queue.enqueue(sharedJob);
+            shared->jobAvailable.wakeOne();
+        }
+        return result;
+    }
+
+    QSharedPointer<WorkerShared> shared;
+    WorkerThread *thread = nullptr;
+
+private:
+    Q_DISABLE_COPY(Private)
+};
+
+KDbConnectionWorker::KDbConnectionWorker(KDbConnection *connection, QObject *parent)
+    : QObject(parent)
+    , d(new Private)
+{
+    d->shared = QSharedPointer<WorkerShared>::create();
+    d->shared->connection = connection;
+    d->thread = new WorkerThread(d->shared);
+    d->thread->start();
+}
+
+KDbConnectionWorker::~KDbConnectionWorker()
+{
+    {
+        QMutexLocker locker(&d->shared->mutex);
+        d->shared->quit = true;
+        while (!d->shared->queue.isEmpty()) {
+            d->shared->cancel(d->shared->queue.head());
+        }
+        if (d->shared->currentJob) {
+            d->shared->cancel(d->shared->currentJob);
+        }
+        d->shared->jobAvailable.wakeAll();
+    }
+    d->thread->wait();
+    {
+        QMutexLocker locker(&d->shared->mutex);
+        d->shared->connection = nullptr;
+    }
+    delete d;
+}
+
+KDbConnection* KDbConnectionWorker::connection() const
+{
+    QMutexLocker locker(&d->shared->mutex);
+    return d->shared->connection;
+}
+
+int KDbConnectionWorker::batchSize() const
+{
+    QMutexLocker locker(&d->shared->mutex);
+    return d->shared->batchSize;
+}
+
+void KDbConnectionWorker::setBatchSize(int size)
+{
+    QMutexLocker locker(&d->shared->mutex);
+    d->shared->batchSize = qMax(1, size);
+}
+
+KDbAsyncResult* KDbConnectionWorker::executeSql(const KDbEscapedString &sql)
+{
+    WorkerJob *job = new WorkerJob;
+    job->type = WorkerJob::Type::ExecuteSql;
+    job->sql = sql;
+    return d->enqueue(job);
+}
+
+KDbAsyncResult* KDbConnectionWorker::executeQuery(const KDbEscapedString &sql,
+                                                  KDbCursor::Options options)
+{
+    WorkerJob *job = new WorkerJob;
+    job->type = WorkerJob::Type::ExecuteQuery;
+    job->sql = sql;
+    job->options = options;
+    return d->enqueue(job);
+}
+
+KDbAsyncResult* KDbConnectionWorker::executeQuery(KDbQuerySchema *query,
+                                                  const QList<QVariant> &params,
+                                                  KDbCursor::Options options)
+{
+    WorkerJob *job = new WorkerJob;
+    job->type = WorkerJob::Type::ExecuteQuerySchema;
+    job->query = query;
+    job->values = params;
+    job->options = options;
+    return d->enqueue(job);
+}
+
+KDbAsyncResult* KDbConnectionWorker::querySingleRecord(const KDbEscapedString &sql)
+{
+    WorkerJob *job = new WorkerJob;
+    job->type = WorkerJob::Type::QuerySingleRecord;
+    job->sql = sql;
+    return d->enqueue(job);
+}
+
+KDbAsyncResult* KDbConnectionWorker::insertRecord(KDbTableSchema *tableSchema,
+                                                  const QList<QVariant> &values)
+{
+    WorkerJob *job = new WorkerJob;
+    job->type = WorkerJob::Type::InsertRecord;
+    job->table = tableSchema;
+    job->values = values;
+    return d->enqueue(job);
+}
+
+int KDbConnectionWorker::pendingCount() const
+{
+    QMutexLocker locker(&d->shared->mutex);
+    return d->shared->queue.count() + (d->shared->currentJob ? 1 : 0);
+}
+
+void KDbConnectionWorker::cancelAll()
+{
+    QMutexLocker locker(&d->shared->mutex);
+    while (!d->shared->queue.isEmpty()) {
+        d->shared->cancel(d->shared->queue.head());
+    }
+    if (d->shared->currentJob) {
+        d->shared->cancel(d->shared->currentJob);
+    }
+}
+
+bool KDbConnectionWorker::waitForDone(int timeout)
+{
+    QMutexLocker locker(&d->shared->mutex);
+    const WorkerShared *shared = d->shared.data();
+    return kdbWaitUntil(&d->shared->jobFinished, &d->shared->mutex, timeout, [shared]() {
+        return shared->isDone();
+    });
+}
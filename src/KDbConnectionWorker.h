@@ -0,0 +1,214 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_CONNECTIONWORKER_H
+#define KDB_CONNECTIONWORKER_H
+
+#include <QObject>
+
+#include "KDbCursor.h"
+#include "KDbEscapedString.h"
+#include "KDbResult.h"
+
+class KDbConnection;
+class KDbQuerySchema;
+class KDbRecordData;
+class KDbTableSchema;
+
+/**
+ * @brief Result of a statement executed asynchronously by KDbConnectionWorker
+ *
+ * Objects of this class are created by KDbConnectionWorker methods and owned by the caller.
+ * They live in the thread that created them and emit their signals in that thread.
+ * Deleting an object that is not finished yet cancels the statement.
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbAsyncResult : public QObject
+{
+    Q_OBJECT
+public:
+    //! Status of the statement
+    enum class Status {
+        Queued,    //!< Waiting for execution of previous statements
+        Running,   //!< Being executed
+        Finished,  //!< Executed successfully
+        Failed,    //!< Failed, result() contains the error
+        Cancelled  //!< Cancelled with cancel() before it finished
+    };
+
+    //! Cancels the statement if it is not finished and destroys this object.
+    ~KDbAsyncResult() override;
+
+    //! @return current status of the statement
+    Status status() const;
+
+    //! @return @c true if the statement has finished, failed or has been cancelled
+    bool isFinished() const;
+
+    //! @return result of the statement, valid after it failed
+    KDbResult result() const;
+
+    /**
+     * @brief Takes records fetched so far
+     *
+     * Records are available for statements that return data, i.e. executeQuery() and
+     * querySingleRecord(). They are appended in batches and recordsAvailable() is emitted
+     * after each batch, so processing can start before all records are fetched.
+     * Ownership of the records is passed to the caller.
+     */
+    Q_REQUIRED_RESULT QList<KDbRecordData*> takeRecords();
+
+    //! @return identifier of record inserted by KDbConnectionWorker::insertRecord()
+    //! @see KDbSqlResult::lastInsertRecordId()
+    quint64 lastInsertRecordId() const;
+
+    /**
+     * @brief Cancels the statement
+     *
+     * A queued statement is removed from the queue. Running statement is interrupted using
+     * KDbConnection::cancelQuery() and fetching of records is stopped. finished() is emitted
+     * afterwards unless the statement finished before it could be cancelled.
+     */
+    void cancel();
+
+    /**
+     * @brief Blocks until the statement is finished
+     *
+     * Negative @a timeout means waiting without a limit.
+     * @return @c true if the statement has finished within @a timeout milliseconds.
+     * Signals are still delivered through the event loop.
+     */
+    bool waitForFinished(int timeout = -1);
+
+Q_SIGNALS:
+    //! Emitted when new records can be obtained using takeRecords()
+    void recordsAvailable();
+
+    //! Emitted when the statement has finished, failed or has been cancelled
+    void finished();
+
+protected:
+    bool event(QEvent *event) override;
+
+private:
+    KDbAsyncResult();
+    Q_DISABLE_COPY(KDbAsyncResult)
+    friend class KDbConnectionWorker;
+    class Private;
+    Private * const d;
+};
+
+/**
+ * @brief Executes statements of a connection in a separate thread
+ *
+ * All methods of KDbConnection block the calling thread until the database backend responds.
+ * KDbConnectionWorker runs statements on a dedicated thread instead and returns immediately
+ * with a KDbAsyncResult object that delivers records and completion using signals.
+ *
+ * Statements are executed one by one in order in which they have been requested. The worker
+ * starts the next statement as soon as the previous one is finished, without waiting for the
+ * caller to process the previous result. Records of queries are delivered in batches of
+ * batchSize() records.
+ *
+ * The connection is not thread-safe so it should not be used directly while the worker
+ * has pending statements (see waitForDone()). Schema objects passed to the worker should
+ * not be modified or deleted until the statement has finished.
+ *
+ * Example usage:
+ * <code>
+ *  KDbConnectionWorker *worker = new KDbConnectionWorker(connection, this);
+ *  KDbAsyncResult *result = worker->executeQuery(KDbEscapedString("SELECT * FROM cars"));
+ *  connect(result, &KDbAsyncResult::recordsAvailable, [result]() {
+ *      const QList<KDbRecordData*> records(result->takeRecords());
+ *      // ... process and delete records
+ *  });
+ *  connect(result, &KDbAsyncResult::finished, result, &QObject::deleteLater);
+ * </code>
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbConnectionWorker : public QObject
+{
+    Q_OBJECT
+public:
+    //! Creates a worker for @a connection and starts its thread.
+    //! @a connection is not owned and should outlive the worker.
+    explicit KDbConnectionWorker(KDbConnection *connection, QObject *parent = nullptr);
+
+    //! Cancels all pending statements and stops the worker thread.
+    ~KDbConnectionWorker() override;
+
+    //! @return connection used by this worker
+    KDbConnection* connection() const;
+
+    //! @return number of records fetched before they are delivered using
+    //! KDbAsyncResult::recordsAvailable(); default is 256
+    int batchSize() const;
+
+    //! Sets number of records fetched before they are delivered to @a size.
+    void setBatchSize(int size);
+
+    //! Queues execution of raw statement @a sql.
+    //! @see KDbConnection::executeSql()
+    Q_REQUIRED_RESULT KDbAsyncResult* executeSql(const KDbEscapedString &sql);
+
+    //! Queues execution of query for raw statement @a sql and fetching of all its records.
+    //! @see KDbConnection::executeQuery()
+    Q_REQUIRED_RESULT KDbAsyncResult* executeQuery(const KDbEscapedString &sql,
+                                                   KDbCursor::Options options = KDbCursor::Option::None);
+
+    //! Queues execution of query defined by @a query with parameters @a params and fetching of
+    //! all its records.
+    //! A copy of @a query is made by the worker thread when the statement starts, so @a query
+    //! and tables used by it should not be modified or deleted until the statement finishes.
+    //! @a query itself is not used with the worker's connection.
+    //! @see KDbConnection::executeQuery()
+    Q_REQUIRED_RESULT KDbAsyncResult* executeQuery(KDbQuerySchema *query,
+                                                   const QList<QVariant> &params = QList<QVariant>(),
+                                                   KDbCursor::Options options = KDbCursor::Option::None);
+
+    //! Queues execution of query for raw statement @a sql and fetching of its first record.
+    //! The result has no records if the query returned none.
+    //! @see KDbConnection::querySingleRecord()
+    Q_REQUIRED_RESULT KDbAsyncResult* querySingleRecord(const KDbEscapedString &sql);
+
+    //! Queues insertion of a record with @a values into table @a tableSchema.
+    //! @see KDbConnection::insertRecord()
+    Q_REQUIRED_RESULT KDbAsyncResult* insertRecord(KDbTableSchema *tableSchema,
+                                                   const QList<QVariant> &values);
+
+    //! @return number of queued and running statements
+    int pendingCount() const;
+
+    //! Cancels all queued and running statements.
+    void cancelAll();
+
+    //! Blocks until all queued statements are finished or @a timeout milliseconds pass.
+    //! Negative @a timeout means waiting without a limit.
+    //! @return @c true if there are no pending statements.
+    bool waitForDone(int timeout = -1);
+
+private:
+    Q_DISABLE_COPY(KDbConnectionWorker)
+    class Private;
+    Private * const d;
+};
+
+#endif
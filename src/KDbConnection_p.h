@@ -27,8 +27,14 @@
 #include "KDbParser.h"
 #include "KDbProperties.h"
 #include "KDbQuerySchema_p.h"
+#include "KDbSqlWriter.h"
 #include "KDbVersionInfo.h"
 
+#include <QElapsedTimer>
+#include <QSharedPointer>
+
+class KDbLookupFieldSchema;
+
 //! Interface for accessing connection's internal result, for use by drivers.
 class KDB_EXPORT KDbConnectionInternal
 {
@@ -133,6 +139,11 @@ public:
     void removeFieldsExpanded(const KDbQuerySchema *query);
 
     KDbConnection* const conn; //!< The @a KDbConnection instance this @a KDbConnectionPrivate belongs to.
+
+    //! Identifier of the connection, unique within the process and never reused
+    //! unlike address of the connection. Used for caching.
+    const quint64 id;
+
     KDbConnectionData connData; //!< the @a KDbConnectionData used within that connection.
 
     //! True for read only connection. Used especially for file-based drivers.
@@ -141,12 +152,24 @@ public:
     //!< The driver this @a KDbConnection instance uses.
     KDbDriver * const driver;
 
+    //! Writer reused for generating record-level statements; call clear() before use
+    KDbSqlWriter sqlWriter;
+
     /*! Default transaction handle.
     If transactions are supported: Any operation on database (e.g. inserts)
     that is started without specifying transaction context, will be performed
     in the context of this transaction. */
     KDbTransaction default_trans;
     QList<KDbTransaction> transactions;
+    //! Nested transactions of the default transaction, innermost last
+    QList<KDbTransaction> nestedTransactions;
+
+    //! @return name of savepoint for nested transaction of nesting level @a level
+    static KDbEscapedString savepointName(int level);
+
+    //! Makes nested transactions of nesting level >= @a level inactive and forgets them.
+    //! Called when they are ended by the database, e.g. when enclosing transaction ends.
+    void deactivateNestedTransactions(int level);
 
     QHash<const KDbTableSchema*, QSet<KDbTableSchemaChangeListener*>* > tableSchemaChangeListeners;
 
@@ -197,6 +220,82 @@ public:
 
     bool insideCloseDatabase = false; //!< helper: true while closeDatabase() is executed
 
+    //! Incremented whenever a table or query schema of this connection is added, removed,
+    //! renamed or its lookup fields change. Used to invalidate native statements cached
+    //! by query schemas (e.g. the ones that contain joins for lookup record sources).
+    quint64 schemaRevision = 0;
+
+    //! Visible values of a lookup record source keyed by bound values converted to strings
+    typedef QSharedPointer<const QHash<QString, QVariant>> LookupValues;
+
+    /*! @return visible values of the record source of @a lookupFieldSchema. The values are
+     loaded on first use and shared by cursors opened with KDbCursor::Option::ClientSideLookup
+     until invalidateLookupValues() is called for a table they depend on, schema of the
+     connection changes or the record source query is modified. Null pointer is returned
+     on failure. */
+    LookupValues lookupValues(const KDbLookupFieldSchema &lookupFieldSchema);
+
+    //! Removes lookup values that depend on table @a tableName, all values if @a tableName
+    //! is empty. Called when records are modified.
+    void invalidateLookupValues(const QString &tableName = QString());
+
+    //! State of the write-behind mode, see KDbConnection::isWriteBehindEnabled()
+    struct WriteBehind {
+        bool enabled = false;
+        int recordLimit = 1000;
+        int sizeLimit = 1024 * 1024;
+        int timeLimit = 1000;
+        KDbTransaction transaction; //!< group transaction, null if no records are pending
+        int recordCount = 0; //!< number of records written in the group
+        qint64 size = 0; //!< size of SQL statements executed in the group
+        QElapsedTimer timer; //!< started on first write of the group
+        bool beginning = false; //!< true while the group transaction is being started
+        bool statement = false; //!< true while a grouped statement is being executed
+    };
+    WriteBehind writeBehind;
+
+    //! Default memory budget of buffered cursors, see KDbConnection::cursorMemoryBudget()
+    qint64 cursorMemoryBudget = 0;
+
+    /*! Called before a data-modifying statement is executed. Starts write-behind group
+     transaction if needed. For drivers where a failed statement aborts the transaction
+     (see KDbDriverBehavior::FAILED_STATEMENT_ABORTS_TRANSACTION) a savepoint is set so the
+     statement can be undone alone. Statements nested in the grouped one, e.g. prepared
+     statements executed by KDbConnection::updateRecord(), are part of the outer statement.
+     @return true if the statement is executed within the group. */
+    bool beginWriteBehindStatement();
+
+    /*! Called after a data-modifying statement of @a size bytes is executed with result @a ok.
+     @a grouped is the value returned by beginWriteBehindStatement(). @a ok is set to false
+     if releasing savepoint of the statement fails. @a recordCount records are added to the
+     group, more than one for batches. Commits the group if limits are reached.
+     @return false if committing the group failed. */
+    bool endWriteBehindStatement(bool grouped, bool *ok, qint64 size, int recordCount = 1);
+
+    /*! Commits write-behind group transaction if there is any.
+     @return false on failure, result of the connection is set then. */
+    bool flushWriteBehind();
+
+    /*! @return prepared statement of @a type (UPDATE or DELETE) for records of @a table,
+     setting values of @a fields and identifying records by @a whereFieldNames.
+     Statements are cached, so repeated updates and deletions, e.g. edits in data grids,
+     reuse the statement compiled by the backend. The cache is cleared when schema of the
+     connection changes. Statement is owned by the connection. */
+    KDbPreparedStatement* recordStatement(KDbPreparedStatement::Type type, KDbTableSchema *table,
+                                          const KDbField::List &fields,
+                                          const QStringList &whereFieldNames);
+
+    //! Destroys statements cached by recordStatement()
+    void clearRecordStatements();
+
+    /*! Executes statement obtained from recordStatement() for @a table with @a parameters,
+     identifying records by fields of primary key @a pkey. Approximate size of the data
+     is stored in @a size. On failure result of the connection is set, on success
+     cached lookup values depending on @a table are invalidated. */
+    bool executeRecordStatement(KDbPreparedStatement::Type type, KDbTableSchema *table,
+                                const KDbField::List &fields, KDbIndexSchema *pkey,
+                                const KDbPreparedStatementParameters &parameters, qint64 *size);
+
 private:
     //! Table schemas retrieved on demand with tableSchema()
     QHash<int, KDbTableSchema*> m_tables;
@@ -207,6 +306,21 @@ private:
     QHash<int, KDbQuerySchema*> m_queries;
     QHash<QString, KDbQuerySchema*> m_queriesByName;
     KDbUtils::AutodeletedHash<const KDbQuerySchema*, KDbQuerySchemaFieldsExpanded*> m_fieldsExpandedCache;
+    //! Cached lookup values, see lookupValues()
+    struct CachedLookupValues {
+        LookupValues values;
+        QSet<QString> tableNames; //!< names of tables the values depend on
+        quint64 schemaRevision;
+        quint64 queryRevision; //!< revision of the record source query, see KDbQuerySchemaPrivate::revision()
+    };
+    QHash<QString, CachedLookupValues> m_lookupValues;
+    //! Statement cached by recordStatement()
+    struct CachedRecordStatement {
+        KDbFieldList fields; //!< fields to set, not owned
+        KDbPreparedStatement statement;
+    };
+    KDbUtils::AutodeletedHash<QString, CachedRecordStatement*> m_recordStatements;
+    quint64 m_recordStatementsRevision = 0;
     Q_DISABLE_COPY(KDbConnectionPrivate)
 };
 
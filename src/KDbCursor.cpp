@@ -19,16 +19,133 @@
 
 #include "KDbCursor.h"
 #include "KDbConnection.h"
+#include "KDbConnection_p.h"
+#include "KDbCursor_p.h"
 #include "KDbDriver.h"
 #include "KDbDriverBehavior.h"
 #include "KDbError.h"
 #include "KDb.h"
+#include "KDbLookupFieldSchema.h"
 #include "KDbNativeStatementBuilder.h"
 #include "KDbQuerySchema.h"
 #include "KDbRecordData.h"
 #include "KDbRecordEditBuffer.h"
 #include "kdb_debug.h"
 
+#include <QDataStream>
+
+//! Size of a part of the temporary file read at once by KDbCursorBuffer
+static const int CURSOR_BUFFER_PAGE_SIZE = 64 * 1024;
+
+KDbCursorBuffer::KDbCursorBuffer(qint64 memoryBudget)
+    : m_memoryBudget(qMin(memoryBudget, qint64(1024 * 1024 * 1024))) // limited by QByteArray
+{
+}
+
+KDbCursorBuffer::~KDbCursorBuffer()
+{
+    delete m_file;
+}
+
+bool KDbCursorBuffer::append(const KDbRecordData &record)
+{
+    m_encoded.clear();
+    {
+        QDataStream stream(&m_encoded, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_5_0);
+        stream << quint32(record.count());
+        for (int i = 0; i < record.count(); ++i) {
+            stream << record.at(i);
+        }
+    }
+    if (!isSpilled() && (m_memory.size() + m_encoded.size()) <= m_memoryBudget) {
+        m_offsets.append(m_memory.size());
+        m_memory.append(m_encoded);
+        ++m_memoryCount;
+        return true;
+    }
+    if (!m_file) {
+        m_file = new QTemporaryFile;
+        if (!m_file->open()) {
+            kdbWarning() << "Could not create temporary file for cursor's buffer:"
+                         << m_file->errorString();
+            delete m_file;
+            m_file = nullptr;
+            return false;
+        }
+    }
+    if (m_file->pos() != m_fileSize && !m_file->seek(m_fileSize)) {
+        return false;
+    }
+    if (m_file->write(m_encoded) != m_encoded.size()) {
+        kdbWarning() << "Could not write to cursor's buffer:" << m_file->errorString();
+        return false;
+    }
+    m_offsets.append(m_fileSize);
+    m_fileSize += m_encoded.size();
+    return true;
+}
+
+bool KDbCursorBuffer::read(qint64 offset, int length, QByteArray *data)
+{
+    if (m_pageOffset < 0 || offset < m_pageOffset
+        || (offset + length) > (m_pageOffset + m_page.size()))
+    {
+        // seek() flushes data that is not written yet
+        if (!m_file->seek(offset)) {
+            return false;
+        }
+        m_page = m_file->read(qMax(length, CURSOR_BUFFER_PAGE_SIZE));
+        if (m_page.size() < length) {
+            kdbWarning() << "Could not read from cursor's buffer:" << m_file->errorString();
+            m_pageOffset = -1;
+            return false;
+        }
+        m_pageOffset = offset;
+    }
+    *data = QByteArray::fromRawData(m_page.constData() + (offset - m_pageOffset), length);
+    return true;
+}
+
+bool KDbCursorBuffer::load(qint64 index, KDbRecordData *record)
+{
+    if (index < 0 || index >= count()) {
+        return false;
+    }
+    const qint64 offset = m_offsets.at(index);
+    QByteArray data;
+    if (index < m_memoryCount) {
+        const qint64 end = (index + 1) < m_memoryCount ? m_offsets.at(index + 1) : m_memory.size();
+        data = QByteArray::fromRawData(m_memory.constData() + offset, end - offset);
+    } else {
+        const qint64 end = (index + 1) < count() ? m_offsets.at(index + 1) : m_fileSize;
+        if (!read(offset, end - offset, &data)) {
+            return false;
+        }
+    }
+    QDataStream stream(data);
+    stream.setVersion(QDataStream::Qt_5_0);
+    quint32 columnCount;
+    stream >> columnCount;
+    record->resize(columnCount);
+    for (int i = 0; i < int(columnCount); ++i) {
+        stream >> (*record)[i];
+    }
+    return stream.status() == QDataStream::Ok;
+}
+
+void KDbCursorBuffer::clear()
+{
+    m_memory.clear();
+    m_offsets.clear();
+    m_memoryCount = 0;
+    delete m_file;
+    m_file = nullptr;
+    m_fileSize = 0;
+    m_page.clear();
+    m_pageOffset = -1;
+}
+
 class Q_DECL_HIDDEN KDbCursor::Private
 {
 public:
@@ -42,6 +159,7 @@ public:
     }
 
     ~Private() {
+        delete buffer;
     }
 
     bool containsRecordIdInfo; //!< true if result contains extra column for record id;
@@ -58,8 +176,22 @@ public:
     KDbQueryColumnInfo::Vector orderByColumnList;
     QList<QVariant> queryParameters;
 
+    //<members related to client-side lookup>
+    //! Lookup column fetched from connection's cache instead of the LEFT OUTER JOIN
+    struct ClientSideLookupColumn {
+        int boundPosition; //!< position of the bound value in record data, -1 if not available
+        const KDbLookupFieldSchema *lookupFieldSchema;
+    };
+    QVector<ClientSideLookupColumn> clientSideLookupColumns;
+    //! Values of lookup columns, loaded on opening
+    QVector<KDbConnectionPrivate::LookupValues> clientSideLookupValues;
+    //</members related to client-side lookup>
+
     //<members related to buffering>
     bool atBuffer; //!< true if we already point to the buffer with curr_coldata
+    qint64 memoryBudget; //!< see KDbCursor::memoryBudget()
+    KDbCursorBuffer *buffer = nullptr; //!< used if memoryBudget is set, see usesRecordBuffer()
+    KDbRecordData bufferedRecord; //!< current record if buffer is used
     //</members related to buffering>
 };
 
@@ -93,13 +225,14 @@ void KDbCursor::init(KDbConnection* conn)
     Q_ASSERT(conn);
     d->conn = conn;
     d->conn->addCursor(this);
+    d->memoryBudget = conn->cursorMemoryBudget();
     m_afterLast = false;
     m_at = 0;
     m_records_in_buf = 0;
     m_buffering_completed = false;
     m_fetchResult = FetchResult::Invalid;
 
-    d->containsRecordIdInfo = (m_query && m_query->masterTable())
+    d->containsRecordIdInfo = (m_query && m_query->masterTable() && !m_query->isGrouped())
                               && d->conn->driver()->behavior()->ROW_ID_FIELD_RETURNS_LAST_AUTOINCREMENTED_VALUE == false;
 
     if (m_query) {
@@ -110,6 +243,9 @@ void KDbCursor::init(KDbConnection* conn)
                                             : KDbQuerySchema::FieldsExpandedMode::WithInternalFields);
         m_logicalFieldCount = m_visibleFieldsExpanded->count()
                               - m_query->internalFields(conn).count() - (d->containsRecordIdInfo ? 1 : 0);
+        if (m_options & Option::ClientSideLookup) {
+            initClientSideLookup();
+        }
         m_fieldCount = m_visibleFieldsExpanded->count();
         m_fieldsToStoreInRecord = m_fieldCount;
     } else {
@@ -120,6 +256,54 @@ void KDbCursor::init(KDbConnection* conn)
     }
 }
 
+void KDbCursor::initClientSideLookup()
+{
+    const int internalFieldCount = m_visibleFieldsExpanded->count() - m_logicalFieldCount
+                                   - (d->containsRecordIdInfo ? 1 : 0);
+    if (internalFieldCount <= 0) {
+        return;
+    }
+    const KDbQueryColumnInfo::Vector fields(*m_visibleFieldsExpanded);
+    for (int i = m_logicalFieldCount; i < m_logicalFieldCount + internalFieldCount; ++i) {
+        KDbQueryColumnInfo *foreignColumn = fields.at(i)->foreignColumn();
+        Private::ClientSideLookupColumn column;
+        column.boundPosition = fields.indexOf(foreignColumn);
+        column.lookupFieldSchema = (foreignColumn && foreignColumn->field() && foreignColumn->field()->table())
+            ? foreignColumn->field()->table()->lookupFieldSchema(*foreignColumn->field()) : nullptr;
+        d->clientSideLookupColumns.append(column);
+    }
+    // Internal fields are not part of the SELECT statement, so make the vector
+    // match the statement's columns: logical columns and optional record id.
+    m_visibleFieldsExpanded->remove(m_logicalFieldCount, internalFieldCount);
+}
+
+bool KDbCursor::appendClientSideLookupValues(KDbRecordData *data) const
+{
+    if (d->clientSideLookupColumns.isEmpty()) {
+        return true;
+    }
+    const int lookupCount = d->clientSideLookupColumns.count();
+    const int oldCount = data->count();
+    data->resize(oldCount + lookupCount);
+    // keep the record id at the end
+    for (int i = oldCount - 1; i >= m_logicalFieldCount; --i) {
+        (*data)[i + lookupCount] = data->at(i);
+    }
+    for (int k = 0; k < lookupCount; ++k) {
+        const Private::ClientSideLookupColumn &column = d->clientSideLookupColumns.at(k);
+        const KDbConnectionPrivate::LookupValues values(d->clientSideLookupValues.value(k));
+        QVariant value;
+        if (values && column.boundPosition >= 0 && column.boundPosition < oldCount) {
+            const QVariant boundValue(data->at(column.boundPosition));
+            if (!boundValue.isNull()) {
+                value = values->value(boundValue.toString());
+            }
+        }
+        (*data)[m_logicalFieldCount + k] = value;
+    }
+    return true;
+}
+
 KDbCursor::~KDbCursor()
 {
 #ifdef KDB_DEBUG_GUI
@@ -180,10 +364,21 @@ bool KDbCursor::containsRecordIdInfo() const
     return d->containsRecordIdInfo;
 }
 
+bool KDbCursor::storeRecord(KDbRecordData* data) const
+{
+    if (d->buffer) {
+        for (int i = 0; i < m_fieldsToStoreInRecord; ++i) {
+            (*data)[i] = d->bufferedRecord.value(i);
+        }
+        return true;
+    }
+    return drv_storeCurrentRecord(data);
+}
+
 KDbRecordData* KDbCursor::storeCurrentRecord() const
 {
     KDbRecordData* data = new KDbRecordData(m_fieldsToStoreInRecord);
-    if (!drv_storeCurrentRecord(data)) {
+    if (!storeRecord(data) || !appendClientSideLookupValues(data)) {
         delete data;
         return nullptr;
     }
@@ -196,7 +391,7 @@ bool KDbCursor::storeCurrentRecord(KDbRecordData* data) const
         return false;
     }
     data->resize(m_fieldsToStoreInRecord);
-    return drv_storeCurrentRecord(data);
+    return storeRecord(data) && appendClientSideLookupValues(data);
 }
 
 bool KDbCursor::open()
@@ -217,6 +412,7 @@ bool KDbCursor::open()
         }
         KDbSelectStatementOptions options;
         options.setAlsoRetrieveRecordId(d->containsRecordIdInfo); /*get record Id if needed*/
+        options.setAddVisibleLookupColumns(!(m_options & Option::ClientSideLookup));
         KDbNativeStatementBuilder builder(d->conn, KDb::DriverEscaping);
         KDbEscapedString sql;
         if (!builder.generateSelectStatement(&sql, m_query, options, d->queryParameters)
@@ -234,6 +430,15 @@ bool KDbCursor::open()
                       + m_result.sql().toString());
 #endif
     }
+    // Load lookup values before opening because some drivers cannot execute
+    // other statements while the cursor's result is not fully fetched.
+    d->clientSideLookupValues.clear();
+    for (const Private::ClientSideLookupColumn &column : qAsConst(d->clientSideLookupColumns)) {
+        d->clientSideLookupValues.append(column.lookupFieldSchema
+            ? d->conn->d->lookupValues(*column.lookupFieldSchema) : KDbConnectionPrivate::LookupValues());
+    }
+    delete d->buffer;
+    d->buffer = (isBuffered() && d->memoryBudget > 0) ? new KDbCursorBuffer(d->memoryBudget) : nullptr;
     d->opened = drv_open(m_result.sql());
     m_afterLast = false; //we are not @ the end
     m_at = 0; //we are before 1st rec
@@ -261,6 +466,8 @@ bool KDbCursor::close()
     bool ret = drv_close();
 
     clearBuffer();
+    delete d->buffer;
+    d->buffer = nullptr;
 
     d->opened = false;
     m_afterLast = false;
@@ -367,7 +574,13 @@ bool KDbCursor::movePrev()
     //we're after last record and there are records in the buffer
     //--let's move to last record
     if (m_afterLast && (m_records_in_buf > 0)) {
-        drv_bufferMovePointerTo(m_records_in_buf - 1);
+        if (d->buffer) {
+            if (!loadBufferedRecord(m_records_in_buf - 1)) {
+                return false;
+            }
+        } else {
+            drv_bufferMovePointerTo(m_records_in_buf - 1);
+        }
         m_at = m_records_in_buf;
         d->atBuffer = true; //now current record is stored in the buffer
         d->validRecord = true;
@@ -382,6 +595,15 @@ bool KDbCursor::movePrev()
         return false;
     }
 
+    if (d->buffer) {
+        if (!loadBufferedRecord(m_at - 2)) {
+            return false;
+        }
+        m_at--;
+        d->validRecord = true;
+        m_afterLast = false;
+        return true;
+    }
     m_at--;
     if (d->atBuffer) {//we already have got a pointer to buffer
         drv_bufferMovePointerPrev(); //just move to prev record in the buffer
@@ -410,12 +632,48 @@ void KDbCursor::setBuffered(bool buffered)
     m_options ^= KDbCursor::Option::Buffered;
 }
 
+qint64 KDbCursor::memoryBudget() const
+{
+    return d->memoryBudget;
+}
+
+void KDbCursor::setMemoryBudget(qint64 bytes)
+{
+    d->memoryBudget = qMax(qint64(0), bytes);
+}
+
+bool KDbCursor::usesRecordBuffer() const
+{
+    return d->buffer != nullptr;
+}
+
+const KDbRecordData* KDbCursor::bufferedRecord() const
+{
+    return d->buffer ? &d->bufferedRecord : nullptr;
+}
+
+bool KDbCursor::loadBufferedRecord(qint64 index)
+{
+    if (!d->buffer->load(index, &d->bufferedRecord)) {
+        m_result = KDbResult(ERR_CURSOR_RECORD_FETCHING,
+                             tr("Could not read record from the cursor's buffer."));
+        d->validRecord = false;
+        return false;
+    }
+    d->atBuffer = true;
+    return true;
+}
+
 void KDbCursor::clearBuffer()
 {
     if (!isBuffered() || m_fieldCount == 0)
         return;
 
     drv_clearBuffer();
+    if (d->buffer) {
+        d->buffer->clear();
+        d->bufferedRecord.clear();
+    }
 
     m_records_in_buf = 0;
     d->atBuffer = false;
@@ -428,7 +686,11 @@ bool KDbCursor::getNextRecord()
     if (m_options & KDbCursor::Option::Buffered) {//this cursor is buffered:
 //  kdbDebug() << "m_at < m_records_in_buf :: " << (long)m_at << " < " << m_records_in_buf;
         if (m_at < m_records_in_buf) {//we have next record already buffered:
-            if (d->atBuffer) {//we already have got a pointer to buffer
+            if (d->buffer) {
+                if (!loadBufferedRecord(m_at)) {
+                    return false;
+                }
+            } else if (d->atBuffer) {//we already have got a pointer to buffer
                 drv_bufferMovePointerNext(); //just move to next record in the buffer
             } else {//we have no pointer
                 //compute a place in the buffer that contain next record's data
@@ -457,7 +719,22 @@ bool KDbCursor::getNextRecord()
                     return false; // in case of m_fetchResult = FetchResult::End or m_fetchResult = FetchInvalid
                 }
                 //we have a record: store this record's values in the buffer
-                drv_appendCurrentRecordToBuffer();
+                if (d->buffer) {
+                    d->bufferedRecord.resize(m_fieldsToStoreInRecord);
+                    if (!drv_storeCurrentRecord(&d->bufferedRecord)
+                        || !d->buffer->append(d->bufferedRecord))
+                    {
+                        d->validRecord = false;
+                        m_afterLast = true;
+                        m_at = -1;
+                        m_result = KDbResult(ERR_CURSOR_RECORD_FETCHING,
+                                             tr("Could not store record in the cursor's buffer."));
+                        return false;
+                    }
+                    d->atBuffer = false;
+                } else {
+                    drv_appendCurrentRecordToBuffer();
+                }
                 m_records_in_buf++;
             } else //we have a record that was read ahead: eat this
                 d->readAhead = false;
@@ -72,7 +72,15 @@ public:
     //! Options that describe behavior of database cursor
     enum class Option {
         None = 0,
-        Buffered = 1
+        Buffered = 1,
+        ClientSideLookup = 2, //!< Visible values of lookup columns are taken from a cache shared
+                              //!< by the connection instead of LEFT OUTER JOINs added to the SELECT
+                              //!< statement. Values of the lookup columns are only available
+                              //!< in records returned by storeCurrentRecord(). @since 3.3
+        ReadAhead = 4 //!< Records are fetched and decoded in advance by a separate thread while
+                      //!< the current record is processed. Useful for processing all records
+                      //!< of large results. Used only for unbuffered cursors of drivers that
+                      //!< support it (currently SQLite), ignored otherwise. @since 3.3
     };
     Q_DECLARE_FLAGS(Options, Option)
 
@@ -119,6 +127,26 @@ public:
     /*! @return true if the cursor is buffered. */
     bool isBuffered() const;
 
+    /*! @return maximum size in bytes of records of a buffered cursor kept in memory.
+     Records fetched beyond this limit are stored in a temporary file and read back when
+     the cursor moves to them again, so memory use does not grow with the size of result.
+     0 means no limit; then drivers may keep the entire result in memory.
+     The initial value is taken from KDbConnection::cursorMemoryBudget().
+     @note With the limit set, drivers that otherwise receive the entire result at once
+     (PostgreSQL and MySQL) receive records one by one as the cursor moves. Until all records
+     are received or the cursor is closed, the connection is busy and cannot execute other
+     statements; they fail with "another command is already in progress" (PostgreSQL)
+     or "commands out of sync" (MySQL) errors. Call moveLast() or close() before executing
+     other statements or use a separate connection for such cursors.
+     @since 3.3 */
+    qint64 memoryBudget() const;
+
+    /*! Sets maximum size in bytes of records kept in memory to @a bytes.
+     It takes effect on next open() of a buffered cursor. 0 or negative value removes the limit.
+     @see memoryBudget()
+     @since 3.3 */
+    void setMemoryBudget(qint64 bytes);
+
     /*! Sets this cursor to buffered type or not. See description
       of buffered and nonbuffered cursors in class description.
       This method only works if cursor is not opened (isOpened()==false).
@@ -181,7 +209,8 @@ public:
      Note for driver developers:
      If @a i is >= than m_fieldCount, null QVariant value should be returned.
      To return a value typically you can use a pointer to internal structure
-     that contain current record data (buffered or unbuffered). */
+     that contain current record data (buffered or unbuffered),
+     or bufferedRecord() if it is not @c nullptr. */
     virtual QVariant value(int i) = 0;
 
     /*! [PROTOTYPE] @return current record data or @c nullptr if there is no current records. */
@@ -244,6 +273,12 @@ protected:
 
     void init(KDbConnection* conn);
 
+    //! @internal Prepares lookup columns for the ClientSideLookup option
+    void initClientSideLookup();
+
+    //! @internal Adds values of lookup columns to @a data for the ClientSideLookup option
+    bool appendClientSideLookupValues(KDbRecordData *data) const;
+
     /*! Internal: cares about proper flag setting depending on result of drv_getNextRecord()
      and depending on wherher a cursor is buffered. */
     bool getNextRecord();
@@ -287,6 +322,19 @@ protected:
     //! @internal clears buffer with reimplemented drv_clearBuffer(). */
     void clearBuffer();
 
+    /*! @return true if records of this buffered cursor are buffered by KDbCursor itself
+     because memoryBudget() is set. Known before drv_open() is called.
+     Note for driver developers: records should then be fetched from the server one by one
+     in drv_getNextRecord() instead of storing the entire result, drv_bufferMovePointer*()
+     methods are not used and value() should return values of bufferedRecord().
+     @since 3.3 */
+    bool usesRecordBuffer() const;
+
+    /*! @return current record stored by KDbCursor if usesRecordBuffer() is true,
+     @c nullptr otherwise.
+     @since 3.3 */
+    const KDbRecordData* bufferedRecord() const;
+
     /*! Puts current record's data into @a data (makes a deep copy of each field).
      This method has unspecified behavior if the cursor is not at valid record.
      @return true on success.
@@ -326,6 +374,12 @@ protected:
 private:
     bool readAhead() const;
 
+    //! Loads record at @a index from the buffer, see usesRecordBuffer()
+    bool loadBufferedRecord(qint64 index);
+
+    //! Puts current record's data into @a data, from the buffer if usesRecordBuffer() is true
+    bool storeRecord(KDbRecordData* data) const;
+
     Q_DISABLE_COPY(KDbCursor)
     friend class CursorDeleter;
     class Private;
@@ -20,6 +20,57 @@
 #ifndef KDB_CURSOR_P_H
 #define KDB_CURSOR_P_H
 
+#include <QByteArray>
+#include <QTemporaryFile>
+#include <QVector>
+
+#include "config-kdb.h"
+#include "kdb_export.h"
+
+class KDbRecordData;
+
+/*! @internal Storage for records of buffered cursors limited by a memory budget.
+ Records are serialized in a compact form. They are kept in memory until total size
+ of the serialized records reaches the budget, records appended later are written to
+ a temporary file and read back in pages when needed. */
+class KDB_TESTING_EXPORT KDbCursorBuffer
+{
+public:
+    //! Creates buffer keeping up to @a memoryBudget bytes of records in memory
+    explicit KDbCursorBuffer(qint64 memoryBudget);
+
+    ~KDbCursorBuffer();
+
+    //! @return number of stored records
+    inline qint64 count() const { return m_offsets.count(); }
+
+    //! @return true if some records have been written to the temporary file
+    inline bool isSpilled() const { return m_memoryCount < count(); }
+
+    //! Appends values of @a record. @return false if the temporary file cannot be written.
+    bool append(const KDbRecordData &record);
+
+    //! Loads record at @a index to @a record. @return false on read error.
+    bool load(qint64 index, KDbRecordData *record);
+
+    //! Removes all records and the temporary file.
+    void clear();
+
+private:
+    bool read(qint64 offset, int length, QByteArray *data);
+
+    const qint64 m_memoryBudget;
+    QByteArray m_memory; //!< records kept in memory
+    QVector<qint64> m_offsets; //!< offsets of records in m_memory or in m_file
+    qint64 m_memoryCount = 0; //!< number of records kept in m_memory
+    QTemporaryFile *m_file = nullptr; //!< records that do not fit in the budget
+    qint64 m_fileSize = 0;
+    QByteArray m_page; //!< recently read part of m_file
+    qint64 m_pageOffset = -1;
+    QByteArray m_encoded; //!< reused for encoding records
+    Q_DISABLE_COPY(KDbCursorBuffer)
+};
+
 
 #if 0
 /*PRIVATE*/ class /*KDB_EXPORT*/ CursorData
@@ -300,6 +300,11 @@ void KDbDriver::initDriverSpecificKeywords(const char* const* keywords)
     d->driverSpecificSqlKeywords.setStrings(keywords);
 }
 
+void KDbDriver::initDriverSpecificKeywords(const KDbUtils::StaticSetOfStrings::HashTable &keywords)
+{
+    d->driverSpecificSqlKeywords.setStrings(keywords);
+}
+
 KDbEscapedString KDbDriver::addLimitTo1(const KDbEscapedString& sql, bool add)
 {
     return add ? (sql + " LIMIT 1") : sql;
@@ -397,14 +402,9 @@ KDbEscapedString KDbDriver::concatenateFunctionToString(const KDbBinaryExpressio
 
 //---------------
 
-Q_GLOBAL_STATIC_WITH_ARGS(
-    KDbUtils::StaticSetOfStrings,
-    KDb_kdbSqlKeywords,
-    (KDbDriverPrivate::kdbSQLKeywords) )
-
 KDB_EXPORT bool KDb::isKDbSqlKeyword(const QByteArray& word)
 {
-    return KDb_kdbSqlKeywords->contains(word.toUpper());
+    return KDbDriverPrivate::kdbSQLKeywordsHash.contains(word.constData(), word.length());
 }
 
 KDB_EXPORT QString KDb::escapeIdentifier(const KDbDriver* driver,
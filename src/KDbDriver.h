@@ -59,9 +59,10 @@ public:
         //! multiple concurrent trasactions are supported
         //! (this implies !SingleTransactions)
         MultipleTransactions = 2,
-//(js) NOT YET IN USE:
-        /*! nested trasactions are supported
-         (this should imply !SingleTransactions and MultipleTransactions) */
+        /*! nested trasactions are supported within a transaction started with
+         SingleTransactions; they are implemented using SQL savepoints
+         (SAVEPOINT, RELEASE SAVEPOINT and ROLLBACK TO SAVEPOINT statements),
+         see KDbConnection::beginTransaction() */
         NestedTransactions = 4,
         /*! forward moving is supported for cursors
          (if not available, no cursors available at all) */
@@ -75,7 +76,7 @@ public:
          with success. Set this if your driver does not support transactions at all
          Currently, this is only way to get it working with KDb.
          Keep in mind that this hack do not provide data integrity!
-         This flag is currently used for MySQL driver. */
+         This flag is currently used for Sybase driver. */
         IgnoreTransactions = 1024
     };
 
@@ -124,6 +125,7 @@ public:
     bool isSystemFieldName(const QString& name) const;
 
     /*! @return true if @a word is a driver-specific keyword.
+     Comparison is case insensitive. The function is thread-safe.
      @see KDb::isKDbSqlKeyword(const QByteArray&) */
     bool isDriverSpecificKeyword(const QByteArray& word) const;
 
@@ -395,6 +397,12 @@ protected:
       @a keywords should be 0-terminated array of null-terminated strings. */
     void initDriverSpecificKeywords(const char* const* keywords);
 
+    /*! @overload
+      Uses hash table of keywords generated by tools/sql_keywords.sh, so no
+      initialization is needed at run time. The table is not copied.
+      @since 3.3 */
+    void initDriverSpecificKeywords(const KDbUtils::StaticSetOfStrings::HashTable &keywords);
+
     /*! @return SQL statement @a sql modified by appending a "LIMIT 1" clause,
      (if possible and if @a add is @c true). Used for optimization for the server side.
      Can be reimplemented for other drivers. */
@@ -219,6 +219,42 @@ public:
      expressions. */
     QString RANDOM_FUNCTION;
 
+    /*! True if "LIMIT n" and "OFFSET n" sections of the SELECT statement are supported.
+     True by default. Used by KDbNativeStatementBuilder to generate statements for queries
+     with KDbQuerySchema::limit() or KDbQuerySchema::offset() set. If false, generating
+     such statements fails.
+     @since 3.3 */
+    bool SELECT_LIMIT_SUPPORTED;
+
+    /*! Value for the "LIMIT" section meaning "no limit". It is used for statements that only
+     have the "OFFSET" section defined because some backends do not accept "OFFSET" without
+     "LIMIT". Empty by default, what means that "LIMIT" is omitted in this case (PostgreSQL).
+     It's "-1" for SQLite and "18446744073709551615" for MySQL.
+     @since 3.3 */
+    QString SELECT_NO_LIMIT_VALUE;
+
+    /*! True if a failed statement aborts the whole transaction it is executed in, so that
+     no further statements can be executed until the transaction is rolled back. False by
+     default. It's true for PostgreSQL. If true, KDbConnection executes statements within
+     savepoints when their failure should not affect other statements of the transaction,
+     e.g. in write-behind mode (see KDbConnection::isWriteBehindEnabled()).
+     @since 3.3 */
+    bool FAILED_STATEMENT_ABORTS_TRANSACTION;
+
+    /*! True if name of the table has to be specified when dropping an index, i.e.
+     "DROP INDEX index_name ON table_name" statement is used, because index names are unique
+     only within a table. False by default, what means "DROP INDEX index_name" is used.
+     It's true for MySQL. Used by KDbNativeStatementBuilder::generateDropIndexStatement().
+     @since 3.3 */
+    bool DROP_INDEX_REQUIRES_TABLE_NAME;
+
+    /*! True if data definition statements such as "CREATE TABLE" implicitly commit the current
+     transaction. False by default. It's true for MySQL. If true, KDbConnection does not wrap
+     schema changes in nested transactions (see KDbDriver::NestedTransactions) because their
+     savepoints are lost by the implicit commit.
+     @since 3.3 */
+    bool DDL_COMMITS_TRANSACTION;
+
     /**
      * SQL statement used to obtain list of physical table names.
      * Used by default implementation of KDbConnection::drv_getTableNames(). Empty by default.
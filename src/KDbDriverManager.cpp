@@ -38,6 +38,7 @@ Q_GLOBAL_STATIC(DriverManagerInternal, s_self)
 
 DriverManagerInternal::DriverManagerInternal()
  : m_lookupDriversNeeded(true)
+ , m_mimeTypesResolved(false)
 {
     qsrand(QTime::currentTime().msec()); // needed e.g. to create random table names
 }
@@ -56,6 +57,8 @@ void DriverManagerInternal::clear()
     m_drivers.clear();
     qDeleteAll(m_driversMetaData);
     m_driversMetaData.clear();
+    m_metadata_by_mimetype.clear();
+    m_mimeTypesResolved = false;
 }
 
 void DriverManagerInternal::slotAppQuits()
@@ -99,15 +102,12 @@ void DriverManagerInternal::lookupDriversInternal()
     clearResult();
 
     //drivermanagerDebug() << "Load all plugins";
-    QList<QPluginLoader*> offers
+    const QList<KPluginMetaData> offers
             = KDbJsonTrader::self()->query(QLatin1String("KDb/Driver"));
     const QString expectedVersion = QString::fromLatin1("%1.%2")
             .arg(KDB_STABLE_VERSION_MAJOR).arg(KDB_STABLE_VERSION_MINOR);
-    QMimeDatabase mimedb;
-    foreach(const QPluginLoader *loader, offers) {
-        //QJsonObject json = loader->metaData();
-        //drivermanagerDebug() << json;
-        QScopedPointer<KDbDriverMetaData> metaData(new KDbDriverMetaData(*loader));
+    for (const KPluginMetaData &offer : offers) {
+        QScopedPointer<KDbDriverMetaData> metaData(new KDbDriverMetaData(offer));
         //qDebug() << "VER:" << metaData->version();
         if (metaData->version() != expectedVersion) {
             kdbWarning() << "Driver with ID" << metaData->id()
@@ -125,6 +125,21 @@ void DriverManagerInternal::lookupDriversInternal()
             }
             continue;
         }
+        m_driversMetaData.insert(metaData->id(), metaData.data());
+        metaData.take();
+    }
+    m_mimeTypesResolved = false;
+}
+
+void DriverManagerInternal::resolveMimeTypes()
+{
+    if (m_mimeTypesResolved) {
+        return;
+    }
+    m_mimeTypesResolved = true;
+    m_metadata_by_mimetype.clear();
+    QMimeDatabase mimedb;
+    for (KDbDriverMetaData *metaData : qAsConst(m_driversMetaData)) {
         QSet<QString> resolvedMimeTypes;
         for (const QString &mimeType : metaData->mimeTypes()) {
             const QMimeType mime = mimedb.mimeTypeForName(mimeType);
@@ -137,13 +152,9 @@ void DriverManagerInternal::lookupDriversInternal()
            resolvedMimeTypes.insert(mime.name());
         }
         for (const QString &mimeType : resolvedMimeTypes) {
-            m_metadata_by_mimetype.insertMulti(mimeType, metaData.data());
+            m_metadata_by_mimetype.insertMulti(mimeType, metaData);
         }
-        m_driversMetaData.insert(metaData->id(), metaData.data());
-        metaData.take();
     }
-    qDeleteAll(offers);
-    offers.clear();
 }
 
 QStringList DriverManagerInternal::driverIds()
@@ -175,6 +186,7 @@ QStringList DriverManagerInternal::driverIdsForMimeType(const QString &mimeType)
     if (!lookupDrivers()) {
         return QStringList();
     }
+    resolveMimeTypes();
     QMimeDatabase mimedb;
     const QMimeType mime = mimedb.mimeTypeForName(mimeType.toLower());
     if (!mime.isValid()) {
@@ -215,7 +227,9 @@ KDbDriver* DriverManagerInternal::driver(const QString& id)
     }
 
     const KDbDriverMetaData *metaData = m_driversMetaData.value(id.toLower());
-    KPluginFactory *factory = qobject_cast<KPluginFactory*>(metaData->instantiate());
+    KPluginFactory *factory = qobject_cast<KPluginFactory*>(
+        metaData->fileName().isEmpty() ? KDbJsonTrader::staticPluginInstance(metaData->id())
+                                       : metaData->instantiate());
     if (!factory) {
         m_result = KDbResult(ERR_DRIVERMANAGER,
                              tr("Could not load database driver's plugin file \"%1\".")
@@ -34,6 +34,15 @@ class KDbDriver;
 class KDbDriverMetaData;
 
 //! A driver manager for finding and loading driver plugins.
+/*! Metadata of driver plugin files found on the plugin search path is stored in
+    a persistent index keyed by file path, modification time and size, so plugin
+    files are only read when they change. Setting the KDB_NO_PLUGIN_INDEX environment
+    variable disables the index.
+
+    Drivers linked statically to the application are found as well; they have to be
+    imported using Q_IMPORT_PLUGIN() with the name of the plugin factory class, e.g.
+    Q_IMPORT_PLUGIN(SqliteDriverFactory). Statically linked drivers take precedence over
+    driver plugin files with the same ID and their KDbDriverMetaData::fileName() is empty. */
 class KDB_EXPORT KDbDriverManager
 {
     Q_DECLARE_TR_FUNCTIONS(KDbDriverManager)
@@ -71,6 +71,8 @@ private:
 
     bool lookupDrivers();
     void lookupDriversInternal();
+    //! Fills m_metadata_by_mimetype; deferred because loading the MIME database is expensive
+    void resolveMimeTypes();
     void clear();
 
     QMap<QString, KDbDriverMetaData*> m_metadata_by_mimetype;
@@ -79,6 +81,7 @@ private:
     QString m_pluginsDir;
     QStringList m_possibleProblems;
     bool m_lookupDriversNeeded;
+    bool m_mimeTypesResolved;
 };
 
 #endif
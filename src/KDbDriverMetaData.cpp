@@ -50,6 +50,11 @@ KDbDriverMetaData::KDbDriverMetaData(const QPluginLoader &loader)
 {
 }
 
+KDbDriverMetaData::KDbDriverMetaData(const KPluginMetaData &metaData)
+    : KPluginMetaData(metaData), d(new Private(this))
+{
+}
+
 KDbDriverMetaData::~KDbDriverMetaData()
 {
     delete d;
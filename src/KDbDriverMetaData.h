@@ -44,6 +44,9 @@ public:
 
 protected:
     explicit KDbDriverMetaData(const QPluginLoader &loader);
+
+    //! @since 3.3
+    explicit KDbDriverMetaData(const KPluginMetaData &metaData);
     friend class DriverManagerInternal;
 
 private:
@@ -54,6 +54,10 @@ KDbDriverBehavior::KDbDriverBehavior(KDbDriver *driver)
         , TEXT_TYPE_MAX_LENGTH(0)
         , LIKE_OPERATOR(QLatin1String("LIKE"))
         , RANDOM_FUNCTION(QLatin1String("RANDOM"))
+        , SELECT_LIMIT_SUPPORTED(true)
+        , FAILED_STATEMENT_ABORTS_TRANSACTION(false)
+        , DROP_INDEX_REQUIRES_TABLE_NAME(false)
+        , DDL_COMMITS_TRANSACTION(false)
         , d(new Private)
 {
     d->driver = driver;
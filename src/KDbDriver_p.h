@@ -71,6 +71,9 @@ public:
     */
     static const char* const kdbSQLKeywords[];
 
+    //! Perfect hash table of kdbSQLKeywords
+    static const KDbUtils::StaticSetOfStrings::HashTable kdbSQLKeywordsHash;
+
     friend class KDbDriver;
 private:
     Q_DISABLE_COPY(KDbDriverPrivate)
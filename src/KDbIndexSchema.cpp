@@ -95,7 +95,7 @@ KDbIndexSchema::KDbIndexSchema(const KDbIndexSchema& index, KDbTableSchema* pare
             KDbFieldList::clear();
             break;
         }
-        (void)KDbFieldList::addField(f);
+        (void)KDbFieldList::addField(parentTableField);
     }
 
 //! @todo copy relationships!
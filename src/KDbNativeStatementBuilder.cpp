@@ -27,8 +27,10 @@
 #include "KDbOrderByColumn.h"
 #include "KDbQueryAsterisk.h"
 #include "KDbQuerySchema.h"
+#include "KDbQuerySchema_p.h"
 #include "KDbQuerySchemaParameter.h"
 #include "KDbRelationship.h"
+#include "KDbSqlWriter.h"
 
 KDbSelectStatementOptions::~KDbSelectStatementOptions()
 {
@@ -63,12 +65,71 @@ KDbNativeStatementBuilder::~KDbNativeStatementBuilder()
     delete d;
 }
 
+//! Builds condition for keyset pagination, see KDbQuerySchema::seekAfterValues()
+//! For columns (c1, c2 DESC) and values (v1, v2) it is "(c1 > v1 OR (c1 = v1 AND c2 < v2))".
+static bool seekAfterCondition(KDbEscapedString *target, const KDbDriver *driver,
+                               KDbQuerySchema *querySchema, bool includeTableName)
+{
+    const QList<QVariant> values(querySchema->seekAfterValues());
+    const KDbOrderByColumnList *orderByColumnList = querySchema->orderByColumnList();
+    if (values.count() > orderByColumnList->count()) {
+        kdbWarning() << "Number of values to seek after" << values.count()
+                     << "is greater than number of ORDER BY columns" << orderByColumnList->count();
+        return false;
+    }
+    KDbEscapedString condition;
+    for (int i = values.count() - 1; i >= 0; --i) {
+        const KDbOrderByColumn *orderByColumn = orderByColumnList->value(i);
+        KDbField *field = orderByColumn->column() ? orderByColumn->column()->field()
+                                                  : orderByColumn->field();
+        if (!field) {
+            kdbWarning() << "No field for ORDER BY column" << i;
+            return false;
+        }
+        KDbEscapedString columnString;
+        if (field->isExpression()) {
+            columnString = '(' + field->expression().toString(driver) + ')';
+        } else {
+            if (includeTableName && field->table()) {
+                columnString = KDbEscapedString(KDb::escapeIdentifier(
+                    driver, querySchema->tableAliasOrName(field->table()->name()))) + '.';
+            }
+            columnString += KDb::escapeIdentifier(driver, field->name());
+        }
+        if (driver && field->isTextType()) { // compare the same way as ORDER BY sorts
+            columnString += driver->collationSql();
+        }
+        const KDbEscapedString valueString(KDb::valueToSql(driver, field->type(), values.at(i)));
+        const KDbEscapedString greaterThan(columnString
+            + (orderByColumn->sortOrder() == KDbOrderByColumn::SortOrder::Ascending ? " > " : " < ")
+            + valueString);
+        if (condition.isEmpty()) {
+            condition = greaterThan;
+        } else {
+            condition = '(' + greaterThan + " OR (" + columnString + " = " + valueString
+                + " AND " + condition + "))";
+        }
+    }
+    *target = condition;
+    return true;
+}
+
+static bool cachedSelectStatementInternal(KDbEscapedString *target,
+                                          KDbConnection *connection,
+                                          KDb::IdentifierEscapingType dialect,
+                                          KDbQuerySchema* querySchema,
+                                          const KDbSelectStatementOptions& options,
+                                          const QList<QVariant>& parameters,
+                                          KDbQuerySchemaCachedStatement::LookupQueries *lookupQueries);
+
+//! Generates SELECT statement for @a querySchema, lookup queries used are appended to @a lookupQueries
 static bool selectStatementInternal(KDbEscapedString *target,
                                     KDbConnection *connection,
                                     KDb::IdentifierEscapingType dialect,
                                     KDbQuerySchema* querySchema,
                                     const KDbSelectStatementOptions& options,
-                                    const QList<QVariant>& parameters)
+                                    const QList<QVariant>& parameters,
+                                    KDbQuerySchemaCachedStatement::LookupQueries *lookupQueries)
 {
     Q_ASSERT(target);
     Q_ASSERT(querySchema);
@@ -245,13 +306,14 @@ static bool selectStatementInternal(KDbEscapedString *target,
                         driver,
                         kdb_subquery_prefix + lookupQuery->name() + QLatin1Char('_')
                             + QString::number(internalUniqueQueryAliasNumber++)));
-                    KDbNativeStatementBuilder builder(connection, dialect);
                     KDbEscapedString subSql;
-                    if (!builder.generateSelectStatement(&subSql, lookupQuery, options,
-                                                         parameters))
+                    if (!cachedSelectStatementInternal(&subSql, connection, dialect, lookupQuery,
+                                                       options, parameters, lookupQueries))
                     {
                         return false;
                     }
+                    lookupQueries->append(qMakePair<const KDbQuerySchema*, quint64>(
+                        lookupQuery, KDbQuerySchemaPrivate::revision(lookupQuery)));
                     s_additional_joins += KDbEscapedString("LEFT OUTER JOIN (%1) AS %2 ON %3.%4=%5.%6")
                         .arg(subSql)
                         .arg(internalUniqueQueryAlias)
@@ -331,7 +393,9 @@ static bool selectStatementInternal(KDbEscapedString *target,
             if (!s_from.isEmpty())
                 s_from += ", ";
             KDbEscapedString subSql;
-            if (!selectStatementInternal(&subSql, connection, dialect, subQuery, options, parameters)) {
+            if (!selectStatementInternal(&subSql, connection, dialect, subQuery, options, parameters,
+                                         lookupQueries))
+            {
                 return false;
             }
             s_from += '(' + subSql + ") AS "
@@ -384,10 +448,49 @@ static bool selectStatementInternal(KDbEscapedString *target,
             s_where = querySchema->whereExpression().toString(driver, paramValuesItPtr);
         }
     }
+    //KEYSET PAGINATION
+    KDbEscapedString s_seek;
+    if (!querySchema->seekAfterValues().isEmpty()) {
+        if (!seekAfterCondition(&s_seek, driver, querySchema, !singleTable)) {
+            return false;
+        }
+    }
+    const bool grouped = querySchema->isGrouped();
+    if (!s_seek.isEmpty() && !grouped) {
+        if (s_where.isEmpty()) {
+            s_where = s_seek;
+        } else {
+            s_where = '(' + s_where + ") AND " + s_seek;
+        }
+    }
     if (!s_where.isEmpty())
         sql += " WHERE " + s_where;
-//! @todo (js) add other sql parts
-    //(use wasWhere here)
+
+    // GROUP BY
+    KDbEscapedString s_groupBy;
+    foreach(const KDbExpression &expr, querySchema->groupByExpressions()) {
+        if (!s_groupBy.isEmpty())
+            s_groupBy += ", ";
+        s_groupBy += expr.toString(driver, paramValuesItPtr);
+    }
+    if (!s_groupBy.isEmpty())
+        sql += " GROUP BY " + s_groupBy;
+
+    // HAVING; for grouped queries ORDER BY columns are known after grouping
+    // so the keyset pagination condition belongs here
+    KDbEscapedString s_having;
+    if (!querySchema->havingExpression().isNull()) {
+        s_having = querySchema->havingExpression().toString(driver, paramValuesItPtr);
+    }
+    if (!s_seek.isEmpty() && grouped) {
+        if (s_having.isEmpty()) {
+            s_having = s_seek;
+        } else {
+            s_having = '(' + s_having + ") AND " + s_seek;
+        }
+    }
+    if (!s_having.isEmpty())
+        sql += " HAVING " + s_having;
 
     // ORDER BY
     KDbEscapedString orderByString(querySchema->orderByColumnList()->toSqlString(
@@ -415,25 +518,78 @@ static bool selectStatementInternal(KDbEscapedString *target,
     if (!orderByString.isEmpty())
         sql += (" ORDER BY " + orderByString);
 
+    // LIMIT, OFFSET
+    if (querySchema->limit() >= 0 || querySchema->offset() > 0) {
+        if (driver && !KDbDriverPrivate::behavior(driver)->SELECT_LIMIT_SUPPORTED) {
+            kdbWarning() << "LIMIT and OFFSET are not supported by the driver";
+            return false;
+        }
+        if (querySchema->limit() >= 0) {
+            sql += " LIMIT " + KDbEscapedString::number(querySchema->limit());
+        } else if (driver && !KDbDriverPrivate::behavior(driver)->SELECT_NO_LIMIT_VALUE.isEmpty()) {
+            sql += " LIMIT " + KDbDriverPrivate::behavior(driver)->SELECT_NO_LIMIT_VALUE;
+        }
+        if (querySchema->offset() > 0) {
+            sql += " OFFSET " + KDbEscapedString::number(querySchema->offset());
+        }
+    }
+
     //kdbDebug() << sql;
     *target = sql;
     return true;
 }
 
+//! Like selectStatementInternal() but reuses statements cached by the query schema
+static bool cachedSelectStatementInternal(KDbEscapedString *target,
+                                          KDbConnection *connection,
+                                          KDb::IdentifierEscapingType dialect,
+                                          KDbQuerySchema* querySchema,
+                                          const KDbSelectStatementOptions& options,
+                                          const QList<QVariant>& parameters,
+                                          KDbQuerySchemaCachedStatement::LookupQueries *lookupQueries)
+{
+    Q_ASSERT(target);
+    Q_ASSERT(querySchema);
+    if (!querySchema->statement().isEmpty()) {
+        *target = querySchema->statement();
+        return true;
+    }
+    KDbEscapedString sql = KDbQuerySchemaPrivate::cachedStatement(querySchema, connection, dialect,
+                                                                  options, parameters, lookupQueries);
+    if (!sql.isEmpty()) {
+        *target = sql;
+        return true;
+    }
+    KDbQuerySchemaCachedStatement::LookupQueries usedLookupQueries;
+    if (!selectStatementInternal(&sql, connection, dialect, querySchema, options, parameters,
+                                 &usedLookupQueries))
+    {
+        return false;
+    }
+    KDbQuerySchemaPrivate::insertCachedStatement(querySchema, connection, dialect, options,
+                                                 parameters, usedLookupQueries, sql);
+    if (lookupQueries) {
+        *lookupQueries += usedLookupQueries;
+    }
+    *target = sql;
+    return true;
+}
+
 bool KDbNativeStatementBuilder::generateSelectStatement(KDbEscapedString *target,
                                                         KDbQuerySchema* querySchema,
                                                         const KDbSelectStatementOptions& options,
                                                         const QList<QVariant>& parameters) const
 {
-    return selectStatementInternal(target, d->connection, d->dialect, querySchema, options, parameters);
+    return cachedSelectStatementInternal(target, d->connection, d->dialect, querySchema, options,
+                                         parameters, nullptr);
 }
 
 bool KDbNativeStatementBuilder::generateSelectStatement(KDbEscapedString *target,
                                                         KDbQuerySchema* querySchema,
                                                         const QList<QVariant>& parameters) const
 {
-    return selectStatementInternal(target, d->connection, d->dialect, querySchema, KDbSelectStatementOptions(),
-                                   parameters);
+    return cachedSelectStatementInternal(target, d->connection, d->dialect, querySchema,
+                                         KDbSelectStatementOptions(), parameters, nullptr);
 }
 
 bool KDbNativeStatementBuilder::generateSelectStatement(KDbEscapedString *target,
@@ -443,6 +599,88 @@ bool KDbNativeStatementBuilder::generateSelectStatement(KDbEscapedString *target
     return generateSelectStatement(target, tableSchema->query(), options);
 }
 
+//! Writes type of @a field for @a driver, see KDbNativeStatementBuilder::generateFieldType()
+static void writeFieldType(KDbSqlWriter *writer, const KDbDriver *driver, const KDbField &field)
+{
+    const KDbDriverBehavior *behavior = KDbDriverPrivate::behavior(driver);
+    const KDbField::Type type = field.type(); // cache: evaluating type of expressions can be expensive
+    if (field.isAutoIncrement() && !behavior->AUTO_INCREMENT_TYPE.isEmpty())
+        *writer << behavior->AUTO_INCREMENT_TYPE;
+    else
+        *writer << driver->sqlTypeName(type, field);
+
+    if (KDbField::isIntegerType(type) && field.isUnsigned()) {
+        *writer << ' ' << behavior->UNSIGNED_TYPE_KEYWORD;
+    }
+
+    if (KDbField::isFPNumericType(type) && field.precision() > 0) {
+        *writer << '(';
+        writer->appendNumber(qint64(field.precision()));
+        if (field.scale() > 0) {
+            *writer << ',';
+            writer->appendNumber(qint64(field.scale()));
+        }
+        *writer << ')';
+    }
+    else if (type == KDbField::Text) {
+        int realMaxLen;
+        if (behavior->TEXT_TYPE_MAX_LENGTH == 0) {
+            realMaxLen = field.maxLength(); // allow to skip (N)
+        }
+        else { // max length specified by driver
+            if (field.maxLength() == 0) { // as long as possible
+                realMaxLen = behavior->TEXT_TYPE_MAX_LENGTH;
+            }
+            else { // not longer than specified by driver
+                realMaxLen = qMin(behavior->TEXT_TYPE_MAX_LENGTH, field.maxLength());
+            }
+        }
+        if (realMaxLen > 0) {
+            *writer << '(';
+            writer->appendNumber(qint64(realMaxLen));
+            *writer << ')';
+        }
+    }
+}
+
+/*! Writes definition of @a field for @a driver, see KDbNativeStatementBuilder::generateFieldDefinition().
+ Identifiers are escaped by @a writer. */
+static void writeFieldDefinition(KDbSqlWriter *writer, const KDbDriver *driver, const KDbField &field)
+{
+    const KDbDriverBehavior *behavior = KDbDriverPrivate::behavior(driver);
+    writer->appendIdentifier(field.name()) << ' ';
+    const bool autoinc = field.isAutoIncrement();
+    const bool pk = field.isPrimaryKey()
+            || (autoinc && writer->driver() && behavior->AUTO_INCREMENT_REQUIRES_PK);
+//! @todo warning: ^^^^^ this allows only one autonumber per table when AUTO_INCREMENT_REQUIRES_PK==true!
+    if (autoinc && behavior->SPECIAL_AUTO_INCREMENT_DEF) {
+        *writer << behavior->AUTO_INCREMENT_TYPE << ' '
+                << (pk ? behavior->AUTO_INCREMENT_PK_FIELD_OPTION : behavior->AUTO_INCREMENT_FIELD_OPTION);
+    } else {
+        writeFieldType(writer, driver, field);
+
+        if (autoinc) {
+            *writer << ' ' << (pk ? behavior->AUTO_INCREMENT_PK_FIELD_OPTION
+                                  : behavior->AUTO_INCREMENT_FIELD_OPTION);
+        }
+        else {
+            //! @todo here is automatically a single-field key created
+            if (pk)
+                *writer << " PRIMARY KEY";
+        }
+        if (!pk && field.isUniqueKey())
+            *writer << " UNIQUE";
+///@todo IS this ok for all engines?: if (!autoinc && !field.isPrimaryKey() && field.isNotNull())
+        if (!autoinc && !pk && field.isNotNull())
+            *writer << " NOT NULL"; //only add not null option if no autocommit is set
+        if (driver->supportsDefaultValue(field) && field.defaultValue().isValid()) {
+            const KDbEscapedString valToSql(driver->valueToSql(&field, field.defaultValue()));
+            if (!valToSql.isEmpty()) //for sanity
+                *writer << " DEFAULT " << valToSql;
+        }
+    }
+}
+
 bool KDbNativeStatementBuilder::generateCreateTableStatement(KDbEscapedString *target,
                                                              const KDbTableSchema& tableSchema) const
 {
@@ -451,85 +689,89 @@ bool KDbNativeStatementBuilder::generateCreateTableStatement(KDbEscapedString *t
     }
     // Each SQL identifier needs to be escaped in the generated query.
     const KDbDriver *driver = d->dialect == KDb::DriverEscaping ? d->connection->driver() : nullptr;
-    KDbEscapedString sql;
-    sql.reserve(4096);
-    sql = KDbEscapedString("CREATE TABLE ")
-            + KDb::escapeIdentifier(driver, tableSchema.name()) + " (";
+    KDbSqlWriter writer(driver, 4096);
+    writer << "CREATE TABLE ";
+    writer.appendIdentifier(tableSchema.name()) << " (";
     bool first = true;
     for (const KDbField *field : *tableSchema.fields()) {
         if (first)
             first = false;
         else
-            sql += ", ";
-        KDbEscapedString v = KDbEscapedString(KDb::escapeIdentifier(driver, field->name())) + ' ';
-        const bool autoinc = field->isAutoIncrement();
-        const bool pk = field->isPrimaryKey() || (autoinc && driver && driver->behavior()->AUTO_INCREMENT_REQUIRES_PK);
-//! @todo warning: ^^^^^ this allows only one autonumber per table when AUTO_INCREMENT_REQUIRES_PK==true!
-        const KDbField::Type type = field->type(); // cache: evaluating type of expressions can be expensive
-        if (autoinc && d->connection->driver()->behavior()->SPECIAL_AUTO_INCREMENT_DEF) {
-            if (pk)
-                v.append(d->connection->driver()->behavior()->AUTO_INCREMENT_TYPE).append(' ')
-                 .append(d->connection->driver()->behavior()->AUTO_INCREMENT_PK_FIELD_OPTION);
-            else
-                v.append(d->connection->driver()->behavior()->AUTO_INCREMENT_TYPE).append(' ')
-                 .append(d->connection->driver()->behavior()->AUTO_INCREMENT_FIELD_OPTION);
-        } else {
-            if (autoinc && !d->connection->driver()->behavior()->AUTO_INCREMENT_TYPE.isEmpty())
-                v += d->connection->driver()->behavior()->AUTO_INCREMENT_TYPE;
-            else
-                v += d->connection->driver()->sqlTypeName(type, *field);
+            writer << ", ";
+        writeFieldDefinition(&writer, d->connection->driver(), *field);
+    }
+    writer << ')';
+    *target = writer.toString();
+    return true;
+}
 
-            if (KDbField::isIntegerType(type) && field->isUnsigned()) {
-                v.append(' ').append(d->connection->driver()->behavior()->UNSIGNED_TYPE_KEYWORD);
-            }
+bool KDbNativeStatementBuilder::generateFieldDefinition(KDbEscapedString *target,
+                                                        const KDbField &field) const
+{
+    if (!target) {
+        return false;
+    }
+    const KDbDriver *driver = d->dialect == KDb::DriverEscaping ? d->connection->driver() : nullptr;
+    KDbSqlWriter writer(driver);
+    writeFieldDefinition(&writer, d->connection->driver(), field);
+    *target = writer.toString();
+    return true;
+}
 
-            if (KDbField::isFPNumericType(type) && field->precision() > 0) {
-                if (field->scale() > 0)
-                    v += QString::fromLatin1("(%1,%2)").arg(field->precision()).arg(field->scale());
-                else
-                    v += QString::fromLatin1("(%1)").arg(field->precision());
-            }
-            else if (type == KDbField::Text) {
-                int realMaxLen;
-                if (d->connection->driver()->behavior()->TEXT_TYPE_MAX_LENGTH == 0) {
-                    realMaxLen = field->maxLength(); // allow to skip (N)
-                }
-                else { // max length specified by driver
-                    if (field->maxLength() == 0) { // as long as possible
-                        realMaxLen = d->connection->driver()->behavior()->TEXT_TYPE_MAX_LENGTH;
-                    }
-                    else { // not longer than specified by driver
-                        realMaxLen = qMin(d->connection->driver()->behavior()->TEXT_TYPE_MAX_LENGTH, field->maxLength());
-                    }
-                }
-                if (realMaxLen > 0) {
-                    v += QString::fromLatin1("(%1)").arg(realMaxLen);
-                }
-            }
+bool KDbNativeStatementBuilder::generateFieldType(KDbEscapedString *target,
+                                                  const KDbField &field) const
+{
+    if (!target) {
+        return false;
+    }
+    KDbSqlWriter writer(d->connection->driver(), 64);
+    writeFieldType(&writer, d->connection->driver(), field);
+    *target = writer.toString();
+    return true;
+}
 
-            if (autoinc) {
-                v.append(' ').append(pk ? d->connection->driver()->behavior()->AUTO_INCREMENT_PK_FIELD_OPTION
-                                        : d->connection->driver()->behavior()->AUTO_INCREMENT_FIELD_OPTION);
-            }
-            else {
-                //! @todo here is automatically a single-field key created
-                if (pk)
-                    v += " PRIMARY KEY";
-            }
-            if (!pk && field->isUniqueKey())
-                v += " UNIQUE";
-///@todo IS this ok for all engines?: if (!autoinc && !field->isPrimaryKey() && field->isNotNull())
-            if (!autoinc && !pk && field->isNotNull())
-                v += " NOT NULL"; //only add not null option if no autocommit is set
-            if (d->connection->driver()->supportsDefaultValue(*field) && field->defaultValue().isValid()) {
-                KDbEscapedString valToSql(d->connection->driver()->valueToSql(field, field->defaultValue()));
-                if (!valToSql.isEmpty()) //for sanity
-                    v += " DEFAULT " + valToSql;
-            }
-        }
-        sql += v;
+QString KDbNativeStatementBuilder::indexName(const KDbIndexSchema& index)
+{
+    if (!index.name().isEmpty()) {
+        return index.name();
     }
-    sql += ')';
-    *target = sql;
+    QString name(index.table() ? index.table()->name() : QString());
+    for (const KDbField *field : *index.fields()) {
+        name += QLatin1Char('_') + field->name();
+    }
+    return name + QLatin1String("_idx");
+}
+
+bool KDbNativeStatementBuilder::generateCreateIndexStatement(KDbEscapedString *target,
+                                                             const KDbIndexSchema& index) const
+{
+    if (!target || !index.table() || index.fieldCount() == 0) {
+        return false;
+    }
+    const KDbDriver *driver = d->dialect == KDb::DriverEscaping ? d->connection->driver() : nullptr;
+    KDbSqlWriter writer(driver);
+    writer << (index.isUnique() ? "CREATE UNIQUE INDEX " : "CREATE INDEX ");
+    writer.appendIdentifier(indexName(index)) << " ON ";
+    writer.appendIdentifier(index.table()->name()) << " (";
+    writer.appendFieldNames(*index.fields(), ", ") << ')';
+    *target = writer.toString();
+    return true;
+}
+
+bool KDbNativeStatementBuilder::generateDropIndexStatement(KDbEscapedString *target,
+                                                           const KDbIndexSchema& index) const
+{
+    if (!target || !index.table()) {
+        return false;
+    }
+    const KDbDriver *driver = d->dialect == KDb::DriverEscaping ? d->connection->driver() : nullptr;
+    KDbSqlWriter writer(driver);
+    writer << "DROP INDEX ";
+    writer.appendIdentifier(indexName(index));
+    if (d->connection->driver()->behavior()->DROP_INDEX_REQUIRES_TABLE_NAME) {
+        writer << " ON ";
+        writer.appendIdentifier(index.table()->name());
+    }
+    *target = writer.toString();
     return true;
 }
@@ -43,6 +43,17 @@ public:
      query defined by @a querySchema, @a params and @a options.
 
      @a target and @a querySchema must not be 0. The statement is written to @ref *target on success.
+
+     Generated statements are cached by @a querySchema for given connection, dialect, @a options
+     and @a parameters, so repeated calls (e.g. by KDbCursor::reopen()) are cheap. The cache is
+     invalidated whenever @a querySchema changes or when tables and queries of the connection
+     (such as record sources of lookup fields) change.
+
+     Record limit, offset and keyset pagination defined for @a querySchema (see
+     KDbQuerySchema::limit()) are rendered for the driver; generation fails if the driver
+     does not support them (see KDbDriverBehavior::SELECT_LIMIT_SUPPORTED).
+     GROUP BY and HAVING sections are rendered for grouped queries (see
+     KDbQuerySchema::isGrouped()); keyset pagination condition is then added to HAVING.
      @return true on success. */
     bool generateSelectStatement(KDbEscapedString *target, KDbQuerySchema* querySchema,
                                  const KDbSelectStatementOptions& options,
@@ -74,6 +85,46 @@ public:
     bool generateCreateTableStatement(KDbEscapedString *target,
                                       const KDbTableSchema& tableSchema) const;
 
+    /*! Generates a native definition of @a field as used in "CREATE TABLE ..." statement,
+     e.g. "name VARCHAR(50) NOT NULL", also usable in "ALTER TABLE ... ADD COLUMN ..." statements.
+     The definition is written to @ref *target on success.
+     @return true on success.
+     @since 3.3 */
+    bool generateFieldDefinition(KDbEscapedString *target, const KDbField &field) const;
+
+    /*! Generates a native type of @a field as used in field definitions, e.g. "VARCHAR(50)"
+     or "NUMERIC(10,2)", also usable in statements changing type of an existing column.
+     Constraints and default values are not included.
+     The type is written to @ref *target on success.
+     @return true on success.
+     @since 3.3 */
+    bool generateFieldType(KDbEscapedString *target, const KDbField &field) const;
+
+    /*! Generates a native "CREATE [UNIQUE] INDEX ..." statement string that can be used for
+     creation of @a index in the database. @a index has to be assigned to a table and contain
+     at least one field. If @a index has no name, a name is generated from names of the table
+     and indexed fields, e.g. "persons_surname_idx" (see indexName()).
+     The statement is written to @ref *target on success.
+     @return true on success.
+     @since 3.3 */
+    bool generateCreateIndexStatement(KDbEscapedString *target,
+                                      const KDbIndexSchema& index) const;
+
+    /*! Generates a native "DROP INDEX ..." statement string that can be used for removing
+     @a index from the database. The table name is added if required by the driver
+     (see KDbDriverBehavior::DROP_INDEX_REQUIRES_TABLE_NAME).
+     The statement is written to @ref *target on success.
+     @return true on success.
+     @since 3.3 */
+    bool generateDropIndexStatement(KDbEscapedString *target,
+                                    const KDbIndexSchema& index) const;
+
+    /*! @return name of @a index used in the database.
+     It is KDbIndexSchema::name() or, if it is empty, a name generated from names of the table
+     and indexed fields.
+     @since 3.3 */
+    static QString indexName(const KDbIndexSchema& index);
+
 private:
     Q_DISABLE_COPY(KDbNativeStatementBuilder)
     class Private;
@@ -0,0 +1,429 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbParallelScan.h"
+#include "KDbBackgroundTask_p.h"
+#include "KDbConnection.h"
+#include "KDbConnectionOptions.h"
+#include "KDbCursor.h"
+#include "KDbDriver.h"
+#include "KDbOrderByColumn.h"
+#include "KDbQuerySchema.h"
+#include "KDbRecordData.h"
+#include "KDbTableSchema.h"
+#include "KDbTransaction.h"
+
+#include <QThread>
+
+#include <limits>
+
+namespace {
+
+//! A range of records read by one thread
+struct ScanPartition
+{
+    ~ScanPartition()
+    {
+        qDeleteAll(records);
+    }
+
+    KDbConnection *connection = nullptr; //!< owned, created and deleted in the scan's thread
+    KDbQuerySchema *query = nullptr; //!< owned copy of the query limited to the range
+    QThread *thread = nullptr;
+
+    // members below are guarded by ScanShared::mutex
+    QList<KDbRecordData*> records;
+    bool connected = false;
+    bool finished = false;
+};
+
+//! State shared by the scan and its threads, mutex also guards mutable members of ScanPartition
+struct ScanShared : public KDbBackgroundTaskShared
+{
+    QString databaseName;
+    int batchSize = 256;
+};
+
+//! Thread reading records of one partition
+class ScanThread : public QThread
+{
+public:
+    ScanThread(ScanShared *shared, ScanPartition *partition, int index)
+        : m_shared(shared), m_partition(partition), m_index(index) {}
+
+protected:
+    void run() override
+    {
+        KDbConnection *conn = m_partition->connection;
+        KDbResult result;
+        const bool ok = read(conn, &result);
+        if (!ok && !result.isError()) {
+            result = conn->result();
+        }
+        QMutexLocker locker(&m_shared->mutex);
+        if (m_partition->connected) {
+            m_partition->connected = false;
+            locker.unlock();
+            conn->disconnect();
+            locker.relock();
+        }
+        m_partition->finished = true;
+        if (!ok) {
+            m_shared->setFailure(result); // stops other partitions
+        }
+        m_shared->threadDone();
+    }
+
+private:
+    //! Passes records of @a batch to the partition
+    void deliver(QList<KDbRecordData*> *batch)
+    {
+        if (batch->isEmpty()) {
+            return;
+        }
+        QMutexLocker locker(&m_shared->mutex);
+        m_partition->records += *batch;
+        batch->clear();
+        m_shared->post(KDbBackgroundEvent::Kind::Progress, m_index);
+    }
+
+    bool read(KDbConnection *conn, KDbResult *result)
+    {
+        if (!conn->connect() || !conn->useDatabase(m_shared->databaseName, false)) {
+            return false;
+        }
+        {
+            QMutexLocker locker(&m_shared->mutex);
+            m_partition->connected = true;
+            if (m_shared->cancelRequested) {
+                return true;
+            }
+        }
+        // one read transaction gives consistent view of the partition, e.g. in SQLite's WAL mode
+        KDbTransaction transaction = conn->beginTransaction();
+        KDbCursor *cursor = conn->executeQuery(m_partition->query);
+        if (!cursor) {
+            conn->rollbackTransaction(transaction, KDbTransaction::CommitOption::IgnoreInactive);
+            return false;
+        }
+        const int batchSize = m_shared->batchSize;
+        QList<KDbRecordData*> batch;
+        bool ok = true;
+        while (!cursor->eof() && !m_shared->isCancelRequested()) {
+            KDbRecordData *record = cursor->storeCurrentRecord();
+            if (!record) {
+                break;
+            }
+            batch.append(record);
+            if (batch.count() >= batchSize) {
+                deliver(&batch);
+            }
+            cursor->moveNext();
+        }
+        deliver(&batch);
+        if (cursor->result().isError()) {
+            *result = cursor->result();
+            ok = false;
+        }
+        conn->deleteCursor(cursor);
+        conn->rollbackTransaction(transaction, KDbTransaction::CommitOption::IgnoreInactive);
+        return ok;
+    }
+
+    ScanShared * const m_shared;
+    ScanPartition * const m_partition;
+    const int m_index;
+};
+}
+
+class Q_DECL_HIDDEN KDbParallelScan::Private
+{
+public:
+    Private() {}
+
+    ~Private()
+    {
+        qDeleteAll(partitions);
+    }
+
+    //! Creates partitions for key range from @a min to @a max
+    bool createPartitions(KDbParallelScan *scan, KDbField *keyField, qint64 min, qint64 max);
+
+    KDbConnection *connection = nullptr;
+    KDbTableSchema *table = nullptr;
+    KDbQuerySchema *query = nullptr;
+    int partitionCount = QThread::idealThreadCount();
+    bool started = false;
+    int nextMergedPartition = 0; //!< partition used by takeRecords()
+    ScanShared shared;
+    QList<ScanPartition*> partitions;
+
+private:
+    Q_DISABLE_COPY(Private)
+};
+
+bool KDbParallelScan::Private::createPartitions(KDbParallelScan *scan, KDbField *keyField,
+                                                qint64 min, qint64 max)
+{
+    const quint64 span = quint64(max) - quint64(min) + 1; // 0 for the whole qint64 range
+    int count = qMax(1, partitionCount);
+    if (span > 0 && span < quint64(count)) {
+        count = int(span);
+    }
+    const quint64 rangeSize = span > 0 ? span / quint64(count)
+                                       : (std::numeric_limits<quint64>::max() / quint64(count));
+    KDbConnectionOptions options(*connection->options());
+    options.setReadOnly(true);
+    qint64 low = min;
+    for (int i = 0; i < count; ++i) {
+        const qint64 high = (i == count - 1) ? max : qint64(quint64(low) + rangeSize - 1);
+        ScanPartition *partition = new ScanPartition;
+        partitions.append(partition);
+        partition->query = query ? new KDbQuerySchema(*query, connection)
+                                 : new KDbQuerySchema(table);
+        QString errorMessage;
+        QString errorDescription;
+        if (!partition->query->addToWhereExpression(keyField, low, KDbToken::GREATER_OR_EQUAL,
+                                                    &errorMessage, &errorDescription)
+            || !partition->query->addToWhereExpression(keyField, high, KDbToken::LESS_OR_EQUAL,
+                                                       &errorMessage, &errorDescription))
+        {
+            scan->m_result = KDbResult(ERR_OTHER, errorDescription);
+            scan->m_result.setMessageTitle(errorMessage);
+            return false;
+        }
+        if (partition->query->orderByColumnList()->isEmpty()) {
+            partition->query->orderByColumnList()->appendField(keyField);
+        }
+        partition->connection = connection->driver()->createConnection(connection->data(),
+                                                                       options);
+        if (!partition->connection) {
+            scan->m_result = connection->driver()->result();
+            return false;
+        }
+        low = qint64(quint64(high) + 1);
+    }
+    return true;
+}
+
+KDbParallelScan::KDbParallelScan(KDbConnection *connection, KDbTableSchema *table,
+                                 QObject *parent)
+    : QObject(parent)
+    , d(new Private)
+{
+    d->connection = connection;
+    d->table = table;
+    d->shared.owner = this;
+}
+
+KDbParallelScan::KDbParallelScan(KDbConnection *connection, KDbQuerySchema *query,
+                                 QObject *parent)
+    : QObject(parent)
+    , d(new Private)
+{
+    d->connection = connection;
+    d->query = query;
+    d->shared.owner = this;
+}
+
+KDbParallelScan::~KDbParallelScan()
+{
+    cancel();
+    for (ScanPartition *partition : qAsConst(d->partitions)) {
+        if (partition->thread) {
+            partition->thread->wait();
+            delete partition->thread;
+        }
+        delete partition->connection;
+        delete partition->query;
+    }
+    delete d;
+}
+
+int KDbParallelScan::partitionCount() const
+{
+    return d->partitionCount;
+}
+
+void KDbParallelScan::setPartitionCount(int count)
+{
+    if (!d->started) {
+        d->partitionCount = qMax(1, count);
+    }
+}
+
+int KDbParallelScan::batchSize() const
+{
+    QMutexLocker locker(&d->shared.mutex);
+    return d->shared.batchSize;
+}
+
+void KDbParallelScan::setBatchSize(int size)
+{
+    QMutexLocker locker(&d->shared.mutex);
+    d->shared.batchSize = qMax(1, size);
+}
+
+bool KDbParallelScan::start()
+{
+    clearResult();
+    if (d->started) {
+        m_result = KDbResult(ERR_OTHER, tr("Scan has already been started."));
+        return false;
+    }
+    if (!d->connection || !d->connection->isDatabaseUsed()) {
+        m_result = KDbResult(ERR_NO_DB_USED, tr("No database is used by the connection."));
+        return false;
+    }
+    KDbTableSchema *table = d->query ? d->query->masterTable() : d->table;
+    if (!table || (d->query && (d->query->tables()->count() != 1
+                                || d->query->isGrouped() // GROUP BY, HAVING or aggregates
+                                || d->query->limit() >= 0 || d->query->offset() > 0)))
+    {
+        m_result = KDbResult(ERR_OTHER,
+                             tr("Only single-table queries without grouping, aggregate functions "
+                                "and limits can be scanned in parallel."));
+        return false;
+    }
+    KDbIndexSchema *pkey = table->primaryKey();
+    KDbField *keyField = (pkey && pkey->fieldCount() == 1) ? pkey->field(0) : nullptr;
+    if (!keyField || !keyField->isIntegerType()) {
+        m_result = KDbResult(ERR_OTHER,
+                             tr("Table \"%1\" has no integer primary key needed to scan it "
+                                "in parallel.").arg(table->name()));
+        return false;
+    }
+    KDbRecordData range;
+    const QString key(d->connection->escapeIdentifier(keyField->name()));
+    const tristate res = d->connection->querySingleRecord(
+        KDbEscapedString("SELECT MIN(%1), MAX(%1) FROM %2")
+            .arg(KDbEscapedString(key), KDbEscapedString(d->connection->escapeIdentifier(table->name()))),
+        &range);
+    if (res == false) {
+        m_result = d->connection->result();
+        return false;
+    }
+    d->started = true;
+    d->shared.databaseName = d->connection->currentDatabase();
+    if (res == cancelled || range.count() < 2 || range.at(0).isNull()) { // no records
+        d->shared.post(KDbBackgroundEvent::Kind::Finished);
+        return true;
+    }
+    bool minOk;
+    bool maxOk;
+    const qint64 min = range.at(0).toLongLong(&minOk);
+    const qint64 max = range.at(1).toLongLong(&maxOk);
+    if (!minOk || !maxOk || !d->createPartitions(this, keyField, min, max)) {
+        if (!m_result.isError()) {
+            m_result = KDbResult(ERR_OTHER, tr("Could not compute partitions for table \"%1\".")
+                                            .arg(table->name()));
+        }
+        for (ScanPartition *partition : qAsConst(d->partitions)) {
+            delete partition->connection;
+            delete partition->query;
+        }
+        qDeleteAll(d->partitions);
+        d->partitions.clear();
+        d->started = false;
+        return false;
+    }
+    d->shared.running = d->partitions.count();
+    for (int i = 0; i < d->partitions.count(); ++i) {
+        ScanPartition *partition = d->partitions.at(i);
+        partition->thread = new ScanThread(&d->shared, partition, i);
+        partition->thread->start();
+    }
+    return true;
+}
+
+int KDbParallelScan::startedPartitionCount() const
+{
+    return d->partitions.count();
+}
+
+bool KDbParallelScan::isFinished() const
+{
+    QMutexLocker locker(&d->shared.mutex);
+    return d->started && d->shared.running == 0;
+}
+
+QList<KDbRecordData*> KDbParallelScan::takeRecords(int partition)
+{
+    QList<KDbRecordData*> records;
+    if (partition < 0 || partition >= d->partitions.count()) {
+        return records;
+    }
+    QMutexLocker locker(&d->shared.mutex);
+    records.swap(d->partitions.at(partition)->records);
+    return records;
+}
+
+QList<KDbRecordData*> KDbParallelScan::takeRecords()
+{
+    QList<KDbRecordData*> records;
+    QMutexLocker locker(&d->shared.mutex);
+    while (d->nextMergedPartition < d->partitions.count()) {
+        ScanPartition *partition = d->partitions.at(d->nextMergedPartition);
+        records += partition->records;
+        partition->records.clear();
+        if (!partition->finished) {
+            break;
+        }
+        ++d->nextMergedPartition;
+    }
+    return records;
+}
+
+void KDbParallelScan::cancel()
+{
+    QMutexLocker locker(&d->shared.mutex);
+    if (d->shared.cancelRequested) {
+        return;
+    }
+    d->shared.cancelRequested = true;
+    for (ScanPartition *partition : qAsConst(d->partitions)) {
+        if (partition->connected && !partition->finished) {
+            // the connection can't be disconnected while the mutex is locked
+            partition->connection->cancelQuery();
+        }
+    }
+}
+
+bool KDbParallelScan::waitForFinished(int timeout)
+{
+    return d->shared.waitForFinished(timeout);
+}
+
+bool KDbParallelScan::event(QEvent *event)
+{
+    const KDbBackgroundEvent *scanEvent = KDbBackgroundEvent::cast(event);
+    if (scanEvent) {
+        if (scanEvent->kind() == KDbBackgroundEvent::Kind::Progress) {
+            emit recordsAvailable(int(scanEvent->value()));
+        } else {
+            const KDbResult failure(d->shared.failure());
+            if (failure.isError()) {
+                m_result = failure;
+            }
+            emit finished();
+        }
+        return true;
+    }
+    return QObject::event(event);
+}
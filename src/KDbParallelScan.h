@@ -0,0 +1,153 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_PARALLELSCAN_H
+#define KDB_PARALLELSCAN_H
+
+#include <QObject>
+
+#include "KDbResult.h"
+
+class KDbConnection;
+class KDbQuerySchema;
+class KDbRecordData;
+class KDbTableSchema;
+
+/**
+ * @brief Reads all records of a table or a single-table query using multiple threads
+ *
+ * The records are split into partitions by ranges of the master table's integer primary key
+ * (for SQLite this is the rowid, so every range is a cheap B-tree range scan). Each partition
+ * is read by its own thread using its own read-only connection opened for the same database.
+ * Every partition is read within a transaction, so with SQLite databases in WAL mode each
+ * partition sees a consistent snapshot while the database is being modified. Partitions are
+ * not synchronized with each other.
+ *
+ * Records are delivered in batches of batchSize() records, similarly to KDbAsyncResult.
+ * They can be taken per partition using takeRecords(int) as soon as any partition has
+ * them, or merged in key order using takeRecords(). Only one of the two ways should be used.
+ *
+ * Ranges are computed from minimum and maximum key values, so tables with large gaps in
+ * the keys may produce partitions of uneven size. The main connection is only used in start()
+ * and should not be used by other threads at that time. Database schema should not change
+ * and the table or query should not be modified or deleted until the scan is finished.
+ *
+ * Example usage:
+ * <code>
+ *  KDbParallelScan *scan = new KDbParallelScan(connection, table, this);
+ *  connect(scan, &KDbParallelScan::recordsAvailable, [scan](int partition) {
+ *      const QList<KDbRecordData*> records(scan->takeRecords(partition));
+ *      // ... process and delete records
+ *  });
+ *  connect(scan, &KDbParallelScan::finished, scan, &QObject::deleteLater);
+ *  if (!scan->start()) {
+ *      qWarning() << scan->result();
+ *  }
+ * </code>
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbParallelScan : public QObject, public KDbResultable
+{
+    Q_OBJECT
+public:
+    //! Creates scan of all records of @a table available through @a connection.
+    KDbParallelScan(KDbConnection *connection, KDbTableSchema *table, QObject *parent = nullptr);
+
+    /*! Creates scan of records of @a query available through @a connection.
+     The query should have one table, must not be grouped (see KDbQuerySchema::isGrouped()),
+     so it cannot have GROUP BY or HAVING sections nor aggregate functions, and must not have
+     LIMIT or OFFSET sections. Otherwise start() fails because results of such queries cannot
+     be computed for each partition separately. */
+    KDbParallelScan(KDbConnection *connection, KDbQuerySchema *query, QObject *parent = nullptr);
+
+    //! Cancels the scan if it is running and waits for its threads.
+    ~KDbParallelScan() override;
+
+    //! @return maximum number of partitions; default is QThread::idealThreadCount()
+    int partitionCount() const;
+
+    //! Sets maximum number of partitions to @a count. Has no effect after start().
+    void setPartitionCount(int count);
+
+    //! @return number of records fetched before they are delivered using recordsAvailable();
+    //! default is 256
+    int batchSize() const;
+
+    //! Sets number of records fetched before they are delivered to @a size.
+    void setBatchSize(int size);
+
+    /**
+     * @brief Computes partitions and starts reading them
+     *
+     * @return @c false if the scan cannot be started, result() contains the error then.
+     * The table without records does not need any partitions and finished() is emitted
+     * immediately.
+     */
+    bool start();
+
+    //! @return number of partitions being read, valid after start()
+    int startedPartitionCount() const;
+
+    //! @return @c true if all partitions have been read, one failed or the scan was cancelled
+    bool isFinished() const;
+
+    /**
+     * @brief Takes records of @a partition fetched so far
+     *
+     * Within a partition records are ordered by primary key unless the query has its own
+     * ORDER BY section. Ownership of the records is passed to the caller.
+     */
+    Q_REQUIRED_RESULT QList<KDbRecordData*> takeRecords(int partition);
+
+    /**
+     * @brief Takes records fetched so far in order of partitions
+     *
+     * Records of a partition are returned after all records of previous partitions are
+     * returned, so all records are merged in primary key order unless the query has its own
+     * ORDER BY section. Ownership of the records is passed to the caller.
+     */
+    Q_REQUIRED_RESULT QList<KDbRecordData*> takeRecords();
+
+    //! Stops reading of all partitions; finished() is emitted afterwards.
+    void cancel();
+
+    //! Blocks until the scan is finished or @a timeout milliseconds pass.
+    //! Negative @a timeout means waiting without a limit.
+    //! @return @c true if the scan is finished.
+    bool waitForFinished(int timeout = -1);
+
+Q_SIGNALS:
+    //! Emitted when new records of @a partition are available
+    void recordsAvailable(int partition);
+
+    //! Emitted when all partitions have been read, one of them failed (see result())
+    //! or the scan has been cancelled
+    void finished();
+
+protected:
+    bool event(QEvent *event) override;
+
+private:
+    Q_DISABLE_COPY(KDbParallelScan)
+    class Private;
+    Private * const d;
+};
+
+#endif
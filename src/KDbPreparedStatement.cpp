@@ -18,8 +18,13 @@
 */
 
 #include "KDbPreparedStatement.h"
+#include "KDb.h"
+#include "KDbConnection.h"
+#include "KDbConnection_p.h"
+#include "KDbDriverBehavior.h"
 #include "KDbPreparedStatementInterface.h"
 #include "KDbSqlResult.h"
+#include "KDbSqlWriter.h"
 #include "KDbTableSchema.h"
 #include "kdb_debug.h"
 
@@ -32,7 +37,8 @@ KDbPreparedStatement::Data::Data(Type _type, KDbPreparedStatementInterface* _ifa
                                  KDbFieldList* _fields,
      const QStringList& _whereFieldNames)
     : type(_type), fields(_fields), whereFieldNames(_whereFieldNames)
-    , fieldsForParameters(nullptr), whereFields(nullptr), dirty(true), iface(_iface)
+    , fieldsForParameters(nullptr), whereFields(nullptr), updateFields(nullptr)
+    , dirty(true), iface(_iface)
     , lastInsertRecordId(std::numeric_limits<quint64>::max())
 {
 }
@@ -41,6 +47,7 @@ KDbPreparedStatement::Data::~Data()
 {
     delete iface;
     delete whereFields;
+    delete updateFields;
 }
 
 KDbPreparedStatement::KDbPreparedStatement()
@@ -59,7 +66,7 @@ KDbPreparedStatement::~KDbPreparedStatement()
 {
 }
 
-bool KDbPreparedStatement::execute(const KDbPreparedStatementParameters& parameters)
+bool KDbPreparedStatement::prepareIfNeeded()
 {
     if (d->dirty) {
         KDbEscapedString s;
@@ -78,12 +85,160 @@ bool KDbPreparedStatement::execute(const KDbPreparedStatementParameters& paramet
         }
         d->dirty = false;
     }
-    QSharedPointer<KDbSqlResult> result
-        = d->iface->execute(d->type, *d->fieldsForParameters, d->fields, parameters);
-    if (!result) {
+    return true;
+}
+
+//! @return approximate size of @a values, used for limits of the write-behind mode
+static qint64 valuesSize(const QList<QVariant> &values)
+{
+    qint64 size = 0;
+    for (const QVariant &value : values) {
+        switch (value.type()) {
+        case QVariant::ByteArray:
+            size += static_cast<const QByteArray*>(value.constData())->size();
+            break;
+        case QVariant::String:
+            size += static_cast<const QString*>(value.constData())->length();
+            break;
+        default:
+            size += 8;
+        }
+    }
+    return size;
+}
+
+bool KDbPreparedStatement::execute(const KDbPreparedStatementParameters& parameters)
+{
+    if (!prepareIfNeeded()) {
+        return false;
+    }
+    const auto run = [this, &parameters](qint64 *affectedRecords) {
+        QSharedPointer<KDbSqlResult> result
+            = d->iface->execute(d->type, *d->fieldsForParameters, d->fields, parameters);
+        if (!result) {
+            return false;
+        }
+        d->lastInsertRecordId = result->lastInsertRecordId();
+        *affectedRecords = -1; // unknown, records could be modified
+        return true;
+    };
+    qint64 affected = 0;
+    if (d->type == SelectStatement) {
+        if (!run(&affected)) {
+            m_result = d->iface->result();
+            return false;
+        }
+        return true;
+    }
+    return executeWrite(run, valuesSize(parameters), 1, &affected);
+}
+
+bool KDbPreparedStatement::executeWrite(const std::function<bool(qint64*)> &run, qint64 size,
+                                        int recordCount, qint64 *affectedRecords)
+{
+    // the statement is a single write in the write-behind mode, like KDbConnection::insertRecord()
+    KDbTableSchema *table = d->fields->field(0)->table(); // not empty after preparing
+    KDbConnection *conn = table ? table->connection() : nullptr;
+    const bool grouped = conn && conn->d->beginWriteBehindStatement();
+    *affectedRecords = 0;
+    bool ok = run(affectedRecords);
+    KDbResult result(d->iface->result());
+    if (conn) {
+        if (*affectedRecords != 0) { // also after failure since preceding records are kept
+            conn->d->invalidateLookupValues(table->name());
+        }
+        if (grouped && !ok && conn->driver()->behavior()->FAILED_STATEMENT_ABORTS_TRANSACTION) {
+            *affectedRecords = 0; // the whole statement is undone to keep the group usable
+        }
+        const bool executed = ok;
+        if (!conn->d->endWriteBehindStatement(grouped, &ok, size, recordCount)) {
+            ok = false; // the group transaction could not be committed
+            *affectedRecords = 0;
+            result = conn->result();
+        } else if (executed && !ok) { // releasing savepoint of the statement failed
+            *affectedRecords = 0;
+            result = conn->result();
+        }
+    }
+    if (!ok) {
+        m_result = result;
+        if (m_result.code() == ERR_NONE) { // e.g. only server error code is set
+            m_result.setCode(ERR_OTHER);
+        }
         return false;
     }
-    d->lastInsertRecordId = result->lastInsertRecordId();
+    m_result = KDbResult();
+    return true;
+}
+
+bool KDbPreparedStatement::executeBatch(const KDbPreparedStatementColumns& columns,
+                                        qint64 *affectedRecords, int *failedRecord)
+{
+    qint64 affected = 0;
+    int failed = -1;
+    if (affectedRecords) {
+        *affectedRecords = 0;
+    }
+    if (failedRecord) {
+        *failedRecord = -1;
+    }
+    if (d->type == SelectStatement) {
+        m_result = KDbResult(ERR_UNSUPPORTED_DRV_FEATURE,
+                             tr("Batch execution of SELECT statements is not supported."));
+        return false;
+    }
+    if (!prepareIfNeeded()) {
+        return false;
+    }
+    int recordCount = 0;
+    qint64 size = 0;
+    for (const QList<QVariant> &column : columns) {
+        recordCount = qMax(recordCount, column.count());
+        size += valuesSize(column);
+    }
+    const bool ok = executeWrite([this, &columns, recordCount, &failed](qint64 *affectedCount) {
+        return d->iface->executeBatch(d->type, *d->fieldsForParameters, d->fields, columns,
+                                      recordCount, affectedCount, &failed);
+    }, size, recordCount, &affected);
+    if (affectedRecords) {
+        *affectedRecords = affected;
+    }
+    if (failedRecord) {
+        *failedRecord = ok ? -1 : failed;
+    }
+    return ok;
+}
+
+bool KDbPreparedStatementInterface::executeBatch(KDbPreparedStatement::Type type,
+                                                 const KDbField::List& fieldList,
+                                                 KDbFieldList* insertFieldList,
+                                                 const KDbPreparedStatementColumns& columns,
+                                                 int recordCount, qint64 *affectedRecords,
+                                                 int *failedRecord)
+{
+    KDbPreparedStatementParameters parameters;
+    parameters.reserve(columns.count());
+    for (int record = 0; record < recordCount; ++record) {
+        parameters.clear();
+        for (const QList<QVariant> &column : columns) {
+            parameters.append(column.value(record));
+        }
+        if (!execute(type, fieldList, insertFieldList, parameters)) {
+            *failedRecord = record;
+            if (type != KDbPreparedStatement::InsertStatement) {
+                *affectedRecords = -1;
+            }
+            return false;
+        }
+        if (type == KDbPreparedStatement::InsertStatement) {
+            ++(*affectedRecords);
+        }
+    }
+    if (type != KDbPreparedStatement::InsertStatement) {
+        // execute() does not report number of updated or deleted records,
+        // backends able to count them reimplement this method
+        *affectedRecords = -1;
+    }
     return true;
 }
 
@@ -95,12 +250,22 @@ bool KDbPreparedStatement::generateStatementString(KDbEscapedString * s)
         return generateSelectStatementString(s);
     case InsertStatement:
         return generateInsertStatementString(s);
+    case UpdateStatement:
+        return generateUpdateStatementString(s);
+    case DeleteStatement:
+        return generateDeleteStatementString(s);
     default:;
     }
     kdbCritical() << "Unsupported type" << d->type;
     return false;
 }
 
+//! @return driver used for escaping identifiers of @a table, @c nullptr for KDbSQL escaping
+static const KDbDriver *driverForTable(const KDbTableSchema *table)
+{
+    return table->connection() ? table->connection()->driver() : nullptr;
+}
+
 bool KDbPreparedStatement::generateSelectStatementString(KDbEscapedString * s)
 {
 //! @todo only tables and trivial queries supported for select...
@@ -116,7 +281,7 @@ bool KDbPreparedStatement::generateSelectStatementString(KDbEscapedString * s)
     // create WHERE
     first = true;
     delete d->whereFields;
-    d->whereFields = new KDbField::List();
+    d->whereFields = new KDbField::List(false); // fields are owned by the table
     foreach(const QString& whereItem, d->whereFieldNames) {
         if (first) {
             s->append(" WHERE ");
@@ -144,32 +309,95 @@ bool KDbPreparedStatement::generateInsertStatementString(KDbEscapedString * s)
     if (!table)
         return false; //err
 
-    KDbEscapedString namesList;
-    bool first = true;
+    KDbSqlWriter writer(driverForTable(table), 1024);
+    writer << "INSERT INTO ";
+    writer.appendIdentifier(table->name());
     //we are using a selection of fields only
     const bool allTableFieldsUsed = dynamic_cast<KDbTableSchema*>(d->fields);
-    foreach(const KDbField* f, *d->fields->fields()) {
-        if (first) {
-            s->append("?");
-            if (!allTableFieldsUsed)
-                namesList = KDbEscapedString(f->name());
-            first = false;
-        } else {
-            s->append(",?");
-            if (!allTableFieldsUsed) {
-                namesList.append(", ");
-                namesList.append(f->name());
-            }
-        }
+    if (!allTableFieldsUsed) {
+        writer << " (";
+        writer.appendFieldNames(*d->fields->fields(), ", ") << ')';
+    }
+    writer << " VALUES (";
+    for (int i = 0; i < d->fields->fieldCount(); ++i) {
+        writer << (i == 0 ? "?" : ",?");
     }
-    s->append(")");
-    s->prepend(KDbEscapedString("INSERT INTO ") + table->name()
-               + (allTableFieldsUsed ? KDbEscapedString() : (KDbEscapedString(" (") + namesList + ')'))
-               + " VALUES (");
+    writer << ')';
+    *s = writer.toString();
     d->fieldsForParameters = d->fields->fields();
     return true;
 }
 
+bool KDbPreparedStatement::generateWhereString(KDbSqlWriter *writer, KDbTableSchema *table)
+{
+    if (d->whereFieldNames.isEmpty()) {
+        kdbWarning() << "no WHERE fields specified, aborting";
+        return false;
+    }
+    delete d->whereFields;
+    d->whereFields = new KDbField::List(false); // fields are owned by the table
+    bool first = true;
+    for (const QString& whereItem : qAsConst(d->whereFieldNames)) {
+        KDbField *f = table->field(whereItem);
+        if (!f) {
+            kdbWarning() << "field" << whereItem << "not found, aborting";
+            return false;
+        }
+        d->whereFields->append(f);
+        *writer << (first ? " WHERE " : " AND ");
+        first = false;
+        writer->appendIdentifier(f->name()) << "=?";
+    }
+    return true;
+}
+
+bool KDbPreparedStatement::generateUpdateStatementString(KDbEscapedString * s)
+{
+    KDbTableSchema *table = d->fields->isEmpty() ? nullptr : d->fields->field(0)->table();
+    if (!table)
+        return false; //err
+
+    KDbSqlWriter writer(driverForTable(table), 1024);
+    writer << "UPDATE ";
+    writer.appendIdentifier(table->name()) << " SET ";
+    bool first = true;
+    for (const KDbField *f : *d->fields->fields()) {
+        if (first)
+            first = false;
+        else
+            writer << ", ";
+        writer.appendIdentifier(f->name()) << "=?";
+    }
+    if (!generateWhereString(&writer, table)) {
+        s->clear();
+        return false;
+    }
+    *s = writer.toString();
+    delete d->updateFields;
+    d->updateFields = new KDbField::List(*d->fields->fields());
+    d->updateFields->append(*d->whereFields);
+    d->fieldsForParameters = d->updateFields;
+    return true;
+}
+
+bool KDbPreparedStatement::generateDeleteStatementString(KDbEscapedString * s)
+{
+    KDbTableSchema *table = d->fields->isEmpty() ? nullptr : d->fields->field(0)->table();
+    if (!table)
+        return false; //err
+
+    KDbSqlWriter writer(driverForTable(table), 1024);
+    writer << "DELETE FROM ";
+    writer.appendIdentifier(table->name());
+    if (!generateWhereString(&writer, table)) {
+        s->clear();
+        return false;
+    }
+    *s = writer.toString();
+    d->fieldsForParameters = d->whereFields;
+    return true;
+}
+
 bool KDbPreparedStatement::isValid() const
 {
     return d->type != InvalidStatement;
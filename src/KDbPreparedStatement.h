@@ -20,22 +20,32 @@
 #ifndef KDB_PREPAREDSTATEMENT_H
 #define KDB_PREPAREDSTATEMENT_H
 
+#include <QCoreApplication>
 #include <QVariant>
 #include <QStringList>
 #include <QSharedData>
 
+#include <functional>
+
 #include "KDbField.h"
 #include "KDbResult.h"
 
 class KDbFieldList;
 class KDbPreparedStatementInterface;
+class KDbSqlWriter;
+class KDbTableSchema;
 
 //! Prepared statement paraneters used in KDbPreparedStatement::execute()
 typedef QList<QVariant> KDbPreparedStatementParameters;
 
+/*! Columns of prepared statement parameters used in KDbPreparedStatement::executeBatch().
+ Every item contains values of one parameter for all records.
+ @since 3.3 */
+typedef QList<QList<QVariant>> KDbPreparedStatementColumns;
+
 /*! @short Prepared database command for optimizing sequences of multiple database actions
 
-  Currently INSERT and SELECT statements are supported.
+  Currently INSERT, SELECT, UPDATE and DELETE statements are supported.
   For example when using KDbPreparedStatement for INSERTs,
   you can gain about 30% speedup compared to using multiple
   connection.insertRecord(*tabelSchema, dbRecordBuffer).
@@ -71,16 +81,45 @@ typedef QList<QVariant> KDbPreparedStatementParameters;
   Another use case is inserting large objects (BLOBs or CLOBs).
   Depending on database backend, you can avoid escaping BLOBs.
   See KexiFormView::storeData() for example use.
+
+  UPDATE statements set values of fields() in records identified by values of
+  whereFieldNames() fields, so parameters are values to set followed by values of the WHERE
+  fields. DELETE statements only take values of the WHERE fields as parameters; fields() is used
+  to identify the table. WHERE fields are looked up in the table of fields() and do not need to
+  be part of fields(). For example:
+  @code
+    KDbFieldList fields;
+    fields.addField(tableSchema->field("price"));
+    KDbPreparedStatement statement = conn->prepareStatement(
+      KDbPreparedStatement::UpdateStatement, &fields, QStringList() << "id");
+    // UPDATE products SET price=? WHERE id=?
+    statement.execute(KDbPreparedStatementParameters() << 9.99 << 12);
+  @endcode
+
+  Large sets of records are best passed to executeBatch() at once, column by column.
+  This way backends bind the values in a tight loop or send them in bulk:
+  @code
+    KDbPreparedStatementColumns columns;
+    columns << numbers << texts; // two lists of 10000 values each
+    qint64 affected;
+    int failed;
+    if (!statement.executeBatch(columns, &affected, &failed)) {
+        qWarning() << "Record" << failed << "could not be inserted";
+    }
+  @endcode
 */
 class KDB_EXPORT KDbPreparedStatement : public KDbResultable
 {
+    Q_DECLARE_TR_FUNCTIONS(KDbPreparedStatement)
 public:
 
     //! Defines type of the prepared statement.
     enum Type {
         InvalidStatement, //!< Used only in invalid statements
         SelectStatement,  //!< SELECT statement will be prepared end executed
-        InsertStatement   //!< INSERT statement will be prepared end executed
+        InsertStatement,  //!< INSERT statement will be prepared end executed
+        UpdateStatement,  //!< UPDATE statement will be prepared end executed (@since 3.3)
+        DeleteStatement   //!< DELETE statement will be prepared end executed (@since 3.3)
     };
 
     //! @internal
@@ -94,7 +133,10 @@ public:
         KDbFieldList *fields;
         QStringList whereFieldNames;
         const KDbField::List* fieldsForParameters; //!< fields where we'll put the inserted parameters
-        KDbField::List* whereFields; //!< temporary, used for select statements, based on whereFieldNames
+        KDbField::List* whereFields; //!< temporary, used for select, update and delete statements,
+                                     //!< based on whereFieldNames
+        KDbField::List* updateFields; //!< temporary, used for update statements: fields followed
+                                      //!< by whereFields (@since 3.3)
         bool dirty; //!< true if the statement has to be internally
                     //!< prepared (possible again) before calling executeInternal()
         KDbPreparedStatementInterface *iface;
@@ -124,10 +166,32 @@ public:
     /*! Executes the prepared statement using @a parameters parameters.
      A number parameters set up for the statement must be the same as a number of fields
      defined in the underlying database table.
+     In write-behind mode (see KDbConnection::isWriteBehindEnabled()) INSERT, UPDATE and
+     DELETE statements are added to the group transaction like KDbConnection::insertRecord().
      @return false on failure. Detailed error status can be obtained
      from KDbConnection object that was used to create this statement object. */
     bool execute(const KDbPreparedStatementParameters& parameters);
 
+    /*! Executes the prepared statement once for every record of @a columns.
+     Every item of @a columns contains values of one parameter, so value of parameter
+     @c i for record @c j is columns[i][j]. Number of records is the length of the longest
+     column; missing values are passed as NULL.
+     Records are processed in order and execution stops at the first failing record.
+     Records processed before that are not reverted, use a transaction if this is needed.
+     Only INSERT, UPDATE and DELETE statements are supported.
+     @a affectedRecords is set to the total number of records affected by the statement,
+     or to -1 if the backend cannot report it for UPDATE and DELETE statements.
+     @a failedRecord is set to the index of the first failing record or -1 if there was
+     no such record.
+     In write-behind mode (see KDbConnection::isWriteBehindEnabled()) the batch is added
+     to the group transaction as one write of all its records. If a failed statement aborts
+     transactions of the backend (see KDbDriverBehavior::FAILED_STATEMENT_ABORTS_TRANSACTION),
+     failed batch is undone as a whole then.
+     @return false on failure.
+     @since 3.3 */
+    bool executeBatch(const KDbPreparedStatementColumns& columns,
+                      qint64 *affectedRecords = nullptr, int *failedRecord = nullptr);
+
     /*! @return unique identifier of the most recently inserted record.
      Typically this is just primary key value. This identifier could be reused when we want
      to reference just inserted record. If there was no insertion recently performed,
@@ -146,8 +210,18 @@ protected:
 private:
 //! @todo is this portable across backends?
     bool generateStatementString(KDbEscapedString* s);
+    //! Prepares statement in the backend if needed
+    bool prepareIfNeeded();
+    //! Executes data-modifying statement by calling @a run as a single write of @a recordCount
+    //! records and @a size bytes in the write-behind mode, then invalidates lookup values
+    //! cached for the modified table. @a run sets number of affected records, -1 if unknown.
+    bool executeWrite(const std::function<bool(qint64*)> &run, qint64 size, int recordCount,
+                      qint64 *affectedRecords);
     bool generateSelectStatementString(KDbEscapedString * s);
     bool generateInsertStatementString(KDbEscapedString * s);
+    bool generateUpdateStatementString(KDbEscapedString * s);
+    bool generateDeleteStatementString(KDbEscapedString * s);
+    bool generateWhereString(KDbSqlWriter *writer, KDbTableSchema *table);
 
     QSharedDataPointer<Data> d;
 };
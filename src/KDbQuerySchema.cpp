@@ -285,8 +285,10 @@ bool KDbQuerySchema::isColumnVisible(int position) const
 
 void KDbQuerySchema::setColumnVisible(int position, bool visible)
 {
-    if (position < fieldCount())
+    if (position < fieldCount()) {
         d->visibility.setBit(position, visible);
+        d->clearCachedStatements();
+    }
 }
 
 bool KDbQuerySchema::addAsteriskInternal(KDbQueryAsterisk *asterisk, bool visible)
@@ -424,12 +426,27 @@ QDebug operator<<(QDebug dbg, const KDbConnectionAndQuerySchema &connectionAndSc
     if (!query.whereExpression().isNull()) {
         dbg.nospace() << " - WHERE EXPRESSION:\n" << query.whereExpression() << '\n';
     }
+    if (!query.groupByExpressions().isEmpty()) {
+        dbg.nospace() << " - GROUP BY:\n" << query.groupByExpressions() << '\n';
+    }
+    if (!query.havingExpression().isNull()) {
+        dbg.nospace() << " - HAVING EXPRESSION:\n" << query.havingExpression() << '\n';
+    }
     dbg.nospace() << qPrintable(QString::fromLatin1(" - ORDER BY (%1):\n").arg(query.orderByColumnList()->count()));
     if (query.orderByColumnList()->isEmpty()) {
         dbg.nospace() << "<NONE>\n";
     } else {
         dbg.nospace() << *query.orderByColumnList();
     }
+    if (!query.seekAfterValues().isEmpty()) {
+        dbg.nospace() << " - SEEK AFTER:" << query.seekAfterValues() << '\n';
+    }
+    if (query.limit() >= 0) {
+        dbg.nospace() << " - LIMIT:" << query.limit() << '\n';
+    }
+    if (query.offset() > 0) {
+        dbg.nospace() << " - OFFSET:" << query.offset() << '\n';
+    }
     return dbg.nospace();
 }
 
@@ -456,8 +473,10 @@ KDbTableSchema* KDbQuerySchema::masterTable() const
 
 void KDbQuerySchema::setMasterTable(KDbTableSchema *table)
 {
-    if (table)
+    if (table) {
         d->masterTable = table;
+        d->clearCachedStatements();
+    }
 }
 
 QList<KDbTableSchema*>* KDbQuerySchema::tables() const
@@ -485,6 +504,7 @@ void KDbQuerySchema::addTable(KDbTableSchema *table, const QString& alias)
         }
     }
     d->tables.append(table);
+    d->clearCachedStatements();
     if (!alias.isEmpty())
         setTableAlias(d->tables.count() - 1, alias);
 }
@@ -496,6 +516,7 @@ void KDbQuerySchema::removeTable(KDbTableSchema *table)
     if (d->masterTable == table)
         d->masterTable = nullptr;
     d->tables.removeAt(d->tables.indexOf(table));
+    d->clearCachedStatements();
 //! @todo remove fields!
 }
 
@@ -563,6 +584,7 @@ bool KDbQuerySchema::setColumnAlias(int position, const QString& alias)
         kdbWarning() << "position" << position << "could not remove alias when no name is specified for expression column!";
         return false;
     }
+    d->clearCachedStatements();
     return d->setColumnAlias(position, fixedAlias);
 }
 
@@ -650,6 +672,7 @@ bool KDbQuerySchema::setTableAlias(int position, const QString& alias)
         kdbWarning() << "position"  << position << "out of range!";
         return false;
     }
+    d->clearCachedStatements();
     const QString fixedAlias(alias.trimmed());
     if (fixedAlias.isEmpty()) {
         const QString oldAlias(d->tableAliases.take(position));
@@ -679,6 +702,7 @@ KDbEscapedString KDbQuerySchema::statement() const
 void KDbQuerySchema::setStatement(const KDbEscapedString& sql)
 {
     d->sql = sql;
+    d->clearCachedStatements();
 }
 
 const KDbField* KDbQuerySchema::field(KDbConnection *conn, const QString& identifier,
@@ -1161,7 +1185,7 @@ QVector<int> KDbQuerySchema::pkeyFieldsOrder(KDbConnection *conn) const
         return *d->pkeyFieldsOrder;
 
     KDbTableSchema *tbl = masterTable();
-    if (!tbl || !tbl->primaryKey())
+    if (!tbl || !tbl->primaryKey() || isGrouped()) // records of grouped query have no PKEY
         return QVector<int>();
 
     //get order of PKEY fields (e.g. for records updating or inserting )
@@ -1205,6 +1229,7 @@ KDbRelationship* KDbQuerySchema::addRelationship(KDbField *field1, KDbField *fie
     }
 
     d->relations.append(r);
+    d->clearCachedStatements();
     return r;
 }
 
@@ -1276,6 +1301,7 @@ bool KDbQuerySchema::setWhereExpression(const KDbExpression &expr, QString *erro
                                         QString *errorDescription)
 {
     KDbExpression newWhereExpr = expr.clone();
+    d->clearCachedStatements();
     KDbParseInfoInternal parseInfo(this);
     QString tempErrorMessage;
     QString tempErrorDescription;
@@ -1290,6 +1316,15 @@ bool KDbQuerySchema::setWhereExpression(const KDbExpression &expr, QString *erro
         d->whereExpr = KDbExpression();
         return false;
     }
+    if (newWhereExpr.containsAggregate()) {
+        *errorMessagePointer = KDbQuerySchemaPrivate::tr("Aggregate function not allowed in WHERE section");
+        *errorDescriptionPointer = KDbQuerySchemaPrivate::tr(
+            "Use HAVING section for conditions containing aggregate functions.");
+        kdbWarning() << "message=" << *errorMessagePointer
+                     << "description=" << *errorDescriptionPointer;
+        d->whereExpr = KDbExpression();
+        return false;
+    }
     errorMessagePointer->clear();
     errorDescriptionPointer->clear();
     KDbQuerySchemaPrivate::setWhereExpressionInternal(this, newWhereExpr);
@@ -1356,10 +1391,96 @@ KDbExpression KDbQuerySchema::whereExpression() const
     return d->whereExpr;
 }
 
+bool KDbQuerySchema::setGroupByExpressions(const QList<KDbExpression> &expressions,
+                                           QString *errorMessage, QString *errorDescription)
+{
+    QList<KDbExpression> newGroupByExprs;
+    KDbParseInfoInternal parseInfo(this);
+    for (const KDbExpression &expr : expressions) {
+        KDbExpression newExpr = expr.clone();
+        if (!newExpr.validate(&parseInfo)) {
+            setResult(parseInfo, errorMessage, errorDescription);
+            kdbWarning() << "message=" << parseInfo.errorMessage()
+                         << "description=" << parseInfo.errorDescription();
+            kdbWarning() << newExpr;
+            return false;
+        }
+        if (newExpr.containsAggregate()) {
+            if (errorMessage) {
+                *errorMessage = KDbQuerySchemaPrivate::tr("Aggregate function not allowed in GROUP BY section");
+            }
+            if (errorDescription) {
+                *errorDescription = KDbQuerySchemaPrivate::tr(
+                    "Expression \"%1\" cannot be used for grouping.")
+                    .arg(newExpr.toString(nullptr).toString());
+            }
+            return false;
+        }
+        newGroupByExprs.append(newExpr);
+    }
+    d->groupByExprs = newGroupByExprs;
+    d->clearCachedStatements();
+    delete d->pkeyFieldsOrder; // grouping affects pkeyFieldsOrder()
+    d->pkeyFieldsOrder = nullptr;
+    return true;
+}
+
+QList<KDbExpression> KDbQuerySchema::groupByExpressions() const
+{
+    return d->groupByExprs;
+}
+
+bool KDbQuerySchema::addToGroupBy(KDbField *field, QString *errorMessage,
+                                  QString *errorDescription)
+{
+    QList<KDbExpression> newGroupByExprs(d->groupByExprs);
+    newGroupByExprs.append(KDbVariableExpression(
+        (field->table() ? (field->table()->name() + QLatin1Char('.')) : QString()) + field->name()));
+    return setGroupByExpressions(newGroupByExprs, errorMessage, errorDescription);
+}
+
+bool KDbQuerySchema::setHavingExpression(const KDbExpression &expr, QString *errorMessage,
+                                         QString *errorDescription)
+{
+    KDbExpression newHavingExpr = expr.clone();
+    KDbParseInfoInternal parseInfo(this);
+    if (!newHavingExpr.isNull() && !newHavingExpr.validate(&parseInfo)) {
+        setResult(parseInfo, errorMessage, errorDescription);
+        kdbWarning() << "message=" << parseInfo.errorMessage()
+                     << "description=" << parseInfo.errorDescription();
+        kdbWarning() << newHavingExpr;
+        return false;
+    }
+    d->havingExpr = newHavingExpr;
+    d->clearCachedStatements();
+    delete d->pkeyFieldsOrder; // grouping affects pkeyFieldsOrder()
+    d->pkeyFieldsOrder = nullptr;
+    return true;
+}
+
+KDbExpression KDbQuerySchema::havingExpression() const
+{
+    return d->havingExpr;
+}
+
+bool KDbQuerySchema::isGrouped() const
+{
+    if (!d->groupByExprs.isEmpty() || !d->havingExpr.isNull()) {
+        return true;
+    }
+    foreach(KDbField *f, *fields()) {
+        if (f->isExpression() && f->expression().containsAggregate()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 void KDbQuerySchema::setOrderByColumnList(const KDbOrderByColumnList& list)
 {
     delete d->orderByColumnList;
     d->orderByColumnList = new KDbOrderByColumnList(list, nullptr, nullptr, nullptr);
+    d->clearCachedStatements();
 // all field names should be found, exit otherwise ..........?
 }
 
@@ -1373,6 +1494,39 @@ const KDbOrderByColumnList* KDbQuerySchema::orderByColumnList() const
     return d->orderByColumnList;
 }
 
+qint64 KDbQuerySchema::limit() const
+{
+    return d->limit;
+}
+
+void KDbQuerySchema::setLimit(qint64 limit)
+{
+    d->limit = limit < 0 ? -1 : limit;
+    d->clearCachedStatements();
+}
+
+qint64 KDbQuerySchema::offset() const
+{
+    return d->offset;
+}
+
+void KDbQuerySchema::setOffset(qint64 offset)
+{
+    d->offset = qMax(offset, qint64(0));
+    d->clearCachedStatements();
+}
+
+QList<QVariant> KDbQuerySchema::seekAfterValues() const
+{
+    return d->seekAfterValues;
+}
+
+void KDbQuerySchema::setSeekAfterValues(const QList<QVariant> &values)
+{
+    d->seekAfterValues = values;
+    d->clearCachedStatements();
+}
+
 QList<KDbQuerySchemaParameter> KDbQuerySchema::parameters(KDbConnection *conn) const
 {
     QList<KDbQuerySchemaParameter> params;
@@ -1387,6 +1541,13 @@ QList<KDbQuerySchemaParameter> KDbQuerySchema::parameters(KDbConnection *conn) c
     if (!where.isNull()) {
         where.getQueryParameters(&params);
     }
+    for (KDbExpression groupByExpr : d->groupByExprs) {
+        groupByExpr.getQueryParameters(&params);
+    }
+    KDbExpression having = havingExpression();
+    if (!having.isNull()) {
+        having.getQueryParameters(&params);
+    }
     return params;
 }
 
@@ -1405,5 +1566,23 @@ bool KDbQuerySchema::validate(QString *errorMessage, QString *errorDescription)
         setResult(parseInfo, errorMessage, errorDescription);
         return false;
     }
+    if (!d->havingExpr.isNull() && !d->havingExpr.validate(&parseInfo)) {
+        setResult(parseInfo, errorMessage, errorDescription);
+        return false;
+    }
+    if (!KDbQuerySchemaPrivate::validateGrouping(this, errorMessage, errorDescription)) {
+        return false;
+    }
+    if (d->seekAfterValues.count() > d->orderByColumnList->count()) {
+        if (errorMessage) {
+            *errorMessage = KDbQuerySchemaPrivate::tr("Invalid keyset pagination");
+        }
+        if (errorDescription) {
+            *errorDescription = KDbQuerySchemaPrivate::tr(
+                "Number of values to seek after (%1) is greater than number of ORDER BY "
+                "columns (%2).").arg(d->seekAfterValues.count()).arg(d->orderByColumnList->count());
+        }
+        return false;
+    }
     return true;
 }
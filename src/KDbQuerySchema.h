@@ -202,7 +202,9 @@ public:
      assigned a master table.
      If no master table is assigned explicitly, but only one table used in this query,
      a single table is returned here, even if there are table aliases,
-     (e.g. "T" table is returned for "SELECT T1.A, T2.B FROM T T1, T T2" statement). */
+     (e.g. "T" table is returned for "SELECT T1.A, T2.B FROM T T1, T T2" statement).
+     Note that records of grouped queries (see isGrouped()) do not correspond to records
+     of the master table, so they cannot be modified even if master table is present. */
     KDbTableSchema* masterTable() const;
 
     /*! Sets master table of this query to @a table.
@@ -669,6 +671,61 @@ public:
                               KDbToken relation = '=', QString *errorMessage = nullptr,
                               QString *errorDescription = nullptr);
 
+    /**
+     * @brief Sets expressions for the GROUP BY section of the query to @a expressions.
+     *
+     * Previously set GROUP BY expressions are removed. An empty list can be passed
+     * to remove the GROUP BY section. Each expression is validated and must not contain
+     * aggregate functions. On failure the GROUP BY section is left unchanged, a string
+     * pointed by @a errorMessage (if provided) is set to a general error message and
+     * a string pointed by @a errorDescription (if provided) is set to a detailed
+     * description of the error.
+     *
+     * Whether the query's columns are compatible with grouping is checked by validate().
+     * @return @c true on success.
+     * @since 3.3
+     */
+    bool setGroupByExpressions(const QList<KDbExpression> &expressions,
+                               QString *errorMessage = nullptr,
+                               QString *errorDescription = nullptr);
+
+    /*! @return expressions of the GROUP BY section of the query.
+     Empty list is returned if the query is not grouped by any expression.
+     @since 3.3 */
+    QList<KDbExpression> groupByExpressions() const;
+
+    /*! Appends @a field to the GROUP BY section.
+     Simplifies creating of GROUP BY section if used instead of setGroupByExpressions().
+     @return @c false if the new GROUP BY expression is not valid, see setGroupByExpressions().
+     @since 3.3 */
+    bool addToGroupBy(KDbField *field, QString *errorMessage = nullptr,
+                      QString *errorDescription = nullptr);
+
+    /**
+     * @brief Sets a HAVING expression @a expr.
+     *
+     * The HAVING condition is applied to groups of records, so unlike the WHERE
+     * expression it can contain aggregate functions, e.g. "SUM(price) > 100".
+     * A null expression (KDbExpression()) can be passed to remove existing HAVING
+     * expression. On failure the HAVING expression is left unchanged and error strings
+     * are set like in setGroupByExpressions().
+     * @return @c true on success.
+     * @since 3.3
+     */
+    bool setHavingExpression(const KDbExpression &expr, QString *errorMessage = nullptr,
+                             QString *errorDescription = nullptr);
+
+    /*! @return HAVING expression or null expression if this query has no HAVING section.
+     @since 3.3 */
+    KDbExpression havingExpression() const;
+
+    /*! @return @c true if records of this query are groups of records, i.e. the query
+     has GROUP BY or HAVING section or any of its columns contains an aggregate function,
+     e.g. "SELECT COUNT(id) FROM cars". Grouped queries are read-only.
+     @see KDbExpression::containsAggregate()
+     @since 3.3 */
+    bool isGrouped() const;
+
     /*! Sets a list of columns for ORDER BY section of the query.
      Each name on the list must be a field or alias present within the query
      and must not be covered by aliases. If one or more names cannot be found
@@ -690,8 +747,50 @@ public:
     /*! @see orderByColumnList() */
     const KDbOrderByColumnList* orderByColumnList() const;
 
-    /*! @return query schema parameters. These are taked from the WHERE section
-     (a tree of expression items). */
+    /*! @return maximum number of records returned by the query (the LIMIT section).
+     -1 is returned if there is no limit (the default).
+     @since 3.3 */
+    qint64 limit() const;
+
+    /*! Sets maximum number of records returned by the query to @a limit.
+     Negative value removes the limit.
+     @since 3.3 */
+    void setLimit(qint64 limit);
+
+    /*! @return number of records skipped before returning the first record (the OFFSET
+     section). 0 is the default. Use offset together with ORDER BY, otherwise the order
+     of records and thus the result is undefined.
+     @since 3.3 */
+    qint64 offset() const;
+
+    /*! Sets number of records skipped before returning the first record to @a offset.
+     Negative value is treated as 0.
+     @since 3.3 */
+    void setOffset(qint64 offset);
+
+    /*! @return values for keyset ("seek") pagination.
+
+     If not empty, only records that follow the record with these values in the order
+     defined by ORDER BY are returned. Value number i corresponds to column number i
+     of orderByColumnList(), so there can be no more values than ORDER BY columns.
+     Sort order of each column is respected. For example, for query
+     "SELECT * FROM cars ORDER BY owner, id DESC" with values (7, 100) the generated
+     native statement contains "WHERE (owner > 7 OR (owner = 7 AND id < 100))".
+
+     Unlike offset(), keyset pagination does not require the server to read the skipped
+     records. Typically values of the last record of recently fetched page are used
+     together with setLimit(). For stable results the ORDER BY columns should identify
+     records uniquely, e.g. end with a primary key, and should not contain NULL values.
+     @since 3.3 */
+    QList<QVariant> seekAfterValues() const;
+
+    /*! Sets values for keyset pagination to @a values. Empty list disables the feature.
+     @see seekAfterValues()
+     @since 3.3 */
+    void setSeekAfterValues(const QList<QVariant> &values);
+
+    /*! @return query schema parameters. These are taked from the columns, WHERE, GROUP BY
+     and HAVING sections (trees of expression items). */
     QList<KDbQuerySchemaParameter> parameters(KDbConnection *conn) const;
 
     //! @return @c true if this query is valid
@@ -702,6 +801,8 @@ public:
      * KDbField::expression().validate(). Then the <whereExpression> (@see
      * whereExpression())
      * is validated using KDbExpression::validate().
+     * For grouped queries (see isGrouped()) each visible column has to be an aggregate,
+     * a constant or an expression present in the GROUP BY section.
      *
      * On error a string pointed by @a errorMessage (if provided) is set to a general
      * error message and a string pointed by @a errorDescription (if provided) is set to a
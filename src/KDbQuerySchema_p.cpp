@@ -23,6 +23,8 @@
 #include "KDbOrderByColumn.h"
 #include "kdb_debug.h"
 
+#include <QSet>
+
 KDbQuerySchemaPrivate::KDbQuerySchemaPrivate(KDbQuerySchema* q, KDbQuerySchemaPrivate* copy)
         : query(q)
         , masterTable(nullptr)
@@ -46,12 +48,19 @@ KDbQuerySchemaPrivate::KDbQuerySchemaPrivate(KDbQuerySchema* q, KDbQuerySchemaPr
         autoincFields = nullptr;
         autoIncrementSqlFieldsList.clear();
         pkeyFieldsOrder = nullptr;
+        cachedStatements.clear();
         fakeRecordIdCol = nullptr;
         fakeRecordIdField = nullptr;
         // </clear, so computeFieldsExpanded() will re-create it>
         if (!copy->whereExpr.isNull()) {
             whereExpr = copy->whereExpr.clone();
         }
+        for (int i = 0; i < groupByExprs.count(); ++i) {
+            groupByExprs[i] = copy->groupByExprs.at(i).clone();
+        }
+        if (!copy->havingExpr.isNull()) {
+            havingExpr = copy->havingExpr.clone();
+        }
         // "*this = *copy" causes copying pointers; pull of them without destroying,
         // will be deep-copied in the KDbQuerySchema ctor.
         asterisks.setAutoDelete(false);
@@ -103,6 +112,99 @@ void KDbQuerySchemaPrivate::clearCachedData()
     delete autoincFields;
     autoincFields = nullptr;
     autoIncrementSqlFieldsList.clear();
+    clearCachedStatements();
+}
+
+//! Maximum number of native statements cached for a single query
+static const int maxCachedStatements = 8;
+
+//! @return copy of ORDER BY columns of @a list
+static QVector<KDbOrderByColumn> orderByColumns(const KDbOrderByColumnList &list)
+{
+    QVector<KDbOrderByColumn> result;
+    result.reserve(list.count());
+    for (QList<KDbOrderByColumn*>::ConstIterator it(list.constBegin()); it != list.constEnd(); ++it) {
+        result.append(**it);
+    }
+    return result;
+}
+
+//! @return true if @a list contains the same columns as @a columns
+static bool sameOrderByColumns(const KDbOrderByColumnList &list,
+                               const QVector<KDbOrderByColumn> &columns)
+{
+    if (list.count() != columns.count()) {
+        return false;
+    }
+    int i = 0;
+    for (QList<KDbOrderByColumn*>::ConstIterator it(list.constBegin()); it != list.constEnd(); ++it, ++i) {
+        if (**it != columns.at(i)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+//static
+KDbEscapedString KDbQuerySchemaPrivate::cachedStatement(const KDbQuerySchema *query,
+                                                        KDbConnection *conn,
+                                                        KDb::IdentifierEscapingType dialect,
+                                                        const KDbSelectStatementOptions &options,
+                                                        const QList<QVariant> &parameters,
+                                                        KDbQuerySchemaCachedStatement::LookupQueries *lookupQueries)
+{
+    QVector<KDbQuerySchemaCachedStatement> *cache = &query->d->cachedStatements;
+    for (int i = 0; i < cache->count(); ++i) {
+        const KDbQuerySchemaCachedStatement &entry = cache->at(i);
+        if (entry.connectionId == conn->d->id && entry.dialect == dialect && entry.options == options
+            && entry.parameters == parameters)
+        {
+            // Lookup queries are owned by the connection and removing them changes the schema
+            // revision, so they can be accessed only when the revision is unchanged.
+            bool outdated = entry.schemaRevision != conn->d->schemaRevision
+                || !sameOrderByColumns(*query->d->orderByColumnList, entry.orderByColumns);
+            for (int j = 0; !outdated && j < entry.lookupQueries.count(); ++j) {
+                outdated = entry.lookupQueries.at(j).first->d->revision != entry.lookupQueries.at(j).second;
+            }
+            if (outdated) {
+                cache->remove(i);
+                return KDbEscapedString();
+            }
+            if (i > 0) { // most recently used first
+                cache->move(i, 0);
+            }
+            if (lookupQueries) {
+                *lookupQueries += cache->first().lookupQueries;
+            }
+            return cache->first().sql;
+        }
+    }
+    return KDbEscapedString();
+}
+
+//static
+void KDbQuerySchemaPrivate::insertCachedStatement(const KDbQuerySchema *query,
+                                                  KDbConnection *conn,
+                                                  KDb::IdentifierEscapingType dialect,
+                                                  const KDbSelectStatementOptions &options,
+                                                  const QList<QVariant> &parameters,
+                                                  const KDbQuerySchemaCachedStatement::LookupQueries &lookupQueries,
+                                                  const KDbEscapedString &sql)
+{
+    KDbQuerySchemaCachedStatement entry;
+    entry.connectionId = conn->d->id;
+    entry.schemaRevision = conn->d->schemaRevision;
+    entry.orderByColumns = orderByColumns(*query->d->orderByColumnList);
+    entry.lookupQueries = lookupQueries;
+    entry.dialect = dialect;
+    entry.options = options;
+    entry.parameters = parameters;
+    entry.sql = sql;
+    QVector<KDbQuerySchemaCachedStatement> *cache = &query->d->cachedStatements;
+    if (cache->count() >= maxCachedStatements) {
+        cache->removeLast();
+    }
+    cache->prepend(entry);
 }
 
 bool KDbQuerySchemaPrivate::setColumnAlias(int position, const QString& alias)
@@ -157,3 +259,52 @@ bool KDbQuerySchemaPrivate::setColumnAliasInternal(int position, const QString&
                  << ", cannot set to a new column. Remove old alias first.";
     return false;
 }
+
+//static
+bool KDbQuerySchemaPrivate::validateGrouping(const KDbQuerySchema *query,
+                                             QString *errorMessage, QString *errorDescription)
+{
+    if (!query->isGrouped()) {
+        return true;
+    }
+    QSet<KDbField*> groupByFields;
+    QSet<QString> groupByStrings;
+    for (const KDbExpression &expr : query->d->groupByExprs) {
+        if (expr.isVariable() && expr.toVariable().field()) {
+            groupByFields.insert(expr.toVariable().field());
+        }
+        groupByStrings.insert(expr.toString(nullptr).toString());
+    }
+    int number = -1;
+    foreach(KDbField *f, *query->fields()) {
+        number++;
+        if (!query->isColumnVisible(number)) {
+            continue;
+        }
+        QString columnName;
+        if (f->isQueryAsterisk()) {
+            columnName = QLatin1String("*");
+        } else if (f->isExpression()) {
+            const KDbExpression expr(f->expression());
+            const QString exprString(expr.toString(nullptr).toString());
+            if (expr.containsAggregate() || expr.isConst() || groupByStrings.contains(exprString)) {
+                continue;
+            }
+            columnName = exprString;
+        } else {
+            if (groupByFields.contains(f)) {
+                continue;
+            }
+            columnName = f->name();
+        }
+        if (errorMessage) {
+            *errorMessage = tr("Column not allowed in grouped query");
+        }
+        if (errorDescription) {
+            *errorDescription = tr("Column \"%1\" must be used in an aggregate function "
+                                   "or be present in the GROUP BY section.").arg(columnName);
+        }
+        return false;
+    }
+    return true;
+}
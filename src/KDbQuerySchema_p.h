@@ -22,8 +22,10 @@
 
 #include "KDbDriver.h"
 #include "KDbExpression.h"
+#include "KDbOrderByColumn.h"
 #include "KDbQueryColumnInfo.h"
 #include "KDbQuerySchema.h"
+#include "KDbSelectStatementOptions.h"
 
 #include <QBitArray>
 #include <QWeakPointer>
@@ -58,6 +60,33 @@ public:
     KDbQueryColumnInfo *foreignColumn;
 };
 
+//! A native SELECT statement cached by KDbQuerySchemaPrivate, see KDbNativeStatementBuilder
+class KDbQuerySchemaCachedStatement
+{
+public:
+    //! Lookup record source queries used by a statement with their revisions
+    //! (KDbQuerySchemaPrivate::revision) at the time the statement has been generated
+    typedef QVector<QPair<const KDbQuerySchema*, quint64>> LookupQueries;
+
+    //! KDbConnectionPrivate::id of the connection for which the statement has been generated.
+    //! Unlike the connection's address it is never reused by another connection.
+    quint64 connectionId = 0;
+
+    //! Value of KDbConnectionPrivate::schemaRevision at the time the statement has been generated
+    quint64 schemaRevision = 0;
+
+    //! Copy of the query's ORDER BY list at the time the statement has been generated
+    QVector<KDbOrderByColumn> orderByColumns;
+
+    //! Lookup queries used directly or indirectly by the statement
+    LookupQueries lookupQueries;
+
+    KDb::IdentifierEscapingType dialect = KDb::DriverEscaping;
+    KDbSelectStatementOptions options;
+    QList<QVariant> parameters;
+    KDbEscapedString sql;
+};
+
 class KDbQuerySchemaPrivate
 {
     Q_DECLARE_TR_FUNCTIONS(KDbQuerySchema)
@@ -74,6 +103,37 @@ public:
 
     void clearCachedData();
 
+    //! Removes all native statements cached by KDbNativeStatementBuilder for this query
+    //! and increments revision, so statements of queries using this one for lookup are outdated
+    inline void clearCachedStatements() {
+        cachedStatements.clear();
+        ++revision;
+    }
+
+    /*! @return native SELECT statement cached for @a query, @a conn, @a dialect, @a options
+     and @a parameters or an empty string if there is no such statement or it is outdated.
+     Lookup queries used by the statement are appended to @a lookupQueries if it is not @c nullptr.
+     Used by KDbNativeStatementBuilder. */
+    static KDbEscapedString cachedStatement(const KDbQuerySchema *query, KDbConnection *conn,
+                                            KDb::IdentifierEscapingType dialect,
+                                            const KDbSelectStatementOptions &options,
+                                            const QList<QVariant> &parameters,
+                                            KDbQuerySchemaCachedStatement::LookupQueries *lookupQueries);
+
+    //! @return revision of @a query, see clearCachedStatements()
+    static quint64 revision(const KDbQuerySchema *query) {
+        return query->d->revision;
+    }
+
+    //! Caches native SELECT statement @a sql generated for @a query using @a lookupQueries,
+    //! see cachedStatement()
+    static void insertCachedStatement(const KDbQuerySchema *query, KDbConnection *conn,
+                                      KDb::IdentifierEscapingType dialect,
+                                      const KDbSelectStatementOptions &options,
+                                      const QList<QVariant> &parameters,
+                                      const KDbQuerySchemaCachedStatement::LookupQueries &lookupQueries,
+                                      const KDbEscapedString &sql);
+
     bool setColumnAlias(int position, const QString& alias);
 
     inline bool setTableAlias(int position, const QString& alias) {
@@ -116,8 +176,15 @@ public:
     static void setWhereExpressionInternal(KDbQuerySchema *query, const KDbExpression &expr)
     {
         query->d->whereExpr = expr;
+        query->d->clearCachedStatements();
     }
 
+    /*! Checks if visible columns of @a query are compatible with grouping, i.e. each is
+     an aggregate, a constant or an expression from the GROUP BY section.
+     Used by KDbQuerySchema::validate() and buildSelectQuery(). */
+    static bool validateGrouping(const KDbQuerySchema *query, QString *errorMessage,
+                                 QString *errorDescription);
+
     KDbQuerySchema *query;
 
     /*! Master table of the query. Can be @c nullptr.
@@ -200,6 +267,22 @@ public:
     /*! WHERE expression */
     KDbExpression whereExpr;
 
+    /*! GROUP BY expressions */
+    QList<KDbExpression> groupByExprs;
+
+    /*! HAVING expression */
+    KDbExpression havingExpr;
+
+    /*! Maximum number of records (LIMIT), -1 for no limit. @see KDbQuerySchema::limit() */
+    qint64 limit = -1;
+
+    /*! Number of records to skip (OFFSET). @see KDbQuerySchema::offset() */
+    qint64 offset = 0;
+
+    /*! Values of ORDER BY columns of the last record of the previous page.
+     @see KDbQuerySchema::seekAfterValues() */
+    QList<QVariant> seekAfterValues;
+
     /*! Set by insertField(): true, if aliases for expression columns should
      be generated on next columnAlias() call. */
     bool regenerateExprAliases;
@@ -210,6 +293,15 @@ public:
 
     //! Owned fields created by KDbQuerySchema::addExpressionInternal()
     KDbField::List ownedExpressionFields;
+
+    //! Native SELECT statements generated for this query, most recently used first.
+    //! Entries are invalidated on any change to the query, to its ORDER BY list or to one of the
+    //! lookup queries it uses and when KDbConnectionPrivate::schemaRevision changes, i.e. when
+    //! tables or queries (e.g. lookup record sources) of the connection change.
+    QVector<KDbQuerySchemaCachedStatement> cachedStatements;
+
+    //! Incremented on any change to the query, see clearCachedStatements()
+    quint64 revision = 0;
 };
 
 //! Information about expanded fields for a single query schema, used for caching
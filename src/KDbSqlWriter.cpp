@@ -0,0 +1,257 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbSqlWriter.h"
+#include "KDb.h"
+#include "KDbDriver.h"
+#include "KDbDriver_p.h"
+#include "KDbDriverBehavior.h"
+
+//! @internal
+class Q_DECL_HIDDEN KDbSqlWriter::Private
+{
+public:
+    Private(const KDbDriver *drv, int _capacity)
+        : driver(drv)
+        , behavior(drv ? KDbDriverPrivate::behavior(drv) : nullptr)
+        , capacity(_capacity)
+        , current(0)
+        , valid(true)
+    {
+        // reserved capacity is kept by QByteArray::resize(0) in clear()
+        buffers[0].reserve(capacity);
+    }
+
+    //! @return the buffer being written
+    inline QByteArray& buffer() { return buffers[current]; }
+
+    //! Appends @a string containing only ASCII characters
+    void appendAscii(const QString &string);
+
+    //! Appends @a identifier if it can be written without escaping characters
+    //! @return false if the identifier needs to be escaped by the driver
+    bool appendSimpleIdentifier(const QString &identifier);
+
+    const KDbDriver * const driver;
+    const KDbDriverBehavior * const behavior;
+    const int capacity;
+    //! Two buffers are used alternately, so the last statement can still be referenced,
+    //! e.g. by KDbResult::sql(), while the next one is written
+    QByteArray buffers[2];
+    int current;
+    bool valid;
+};
+
+//! @return true if @a c can be part of an identifier that never needs escaping of characters
+static inline bool isSimpleIdentifierCharacter(ushort c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_';
+}
+
+void KDbSqlWriter::Private::appendAscii(const QString &string)
+{
+    const int length = string.length();
+    const int start = buffer().length();
+    buffer().resize(start + length);
+    char *data = buffer().data() + start;
+    const QChar *chars = string.constData();
+    for (int i = 0; i < length; ++i) {
+        data[i] = char(chars[i].unicode());
+    }
+}
+
+bool KDbSqlWriter::Private::appendSimpleIdentifier(const QString &identifier)
+{
+    const int length = identifier.length();
+    const QChar *chars = identifier.constData();
+    for (int i = 0; i < length; ++i) {
+        if (!isSimpleIdentifierCharacter(chars[i].unicode())) {
+            return false;
+        }
+    }
+    if (behavior) { // drivers always add quotes
+        buffer().append(behavior->OPENING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER);
+        appendAscii(identifier);
+        buffer().append(behavior->CLOSING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER);
+        return true;
+    }
+    // KDbSQL adds quotes only for keywords and identifiers starting with a digit
+    if (length == 0 || chars[0].isDigit()) {
+        return false;
+    }
+    const int start = buffer().length();
+    appendAscii(identifier);
+    if (KDbDriverPrivate::kdbSQLKeywordsHash.contains(buffer().constData() + start, length)) {
+        buffer().insert(start, '"');
+        buffer().append('"');
+    }
+    return true;
+}
+
+KDbSqlWriter::KDbSqlWriter(const KDbDriver *driver, int capacity)
+    : d(new Private(driver, capacity))
+{
+}
+
+KDbSqlWriter::~KDbSqlWriter()
+{
+    delete d;
+}
+
+const KDbDriver *KDbSqlWriter::driver() const
+{
+    return d->driver;
+}
+
+KDbSqlWriter& KDbSqlWriter::append(const char *sql)
+{
+    d->buffer().append(sql);
+    return *this;
+}
+
+KDbSqlWriter& KDbSqlWriter::append(char c)
+{
+    d->buffer().append(c);
+    return *this;
+}
+
+KDbSqlWriter& KDbSqlWriter::append(const QString &sql)
+{
+    for (const QChar c : sql) {
+        if (c.unicode() >= 0x80) {
+            d->buffer().append(sql.toUtf8());
+            return *this;
+        }
+    }
+    d->appendAscii(sql);
+    return *this;
+}
+
+KDbSqlWriter& KDbSqlWriter::append(const KDbEscapedString &sql)
+{
+    if (!sql.isValid()) {
+        d->valid = false;
+    }
+    d->buffer().append(sql.constData(), sql.length());
+    return *this;
+}
+
+KDbSqlWriter& KDbSqlWriter::appendIdentifier(const QString &identifier)
+{
+    if (!d->appendSimpleIdentifier(identifier)) {
+        d->buffer().append((d->driver ? d->driver->escapeIdentifier(identifier)
+                                    : KDb::escapeIdentifier(identifier)).toUtf8());
+    }
+    return *this;
+}
+
+KDbSqlWriter& KDbSqlWriter::appendFieldNames(const KDbField::List &fields, const char *separator)
+{
+    bool first = true;
+    for (const KDbField *field : fields) {
+        if (first) {
+            first = false;
+        } else {
+            d->buffer().append(separator);
+        }
+        appendIdentifier(field->name());
+    }
+    return *this;
+}
+
+KDbSqlWriter& KDbSqlWriter::appendValue(KDbField::Type type, const QVariant &value)
+{
+    if (d->driver) { // drivers can reimplement valueToSql()
+        return append(d->driver->valueToSql(type, value));
+    }
+    // keep in sync with valueToSqlInternal() from KDbDriver.cpp
+    if (value.isNull() || type == KDbField::Null) {
+        d->buffer().append("NULL");
+        return *this;
+    }
+    if (KDbField::isIntegerType(type)) {
+        switch (value.type()) {
+        case QVariant::Int:
+        case QVariant::LongLong:
+            return appendNumber(value.toLongLong());
+        case QVariant::UInt:
+        case QVariant::ULongLong:
+            return appendNumber(value.toULongLong());
+        default:;
+        }
+    } else if (type == KDbField::Boolean) {
+        return append(value.toInt() == 0 ? "FALSE" : "TRUE");
+    }
+    return append(KDb::valueToSql(type, value));
+}
+
+KDbSqlWriter& KDbSqlWriter::appendValue(const KDbField *field, const QVariant &value)
+{
+    return appendValue(field ? field->type() : KDbField::InvalidType, value);
+}
+
+KDbSqlWriter& KDbSqlWriter::appendNumber(qint64 value)
+{
+    if (value < 0) {
+        d->buffer().append('-');
+        // negation of the minimum value is computed in unsigned arithmetic
+        return appendNumber(quint64(0) - quint64(value));
+    }
+    return appendNumber(quint64(value));
+}
+
+KDbSqlWriter& KDbSqlWriter::appendNumber(quint64 value)
+{
+    char digits[20];
+    int pos = sizeof(digits);
+    do {
+        digits[--pos] = char('0' + value % 10);
+        value /= 10;
+    } while (value > 0);
+    d->buffer().append(digits + pos, int(sizeof(digits)) - pos);
+    return *this;
+}
+
+int KDbSqlWriter::length() const
+{
+    return d->buffer().length();
+}
+
+bool KDbSqlWriter::isEmpty() const
+{
+    return d->buffer().isEmpty();
+}
+
+KDbEscapedString KDbSqlWriter::toString() const
+{
+    return d->valid ? KDbEscapedString(d->buffer()) : KDbEscapedString::invalid();
+}
+
+void KDbSqlWriter::clear()
+{
+    if (!d->buffer().isDetached()) { // still referenced by a string returned by toString()
+        d->current = 1 - d->current;
+        if (!d->buffer().isDetached() || d->buffer().capacity() < d->capacity) {
+            d->buffer() = QByteArray();
+            d->buffer().reserve(d->capacity);
+        }
+    }
+    d->buffer().resize(0);
+    d->valid = true;
+}
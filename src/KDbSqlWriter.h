@@ -0,0 +1,132 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_SQLWRITER_H
+#define KDB_SQLWRITER_H
+
+#include "KDbEscapedString.h"
+#include "KDbField.h"
+
+class KDbDriver;
+
+/**
+ * @brief Streaming writer of SQL statements
+ *
+ * The writer appends SQL text, escaped identifiers and values directly to a single buffer
+ * instead of concatenating temporary KDbEscapedString objects. The buffer keeps its
+ * capacity when clear() is called, so a writer reused for many statements stops allocating
+ * memory once it has grown to the size of the largest statement.
+ *
+ * Identifiers and values are escaped for the driver passed to the constructor using
+ * KDbDriver::escapeIdentifier() and KDbDriver::valueToSql(), or using KDb::escapeIdentifier()
+ * and KDb::valueToSql() if the driver is @c nullptr. Identifiers containing only ASCII
+ * letters, digits and underscores are written without creating temporary strings; this
+ * assumes that KDbDriver::drv_escapeIdentifier() returns such identifiers unchanged.
+ * For KDbSQL escaping, NULL, integer and boolean values are also written directly.
+ * Values for drivers are always converted by KDbDriver::valueToSql() since drivers
+ * may reimplement it.
+ *
+ * toString() returns the statement sharing the writer's buffer. The writer uses two buffers
+ * alternately, so the returned string may be kept until the next statement is executed,
+ * for example by KDbResult::sql(), without causing reallocation.
+ *
+ * Example:
+ * <code>
+ *  KDbSqlWriter writer(connection->driver());
+ *  writer << "DELETE FROM ";
+ *  writer.appendIdentifier(table->name()) << " WHERE ";
+ *  writer.appendIdentifier(field->name()) << '=';
+ *  writer.appendValue(field, value);
+ *  connection->executeSql(writer.toString());
+ * </code>
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbSqlWriter
+{
+public:
+    //! Creates writer escaping identifiers and values for @a driver;
+    //! @a capacity bytes are preallocated for the buffer
+    explicit KDbSqlWriter(const KDbDriver *driver = nullptr, int capacity = 256);
+
+    ~KDbSqlWriter();
+
+    //! @return driver used for escaping, @c nullptr for KDbSQL escaping
+    const KDbDriver *driver() const;
+
+    //! Appends raw SQL text @a sql
+    KDbSqlWriter& append(const char *sql);
+
+    //! @overload
+    KDbSqlWriter& append(char c);
+
+    //! @overload
+    //! @a sql is encoded in UTF-8.
+    KDbSqlWriter& append(const QString &sql);
+
+    //! @overload
+    //! Appending invalid @a sql makes the statement invalid.
+    KDbSqlWriter& append(const KDbEscapedString &sql);
+
+    //! Appends identifier @a identifier escaped for the driver
+    KDbSqlWriter& appendIdentifier(const QString &identifier);
+
+    //! Appends escaped names of @a fields separated by @a separator
+    KDbSqlWriter& appendFieldNames(const KDbField::List &fields, const char *separator = ",");
+
+    //! Appends @a value converted to SQL for type @a type
+    KDbSqlWriter& appendValue(KDbField::Type type, const QVariant &value);
+
+    //! Appends @a value converted to SQL for type of @a field
+    KDbSqlWriter& appendValue(const KDbField *field, const QVariant &value);
+
+    //! Appends decimal representation of @a value
+    KDbSqlWriter& appendNumber(qint64 value);
+
+    //! @overload
+    KDbSqlWriter& appendNumber(quint64 value);
+
+    inline KDbSqlWriter& operator<<(const char *sql) { return append(sql); }
+
+    inline KDbSqlWriter& operator<<(char c) { return append(c); }
+
+    inline KDbSqlWriter& operator<<(const QString &sql) { return append(sql); }
+
+    inline KDbSqlWriter& operator<<(const KDbEscapedString &sql) { return append(sql); }
+
+    //! @return length of the statement in bytes
+    int length() const;
+
+    //! @return @c true if nothing has been written since creation or the last clear()
+    bool isEmpty() const;
+
+    //! @return the statement written so far; invalid string is returned if any invalid
+    //! string has been appended
+    KDbEscapedString toString() const;
+
+    //! Removes the statement keeping capacity of the buffer
+    void clear();
+
+private:
+    Q_DISABLE_COPY(KDbSqlWriter)
+    class Private;
+    Private * const d;
+};
+
+#endif
@@ -0,0 +1,487 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "KDbTableCopy.h"
+#include "KDbBackgroundTask_p.h"
+#include "KDbConnection.h"
+#include "KDbCursor.h"
+#include "KDbIndexSchema.h"
+#include "KDbOrderByColumn.h"
+#include "KDbPreparedStatement.h"
+#include "KDbQuerySchema.h"
+#include "KDbTableSchema.h"
+#include "KDbTransaction.h"
+
+#include <QQueue>
+#include <QThread>
+
+namespace {
+
+//! Records passed from the reader to the writer, column by column
+struct CopyBatch
+{
+    KDbPreparedStatementColumns columns;
+    int recordCount = 0;
+};
+
+//! State shared by the copy and its threads
+struct CopyShared : public KDbBackgroundTaskShared
+{
+    // members below are guarded by mutex
+    QWaitCondition queueNotFull;
+    QWaitCondition queueNotEmpty;
+    QQueue<CopyBatch> queue;
+    int queueCapacity = 8;
+    int batchSize = 1000;
+    bool readerFinished = false;
+    qint64 copiedRecords = 0;
+
+    //! Stores @a result if it is the first error and stops both threads
+    void fail(const KDbResult &failure)
+    {
+        QMutexLocker locker(&mutex);
+        setFailure(failure);
+        queueNotFull.wakeAll();
+        queueNotEmpty.wakeAll();
+    }
+
+    //! Called at the end of each thread
+    void done()
+    {
+        QMutexLocker locker(&mutex);
+        threadDone();
+    }
+};
+
+//! Thread reading records from the source connection
+class ReaderThread : public QThread
+{
+public:
+    ReaderThread(CopyShared *shared, KDbConnection *connection, KDbTableSchema *table,
+                 KDbQuerySchema *query, int columnCount)
+        : m_shared(shared), m_connection(connection), m_table(table), m_query(query)
+        , m_columnCount(columnCount) {}
+
+protected:
+    void run() override
+    {
+        KDbIndexSchema *pkey = m_table ? m_table->primaryKey() : nullptr;
+        KDbField *keyField = (pkey && pkey->fieldCount() == 1) ? pkey->field(0) : nullptr;
+        if (keyField) {
+            readPages(keyField, m_table->indexOf(*keyField));
+        } else {
+            readCursor();
+        }
+        QMutexLocker locker(&m_shared->mutex);
+        m_shared->readerFinished = true;
+        m_shared->queueNotEmpty.wakeAll();
+        m_shared->threadDone();
+    }
+
+private:
+    //! Starts a new batch with space reserved for batchSize records
+    void newBatch(CopyBatch *batch) const
+    {
+        batch->recordCount = 0;
+        batch->columns.clear();
+        batch->columns.reserve(m_columnCount);
+        for (int i = 0; i < m_columnCount; ++i) {
+            batch->columns.append(QList<QVariant>());
+            batch->columns.last().reserve(m_batchSize);
+        }
+    }
+
+    //! Appends current record of @a cursor to @a batch
+    void appendRecord(KDbCursor *cursor, CopyBatch *batch) const
+    {
+        for (int i = 0; i < m_columnCount; ++i) {
+            batch->columns[i].append(cursor->value(i));
+        }
+        ++batch->recordCount;
+    }
+
+    //! Waits for space in the queue and passes @a batch to the writer
+    //! @return @c false if copying has been cancelled
+    bool push(CopyBatch *batch)
+    {
+        QMutexLocker locker(&m_shared->mutex);
+        while (m_shared->queue.count() >= m_shared->queueCapacity
+               && !m_shared->cancelRequested)
+        {
+            m_shared->queueNotFull.wait(&m_shared->mutex);
+        }
+        if (m_shared->cancelRequested) {
+            return false;
+        }
+        m_shared->queue.enqueue(*batch);
+        m_shared->queueNotEmpty.wakeOne();
+        newBatch(batch);
+        return true;
+    }
+
+    //! Reads all records using one cursor
+    void readCursor()
+    {
+        KDbCursor *cursor = m_query ? m_connection->executeQuery(m_query)
+                                    : m_connection->executeQuery(m_table);
+        if (!cursor) {
+            m_shared->fail(m_connection->result());
+            return;
+        }
+        CopyBatch batch;
+        newBatch(&batch);
+        bool ok = true;
+        while (ok && !cursor->eof() && !m_shared->isCancelRequested()) {
+            appendRecord(cursor, &batch);
+            if (batch.recordCount >= m_batchSize) {
+                ok = push(&batch);
+            }
+            cursor->moveNext();
+        }
+        if (cursor->result().isError()) {
+            m_shared->fail(cursor->result());
+        } else if (ok && batch.recordCount > 0) {
+            push(&batch);
+        }
+        m_connection->deleteCursor(cursor);
+    }
+
+    //! Reads records using one query per batch, ordered by @a keyField
+    //! that is at @a keyIndex position in the table
+    void readPages(KDbField *keyField, int keyIndex)
+    {
+        QVariant lastKey;
+        CopyBatch batch;
+        newBatch(&batch);
+        while (!m_shared->isCancelRequested()) {
+            KDbQuerySchema query(m_table);
+            if (!lastKey.isNull()) {
+                QString errorMessage;
+                QString errorDescription;
+                if (!query.addToWhereExpression(keyField, lastKey, '>', &errorMessage,
+                                                &errorDescription))
+                {
+                    KDbResult result(ERR_OTHER, errorDescription);
+                    result.setMessageTitle(errorMessage);
+                    m_shared->fail(result);
+                    return;
+                }
+            }
+            query.orderByColumnList()->appendField(keyField);
+            query.setLimit(m_batchSize);
+            KDbCursor *cursor = m_connection->executeQuery(&query);
+            if (!cursor) {
+                m_shared->fail(m_connection->result());
+                return;
+            }
+            while (!cursor->eof()) {
+                appendRecord(cursor, &batch);
+                cursor->moveNext();
+            }
+            const KDbResult result(cursor->result());
+            m_connection->deleteCursor(cursor);
+            if (result.isError()) {
+                m_shared->fail(result);
+                return;
+            }
+            const int count = batch.recordCount;
+            if (count == 0) {
+                return;
+            }
+            lastKey = batch.columns.at(keyIndex).last();
+            if (!push(&batch) || count < m_batchSize) {
+                return;
+            }
+        }
+    }
+
+    CopyShared * const m_shared;
+    KDbConnection * const m_connection;
+    KDbTableSchema * const m_table;
+    KDbQuerySchema * const m_query;
+    const int m_columnCount;
+    const int m_batchSize = m_shared->batchSize;
+};
+
+//! Thread inserting batches into the destination table
+class WriterThread : public QThread
+{
+public:
+    WriterThread(CopyShared *shared, KDbConnection *connection, KDbTableSchema *table)
+        : m_shared(shared), m_connection(connection), m_table(table) {}
+
+protected:
+    void run() override
+    {
+        KDbPreparedStatement statement
+            = m_connection->prepareStatement(KDbPreparedStatement::InsertStatement, m_table);
+        if (!statement.isValid()) {
+            m_shared->fail(m_connection->result().isError() ? m_connection->result()
+                                                            : statement.result());
+        } else {
+            CopyBatch batch;
+            while (take(&batch) && write(&statement, &batch)) {
+            }
+        }
+        m_shared->done();
+    }
+
+private:
+    //! Waits for the next batch
+    //! @return @c false if there are no more batches or copying has been cancelled
+    bool take(CopyBatch *batch)
+    {
+        QMutexLocker locker(&m_shared->mutex);
+        while (m_shared->queue.isEmpty() && !m_shared->readerFinished
+               && !m_shared->cancelRequested)
+        {
+            m_shared->queueNotEmpty.wait(&m_shared->mutex);
+        }
+        if (m_shared->cancelRequested || m_shared->queue.isEmpty()) {
+            return false;
+        }
+        *batch = m_shared->queue.dequeue();
+        m_shared->queueNotFull.wakeOne();
+        return true;
+    }
+
+    //! Converts values of @a batch to types of the destination fields and inserts them
+    bool write(KDbPreparedStatement *statement, CopyBatch *batch)
+    {
+        for (int i = 0; i < batch->columns.count(); ++i) {
+            const KDbField::Type type = m_table->field(i)->type();
+            QList<QVariant> &column = batch->columns[i];
+            for (QVariant &value : column) {
+                if (!value.isNull()) {
+                    value = KDbField::convertToType(value, type);
+                }
+            }
+        }
+        KDbTransaction transaction = m_connection->beginTransaction();
+        if (transaction.isNull()) {
+            m_shared->fail(m_connection->result());
+            return false;
+        }
+        qint64 affected = 0;
+        int failedRecord = -1;
+        if (!statement->executeBatch(batch->columns, &affected, &failedRecord)) {
+            KDbResult result(statement->result());
+            if (failedRecord >= 0) {
+                result.setMessageTitle(KDbTableCopy::tr("Could not insert record %1.")
+                                       .arg(m_copiedRecords + failedRecord + 1));
+            }
+            m_connection->rollbackTransaction(transaction,
+                                              KDbTransaction::CommitOption::IgnoreInactive);
+            m_shared->fail(result);
+            return false;
+        }
+        if (!m_connection->commitTransaction(transaction)) {
+            m_shared->fail(m_connection->result());
+            return false;
+        }
+        m_copiedRecords += batch->recordCount;
+        QMutexLocker locker(&m_shared->mutex);
+        m_shared->copiedRecords = m_copiedRecords;
+        m_shared->post(KDbBackgroundEvent::Kind::Progress, m_copiedRecords);
+        return true;
+    }
+
+    CopyShared * const m_shared;
+    KDbConnection * const m_connection;
+    KDbTableSchema * const m_table;
+    qint64 m_copiedRecords = 0;
+};
+}
+
+class Q_DECL_HIDDEN KDbTableCopy::Private
+{
+public:
+    Private() {}
+
+    KDbConnection *source = nullptr;
+    KDbTableSchema *sourceTable = nullptr;
+    KDbQuerySchema *sourceQuery = nullptr;
+    KDbConnection *destination = nullptr;
+    KDbTableSchema *destinationTable = nullptr;
+    bool started = false;
+    QThread *reader = nullptr;
+    QThread *writer = nullptr;
+    CopyShared shared;
+
+private:
+    Q_DISABLE_COPY(Private)
+};
+
+KDbTableCopy::KDbTableCopy(KDbConnection *source, KDbTableSchema *sourceTable,
+                           KDbConnection *destination, KDbTableSchema *destinationTable,
+                           QObject *parent)
+    : QObject(parent)
+    , d(new Private)
+{
+    d->source = source;
+    d->sourceTable = sourceTable;
+    d->destination = destination;
+    d->destinationTable = destinationTable;
+    d->shared.owner = this;
+}
+
+KDbTableCopy::KDbTableCopy(KDbConnection *source, KDbQuerySchema *sourceQuery,
+                           KDbConnection *destination, KDbTableSchema *destinationTable,
+                           QObject *parent)
+    : QObject(parent)
+    , d(new Private)
+{
+    d->source = source;
+    d->sourceQuery = sourceQuery;
+    d->destination = destination;
+    d->destinationTable = destinationTable;
+    d->shared.owner = this;
+}
+
+KDbTableCopy::~KDbTableCopy()
+{
+    cancel();
+    if (d->reader) {
+        d->reader->wait();
+        delete d->reader;
+    }
+    if (d->writer) {
+        d->writer->wait();
+        delete d->writer;
+    }
+    delete d;
+}
+
+int KDbTableCopy::batchSize() const
+{
+    QMutexLocker locker(&d->shared.mutex);
+    return d->shared.batchSize;
+}
+
+void KDbTableCopy::setBatchSize(int size)
+{
+    if (!d->started) {
+        QMutexLocker locker(&d->shared.mutex);
+        d->shared.batchSize = qMax(1, size);
+    }
+}
+
+int KDbTableCopy::queueCapacity() const
+{
+    QMutexLocker locker(&d->shared.mutex);
+    return d->shared.queueCapacity;
+}
+
+void KDbTableCopy::setQueueCapacity(int capacity)
+{
+    if (!d->started) {
+        QMutexLocker locker(&d->shared.mutex);
+        d->shared.queueCapacity = qMax(1, capacity);
+    }
+}
+
+bool KDbTableCopy::start()
+{
+    clearResult();
+    if (d->started) {
+        m_result = KDbResult(ERR_OTHER, tr("Copying has already been started."));
+        return false;
+    }
+    if (!d->source || !d->source->isDatabaseUsed()
+        || !d->destination || !d->destination->isDatabaseUsed())
+    {
+        m_result = KDbResult(ERR_NO_DB_USED, tr("No database is used by the connection."));
+        return false;
+    }
+    if (d->source == d->destination) {
+        m_result = KDbResult(ERR_OTHER, tr("Source and destination connections must differ. "
+                                           "Use KDbConnection::copyTable() instead."));
+        return false;
+    }
+    if ((!d->sourceTable && !d->sourceQuery) || !d->destinationTable) {
+        m_result = KDbResult(ERR_OBJECT_NOT_FOUND, tr("No table to copy."));
+        return false;
+    }
+    const int columnCount = d->sourceQuery ? d->sourceQuery->fieldsExpanded(d->source).count()
+                                           : d->sourceTable->fieldCount();
+    if (columnCount != d->destinationTable->fieldCount()) {
+        m_result = KDbResult(ERR_OTHER,
+                             tr("Table \"%1\" has %2 fields while %3 columns are copied.")
+                             .arg(d->destinationTable->name())
+                             .arg(d->destinationTable->fieldCount()).arg(columnCount));
+        return false;
+    }
+    d->started = true;
+    d->shared.running = 2;
+    d->reader = new ReaderThread(&d->shared, d->source, d->sourceTable, d->sourceQuery,
+                                 columnCount);
+    d->writer = new WriterThread(&d->shared, d->destination, d->destinationTable);
+    d->reader->start();
+    d->writer->start();
+    return true;
+}
+
+bool KDbTableCopy::isFinished() const
+{
+    QMutexLocker locker(&d->shared.mutex);
+    return d->started && d->shared.running == 0;
+}
+
+qint64 KDbTableCopy::copiedRecordCount() const
+{
+    QMutexLocker locker(&d->shared.mutex);
+    return d->shared.copiedRecords;
+}
+
+void KDbTableCopy::cancel()
+{
+    QMutexLocker locker(&d->shared.mutex);
+    if (d->shared.cancelRequested) {
+        return;
+    }
+    d->shared.cancelRequested = true;
+    d->shared.queueNotFull.wakeAll();
+    d->shared.queueNotEmpty.wakeAll();
+    if (d->started && !d->shared.readerFinished) {
+        d->source->cancelQuery();
+    }
+}
+
+bool KDbTableCopy::waitForFinished(int timeout)
+{
+    return d->shared.waitForFinished(timeout);
+}
+
+bool KDbTableCopy::event(QEvent *event)
+{
+    const KDbBackgroundEvent *copyEvent = KDbBackgroundEvent::cast(event);
+    if (copyEvent) {
+        if (copyEvent->kind() == KDbBackgroundEvent::Kind::Progress) {
+            emit progress(copyEvent->value());
+        } else {
+            const KDbResult failure(d->shared.failure());
+            if (failure.isError()) {
+                m_result = failure;
+            }
+            emit finished();
+        }
+        return true;
+    }
+    return QObject::event(event);
+}
@@ -0,0 +1,149 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_TABLECOPY_H
+#define KDB_TABLECOPY_H
+
+#include <QObject>
+
+#include "KDbResult.h"
+
+class KDbConnection;
+class KDbQuerySchema;
+class KDbTableSchema;
+
+/**
+ * @brief Copies records of a table or query from one connection to a table of another connection
+ *
+ * Connections can use different drivers, e.g. records can be moved from a MySQL database
+ * to a PostgreSQL database. Copying is pipelined: a reader thread fetches records from the
+ * source connection and groups them into batches of batchSize() records kept in a queue
+ * of at most queueCapacity() batches, while a writer thread inserts the batches into
+ * the destination table using KDbPreparedStatement::executeBatch(), i.e. using the fastest
+ * bulk insert method of the destination driver. Each batch is inserted within its own
+ * transaction. When the writer is slower than the reader, the reader waits, so memory use
+ * is limited regardless of the number of records.
+ *
+ * Source columns are mapped to fields of the destination table by position and values are
+ * converted to types of the destination fields using KDbField::convertToType(). The
+ * destination table has to exist and have the same number of fields as the source has
+ * columns. To create a table with the same design, copy the source table schema using
+ * KDbTableSchema(const KDbTableSchema&, bool) and create it using
+ * KDbConnection::createTable() of the destination connection.
+ *
+ * If the source is a table with a single-field primary key, it is read page by page using
+ * keyset pagination (<tt>WHERE key > last ORDER BY key LIMIT n</tt>), so that drivers
+ * fetching entire results to client side never hold more than one batch. Other tables
+ * and queries are read using a single cursor; set KDbConnection::setCursorMemoryBudget()
+ * for the source connection or use a query that reads a limited number of records then.
+ *
+ * Both connections are used by the copy's threads, so they must not be used by other threads
+ * until the copy is finished. Database schema should not change and the table or query
+ * should not be modified or deleted during the copy.
+ *
+ * Example usage:
+ * <code>
+ *  KDbTableCopy *copy = new KDbTableCopy(mysqlConnection, sourceTable,
+ *                                        pgsqlConnection, destinationTable, this);
+ *  connect(copy, &KDbTableCopy::progress, [](qint64 records) {
+ *      qDebug() << records << "records copied";
+ *  });
+ *  connect(copy, &KDbTableCopy::finished, copy, &QObject::deleteLater);
+ *  if (!copy->start()) {
+ *      qWarning() << copy->result();
+ *  }
+ * </code>
+ *
+ * @since 3.3
+ */
+class KDB_EXPORT KDbTableCopy : public QObject, public KDbResultable
+{
+    Q_OBJECT
+public:
+    //! Creates copy of all records of @a sourceTable available through @a source
+    //! into @a destinationTable available through @a destination.
+    KDbTableCopy(KDbConnection *source, KDbTableSchema *sourceTable,
+                 KDbConnection *destination, KDbTableSchema *destinationTable,
+                 QObject *parent = nullptr);
+
+    //! Creates copy of records of @a sourceQuery available through @a source
+    //! into @a destinationTable available through @a destination.
+    KDbTableCopy(KDbConnection *source, KDbQuerySchema *sourceQuery,
+                 KDbConnection *destination, KDbTableSchema *destinationTable,
+                 QObject *parent = nullptr);
+
+    //! Cancels the copy if it is running and waits for its threads.
+    ~KDbTableCopy() override;
+
+    //! @return number of records inserted using one statement execution and transaction;
+    //! default is 1000
+    int batchSize() const;
+
+    //! Sets number of records inserted using one statement execution to @a size.
+    //! Has no effect after start().
+    void setBatchSize(int size);
+
+    //! @return maximum number of batches read but not yet written; default is 8
+    int queueCapacity() const;
+
+    //! Sets maximum number of batches read but not yet written to @a capacity.
+    //! Has no effect after start().
+    void setQueueCapacity(int capacity);
+
+    /**
+     * @brief Validates the tables and starts the reader and writer threads
+     *
+     * @return @c false if the copy cannot be started, result() contains the error then.
+     */
+    bool start();
+
+    //! @return @c true if all records have been copied, copying failed or was cancelled
+    bool isFinished() const;
+
+    //! @return number of records inserted into the destination table so far
+    qint64 copiedRecordCount() const;
+
+    //! Stops copying; finished() is emitted afterwards.
+    //! Batches that have already been inserted are not removed.
+    void cancel();
+
+    //! Blocks until the copy is finished or @a timeout milliseconds pass.
+    //! Negative @a timeout means waiting without a limit.
+    //! @return @c true if the copy is finished.
+    bool waitForFinished(int timeout = -1);
+
+Q_SIGNALS:
+    //! Emitted after a batch has been inserted; @a copiedRecords is the total number
+    //! of records inserted so far
+    void progress(qint64 copiedRecords);
+
+    //! Emitted when all records have been copied, copying failed (see result())
+    //! or has been cancelled
+    void finished();
+
+protected:
+    bool event(QEvent *event) override;
+
+private:
+    Q_DISABLE_COPY(KDbTableCopy)
+    class Private;
+    Private * const d;
+};
+
+#endif
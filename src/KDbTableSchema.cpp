@@ -21,6 +21,7 @@
 #include "KDbTableSchema.h"
 #include "KDbDriver.h"
 #include "KDbConnection.h"
+#include "KDbConnection_p.h"
 #include "KDbLookupFieldSchema.h"
 #include "KDbQuerySchema.h"
 #include "kdb_debug.h"
@@ -382,6 +383,9 @@ bool KDbTableSchema::setLookupFieldSchema(const QString& fieldName, KDbLookupFie
         d->lookupFields.insert(f, lookupFieldSchema);
     }
     d->lookupFieldsList.clear(); //this will force to rebuid the internal cache
+    if (d->conn) {
+        ++d->conn->d->schemaRevision; // statements cached by queries can contain lookup joins
+    }
     return true;
 }
 
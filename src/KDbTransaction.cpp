@@ -50,6 +50,7 @@ public:
     KDbConnection *connection;
     bool active = true;
     int refcount = 1;
+    int nestingLevel = 0;
 };
 
 KDbTransactionData::KDbTransactionData(KDbConnection *connection)
@@ -96,6 +97,16 @@ void KDbTransactionData::setActive(bool set)
     d->active = set;
 }
 
+int KDbTransactionData::nestingLevel() const
+{
+    return d->nestingLevel;
+}
+
+void KDbTransactionData::setNestingLevel(int level)
+{
+    d->nestingLevel = level;
+}
+
 KDbConnection *KDbTransactionData::connection()
 {
     return d->connection;
@@ -190,6 +201,11 @@ bool KDbTransaction::isNull() const
     return m_data == nullptr;
 }
 
+bool KDbTransaction::isNested() const
+{
+    return m_data && m_data->nestingLevel() > 0;
+}
+
 //---------------------------------------------------
 
 class Q_DECL_HIDDEN KDbTransactionGuard::Private
@@ -109,6 +109,15 @@ public:
      */
     bool isNull() const;
 
+    /**
+     * @brief Returns @c true if this is a nested transaction
+     *
+     * Nested transactions are started by KDbConnection::beginTransaction() within active
+     * default transaction if the driver supports KDbDriver::NestedTransactions.
+     * @since 3.3
+     */
+    bool isNested() const;
+
 #ifdef KDB_TRANSACTIONS_DEBUG
     //! Helper for debugging, returns value of global transaction data reference counter
     static int globalCount();
@@ -118,6 +127,7 @@ protected:
     KDbTransactionData *m_data;
 
     friend class KDbConnection;
+    friend class KDbConnectionPrivate;
 };
 
 Q_DECLARE_OPERATORS_FOR_FLAGS(KDbTransaction::CommitOptions)
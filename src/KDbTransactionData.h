@@ -54,6 +54,15 @@ public:
     //! Sets "active" flag of this data
     void setActive(bool set);
 
+    //! @return nesting level of the transaction, 0 for top-level transactions
+    //! @see KDbTransaction::isNested()
+    //! @since 3.3
+    int nestingLevel() const;
+
+    //! Sets nesting level of the transaction to @a level
+    //! @since 3.3
+    void setNestingLevel(int level);
+
     //! @return connection for this data
     KDbConnection *connection();
 
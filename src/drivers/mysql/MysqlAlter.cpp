@@ -0,0 +1,133 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+// ** bits of MysqlConnection related to table altering **
+
+#include "MysqlConnection.h"
+#include "KDb.h"
+#include "KDbNativeStatementBuilder.h"
+
+//! @return clause placing a column at position @a index among @a fields,
+//! i.e. " FIRST" or " AFTER <name of the preceding field>"
+static KDbEscapedString positionClause(const MysqlConnection &conn,
+                                       const QList<KDbField*> &fields, int index)
+{
+    if (index <= 0 || fields.isEmpty()) {
+        return KDbEscapedString(" FIRST");
+    }
+    const KDbField *previous = fields.at(qMin(index, fields.count()) - 1);
+    return KDbEscapedString(" AFTER ") + conn.escapeIdentifier(previous->name());
+}
+
+//! @return true if definition of @a field can be repeated in CHANGE and MODIFY clauses;
+//! key and auto-increment options would be applied twice
+static bool canRedefineField(const KDbField &field)
+{
+    return !field.isPrimaryKey() && !field.isUniqueKey() && !field.isAutoIncrement();
+}
+
+tristate MysqlConnection::drv_renameFieldStatements(KDbTableSchema *table, KDbField *field,
+        const QString& newName, QList<KDbEscapedString> *statements)
+{
+    // RENAME COLUMN is not available before MySQL 8.0, CHANGE needs the full definition
+    if (!canRedefineField(*field)) {
+        return cancelled;
+    }
+    KDbField renamed(*field);
+    renamed.setName(newName);
+    KDbEscapedString definition;
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    if (!builder.generateFieldDefinition(&definition, renamed)) {
+        return false;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 CHANGE COLUMN %2 ")
+                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                            KDbEscapedString(escapeIdentifier(field->name()))) + definition);
+    return true;
+}
+
+tristate MysqlConnection::drv_insertFieldStatements(KDbTableSchema *table, const KDbField *field,
+        int index, QList<KDbEscapedString> *statements)
+{
+    KDbEscapedString sql;
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    if (!builder.generateFieldDefinition(&sql, *field)) {
+        return false;
+    }
+    sql.prepend(KDbEscapedString("ALTER TABLE %1 ADD COLUMN ").arg(escapeIdentifier(table->name())));
+    if (index < table->fieldCount()) {
+        sql += positionClause(*this, *table->fields(), index);
+    }
+    statements->append(sql);
+    return true;
+}
+
+tristate MysqlConnection::drv_removeFieldStatements(KDbTableSchema *table, KDbField *field,
+        QList<KDbEscapedString> *statements)
+{
+    statements->append(KDbEscapedString("ALTER TABLE %1 DROP COLUMN %2")
+                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                            KDbEscapedString(escapeIdentifier(field->name()))));
+    return true;
+}
+
+tristate MysqlConnection::drv_changeFieldPropertyStatements(KDbTableSchema *table,
+        KDbField *field, const QString& propertyName, const QVariant& value,
+        QList<KDbEscapedString> *statements)
+{
+    if (!canRedefineField(*field)
+        || !(propertyName == QLatin1String("type") || propertyName == QLatin1String("maxLength")
+             || propertyName == QLatin1String("precision") || propertyName == QLatin1String("unsigned")
+             || propertyName == QLatin1String("notNull") || propertyName == QLatin1String("defaultValue")))
+    {
+        return cancelled;
+    }
+    KDbField altered(*field);
+    if (!KDb::setFieldProperty(&altered, propertyName.toLatin1(), value)) {
+        return cancelled;
+    }
+    // MODIFY redefines the column; values are converted by the server
+    KDbEscapedString definition;
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    if (!builder.generateFieldDefinition(&definition, altered)) {
+        return false;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 MODIFY COLUMN ")
+                       .arg(escapeIdentifier(table->name())) + definition);
+    return true;
+}
+
+tristate MysqlConnection::drv_moveFieldStatements(KDbTableSchema *table, KDbField *field,
+        int index, QList<KDbEscapedString> *statements)
+{
+    if (!canRedefineField(*field)) {
+        return cancelled;
+    }
+    QList<KDbField*> otherFields(*table->fields());
+    otherFields.removeOne(field);
+    KDbEscapedString definition;
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    if (!builder.generateFieldDefinition(&definition, *field)) {
+        return false;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 MODIFY COLUMN ")
+                       .arg(escapeIdentifier(table->name()))
+                       + definition + positionClause(*this, otherFields, index));
+    return true;
+}
@@ -0,0 +1,172 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "MysqlBlob.h"
+#include "KDbConnection.h"
+#include "KDbError.h"
+#include "mysql_debug.h"
+
+//! Maximum number of bytes transferred by a single statement
+static const int CHUNK_SIZE = 1024 * 1024;
+
+MysqlBlob::MysqlBlob(MysqlConnectionInternal* conn)
+        : KDbBlobInterface()
+        , MysqlConnectionInternal(conn->connection)
+        , m_size(0)
+{
+    mysql_owned = false;
+    mysql = conn->mysql;
+}
+
+MysqlBlob::~MysqlBlob()
+{
+}
+
+qint64 MysqlBlob::select(const KDbEscapedString &expression, char *data, qint64 maxSize)
+{
+    if (!executeSql(KDbEscapedString("SELECT %1 FROM %2 WHERE %3")
+                        .arg(expression, m_escapedTableName, m_where)))
+    {
+        storeResult(&m_result);
+        return -1;
+    }
+    MYSQL_RES *result = mysql_store_result(mysql);
+    if (!result) {
+        storeResult(&m_result);
+        return -1;
+    }
+    qint64 length = -1;
+    MYSQL_ROW row = mysql_fetch_row(result);
+    if (row) {
+        length = row[0] ? qint64(mysql_fetch_lengths(result)[0]) : 0;
+        if (data) {
+            length = qMin(length, maxSize);
+            memcpy(data, row[0], length);
+        }
+    } else {
+        m_result = KDbResult(ERR_OBJECT_NOT_FOUND,
+                             MysqlConnection::tr("Could not find record in table \"%1\".")
+                                .arg(m_tableName));
+    }
+    mysql_free_result(result);
+    return length;
+}
+
+bool MysqlBlob::update(const KDbEscapedString &value)
+{
+    if (!executeSql(KDbEscapedString("UPDATE %1 SET %2=%3 WHERE %4")
+                        .arg(m_escapedTableName, m_escapedFieldName, value, m_where)))
+    {
+        storeResult(&m_result);
+        return false;
+    }
+    return true;
+}
+
+bool MysqlBlob::open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+                     bool writable)
+{
+    Q_UNUSED(writable)
+    m_tableName = table->name();
+    m_escapedTableName = KDbEscapedString(connection->escapeIdentifier(table->name()));
+    m_escapedFieldName = KDbEscapedString(connection->escapeIdentifier(field->name()));
+    m_where = where;
+    // the value is returned as text
+    char sizeString[32];
+    const qint64 length = select(KDbEscapedString("LENGTH(%1)").arg(m_escapedFieldName),
+                                 sizeString, sizeof(sizeString) - 1);
+    if (length < 0) {
+        return false;
+    }
+    sizeString[length] = '\0';
+    m_size = QByteArray(sizeString).toLongLong();
+    return true;
+}
+
+qint64 MysqlBlob::size()
+{
+    return m_size;
+}
+
+qint64 MysqlBlob::read(qint64 offset, char *data, qint64 maxSize)
+{
+    qint64 total = 0;
+    maxSize = qMin(maxSize, m_size - offset);
+    while (total < maxSize) {
+        const qint64 count = qMin(maxSize - total, qint64(CHUNK_SIZE));
+        const qint64 length = select(KDbEscapedString("SUBSTRING(%1, %2, %3)")
+                                         .arg(m_escapedFieldName).arg(offset + total + 1)
+                                         .arg(count),
+                                     data + total, count);
+        if (length < 0) {
+            return -1;
+        }
+        if (length == 0) { // the value has been truncated meanwhile
+            break;
+        }
+        total += length;
+    }
+    return total;
+}
+
+bool MysqlBlob::write(qint64 offset, const char *data, qint64 size)
+{
+    for (qint64 written = 0; written < size;) {
+        const qint64 count = qMin(size - written, qint64(CHUNK_SIZE));
+        const KDbEscapedString chunk(
+            KDbEscapedString("X'") + QByteArray::fromRawData(data + written, count).toHex() + '\'');
+        const qint64 position = offset + written;
+        KDbEscapedString value;
+        if (position >= m_size) { // append
+            value = KDbEscapedString("CONCAT(COALESCE(%1, ''), %2)").arg(m_escapedFieldName, chunk);
+        } else { // overwrite, possibly past the end
+            value = KDbEscapedString("INSERT(%1, %2, %3, %4)")
+                        .arg(m_escapedFieldName).arg(position + 1).arg(count).arg(chunk);
+        }
+        if (!update(value)) {
+            return false;
+        }
+        written += count;
+        m_size = qMax(m_size, position + count);
+    }
+    return true;
+}
+
+bool MysqlBlob::resize(qint64 size)
+{
+    if (size <= m_size) {
+        if (!update(KDbEscapedString("LEFT(%1, %2)").arg(m_escapedFieldName).arg(size))) {
+            return false;
+        }
+        m_size = size;
+        return true;
+    }
+    // zeros are added in chunks because REPEAT() returns NULL for results
+    // larger than max_allowed_packet
+    while (m_size < size) {
+        const qint64 count = qMin(size - m_size, qint64(CHUNK_SIZE));
+        if (!update(KDbEscapedString("CONCAT(COALESCE(%1, ''), REPEAT(X'00', %2))")
+                        .arg(m_escapedFieldName).arg(count)))
+        {
+            return false;
+        }
+        m_size += count;
+    }
+    return true;
+}
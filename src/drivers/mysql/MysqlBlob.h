@@ -0,0 +1,64 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_MYSQLBLOB_H
+#define KDB_MYSQLBLOB_H
+
+#include "KDbBlobInterface.h"
+#include "MysqlConnection_p.h"
+
+/*! Incremental access to BLOB values for the MySQL driver.
+ Ranges are read using SUBSTRING() and written using INSERT() or CONCAT() in chunks that
+ fit in the default max_allowed_packet limit of the server. */
+class MysqlBlob : public KDbBlobInterface, public MysqlConnectionInternal
+{
+public:
+    explicit MysqlBlob(MysqlConnectionInternal* conn);
+
+    ~MysqlBlob() override;
+
+protected:
+    bool open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+              bool writable) override;
+
+    qint64 size() override;
+
+    qint64 read(qint64 offset, char *data, qint64 maxSize) override;
+
+    bool write(qint64 offset, const char *data, qint64 size) override;
+
+    bool resize(qint64 size) override;
+
+private:
+    /*! Executes SELECT statement for @a expression. Up to @a maxSize bytes of the value
+     are copied to @a data. @return size of the value or -1 on error. */
+    qint64 select(const KDbEscapedString &expression, char *data, qint64 maxSize);
+
+    //! Executes UPDATE statement setting the value to @a value
+    bool update(const KDbEscapedString &value);
+
+    KDbEscapedString m_escapedTableName;
+    KDbEscapedString m_escapedFieldName;
+    KDbEscapedString m_where;
+    QString m_tableName;
+    qint64 m_size;
+    Q_DISABLE_COPY(MysqlBlob)
+};
+
+#endif
@@ -20,14 +20,56 @@
 */
 
 #include "MysqlConnection.h"
+#include "MysqlBlob.h"
 #include "MysqlDriver.h"
 #include "MysqlCursor.h"
 #include "MysqlPreparedStatement.h"
 #include "mysql_debug.h"
 #include "KDbConnectionData.h"
+#include "KDbTransactionData.h"
 #include "KDbVersionInfo.h"
 
 #include <QRegularExpression>
+#include <QThread>
+
+namespace {
+
+/*! Thread killing statement executed by a connection using its own connection.
+ The MySQL client library keeps per-thread state. It is initialized and released
+ in this dedicated thread, not in the thread calling KDbConnection::cancelQuery(). */
+class MysqlQueryKiller : public QThread
+{
+public:
+    MysqlQueryKiller(KDbConnection *connection, unsigned long threadId)
+        : m_connection(connection), m_threadId(threadId) {}
+
+    //! @return true if the KILL QUERY statement succeeded
+    bool isKilled() const { return m_killed; }
+
+protected:
+    void run() override
+    {
+        mysql_thread_init();
+        {
+            MysqlConnectionInternal killer(m_connection);
+            if (killer.db_connect(m_connection->data())) {
+                m_killed = killer.executeSql(
+                    KDbEscapedString("KILL QUERY %1").arg(quint64(m_threadId)));
+            } else {
+                mysqlWarning() << "Could not connect to cancel query:"
+                               << MysqlConnectionInternal::serverResultName(killer.mysql);
+            }
+        } // disconnects before the thread's state is released
+        mysql_thread_end();
+    }
+
+private:
+    KDbConnection * const m_connection;
+    const unsigned long m_threadId;
+    bool m_killed = false;
+};
+
+} // namespace
 
 MysqlConnection::MysqlConnection(KDbDriver *driver, const KDbConnectionData& connData,
                                  const KDbConnectionOptions &options)
@@ -61,6 +103,10 @@ bool MysqlConnection::drv_connect()
     if (res == false) // sanity
         return false;
     d->lowerCaseTableNames = intLowerCaseTableNames > 0;
+    // auto commit mode could be changed before connecting
+    if (!autoCommit() && !drv_setAutoCommit(false)) {
+        return false;
+    }
     return true;
 }
 
@@ -192,6 +238,62 @@ bool MysqlConnection::drv_executeSql(const KDbEscapedString& sql)
     return true;
 }
 
+bool MysqlConnection::drv_cancelQuery()
+{
+    // The running statement blocks this connection so kill it from a new one.
+    // Only the thread id is read here, the busy connection's handle belongs to its thread.
+    const unsigned long threadId = d->serverThreadId;
+    if (threadId == 0) {
+        return false;
+    }
+    MysqlQueryKiller killer(this, threadId);
+    killer.start();
+    killer.wait();
+    return killer.isKilled();
+}
+
+KDbTransactionData* MysqlConnection::drv_beginTransaction()
+{
+    // Note that statements like CREATE TABLE cause implicit commit in MySQL
+    // and that tables of non-transactional engines such as MyISAM ignore transactions.
+    if (!drv_executeSql(KDbEscapedString("START TRANSACTION"))) {
+        return nullptr;
+    }
+    return new KDbTransactionData(this);
+}
+
+bool MysqlConnection::drv_commitTransaction(KDbTransactionData *trans)
+{
+    Q_UNUSED(trans)
+    if (mysql_commit(d->mysql) != 0) {
+        storeResult();
+        return false;
+    }
+    return true;
+}
+
+bool MysqlConnection::drv_rollbackTransaction(KDbTransactionData *trans)
+{
+    Q_UNUSED(trans)
+    if (mysql_rollback(d->mysql) != 0) {
+        storeResult();
+        return false;
+    }
+    return true;
+}
+
+bool MysqlConnection::drv_setAutoCommit(bool on)
+{
+    if (!d->mysql) { // applied in drv_connect()
+        return true;
+    }
+    if (mysql_autocommit(d->mysql, on) != 0) {
+        storeResult();
+        return false;
+    }
+    return true;
+}
+
 QString MysqlConnection::serverResultName() const
 {
     return MysqlConnectionInternal::serverResultName(d->mysql);
@@ -208,6 +310,11 @@ KDbPreparedStatementInterface* MysqlConnection::prepareStatementInternal()
     return new MysqlPreparedStatement(d);
 }
 
+KDbBlobInterface* MysqlConnection::createBlobInterface()
+{
+    return new MysqlBlob(d);
+}
+
 void MysqlConnection::storeResult()
 {
     d->storeResult(&m_result);
@@ -25,12 +25,16 @@
 #include <QStringList>
 
 #include "KDbConnection.h"
+#include "KDbAlterTableInterface.h"
+#include "KDbBlobInterface.h"
+#include "KDbCancelQueryInterface.h"
 
 class MysqlConnectionInternal;
 
 /*! @short Provides database connection, allowing queries and data modification.
 */
-class MysqlConnection : public KDbConnection
+class MysqlConnection : public KDbConnection, public KDbAlterTableInterface,
+        public KDbBlobInterfaceFactory, public KDbCancelQueryInterface
 {
     Q_DECLARE_TR_FUNCTIONS(MysqlConnection)
 public:
@@ -45,6 +49,8 @@ public:
 
     Q_REQUIRED_RESULT KDbPreparedStatementInterface *prepareStatementInternal() override;
 
+    Q_REQUIRED_RESULT KDbBlobInterface *createBlobInterface() override;
+
 protected:
     /*! Used by driver */
     MysqlConnection(KDbDriver *driver, const KDbConnectionData& connData,
@@ -64,6 +70,20 @@ protected:
     Q_REQUIRED_RESULT KDbSqlResult *drv_prepareSql(const KDbEscapedString &sql) override;
     bool drv_executeSql(const KDbEscapedString& sql) override;
 
+    bool drv_cancelQuery() override;
+
+    //! Starts transaction using "START TRANSACTION"
+    Q_REQUIRED_RESULT KDbTransactionData *drv_beginTransaction() override;
+
+    //! Implemented using mysql_commit()
+    bool drv_commitTransaction(KDbTransactionData *trans) override;
+
+    //! Implemented using mysql_rollback()
+    bool drv_rollbackTransaction(KDbTransactionData *trans) override;
+
+    //! Implemented using mysql_autocommit()
+    bool drv_setAutoCommit(bool on) override;
+
     //! Implemented for KDbResultable
     QString serverResultName() const override;
 
@@ -72,6 +92,26 @@ protected:
 
     void storeResult();
 
+    //! Uses ALTER TABLE ... CHANGE COLUMN
+    tristate drv_renameFieldStatements(KDbTableSchema* table, KDbField* field,
+            const QString& newName, QList<KDbEscapedString> *statements) override;
+
+    //! Uses ALTER TABLE ... ADD COLUMN with FIRST or AFTER clause
+    tristate drv_insertFieldStatements(KDbTableSchema* table, const KDbField* field,
+            int index, QList<KDbEscapedString> *statements) override;
+
+    tristate drv_removeFieldStatements(KDbTableSchema* table, KDbField* field,
+            QList<KDbEscapedString> *statements) override;
+
+    //! Uses ALTER TABLE ... MODIFY COLUMN for type, "notNull" and "defaultValue" properties
+    tristate drv_changeFieldPropertyStatements(KDbTableSchema* table, KDbField* field,
+            const QString& propertyName, const QVariant& value,
+            QList<KDbEscapedString> *statements) override;
+
+    //! Uses ALTER TABLE ... MODIFY COLUMN with FIRST or AFTER clause
+    tristate drv_moveFieldStatements(KDbTableSchema* table, KDbField* field,
+            int index, QList<KDbEscapedString> *statements) override;
+
     MysqlConnectionInternal* const d;
 
     friend class MysqlDriver;
@@ -39,6 +39,7 @@ MysqlConnectionInternal::MysqlConnectionInternal(KDbConnection* connection)
         , res(0)
         , lowerCaseTableNames(false)
         , serverVersion(0)
+        , serverThreadId(0)
 {
 }
 
@@ -96,6 +97,7 @@ bool MysqlConnectionInternal::db_connect(const KDbConnectionData& data)
                            client_flag))
     {
         serverVersion = mysql_get_server_version(mysql);
+        serverThreadId = mysql_thread_id(mysql);
         return true;
     }
     return false;
@@ -106,6 +108,7 @@ bool MysqlConnectionInternal::db_disconnect()
     mysql_close(mysql);
     mysql = nullptr;
     serverVersion = 0;
+    serverThreadId = 0;
     mysqlDebug();
     return true;
 }
@@ -149,6 +152,7 @@ MysqlCursorData::MysqlCursorData(KDbConnection* connection)
         , mysqlrow(nullptr)
         , lengths(nullptr)
         , numRows(0)
+        , streaming(false)
 {
     mysql_owned = false;
     mysql = static_cast<MysqlConnection*>(connection)->d->mysql;
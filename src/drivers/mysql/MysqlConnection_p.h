@@ -79,6 +79,9 @@ public:
     //! See https://dev.mysql.com/doc/refman/5.7/en/mysql-get-server-version.html
     //! @todo store in Connection base class as a property or as public server info
     unsigned long serverVersion;
+    //! Id of the server thread handling this connection, known after successful connection.
+    //! Kept so statements can be killed without touching the busy connection's handle.
+    unsigned long serverThreadId;
 private:
     Q_DISABLE_COPY(MysqlConnectionInternal)
 };
@@ -95,6 +98,7 @@ public:
     MYSQL_ROW mysqlrow;
     unsigned long *lengths;
     qint64 numRows;
+    bool streaming; //!< true if records are fetched one by one using mysql_use_result()
 private:
     Q_DISABLE_COPY(MysqlCursorData)
 };
@@ -51,7 +51,19 @@ MysqlCursor::~MysqlCursor()
 bool MysqlCursor::drv_open(const KDbEscapedString& sql)
 {
     if (mysql_real_query(d->mysql, sql.constData(), sql.length()) == 0) {
-        if (mysql_errno(d->mysql) == 0) {
+        if (mysql_errno(d->mysql) == 0 && usesRecordBuffer()) {
+            // KDbCursor buffers the records within its memory budget, so receive them
+            // one by one. Other statements cannot be executed using this connection
+            // until all the records are received or the cursor is closed.
+            d->mysqlres = mysql_use_result(d->mysql);
+            if (d->mysqlres) {
+                d->streaming = true;
+                m_fieldCount = mysql_num_fields(d->mysqlres);
+                m_fieldsToStoreInRecord = m_fieldCount;
+                d->numRows = 0;
+                return true;
+            }
+        } else if (mysql_errno(d->mysql) == 0) {
             //! @todo Add option somewhere so we can use more optimal mysql_num_rows().
             //!       In this case mysql_num_rows() does not work however.
             d->mysqlres = mysql_store_result(d->mysql);
@@ -76,11 +88,25 @@ bool MysqlCursor::drv_close()
     d->mysqlrow = nullptr;
     d->lengths = nullptr;
     d->numRows = 0;
+    d->streaming = false;
     return true;
 }
 
 void MysqlCursor::drv_getNextRecord()
 {
+    if (d->streaming) {
+        d->mysqlrow = mysql_fetch_row(d->mysqlres);
+        if (d->mysqlrow) {
+            d->lengths = mysql_fetch_lengths(d->mysqlres);
+            m_fetchResult = FetchResult::Ok;
+        } else if (mysql_errno(d->mysql) != 0) {
+            storeResult();
+            m_fetchResult = FetchResult::Error;
+        } else {
+            m_fetchResult = FetchResult::End;
+        }
+        return;
+    }
     if (at() >= d->numRows) {
         m_fetchResult = FetchResult::End;
     }
@@ -98,6 +124,9 @@ void MysqlCursor::drv_getNextRecord()
 // This isn't going to work right now as it uses d->mysqlrow
 QVariant MysqlCursor::value(int pos)
 {
+    if (const KDbRecordData *record = bufferedRecord()) {
+        return record->value(pos < m_fieldCount ? pos : -1);
+    }
     if (!d->mysqlrow || pos >= m_fieldCount || d->mysqlrow[pos] == nullptr)
         return QVariant();
 
@@ -117,7 +146,7 @@ QVariant MysqlCursor::value(int pos)
 bool MysqlCursor::drv_storeCurrentRecord(KDbRecordData* data) const
 {
 // mysqlDebug() << "position is " << (long)m_at;
-    if (d->numRows == 0)
+    if (!d->streaming && d->numRows == 0)
         return false;
 
     if (!m_visibleFieldsExpanded) {//simple version: without types
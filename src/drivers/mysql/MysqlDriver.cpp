@@ -42,7 +42,7 @@ MysqlDriver::MysqlDriver(QObject *parent, const QVariantList &args)
     , m_longTextPrimaryKeyType(QLatin1String("VARCHAR(255)")) // fair enough for PK
 {
     KDbDriverBehavior *beh = behavior();
-    beh->features = IgnoreTransactions | CursorForward;
+    beh->features = SingleTransactions | NestedTransactions | CursorForward;
 
     beh->ROW_ID_FIELD_NAME = QLatin1String("LAST_INSERT_ID()");
     beh->ROW_ID_FIELD_RETURNS_LAST_AUTOINCREMENTED_VALUE = true;
@@ -53,9 +53,12 @@ MysqlDriver::MysqlDriver(QObject *parent, const QVariantList &args)
     //! @todo add configuration option
     beh->TEXT_TYPE_MAX_LENGTH = 255;
     beh->RANDOM_FUNCTION = QLatin1String("RAND");
+    beh->SELECT_NO_LIMIT_VALUE = QLatin1String("18446744073709551615"); // as recommended by MySQL docs
     beh->GET_TABLE_NAMES_SQL = KDbEscapedString("SHOW TABLES");
+    beh->DROP_INDEX_REQUIRES_TABLE_NAME = true; // index names are unique per table
+    beh->DDL_COMMITS_TRANSACTION = true; // https://dev.mysql.com/doc/refman/8.0/en/implicit-commit.html
 
-    initDriverSpecificKeywords(keywords);
+    initDriverSpecificKeywords(keywordsHash);
 
     //predefined properties
 #if MYSQL_VERSION_ID < 40000
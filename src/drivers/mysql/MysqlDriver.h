@@ -96,6 +96,7 @@ protected:
 
 private:
     static const char *keywords[];
+    static const KDbUtils::StaticSetOfStrings::HashTable keywordsHash;
     QString m_longTextPrimaryKeyType;
     Q_DISABLE_COPY(MysqlDriver)
 };
@@ -353,3 +353,38 @@ const char* MysqlDriver::keywords[] = {
     "ZEROFILL",
     nullptr
 };
+
+static const quint16 keywordsHashSeeds[] = {
+    0, 4, 1, 1, 0, 7, 1, 26, 10, 10, 5, 5, 11, 30, 15, 144, 0, 3, 6, 16, 19, 189, 27, 2, 1,
+    8, 0, 6, 5, 14, 2, 32, 7, 14, 2, 24, 8, 0, 19, 4, 8, 204, 1, 44, 0, 10, 8, 0, 0, 1, 21,
+    3, 9, 1, 2, 0, 3, 3, 9, 56, 6, 65, 1, 21, 2, 2, 17, 0, 9, 35, 14, 23, 7, 68, 0, 37, 18,
+    20, 0, 0, 0, 0,
+};
+
+static const qint16 keywordsHashSlots[] = {
+    -1, 255, 71, 82, 159, 197, 311, -1, 161, 36, 136, -1, 172, 214, 210, 119, 49, 230, 245,
+    209, -1, 304, 23, 112, 153, 68, 100, 109, 26, 2, 66, 151, -1, -1, 19, 75, -1, 113, 257,
+    13, -1, 44, 104, 306, 193, -1, 33, 52, -1, 238, 170, 200, -1, -1, 246, 87, 192, 85, 11,
+    40, 0, 139, 10, 199, 118, 120, -1, -1, -1, 54, -1, 234, 148, 279, 65, 225, 47, 150, 202,
+    309, -1, 232, -1, 244, 158, 147, 184, 1, -1, -1, 169, 254, -1, 216, 273, 167, -1, -1, 173,
+    -1, 236, 73, 143, 80, 243, 123, 181, 69, -1, 117, 135, 242, 137, 237, 317, 129, 4, -1, 274,
+    61, 134, 81, -1, 201, 156, -1, 313, 247, -1, 105, 261, 154, 176, 41, 22, 187, 276, 140,
+    220, 89, 231, 125, -1, 280, 226, -1, 222, 289, 138, 266, 29, 271, 264, 318, 189, 259, 292,
+    218, 251, 267, -1, 53, -1, 186, 76, 194, 106, 305, 43, 37, -1, -1, 168, -1, 24, 291, 6,
+    -1, 260, 110, -1, 178, 315, -1, 146, 302, 288, 164, 70, 83, 180, 46, -1, 285, 281, -1, -1,
+    62, -1, 282, 157, 74, 211, 204, 107, 28, 207, 268, 196, 108, 233, 15, 96, 314, -1, 32, 293,
+    55, 90, 115, 215, -1, 177, 278, 99, -1, -1, 286, -1, 290, 256, 60, 64, 122, 12, 303, 166,
+    79, -1, -1, 190, 77, 295, -1, 275, 142, 185, 228, 308, 300, 121, 323, 101, 312, 258, 250,
+    93, 130, 175, 229, 320, 67, 183, 132, -1, 145, -1, 219, 263, 103, 155, 235, 124, 221, 94,
+    63, 57, 296, -1, 195, 48, 277, 241, 319, 56, 321, 174, 316, 9, 72, -1, 269, 191, 165, 51,
+    50, -1, 213, 163, 297, 102, 17, -1, 116, -1, 7, 284, 86, 227, 287, 141, 171, -1, -1, 253,
+    128, 88, 149, -1, 198, 212, 249, -1, 162, 45, 283, 20, 31, -1, 208, -1, 144, 38, 252, 239,
+    203, -1, 39, 111, 310, 27, -1, 126, 217, 188, -1, -1, 262, -1, 18, 322, 30, -1, 127, 35,
+    -1, -1, 16, 270, 240, 98, 58, 131, -1, 5, 78, 25, 182, 91, 97, 248, 3, 206, 179, 299, -1,
+    294, 205, -1, 21, -1, 160, -1, -1, 92, 34, 133, 307, 152, 224, -1, 223, 95, 8, -1, -1, 301,
+    265, 59, 114, 272, 298, -1, 14, 84, 42,
+};
+
+const KDbUtils::StaticSetOfStrings::HashTable MysqlDriver::keywordsHash = {
+    MysqlDriver::keywords, keywordsHashSeeds, keywordsHashSlots, 82, 406
+};
@@ -19,6 +19,7 @@
 
 #include "MysqlPreparedStatement.h"
 #include "KDbConnection.h"
+#include "KDbTableSchema.h"
 
 //#include <mysql/errmsg.h>
 // For example prepared MySQL statement code see:
@@ -87,10 +88,39 @@ void MysqlPreparedStatement::done()
 
 bool MysqlPreparedStatement::prepare(const KDbEscapedString& sql)
 {
-    Q_UNUSED(sql);
+    m_tempStatementString = sql;
     return true;
 }
 
+#ifndef KDB_USE_MYSQL_STMT
+//! @return @a sql with "?" placeholders replaced by values of @a parameters for fields
+//! @a fieldList. Placeholders within quoted identifiers and strings are not replaced.
+static KDbEscapedString sqlWithValues(const KDbDriver *driver, const KDbEscapedString &sql,
+                                      const KDbField::List &fieldList,
+                                      const KDbPreparedStatementParameters &parameters)
+{
+    KDbEscapedString result;
+    result.reserve(sql.length() + 64 * fieldList.count());
+    char quote = 0;
+    int par = 0;
+    for (const char c : sql.toByteArray()) {
+        if (quote) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '`' || c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '?' && par < fieldList.count()) {
+            result += driver->valueToSql(fieldList.at(par), parameters.value(par));
+            ++par;
+            continue;
+        }
+        result += c;
+    }
+    return result;
+}
+#endif
+
 #ifdef KDB_USE_MYSQL_STMT
 #define BIND_NULL { \
         m_mysqlBind[arg].buffer_type = MYSQL_TYPE_NULL; \
@@ -237,7 +267,6 @@ QSharedPointer<KDbSqlResult> MysqlPreparedStatement::execute(KDbPreparedStatemen
                                 KDbFieldList *insertFieldList,
                                 const KDbPreparedStatementParameters &parameters)
 {
-    Q_UNUSED(selectFieldList);
     QSharedPointer<KDbSqlResult> result;
 #ifdef KDB_USE_MYSQL_STMT
     if (!m_statement || m_realParamCount <= 0)
@@ -306,8 +335,93 @@ QSharedPointer<KDbSqlResult> MysqlPreparedStatement::execute(KDbPreparedStatemen
             }
         }
         result = connection->insertRecord(insertFieldList, myParameters);
+    } else if (type == KDbPreparedStatement::UpdateStatement
+               || type == KDbPreparedStatement::DeleteStatement)
+    {
+        //! @todo use server-side prepared statement when KDB_USE_MYSQL_STMT is finished
+        result = connection->prepareSql(sqlWithValues(connection->driver(), m_tempStatementString,
+                                                      selectFieldList, parameters));
+        m_result = connection->result();
     }
 //! @todo support select
 #endif // !KDB_USE_MYSQL_STMT
     return result;
 }
+
+#ifndef KDB_USE_MYSQL_STMT
+bool MysqlPreparedStatement::hasTransactionalEngine(const KDbTableSchema *table)
+{
+    QString engine;
+    const tristate res = connection->querySingleString(
+        KDbEscapedString("SELECT ENGINE FROM information_schema.TABLES "
+                         "WHERE TABLE_SCHEMA=DATABASE() AND TABLE_NAME=%1")
+            .arg(connection->escapeString(table->name())), &engine);
+    return res == true
+        && (0 == engine.compare(QLatin1String("InnoDB"), Qt::CaseInsensitive)
+            || 0 == engine.compare(QLatin1String("ndbcluster"), Qt::CaseInsensitive));
+}
+
+bool MysqlPreparedStatement::executeBatch(KDbPreparedStatement::Type type,
+                                          const KDbField::List &fieldList,
+                                          KDbFieldList *insertFieldList,
+                                          const KDbPreparedStatementColumns &columns,
+                                          int recordCount, qint64 *affectedRecords,
+                                          int *failedRecord)
+{
+    //! @todo use array binding of MYSQL_STMT when KDB_USE_MYSQL_STMT is finished
+    const KDbDriver *driver = connection->driver();
+    KDbPreparedStatementParameters parameters;
+    const auto setRecord = [&](int record) {
+        parameters.clear();
+        for (const QList<QVariant> &column : columns) {
+            parameters.append(column.value(record));
+        }
+    };
+    int record = 0;
+    const QByteArray sql(m_tempStatementString.toByteArray());
+    const int valuesPosition = sql.lastIndexOf(" VALUES (");
+    if (type == KDbPreparedStatement::InsertStatement && valuesPosition > 0 && recordCount > 1
+        && insertFieldList && insertFieldList->field(0)
+        && hasTransactionalEngine(insertFieldList->field(0)->table()))
+    {
+        // Insert many records per statement: "INSERT INTO t VALUES (...), (...), ...".
+        // Such statement is atomic for transactional engines, so in case of failure the records
+        // are inserted again one by one below to find the failing one.
+        static const int maxStatementLength = 512 * 1024; // below default max_allowed_packet
+        const KDbEscapedString prefix(sql.left(valuesPosition + int(sizeof(" VALUES")) - 1));
+        const KDbEscapedString tuple(sql.mid(valuesPosition + int(sizeof(" VALUES")) - 1));
+        KDbEscapedString insert;
+        while (record < recordCount) {
+            insert = prefix;
+            int next = record;
+            for (; next < recordCount && (next == record || insert.length() < maxStatementLength);
+                 ++next)
+            {
+                if (next > record) {
+                    insert += ',';
+                }
+                setRecord(next);
+                insert += sqlWithValues(driver, tuple, fieldList, parameters);
+            }
+            if (!connection->executeSql(insert)) {
+                break;
+            }
+            *affectedRecords += mysql_affected_rows(mysql);
+            record = next;
+        }
+    }
+    for (; record < recordCount; ++record) {
+        setRecord(record);
+        if (!connection->executeSql(sqlWithValues(driver, m_tempStatementString, fieldList,
+                                                  parameters)))
+        {
+            m_result = connection->result();
+            *failedRecord = record;
+            return false;
+        }
+        *affectedRecords += mysql_affected_rows(mysql);
+    }
+    m_result = KDbResult();
+    return true;
+}
+#endif // !KDB_USE_MYSQL_STMT
@@ -41,6 +41,17 @@ private:
                                          KDbFieldList *insertFieldList,
                                          const KDbPreparedStatementParameters &parameters) override;
 
+#ifndef KDB_USE_MYSQL_STMT
+    bool executeBatch(KDbPreparedStatement::Type type,
+                      const KDbField::List &fieldList, KDbFieldList *insertFieldList,
+                      const KDbPreparedStatementColumns &columns,
+                      int recordCount, qint64 *affectedRecords, int *failedRecord) override;
+
+    //! @return true if @a table uses a transactional storage engine, so multi-record
+    //! INSERT statements are atomic
+    bool hasTransactionalEngine(const KDbTableSchema *table);
+#endif
+
     bool init();
     void done();
 
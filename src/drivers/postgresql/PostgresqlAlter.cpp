@@ -0,0 +1,115 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+// ** bits of PostgresqlConnection related to table altering **
+
+#include "PostgresqlConnection.h"
+#include "KDb.h"
+#include "KDbDriver.h"
+#include "KDbNativeStatementBuilder.h"
+
+//! @return true if @a propertyName affects the column type
+static bool isTypeProperty(const QString &propertyName)
+{
+    return propertyName == QLatin1String("type") || propertyName == QLatin1String("maxLength")
+        || propertyName == QLatin1String("precision") || propertyName == QLatin1String("unsigned");
+}
+
+tristate PostgresqlConnection::drv_renameFieldStatements(KDbTableSchema *table, KDbField *field,
+        const QString& newName, QList<KDbEscapedString> *statements)
+{
+    statements->append(KDbEscapedString("ALTER TABLE %1 RENAME COLUMN %2 TO %3")
+                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                            KDbEscapedString(escapeIdentifier(field->name())),
+                            KDbEscapedString(escapeIdentifier(newName))));
+    return true;
+}
+
+tristate PostgresqlConnection::drv_insertFieldStatements(KDbTableSchema *table,
+        const KDbField *field, int index, QList<KDbEscapedString> *statements)
+{
+    // PostgreSQL only appends columns
+    if (index != table->fieldCount()) {
+        return cancelled;
+    }
+    KDbEscapedString definition;
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    if (!builder.generateFieldDefinition(&definition, *field)) {
+        return false;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 ADD COLUMN ")
+                       .arg(escapeIdentifier(table->name())) + definition);
+    return true;
+}
+
+tristate PostgresqlConnection::drv_removeFieldStatements(KDbTableSchema *table, KDbField *field,
+        QList<KDbEscapedString> *statements)
+{
+    statements->append(KDbEscapedString("ALTER TABLE %1 DROP COLUMN %2")
+                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                            KDbEscapedString(escapeIdentifier(field->name()))));
+    return true;
+}
+
+tristate PostgresqlConnection::drv_changeFieldPropertyStatements(KDbTableSchema *table,
+        KDbField *field, const QString& propertyName, const QVariant& value,
+        QList<KDbEscapedString> *statements)
+{
+    // serial types and keys are only defined by CREATE TABLE
+    if (field->isPrimaryKey() || field->isAutoIncrement()) {
+        return cancelled;
+    }
+    KDbField altered(*field);
+    if (!KDb::setFieldProperty(&altered, propertyName.toLatin1(), value)) {
+        return cancelled;
+    }
+    const KDbEscapedString column(escapeIdentifier(field->name()));
+    const KDbEscapedString alterColumn(KDbEscapedString("ALTER TABLE %1 ALTER COLUMN %2 ")
+                                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                                            column));
+    if (isTypeProperty(propertyName)) {
+        const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+        KDbEscapedString oldType;
+        KDbEscapedString newType;
+        if (!builder.generateFieldType(&oldType, *field)
+            || !builder.generateFieldType(&newType, altered))
+        {
+            return false;
+        }
+        if (!(oldType == newType)) { // e.g. "unsigned" has no effect
+            // values are converted by the server
+            statements->append(alterColumn + "TYPE " + newType + " USING " + column + "::" + newType);
+        }
+        return true;
+    }
+    if (propertyName == QLatin1String("notNull")) {
+        statements->append(alterColumn + (altered.isNotNull() ? "SET NOT NULL" : "DROP NOT NULL"));
+        return true;
+    }
+    if (propertyName == QLatin1String("defaultValue")) {
+        if (altered.defaultValue().isNull() || !driver()->supportsDefaultValue(altered)) {
+            statements->append(alterColumn + "DROP DEFAULT");
+        } else {
+            statements->append(alterColumn + "SET DEFAULT "
+                               + driver()->valueToSql(&altered, altered.defaultValue()));
+        }
+        return true;
+    }
+    return cancelled;
+}
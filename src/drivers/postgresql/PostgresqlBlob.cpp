@@ -0,0 +1,166 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "PostgresqlBlob.h"
+#include "KDbConnection.h"
+#include "KDbError.h"
+#include "postgresql_debug.h"
+
+//! Maximum size of zeros generated at once when a value is enlarged (in bytes)
+static const int ZEROS_CHUNK_SIZE = 1024 * 1024;
+
+PostgresqlBlob::PostgresqlBlob(PostgresqlConnectionInternal* conn)
+        : KDbBlobInterface()
+        , PostgresqlConnectionInternal(conn->connection)
+        , m_size(0)
+{
+    this->conn = conn->conn;
+    unicode = conn->unicode;
+}
+
+PostgresqlBlob::~PostgresqlBlob()
+{
+}
+
+PGresult* PostgresqlBlob::execute(const KDbEscapedString &sql, const char *data, qint64 size)
+{
+    const int length = int(size);
+    const int format = 1; // binary
+    PGresult *result = PQexecParams(conn, sql.constData(), data ? 1 : 0, nullptr,
+                                    &data, &length, &format, 1 /* binary result */);
+    const ExecStatusType status = PQresultStatus(result);
+    if (status != PGRES_TUPLES_OK && status != PGRES_COMMAND_OK) {
+        m_result.setSql(sql);
+        storeResultAndClear(&m_result, &result, status);
+        return nullptr;
+    }
+    return result;
+}
+
+bool PostgresqlBlob::update(const KDbEscapedString &value, const char *data, qint64 size)
+{
+    PGresult *result = execute(KDbEscapedString("UPDATE %1 SET %2=%3 WHERE %4")
+                                   .arg(m_escapedTableName, m_escapedFieldName, value, m_where),
+                               data, size);
+    if (!result) {
+        return false;
+    }
+    const bool found = QByteArray(PQcmdTuples(result)).toLongLong() > 0;
+    PQclear(result);
+    if (!found) {
+        m_result = KDbResult(ERR_OBJECT_NOT_FOUND,
+                             PostgresqlConnection::tr("Could not find record in table \"%1\".")
+                                .arg(m_tableName));
+    }
+    return found;
+}
+
+bool PostgresqlBlob::open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+                          bool writable)
+{
+    Q_UNUSED(writable)
+    m_tableName = table->name();
+    m_escapedTableName = KDbEscapedString(connection->escapeIdentifier(table->name()));
+    m_escapedFieldName = KDbEscapedString(connection->escapeIdentifier(field->name()));
+    m_where = where;
+    PGresult *result = execute(KDbEscapedString("SELECT octet_length(%1)::text FROM %2 WHERE %3")
+                                   .arg(m_escapedFieldName, m_escapedTableName, m_where));
+    if (!result) {
+        return false;
+    }
+    const bool found = PQntuples(result) > 0;
+    if (found) {
+        // text sent in binary format is the same as in text format
+        m_size = QByteArray(PQgetvalue(result, 0, 0), PQgetlength(result, 0, 0)).toLongLong();
+    } else {
+        m_result = KDbResult(ERR_OBJECT_NOT_FOUND,
+                             PostgresqlConnection::tr("Could not find record in table \"%1\".")
+                                .arg(m_tableName));
+    }
+    PQclear(result);
+    return found;
+}
+
+qint64 PostgresqlBlob::size()
+{
+    return m_size;
+}
+
+qint64 PostgresqlBlob::read(qint64 offset, char *data, qint64 maxSize)
+{
+    const qint64 count = qMin(maxSize, m_size - offset);
+    if (count <= 0) {
+        return 0;
+    }
+    PGresult *result = execute(KDbEscapedString("SELECT substring(%1 FROM %2 FOR %3) FROM %4 WHERE %5")
+                                   .arg(m_escapedFieldName)
+                                   .arg(offset + 1).arg(count)
+                                   .arg(m_escapedTableName, m_where));
+    if (!result) {
+        return -1;
+    }
+    qint64 length = -1;
+    if (PQntuples(result) > 0) {
+        length = qMin(count, qint64(PQgetlength(result, 0, 0)));
+        memcpy(data, PQgetvalue(result, 0, 0), length);
+    } else {
+        m_result = KDbResult(ERR_OBJECT_NOT_FOUND,
+                             PostgresqlConnection::tr("Could not find record in table \"%1\".")
+                                .arg(m_tableName));
+    }
+    PQclear(result);
+    return length;
+}
+
+bool PostgresqlBlob::write(qint64 offset, const char *data, qint64 size)
+{
+    if (size == 0) {
+        return true;
+    }
+    if (!update(KDbEscapedString("overlay(coalesce(%1, ''::bytea) PLACING $1::bytea FROM %2 FOR %3)")
+                    .arg(m_escapedFieldName).arg(offset + 1).arg(size),
+                data, size))
+    {
+        return false;
+    }
+    m_size = qMax(m_size, offset + size);
+    return true;
+}
+
+bool PostgresqlBlob::resize(qint64 size)
+{
+    KDbEscapedString value;
+    if (size <= m_size) {
+        value = KDbEscapedString("substring(%1 FROM 1 FOR %2)").arg(m_escapedFieldName).arg(size);
+    } else {
+        // zeros are generated in chunks because size of a text value is limited to 1GB
+        const qint64 count = size - m_size;
+        value = KDbEscapedString(
+            "coalesce(%1, ''::bytea) || (SELECT string_agg(decode(repeat('00', "
+            "least(%2, %3 - i * %2)::integer), 'hex'), ''::bytea ORDER BY i) "
+            "FROM generate_series(0, %4) AS i)")
+                .arg(m_escapedFieldName).arg(ZEROS_CHUNK_SIZE).arg(count)
+                .arg((count - 1) / ZEROS_CHUNK_SIZE);
+    }
+    if (!update(value)) {
+        return false;
+    }
+    m_size = size;
+    return true;
+}
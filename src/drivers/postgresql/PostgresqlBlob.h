@@ -0,0 +1,66 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_POSTGRESQLBLOB_H
+#define KDB_POSTGRESQLBLOB_H
+
+#include "KDbBlobInterface.h"
+#include "PostgresqlConnection_p.h"
+
+/*! Incremental access to BLOB values for the PostgreSQL driver.
+ Ranges of bytea values are read using substring() and written using overlay(), data is
+ transferred in binary format. Reading a range only fetches needed part of the value from
+ the server if the column uses EXTERNAL storage (uncompressed TOAST). Every write rewrites
+ the value on the server, so large ranges should be written at once. */
+class PostgresqlBlob : public KDbBlobInterface, public PostgresqlConnectionInternal
+{
+public:
+    explicit PostgresqlBlob(PostgresqlConnectionInternal* conn);
+
+    ~PostgresqlBlob() override;
+
+protected:
+    bool open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+              bool writable) override;
+
+    qint64 size() override;
+
+    qint64 read(qint64 offset, char *data, qint64 maxSize) override;
+
+    bool write(qint64 offset, const char *data, qint64 size) override;
+
+    bool resize(qint64 size) override;
+
+private:
+    /*! Executes @a sql with optional binary parameter @a data of @a size bytes.
+     Result is requested in binary format. @return result or @c nullptr on error. */
+    PGresult* execute(const KDbEscapedString &sql, const char *data = nullptr, qint64 size = 0);
+
+    //! Executes UPDATE statement setting the value to @a value
+    bool update(const KDbEscapedString &value, const char *data = nullptr, qint64 size = 0);
+
+    KDbEscapedString m_escapedTableName;
+    KDbEscapedString m_escapedFieldName;
+    KDbEscapedString m_where;
+    QString m_tableName;
+    qint64 m_size;
+    Q_DISABLE_COPY(PostgresqlBlob)
+};
+
+#endif
@@ -20,6 +20,7 @@
 
 #include "PostgresqlConnection.h"
 #include "PostgresqlConnection_p.h"
+#include "PostgresqlBlob.h"
 #include "PostgresqlPreparedStatement.h"
 #include "PostgresqlCursor.h"
 #include "postgresql_debug.h"
@@ -244,6 +245,25 @@ bool PostgresqlConnection::drv_executeSql(const KDbEscapedString& sql)
     return status == PGRES_TUPLES_OK || status == PGRES_COMMAND_OK;
 }
 
+bool PostgresqlConnection::drv_cancelQuery()
+{
+    if (!d->conn) {
+        return false;
+    }
+    // PQcancel() is thread-safe unlike most of libpq calls
+    PGcancel *cancel = PQgetCancel(d->conn);
+    if (!cancel) {
+        return false;
+    }
+    char errorBuffer[256];
+    const bool ok = PQcancel(cancel, errorBuffer, sizeof(errorBuffer));
+    if (!ok) {
+        postgresqlWarning() << "Could not cancel query:" << errorBuffer;
+    }
+    PQfreeCancel(cancel);
+    return ok;
+}
+
 bool PostgresqlConnection::drv_isDatabaseUsed() const
 {
     return d->conn;
@@ -268,6 +288,11 @@ KDbPreparedStatementInterface* PostgresqlConnection::prepareStatementInternal()
     return new PostgresqlPreparedStatement(d);
 }
 
+KDbBlobInterface* PostgresqlConnection::createBlobInterface()
+{
+    return new PostgresqlBlob(d);
+}
+
 KDbEscapedString PostgresqlConnection::escapeString(const QByteArray& str) const
 {
     int error;
@@ -22,6 +22,9 @@
 #define KDB_POSTGRESQLCONNECTION_H
 
 #include "KDbConnection.h"
+#include "KDbAlterTableInterface.h"
+#include "KDbBlobInterface.h"
+#include "KDbCancelQueryInterface.h"
 #include "KDbTransactionData.h"
 
 #include <libpq-fe.h>
@@ -38,7 +41,8 @@ private:
     Q_DISABLE_COPY(PostgresqlTransactionData)
 };
 
-class PostgresqlConnection : public KDbConnection
+class PostgresqlConnection : public KDbConnection, public KDbAlterTableInterface,
+        public KDbBlobInterfaceFactory, public KDbCancelQueryInterface
 {
     Q_DECLARE_TR_FUNCTIONS(PostgresqlConnection)
 public:
@@ -56,6 +60,8 @@ public:
 
     Q_REQUIRED_RESULT KDbPreparedStatementInterface *prepareStatementInternal() override;
 
+    Q_REQUIRED_RESULT KDbBlobInterface *createBlobInterface() override;
+
     /*! Connection-specific string escaping.  */
     KDbEscapedString escapeString(const QString& str) const override;
     virtual KDbEscapedString escapeString(const QByteArray& str) const;
@@ -88,6 +94,8 @@ private:
     Q_REQUIRED_RESULT KDbSqlResult *drv_prepareSql(const KDbEscapedString &sql) override;
     bool drv_executeSql(const KDbEscapedString& sql) override;
 
+    bool drv_cancelQuery() override;
+
     //! Implemented for KDbResultable
     QString serverResultName() const override;
 
@@ -96,6 +104,21 @@ private:
 
     void storeResult(PGresult *pgResult, ExecStatusType execStatus);
 
+    tristate drv_renameFieldStatements(KDbTableSchema* table, KDbField* field,
+            const QString& newName, QList<KDbEscapedString> *statements) override;
+
+    //! Uses ALTER TABLE ... ADD COLUMN for fields appended to the table
+    tristate drv_insertFieldStatements(KDbTableSchema* table, const KDbField* field,
+            int index, QList<KDbEscapedString> *statements) override;
+
+    tristate drv_removeFieldStatements(KDbTableSchema* table, KDbField* field,
+            QList<KDbEscapedString> *statements) override;
+
+    //! Supports changes of type (ALTER COLUMN ... TYPE ... USING), "notNull" and "defaultValue"
+    tristate drv_changeFieldPropertyStatements(KDbTableSchema* table, KDbField* field,
+            const QString& propertyName, const QVariant& value,
+            QList<KDbEscapedString> *statements) override;
+
     PostgresqlConnectionInternal * const d;
 
     friend class PostgresqlDriver;
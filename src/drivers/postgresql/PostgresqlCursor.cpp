@@ -33,6 +33,8 @@ PostgresqlCursor::PostgresqlCursor(KDbConnection* conn, const KDbEscapedString&
                                    KDbCursor::Options options)
         : KDbCursor(conn, sql, options | KDbCursor::Option::Buffered)
         , m_numRows(0)
+        , m_streaming(false)
+        , m_streamedRecordTaken(false)
         , d(new PostgresqlCursorData(conn))
 {
 }
@@ -43,6 +45,8 @@ PostgresqlCursor::PostgresqlCursor(KDbConnection* conn, KDbQuerySchema* query,
                                    KDbCursor::Options options)
         : KDbCursor(conn, query, options | KDbCursor::Option::Buffered)
         , m_numRows(0)
+        , m_streaming(false)
+        , m_streamedRecordTaken(false)
         , d(new PostgresqlCursorData(conn))
 {
 }
@@ -59,17 +63,41 @@ PostgresqlCursor::~PostgresqlCursor()
 //Create a cursor result set
 bool PostgresqlCursor::drv_open(const KDbEscapedString& sql)
 {
-    d->res = d->executeSql(sql);
-    d->resultStatus = PQresultStatus(d->res);
-    if (d->resultStatus != PGRES_TUPLES_OK && d->resultStatus != PGRES_COMMAND_OK) {
-        storeResultAndClear(&d->res, d->resultStatus);
-        return false;
+    m_streaming = usesRecordBuffer();
+    m_streamedRecordTaken = false;
+    if (m_streaming) {
+        // KDbCursor buffers the records within its memory budget, so receive them one by one
+        if (!PQsendQuery(d->conn, sql.toByteArray().constData())) {
+            d->storeResult(&m_result);
+            m_streaming = false;
+            return false;
+        }
+        if (!PQsetSingleRowMode(d->conn)) {
+            postgresqlWarning() << "Could not set single-row mode";
+        }
+        d->res = PQgetResult(d->conn);
+        d->resultStatus = PQresultStatus(d->res);
+        if (d->resultStatus != PGRES_SINGLE_TUPLE && d->resultStatus != PGRES_TUPLES_OK
+            && d->resultStatus != PGRES_COMMAND_OK)
+        {
+            storeResultAndClear(&d->res, d->resultStatus);
+            finishStreaming();
+            return false;
+        }
+        m_numRows = 0;
+    } else {
+        d->res = d->executeSql(sql);
+        d->resultStatus = PQresultStatus(d->res);
+        if (d->resultStatus != PGRES_TUPLES_OK && d->resultStatus != PGRES_COMMAND_OK) {
+            storeResultAndClear(&d->res, d->resultStatus);
+            return false;
+        }
+        m_numRows = PQntuples(d->res);
+        m_records_in_buf = m_numRows;
+        m_buffering_completed = true;
     }
     m_fieldsToStoreInRecord = PQnfields(d->res);
     m_fieldCount = m_fieldsToStoreInRecord - (containsRecordIdInfo() ? 1 : 0);
-    m_numRows = PQntuples(d->res);
-    m_records_in_buf = m_numRows;
-    m_buffering_completed = true;
 
     // get real types for all fields
     PostgresqlDriver* drv = static_cast<PostgresqlDriver*>(connection()->driver());
@@ -88,14 +116,51 @@ bool PostgresqlCursor::drv_open(const KDbEscapedString& sql)
 //Delete objects
 bool PostgresqlCursor::drv_close()
 {
+    if (m_streaming) { // do not receive records that are not needed
+        if (PGcancel *cancel = PQgetCancel(d->conn)) {
+            char errorBuffer[256];
+            PQcancel(cancel, errorBuffer, sizeof(errorBuffer));
+            PQfreeCancel(cancel);
+        }
+        finishStreaming();
+    }
     PQclear(d->res);
+    d->res = nullptr;
     return true;
 }
 
+void PostgresqlCursor::finishStreaming()
+{
+    while (PGresult *result = PQgetResult(d->conn)) {
+        PQclear(result);
+    }
+    m_streaming = false;
+    m_numRows = 0;
+}
+
 //==================================================================================
 //Gets the next record...does not need to do much, just return fetchend if at end of result set
 void PostgresqlCursor::drv_getNextRecord()
 {
+    if (m_streaming) {
+        if (m_streamedRecordTaken) { // the first result is received in drv_open()
+            PQclear(d->res);
+            d->res = PQgetResult(d->conn);
+            d->resultStatus = PQresultStatus(d->res);
+        }
+        m_streamedRecordTaken = true;
+        if (d->resultStatus == PGRES_SINGLE_TUPLE) {
+            m_fetchResult = FetchResult::Ok;
+        } else if (d->resultStatus == PGRES_TUPLES_OK || d->resultStatus == PGRES_COMMAND_OK) {
+            m_fetchResult = FetchResult::End;
+            finishStreaming();
+        } else {
+            storeResultAndClear(&d->res, d->resultStatus);
+            m_fetchResult = FetchResult::Error;
+            finishStreaming();
+        }
+        return;
+    }
     if (at() >= qint64(m_numRows)) {
         m_fetchResult = FetchResult::End;
     }
@@ -128,6 +193,9 @@ void PostgresqlCursor::drv_getPrevRecord()
 //Return the value for a given column for the current record
 QVariant PostgresqlCursor::value(int pos)
 {
+    if (const KDbRecordData *record = bufferedRecord()) {
+        return record->value(pos < m_fieldCount ? pos : -1);
+    }
     if (pos < m_fieldCount)
         return pValue(pos);
     else
@@ -166,9 +234,9 @@ inline QVariant pgsqlCStrToVariant(const pqxx::result::field& r)
 }
 #endif
 
-static inline bool hasTimeZone(const QString& s)
+static inline bool hasTimeZone(const char *data, int len)
 {
-    return s.at(s.length() - 3) == QLatin1Char('+') || s.at(s.length() - 3) == QLatin1Char('-');
+    return len >= 3 && (data[len - 3] == '+' || data[len - 3] == '-');
 }
 
 static inline QVariant convertToKDbType(bool convert, const QVariant &value, KDbField::Type kdbType)
@@ -179,14 +247,10 @@ static inline QVariant convertToKDbType(bool convert, const QVariant &value, KDb
 
 static inline QTime timeFromData(const char *data, int len)
 {
-    if (len == 0) {
-        return QTime();
-    }
-    QString s(QString::fromLatin1(data, len));
-    if (hasTimeZone(s)) {
-        s.chop(3); // skip timezone
+    if (hasTimeZone(data, len)) {
+        len -= 3; // skip timezone
     }
-    return KDbUtils::timeFromISODateStringWithMs(s);
+    return KDbUtils::timeFromISODateStringWithMs(data, len);
 }
 
 static inline QDateTime dateTimeFromData(const char *data, int len)
@@ -194,17 +258,10 @@ static inline QDateTime dateTimeFromData(const char *data, int len)
     if (len < 10 /*ISO Date*/) {
         return QDateTime();
     }
-    QString s(QString::fromLatin1(data, len));
-    if (hasTimeZone(s)) {
-        s.chop(3); // skip timezone
-        if (s.isEmpty()) {
-            return QDateTime();
-        }
-    }
-    if (s.at(s.length() - 3).isPunct()) { // fix ms, should be three digits
-        s += QLatin1Char('0');
+    if (len > 10 && hasTimeZone(data, len)) {
+        len -= 3; // skip timezone
     }
-    return KDbUtils::dateTimeFromISODateStringWithMs(s);
+    return KDbUtils::dateTimeFromISODateStringWithMs(data, len);
 }
 
 static inline QByteArray byteArrayFromData(const char *data)
@@ -222,7 +279,7 @@ static inline QByteArray byteArrayFromData(const char *data)
 QVariant PostgresqlCursor::pValue(int pos) const
 {
 //  postgresqlWarning() << "PostgresqlCursor::value - ERROR: requested position is greater than the number of fields";
-    const qint64 row = at();
+    const qint64 row = m_streaming ? 0 : at(); // single-row results contain the current record only
 
     KDbField *f = (m_visibleFieldsExpanded && pos < qMin(m_visibleFieldsExpanded->count(), m_fieldCount))
                        ? m_visibleFieldsExpanded->at(pos)->field() : nullptr;
@@ -268,7 +325,7 @@ QVariant PostgresqlCursor::pValue(int pos) const
     case KDbField::Date:
         return convertToKDbType(kdbType != KDbField::Date,
                                 (len == 0) ? QVariant(QDate())
-                                           : QVariant(QDate::fromString(QLatin1String(QByteArray::fromRawData(data, len)), Qt::ISODate)),
+                                           : QVariant(KDbUtils::dateFromISODateString(data, len)),
                                 kdbType);
     case KDbField::Time:
         return convertToKDbType(kdbType != KDbField::Time,
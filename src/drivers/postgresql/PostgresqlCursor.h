@@ -54,7 +54,12 @@ public:
 private:
     QVariant pValue(int pos)const;
 
+    //! Reads remaining results of the query sent in single-row mode
+    void finishStreaming();
+
     unsigned long m_numRows;
+    bool m_streaming; //!< true if records are fetched one by one, see usesRecordBuffer()
+    bool m_streamedRecordTaken; //!< true if the record of d->res has been returned
     QVector<KDbField::Type> m_realTypes;
     QVector<int> m_realLengths;
 
@@ -38,7 +38,7 @@ PostgresqlDriver::PostgresqlDriver(QObject *parent, const QVariantList &args)
         : KDbDriver(parent, args)
 {
     KDbDriverBehavior *beh = behavior();
-    beh->features = SingleTransactions | CursorForward | CursorBackward;
+    beh->features = SingleTransactions | NestedTransactions | CursorForward | CursorBackward;
 //! @todo enable this when KDb supports multiple: beh->features = MultipleTransactions | CursorForward | CursorBackward;
 
     beh->UNSIGNED_TYPE_KEYWORD = QString();
@@ -57,11 +57,12 @@ PostgresqlDriver::PostgresqlDriver(QObject *parent, const QVariantList &args)
     beh->BOOLEAN_TRUE_LITERAL = QLatin1String("TRUE");
     beh->BOOLEAN_FALSE_LITERAL = QLatin1String("FALSE");
     beh->USE_TEMPORARY_DATABASE_FOR_CONNECTION_IF_NEEDED = true;
+    beh->FAILED_STATEMENT_ABORTS_TRANSACTION = true;
     beh->GET_TABLE_NAMES_SQL = KDbEscapedString(
         "SELECT table_name FROM information_schema.tables WHERE "
         "table_type='BASE TABLE' AND table_schema NOT IN ('pg_catalog', 'information_schema')");
 
-    initDriverSpecificKeywords(m_keywords);
+    initDriverSpecificKeywords(m_keywordsHash);
     initPgsqlToKDbMap();
 
     //predefined properties
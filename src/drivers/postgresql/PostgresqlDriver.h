@@ -145,6 +145,7 @@ private:
     void initPgsqlToKDbMap();
 
     static const char *m_keywords[];
+    static const KDbUtils::StaticSetOfStrings::HashTable m_keywordsHash;
     QMap<int, KDbField::Type> m_pgsqlToKDbTypes;
     Q_DISABLE_COPY(PostgresqlDriver)
 };
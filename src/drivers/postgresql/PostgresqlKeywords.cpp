@@ -259,3 +259,31 @@ const char* PostgresqlDriver::m_keywords[] = {
     "ZONE",
     nullptr
 };
+
+static const quint16 keywordsHashSeeds[] = {
+    14, 28, 3, 6, 13, 2, 14, 18, 5, 11, 20, 131, 3, 9, 81, 13, 1, 24, 0, 1, 34, 18, 0, 0, 0,
+    0, 0, 6, 1, 0, 0, 1, 2, 0, 5, 23, 35, 0, 6, 16, 10, 3, 3, 5, 8, 13, 22, 11, 23, 4, 28, 35,
+    7, 50, 2, 73, 2, 101,
+};
+
+static const qint16 keywordsHashSlots[] = {
+    125, 62, 6, 166, 141, 22, 46, 84, 9, 138, -1, 189, 210, -1, -1, 163, -1, 226, 50, 59, 169,
+    -1, 25, 57, 11, -1, 40, -1, 70, 39, 49, -1, 75, 24, 21, 116, 184, 135, 156, 154, -1, 10,
+    150, -1, -1, -1, 179, 222, 216, 96, -1, 159, -1, 114, -1, 5, 197, 66, 31, 89, 35, -1, 106,
+    115, 199, 51, 74, 55, 203, -1, -1, 102, 129, 152, 157, 209, 229, -1, -1, 109, 54, 147, 68,
+    13, 112, 127, 48, 38, 122, 180, 107, 146, 144, 162, -1, 227, 86, 172, 183, 73, 151, 121,
+    205, 177, 201, 14, -1, 207, 221, 18, -1, 77, 0, 118, 110, 128, -1, -1, 220, 131, 105, 176,
+    101, -1, 164, -1, -1, 214, 153, 17, 178, -1, 76, 149, -1, -1, 97, 69, -1, -1, 171, 94, 2,
+    32, 133, 194, -1, -1, 223, -1, -1, 63, 28, 167, 85, 170, 82, 188, 95, 72, -1, 99, -1, 168,
+    60, 100, -1, -1, 130, 192, 52, 191, 140, 213, -1, 98, 53, 65, 217, 200, 27, 7, 196, 67,
+    161, 132, -1, 137, 174, 158, 224, 113, 219, 193, 47, 218, 124, -1, -1, -1, 117, 45, -1,
+    87, -1, -1, 204, 15, 44, 61, 208, 34, 185, 78, 37, 136, 143, -1, 123, 111, 104, -1, 33,
+    139, 175, 228, 36, 126, 64, 79, 206, 41, 108, 4, 83, 71, 80, 119, 212, -1, 225, 93, -1,
+    181, 211, 16, 58, -1, 160, 142, 165, 186, 42, 20, 29, 91, 134, 215, 190, -1, 155, 90, 3,
+    -1, 202, -1, 30, 81, 8, 43, 187, 173, 145, 198, 103, 23, 195, 26, 88, 56, 19, 12, 120, 148,
+    92, 182, -1, 1,
+};
+
+const KDbUtils::StaticSetOfStrings::HashTable PostgresqlDriver::m_keywordsHash = {
+    PostgresqlDriver::m_keywords, keywordsHashSeeds, keywordsHashSlots, 58, 288
+};
@@ -20,29 +20,172 @@
 
 #include "PostgresqlPreparedStatement.h"
 #include "KDbConnection.h"
+#include "postgresql_debug.h"
+
+#include <QVector>
 
 PostgresqlPreparedStatement::PostgresqlPreparedStatement(PostgresqlConnectionInternal* conn)
         : KDbPreparedStatementInterface()
         , PostgresqlConnectionInternal(conn->connection)
+        , m_connectionInternal(conn)
 {
 }
 
 
 PostgresqlPreparedStatement::~PostgresqlPreparedStatement()
 {
+    deallocate();
+}
+
+void PostgresqlPreparedStatement::deallocate()
+{
+    if (!m_name.isEmpty() && m_connectionInternal->conn && m_connectionInternal->connectionOK()) {
+        const QByteArray sql("DEALLOCATE " + m_name);
+        PQclear(PQexec(m_connectionInternal->conn, sql.constData()));
+    }
+    m_name.clear();
 }
 
 bool PostgresqlPreparedStatement::prepare(const KDbEscapedString& sql)
 {
-    Q_UNUSED(sql);
+    // Statements are prepared on the server on first execution because only UPDATE and DELETE
+    // statements and batches use server-side preparation.
+    m_sql = sql;
+    deallocate();
     return true;
 }
 
+//! @return @a sql with "?" placeholders replaced by PostgreSQL's "$1", "$2", ...
+//! Placeholders within quoted identifiers and strings are not replaced.
+static QByteArray numberedPlaceholders(const QByteArray &sql, int *count)
+{
+    QByteArray result;
+    result.reserve(sql.length() + 32);
+    char quote = 0;
+    *count = 0;
+    for (const char c : sql) {
+        if (quote) {
+            if (c == quote) {
+                quote = 0;
+            }
+        } else if (c == '"' || c == '\'') {
+            quote = c;
+        } else if (c == '?') {
+            result += '$' + QByteArray::number(++(*count));
+            continue;
+        }
+        result += c;
+    }
+    return result;
+}
+
+bool PostgresqlPreparedStatement::prepareOnServer(int parameterCount)
+{
+    if (!m_name.isEmpty()) {
+        return true;
+    }
+    PGconn *conn = m_connectionInternal->conn;
+    if (!conn) {
+        return false;
+    }
+    int count;
+    const QByteArray sql(numberedPlaceholders(m_sql.toByteArray(), &count));
+    if (count != parameterCount) {
+        postgresqlWarning() << "Expected" << parameterCount << "parameters, found" << count
+                            << "in" << m_sql;
+    }
+    const QByteArray name("kdb_stmt_" + QByteArray::number(quintptr(this), 16));
+    PGresult *result = PQprepare(conn, name.constData(), sql.constData(), count, nullptr);
+    ExecStatusType status = PQresultStatus(result);
+    if (status != PGRES_COMMAND_OK) {
+        storeResultAndClear(&m_result, &result, status);
+        return false;
+    }
+    PQclear(result);
+    m_name = name;
+    return true;
+}
+
+namespace {
+//! Parameter values converted for PQexecPrepared() and PQsendQueryPrepared().
+//! Values are passed in text format except for BLOBs that use binary format.
+class Parameters
+{
+public:
+    explicit Parameters(int count)
+        : buffers(count), values(count), lengths(count), formats(count)
+    {
+    }
+
+    void set(int i, const KDbField *field, const QVariant &value)
+    {
+        formats[i] = 0;
+        lengths[i] = 0;
+        if (value.isNull()) {
+            values[i] = nullptr;
+            return;
+        }
+        switch (field->type()) {
+        case KDbField::Boolean:
+            buffers[i] = value.toBool() ? "TRUE" : "FALSE";
+            break;
+        case KDbField::Date:
+            buffers[i] = value.toDate().toString(Qt::ISODate).toLatin1();
+            break;
+        case KDbField::DateTime:
+            buffers[i] = KDbUtils::toISODateStringWithMs(value.toDateTime()).toLatin1();
+            break;
+        case KDbField::Time:
+            buffers[i] = KDbUtils::toISODateStringWithMs(value.toTime()).toLatin1();
+            break;
+        case KDbField::BLOB:
+            buffers[i] = value.toByteArray(); // shared, not copied
+            formats[i] = 1;
+            break;
+        default:
+            buffers[i] = value.toString().toUtf8();
+        }
+        values[i] = buffers[i].constData();
+        lengths[i] = buffers[i].length();
+    }
+
+    int count() const { return values.count(); }
+
+    QVector<QByteArray> buffers;
+    QVector<const char*> values;
+    QVector<int> lengths;
+    QVector<int> formats;
+};
+}
+
+QSharedPointer<KDbSqlResult> PostgresqlPreparedStatement::executePrepared(
+    const KDbField::List &fieldList, const KDbPreparedStatementParameters &parameters)
+{
+    if (!prepareOnServer(fieldList.count())) {
+        return QSharedPointer<KDbSqlResult>();
+    }
+    const int count = fieldList.count();
+    Parameters pars(count);
+    for (int i = 0; i < count; ++i) {
+        pars.set(i, fieldList.at(i), parameters.value(i));
+    }
+    PGresult *result = PQexecPrepared(m_connectionInternal->conn, m_name.constData(), count,
+                                      pars.values.constData(), pars.lengths.constData(),
+                                      pars.formats.constData(), 0);
+    ExecStatusType status = PQresultStatus(result);
+    if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK) {
+        storeResultAndClear(&m_result, &result, status);
+        return QSharedPointer<KDbSqlResult>();
+    }
+    m_result = KDbResult();
+    return QSharedPointer<KDbSqlResult>(
+        new PostgresqlSqlResult(static_cast<PostgresqlConnection*>(connection), result, status));
+}
+
 QSharedPointer<KDbSqlResult> PostgresqlPreparedStatement::execute(
     KDbPreparedStatement::Type type, const KDbField::List &selectFieldList,
     KDbFieldList *insertFieldList, const KDbPreparedStatementParameters &parameters)
 {
-    Q_UNUSED(selectFieldList);
     QSharedPointer<KDbSqlResult> result;
     if (type == KDbPreparedStatement::InsertStatement) {
         const int missingValues = insertFieldList->fieldCount() - parameters.count();
@@ -54,7 +197,128 @@ QSharedPointer<KDbSqlResult> PostgresqlPreparedStatement::execute(
             }
         }
         result = connection->insertRecord(insertFieldList, myParameters);
+    } else if (type == KDbPreparedStatement::UpdateStatement
+               || type == KDbPreparedStatement::DeleteStatement)
+    {
+        result = executePrepared(selectFieldList, parameters);
     }
 //! @todo support select
     return result;
 }
+
+//! @return number of records affected by command with @a result
+static qint64 affectedRecordCount(PGresult *result)
+{
+    return QByteArray(PQcmdTuples(result)).toLongLong();
+}
+
+bool PostgresqlPreparedStatement::executeBatch(KDbPreparedStatement::Type type,
+                                               const KDbField::List &fieldList,
+                                               KDbFieldList *insertFieldList,
+                                               const KDbPreparedStatementColumns &columns,
+                                               int recordCount, qint64 *affectedRecords,
+                                               int *failedRecord)
+{
+    Q_UNUSED(type);
+    Q_UNUSED(insertFieldList);
+    // INSERT statements are prepared on the server too; last inserted record is not needed here
+    if (!prepareOnServer(fieldList.count())) {
+        *failedRecord = 0;
+        return false;
+    }
+    PGconn *conn = m_connectionInternal->conn;
+    const int count = fieldList.count();
+    Parameters pars(count);
+    const auto setRecord = [&](int record) {
+        for (int i = 0; i < count; ++i) {
+            pars.set(i, fieldList.at(i), i < columns.count() ? columns.at(i).value(record)
+                                                             : QVariant());
+        }
+    };
+#ifdef LIBPQ_HAS_PIPELINING
+    // Records are sent in pipeline mode without waiting for results of previous records.
+    // Results are read after each chunk so the server is never blocked on a full socket.
+    static const int chunkSize = 256;
+    if (PQenterPipelineMode(conn) != 1) {
+        m_result = KDbResult(ERR_OTHER, QString::fromUtf8(PQerrorMessage(conn)));
+        *failedRecord = 0;
+        return false;
+    }
+    bool ok = true;
+    for (int first = 0; ok && first < recordCount; first += chunkSize) {
+        const int last = qMin(first + chunkSize, recordCount);
+        int sent = first;
+        for (; sent < last; ++sent) {
+            setRecord(sent);
+            if (PQsendQueryPrepared(conn, m_name.constData(), count, pars.values.constData(),
+                                    pars.lengths.constData(), pars.formats.constData(), 0) != 1)
+            {
+                break;
+            }
+        }
+        const KDbResult sendResult = sent < last
+            ? KDbResult(ERR_OTHER, QString::fromUtf8(PQerrorMessage(conn))) : KDbResult();
+        if (PQpipelineSync(conn) != 1) {
+            ok = false;
+            *failedRecord = first;
+            m_result = KDbResult(ERR_OTHER, QString::fromUtf8(PQerrorMessage(conn)));
+            break;
+        }
+        // one result per sent record followed by NULL, then the synchronization result
+        for (int record = first; record < sent; ++record) {
+            PGresult *result = PQgetResult(conn);
+            const ExecStatusType status = PQresultStatus(result);
+            if (status == PGRES_COMMAND_OK) {
+                *affectedRecords += affectedRecordCount(result);
+                PQclear(result);
+            } else if (status == PGRES_PIPELINE_ABORTED) {
+                PQclear(result); // a previous record failed
+            } else {
+                if (ok) {
+                    ok = false;
+                    *failedRecord = record;
+                    storeResultAndClear(&m_result, &result, status);
+                } else {
+                    PQclear(result);
+                }
+            }
+            PQclear(PQgetResult(conn)); // NULL that ends results of the record
+        }
+        PGresult *result;
+        while ((result = PQgetResult(conn))) { // PGRES_PIPELINE_SYNC
+            const bool sync = PQresultStatus(result) == PGRES_PIPELINE_SYNC;
+            PQclear(result);
+            if (sync) {
+                break;
+            }
+        }
+        if (ok && sent < last) { // sending failed after all previous records succeeded
+            ok = false;
+            *failedRecord = sent;
+            m_result = sendResult;
+        }
+    }
+    (void)PQexitPipelineMode(conn);
+#else
+    // libpq without pipeline mode: execute records one by one reusing converted buffers
+    bool ok = true;
+    for (int record = 0; record < recordCount; ++record) {
+        setRecord(record);
+        PGresult *result = PQexecPrepared(conn, m_name.constData(), count, pars.values.constData(),
+                                          pars.lengths.constData(), pars.formats.constData(), 0);
+        const ExecStatusType status = PQresultStatus(result);
+        if (status != PGRES_COMMAND_OK) {
+            ok = false;
+            *failedRecord = record;
+            storeResultAndClear(&m_result, &result, status);
+            break;
+        }
+        *affectedRecords += affectedRecordCount(result);
+        PQclear(result);
+    }
+#endif
+    if (ok) {
+        m_result = KDbResult();
+    }
+    return ok;
+}
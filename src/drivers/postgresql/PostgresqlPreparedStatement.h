@@ -39,7 +39,25 @@ public:
             KDbFieldList *insertFieldList,
             const KDbPreparedStatementParameters &parameters) override;
 
+    bool executeBatch(KDbPreparedStatement::Type type,
+                      const KDbField::List &fieldList, KDbFieldList *insertFieldList,
+                      const KDbPreparedStatementColumns &columns,
+                      int recordCount, qint64 *affectedRecords, int *failedRecord) override;
+
 private:
+    //! Removes statement prepared on the server
+    void deallocate();
+
+    //! Prepares m_sql on the server if it is not prepared yet
+    bool prepareOnServer(int parameterCount);
+
+    //! Executes statement prepared on the server using @a parameters for fields @a fieldList
+    QSharedPointer<KDbSqlResult> executePrepared(const KDbField::List &fieldList,
+                                                 const KDbPreparedStatementParameters &parameters);
+
+    PostgresqlConnectionInternal * const m_connectionInternal;
+    KDbEscapedString m_sql;
+    QByteArray m_name; //!< name of the statement prepared on the server, empty if not prepared
     Q_DISABLE_COPY(PostgresqlPreparedStatement)
 };
 
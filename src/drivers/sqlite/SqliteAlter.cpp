@@ -21,10 +21,13 @@
 
 #include "SqliteConnection.h"
 #include "KDb.h"
+#include "KDbNativeStatementBuilder.h"
 
 #include <QHash>
 #include <QGlobalStatic>
 
+#include <sqlite3.h>
+
 enum SqliteTypeAffinity { //as defined here: 2.1 Determination Of Column Affinity (https://sqlite.org/datatype3.html)
     NoAffinity = 0, IntAffinity = 1, TextAffinity = 2, BLOBAffinity = 3
 };
@@ -74,6 +77,48 @@ tristate SqliteConnection::drv_changeFieldProperty(KDbTableSchema *table, KDbFie
     return cancelled;
 }
 
+tristate SqliteConnection::drv_renameFieldStatements(KDbTableSchema *table, KDbField *field,
+        const QString& newName, QList<KDbEscapedString> *statements)
+{
+    if (sqlite3_libversion_number() < 3025000) {
+        return cancelled;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 RENAME COLUMN %2 TO %3")
+                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                            KDbEscapedString(escapeIdentifier(field->name())),
+                            KDbEscapedString(escapeIdentifier(newName))));
+    return true;
+}
+
+tristate SqliteConnection::drv_insertFieldStatements(KDbTableSchema *table, const KDbField *field,
+        int index, QList<KDbEscapedString> *statements)
+{
+    // SQLite only appends columns
+    if (index != table->fieldCount()) {
+        return cancelled;
+    }
+    KDbEscapedString definition;
+    const KDbNativeStatementBuilder builder(this, KDb::DriverEscaping);
+    if (!builder.generateFieldDefinition(&definition, *field)) {
+        return false;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 ADD COLUMN ")
+                       .arg(escapeIdentifier(table->name())) + definition);
+    return true;
+}
+
+tristate SqliteConnection::drv_removeFieldStatements(KDbTableSchema *table, KDbField *field,
+        QList<KDbEscapedString> *statements)
+{
+    if (sqlite3_libversion_number() < 3035000) {
+        return cancelled;
+    }
+    statements->append(KDbEscapedString("ALTER TABLE %1 DROP COLUMN %2")
+                       .arg(KDbEscapedString(escapeIdentifier(table->name())),
+                            KDbEscapedString(escapeIdentifier(field->name()))));
+    return true;
+}
+
 /*!
  From https://sqlite.org/datatype3.html :
  Version 3 enhances provides the ability to store integer and real numbers in a more compact
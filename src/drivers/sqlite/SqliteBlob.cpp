@@ -0,0 +1,157 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#include "SqliteBlob.h"
+#include "KDbError.h"
+#include "KDbRecordData.h"
+#include "sqlite_debug.h"
+
+SqliteBlob::SqliteBlob(SqliteConnectionInternal* conn)
+        : KDbBlobInterface()
+        , SqliteConnectionInternal(conn->connection)
+        , m_blob(nullptr)
+        , m_rowId(0)
+        , m_size(0)
+        , m_writable(false)
+{
+    data_owned = false;
+    data = conn->data; //copy
+}
+
+SqliteBlob::~SqliteBlob()
+{
+    closeHandle();
+}
+
+bool SqliteBlob::open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+                      bool writable)
+{
+    m_tableName = table->name().toUtf8();
+    m_fieldName = field->name().toUtf8();
+    m_escapedTableName = KDbEscapedString(connection->escapeIdentifier(table->name()));
+    m_escapedFieldName = KDbEscapedString(connection->escapeIdentifier(field->name()));
+    m_writable = writable;
+    KDbRecordData record;
+    const tristate res = connection->querySingleRecord(
+        KDbEscapedString("SELECT _ROWID_, length(%1) FROM %2 WHERE %3")
+            .arg(m_escapedFieldName, m_escapedTableName, where), &record);
+    if (res != true) {
+        m_result = connection->result();
+        if (~res) {
+            m_result = KDbResult(ERR_OBJECT_NOT_FOUND,
+                                 SqliteConnection::tr("Could not find record in table \"%1\".")
+                                    .arg(table->name()));
+        }
+        return false;
+    }
+    m_rowId = record.at(0).toLongLong();
+    m_size = 0;
+    return record.at(1).isNull() || openHandle(); // NULL cannot be opened, it is empty
+}
+
+bool SqliteBlob::openHandle()
+{
+    const int res = sqlite3_blob_open(data, "main", m_tableName.constData(),
+                                      m_fieldName.constData(), m_rowId, m_writable ? 1 : 0,
+                                      &m_blob);
+    if (res != SQLITE_OK) {
+        m_result.setServerErrorCode(res);
+        storeResult(&m_result);
+        closeHandle();
+        return false;
+    }
+    m_size = sqlite3_blob_bytes(m_blob);
+    return true;
+}
+
+void SqliteBlob::closeHandle()
+{
+    if (m_blob) {
+        sqlite3_blob_close(m_blob);
+        m_blob = nullptr;
+    }
+}
+
+qint64 SqliteBlob::size()
+{
+    return m_size;
+}
+
+qint64 SqliteBlob::read(qint64 offset, char *data, qint64 maxSize)
+{
+    if (!m_blob) {
+        return 0;
+    }
+    const int count = int(qMin(maxSize, m_size - offset));
+    int res = sqlite3_blob_read(m_blob, data, count, int(offset));
+    if (res == SQLITE_ABORT && openHandle()) { // the record has been modified, try again
+        res = sqlite3_blob_read(m_blob, data, count, int(offset));
+    }
+    if (res != SQLITE_OK) {
+        m_result.setServerErrorCode(res);
+        storeResult(&m_result);
+        return -1;
+    }
+    return count;
+}
+
+bool SqliteBlob::write(qint64 offset, const char *data, qint64 size)
+{
+    if (size == 0) {
+        return true;
+    }
+    if ((offset + size) > m_size && !resize(offset + size)) {
+        return false;
+    }
+    int res = sqlite3_blob_write(m_blob, data, int(size), int(offset));
+    if (res == SQLITE_ABORT && openHandle()) { // the record has been modified, try again
+        res = sqlite3_blob_write(m_blob, data, int(size), int(offset));
+    }
+    if (res != SQLITE_OK) {
+        m_result.setServerErrorCode(res);
+        storeResult(&m_result);
+        return false;
+    }
+    return true;
+}
+
+bool SqliteBlob::resize(qint64 size)
+{
+    // Size of a value cannot be changed using sqlite3_blob_write(), so the value is rewritten.
+    KDbEscapedString value;
+    if (m_size == 0 || size == 0) {
+        value = KDbEscapedString("zeroblob(%1)").arg(size);
+    } else if (size < m_size) {
+        value = KDbEscapedString("substr(%1, 1, %2)").arg(m_escapedFieldName).arg(size);
+    } else {
+        // Concatenation gives text but bytes are kept intact for UTF-8 databases
+        value = KDbEscapedString("CAST(%1 || zeroblob(%2) AS BLOB)")
+                    .arg(m_escapedFieldName).arg(size - m_size);
+    }
+    closeHandle();
+    if (!connection->executeSql(KDbEscapedString("UPDATE %1 SET %2=%3 WHERE _ROWID_=%4")
+                                    .arg(m_escapedTableName, m_escapedFieldName, value)
+                                    .arg(m_rowId)))
+    {
+        m_result = connection->result();
+        openHandle();
+        return false;
+    }
+    return openHandle();
+}
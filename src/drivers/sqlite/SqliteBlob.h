@@ -0,0 +1,63 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_SQLITEBLOB_H
+#define KDB_SQLITEBLOB_H
+
+#include "KDbBlobInterface.h"
+#include "SqliteConnection_p.h"
+
+/*! Incremental access to BLOB values for the SQLite driver using sqlite3_blob_open(). */
+class SqliteBlob : public KDbBlobInterface, public SqliteConnectionInternal
+{
+public:
+    explicit SqliteBlob(SqliteConnectionInternal* conn);
+
+    ~SqliteBlob() override;
+
+protected:
+    bool open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+              bool writable) override;
+
+    qint64 size() override;
+
+    qint64 read(qint64 offset, char *data, qint64 maxSize) override;
+
+    bool write(qint64 offset, const char *data, qint64 size) override;
+
+    bool resize(qint64 size) override;
+
+private:
+    //! Opens m_blob for the current value, NULL values are not opened
+    bool openHandle();
+
+    void closeHandle();
+
+    sqlite3_blob *m_blob;
+    QByteArray m_tableName;
+    QByteArray m_fieldName;
+    KDbEscapedString m_escapedTableName;
+    KDbEscapedString m_escapedFieldName;
+    sqlite3_int64 m_rowId;
+    qint64 m_size;
+    bool m_writable;
+    Q_DISABLE_COPY(SqliteBlob)
+};
+
+#endif
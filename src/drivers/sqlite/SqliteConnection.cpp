@@ -19,6 +19,7 @@
 
 #include "SqliteConnection.h"
 #include "SqliteConnection_p.h"
+#include "SqliteBlob.h"
 #include "SqliteCursor.h"
 #include "SqlitePreparedStatement.h"
 #include "SqliteFunctions.h"
@@ -348,6 +349,15 @@ bool SqliteConnection::drv_executeSql(const KDbEscapedString& sql)
     return res == SQLITE_OK;
 }
 
+bool SqliteConnection::drv_cancelQuery()
+{
+    if (!d->data) {
+        return false;
+    }
+    sqlite3_interrupt(d->data); // thread-safe, running statement fails with SQLITE_INTERRUPT
+    return true;
+}
+
 QString SqliteConnection::serverResultName() const
 {
     return SqliteConnectionInternal::serverResultName(m_result.serverErrorCode());
@@ -358,6 +368,11 @@ KDbPreparedStatementInterface* SqliteConnection::prepareStatementInternal()
     return new SqlitePreparedStatement(d);
 }
 
+KDbBlobInterface* SqliteConnection::createBlobInterface()
+{
+    return new SqliteBlob(d);
+}
+
 bool SqliteConnection::findAndLoadExtension(const QString & name)
 {
     QStringList pluginPaths;
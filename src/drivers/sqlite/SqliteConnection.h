@@ -23,6 +23,9 @@
 #include <QStringList>
 
 #include "KDbConnection.h"
+#include "KDbAlterTableInterface.h"
+#include "KDbBlobInterface.h"
+#include "KDbCancelQueryInterface.h"
 
 class SqliteConnectionInternal;
 class KDbDriver;
@@ -33,7 +36,8 @@ class KDbDriver;
                                 extensions. Set them before KDbConnection::useDatabase()
                                 is called. Absolute paths are recommended.
 */
-class SqliteConnection : public KDbConnection
+class SqliteConnection : public KDbConnection, public KDbAlterTableInterface,
+        public KDbBlobInterfaceFactory, public KDbCancelQueryInterface
 {
     Q_DECLARE_TR_FUNCTIONS(SqliteConnection)
 public:
@@ -48,6 +52,8 @@ public:
 
     Q_REQUIRED_RESULT KDbPreparedStatementInterface *prepareStatementInternal() override;
 
+    Q_REQUIRED_RESULT KDbBlobInterface *createBlobInterface() override;
+
 protected:
     /*! Used by driver */
     SqliteConnection(KDbDriver *driver, const KDbConnectionData& connData,
@@ -89,6 +95,8 @@ protected:
 
     bool drv_executeSql(const KDbEscapedString& sql) override;
 
+    bool drv_cancelQuery() override;
+
     //! Implemented for KDbResultable
     QString serverResultName() const override;
 
@@ -100,6 +108,18 @@ protected:
     //! for drv_changeFieldProperty()
     tristate changeFieldType(KDbTableSchema *table, KDbField *field, KDbField::Type type);
 
+    //! Uses ALTER TABLE ... RENAME COLUMN available since SQLite 3.25.0
+    tristate drv_renameFieldStatements(KDbTableSchema* table, KDbField* field,
+            const QString& newName, QList<KDbEscapedString> *statements) override;
+
+    //! Uses ALTER TABLE ... ADD COLUMN for fields appended to the table
+    tristate drv_insertFieldStatements(KDbTableSchema* table, const KDbField* field,
+            int index, QList<KDbEscapedString> *statements) override;
+
+    //! Uses ALTER TABLE ... DROP COLUMN available since SQLite 3.35.0
+    tristate drv_removeFieldStatements(KDbTableSchema* table, KDbField* field,
+            QList<KDbEscapedString> *statements) override;
+
     SqliteConnectionInternal* d;
 
 private:
@@ -30,7 +30,11 @@
 
 #include <QVector>
 #include <QDateTime>
+#include <QAtomicInteger>
 #include <QByteArray>
+#include <QMutex>
+#include <QThread>
+#include <QWaitCondition>
 
 //! safer interpretations of boolean values for SQLite
 static bool sqliteStringToBool(const QString& s)
@@ -39,6 +43,203 @@ static bool sqliteStringToBool(const QString& s)
         || (0 != s.compare(QLatin1String("no"), Qt::CaseInsensitive) && s != QLatin1String("0"));
 }
 
+//! Type information of a result column used for decoding its values
+class SqliteColumn
+{
+public:
+    SqliteColumn() : hasField(false), type(KDbField::InvalidType), isUnsigned(false) {}
+    explicit SqliteColumn(KDbField *f)
+        : hasField(f)
+        , type(f ? f->type() : KDbField::InvalidType) // cache: evaluating type of expressions can be expensive
+        , isUnsigned(f && f->isUnsigned())
+    {
+    }
+    bool hasField; //!< false if values are decoded as strings
+    KDbField::Type type;
+    bool isUnsigned;
+};
+
+//! @return value of column @a i of the current record of statement @a st
+static QVariant sqliteValue(sqlite3_stmt *st, int i, const SqliteColumn &column)
+{
+    int type = sqlite3_column_type(st, i);
+    if (type == SQLITE_NULL) {
+        return QVariant();
+    } else if (!column.hasField || type == SQLITE_TEXT) {
+//! @todo support for UTF-16
+        const char *data = (const char*)sqlite3_column_text(st, i);
+        const int length = sqlite3_column_bytes(st, i);
+        if (!column.hasField) {
+            return QString::fromUtf8(data, length);
+        }
+        const KDbField::Type t = column.type;
+        if (KDbField::isTextType(t)) {
+            return QString::fromUtf8(data, length);
+        } else if (t == KDbField::Date) {
+            return KDbUtils::dateFromISODateString(data, length);
+        } else if (t == KDbField::Time) {
+            //QDateTime - a hack needed because QVariant(QTime) has broken isNull()
+            return KDbUtils::stringToHackedQTime(data, length);
+        } else if (t == KDbField::DateTime) {
+            return KDbUtils::dateTimeFromISODateStringWithMs(data, length);
+        } else if (t == KDbField::Boolean) {
+            return sqliteStringToBool(QString::fromUtf8(data, length));
+        } else {
+            return QVariant(); //!< @todo
+        }
+    } else if (type == SQLITE_INTEGER) {
+        const KDbField::Type t = column.type;
+        if (t == KDbField::BigInteger) {
+            return QVariant(qint64(sqlite3_column_int64(st, i)));
+        } else if (KDbField::isIntegerType(t)) {
+            const int intVal = sqlite3_column_int(st, i);
+            return column.isUnsigned ? QVariant(static_cast<uint>(intVal)) : QVariant(intVal);
+        } else if (t == KDbField::Boolean) {
+            return sqlite3_column_int(st, i) != 0;
+        } else if (KDbField::isFPNumericType(t)) { //WEIRD, YEAH?
+            return QVariant(double(sqlite3_column_int(st, i)));
+        } else {
+            return QVariant(); //!< @todo
+        }
+    } else if (type == SQLITE_FLOAT) {
+        const KDbField::Type t = column.type;
+        if (KDbField::isFPNumericType(t)) {
+            return QVariant(sqlite3_column_double(st, i));
+        } else if (t == KDbField::BigInteger) {
+            return QVariant(qint64(sqlite3_column_int64(st, i)));
+        } else if (KDbField::isIntegerType(t)) {
+            const double doubleVal = sqlite3_column_double(st, i);
+            return column.isUnsigned ? QVariant(static_cast<uint>(doubleVal)) : QVariant(static_cast<int>(doubleVal));
+        } else {
+            return QVariant(); //!< @todo
+        }
+    } else if (type == SQLITE_BLOB) {
+        if (column.type == KDbField::BLOB) {
+//! @todo efficient enough?
+            return QByteArray((const char*)sqlite3_column_blob(st, i),
+                              sqlite3_column_bytes(st, i));
+        } else
+            return QVariant(); //!< @todo
+    }
+    return QVariant();
+}
+
+//----------------------------------------------------
+
+/*! Steps the statement and decodes records in a separate thread, see KDbCursor::Option::ReadAhead.
+ Decoded records are passed to the cursor through a single-producer single-consumer ring
+ buffer. Locking is only needed when the buffer is full or empty. */
+class SqliteReadAheadThread : public QThread
+{
+public:
+    SqliteReadAheadThread(sqlite3_stmt *statement, const QVector<SqliteColumn> &columns)
+        : m_statement(statement), m_columns(columns), m_finalCode(SQLITE_DONE)
+    {
+    }
+
+    ~SqliteReadAheadThread() override
+    {
+        stop();
+    }
+
+    //! Moves next record to @a record.
+    //! @return SQLITE_ROW on success, SQLITE_DONE after the last record or error code.
+    int takeRecord(QVector<QVariant> *record)
+    {
+        const quint32 head = m_head.load();
+        if (m_tail.loadAcquire() == head) { // empty
+            QMutexLocker locker(&m_mutex);
+            m_consumerWaiting.fetchAndStoreOrdered(1);
+            while (m_tail.loadAcquire() == head && !m_finished.loadAcquire()) {
+                m_notEmpty.wait(&m_mutex);
+            }
+            m_consumerWaiting.fetchAndStoreOrdered(0);
+            if (m_tail.loadAcquire() == head) {
+                return m_finalCode;
+            }
+        }
+        record->swap(m_records[head % capacity]);
+        m_head.fetchAndStoreOrdered(head + 1);
+        if (m_producerWaiting.loadAcquire()) {
+            QMutexLocker locker(&m_mutex);
+            m_notFull.wakeOne();
+        }
+        return SQLITE_ROW;
+    }
+
+    //! Stops reading records and waits for the thread
+    void stop()
+    {
+        m_stop.fetchAndStoreOrdered(1);
+        {
+            QMutexLocker locker(&m_mutex);
+            m_notFull.wakeOne();
+        }
+        wait();
+    }
+
+protected:
+    void run() override
+    {
+        QVector<QVariant> record;
+        while (!m_stop.loadAcquire()) {
+            const int res = sqlite3_step(m_statement);
+            if (res != SQLITE_ROW) {
+                m_finalCode = res;
+                break;
+            }
+            const int count = sqlite3_data_count(m_statement);
+            record.resize(count);
+            for (int i = 0; i < count; ++i) {
+                record[i] = sqliteValue(m_statement, i,
+                                        i < m_columns.count() ? m_columns.at(i) : SqliteColumn());
+            }
+            const quint32 tail = m_tail.load();
+            if (tail - m_head.loadAcquire() == capacity) { // full
+                QMutexLocker locker(&m_mutex);
+                m_producerWaiting.fetchAndStoreOrdered(1);
+                while (tail - m_head.loadAcquire() == capacity && !m_stop.loadAcquire()) {
+                    m_notFull.wait(&m_mutex);
+                }
+                m_producerWaiting.fetchAndStoreOrdered(0);
+                if (m_stop.loadAcquire()) {
+                    break;
+                }
+            }
+            m_records[tail % capacity].swap(record);
+            m_tail.fetchAndStoreOrdered(tail + 1);
+            wakeConsumer();
+        }
+        m_finished.fetchAndStoreOrdered(1);
+        wakeConsumer();
+    }
+
+private:
+    void wakeConsumer()
+    {
+        if (m_consumerWaiting.loadAcquire()) {
+            QMutexLocker locker(&m_mutex);
+            m_notEmpty.wakeOne();
+        }
+    }
+
+    static const quint32 capacity = 256; //!< maximum number of records read ahead
+    sqlite3_stmt * const m_statement;
+    const QVector<SqliteColumn> m_columns;
+    QVector<QVariant> m_records[capacity];
+    QAtomicInteger<quint32> m_head; //!< index of the next record to take, changed by consumer
+    QAtomicInteger<quint32> m_tail; //!< index of the next record to store, changed by producer
+    QAtomicInt m_consumerWaiting;
+    QAtomicInt m_producerWaiting;
+    QAtomicInt m_stop;
+    QAtomicInt m_finished;
+    int m_finalCode; //!< result of the last step, valid when m_finished is set
+    QMutex m_mutex;
+    QWaitCondition m_notEmpty;
+    QWaitCondition m_notFull;
+    Q_DISABLE_COPY(SqliteReadAheadThread)
+};
+
 //----------------------------------------------------
 
 class SqliteCursorData : public SqliteConnectionInternal
@@ -51,22 +252,15 @@ public:
             , curr_coldata(nullptr)
             , curr_colname(nullptr)
             , cols_pointers_mem_size(0)
+            , readAhead(nullptr)
     {
         data_owned = false;
     }
 
-    /*
-        void fetchRowDataIfNeeded()
-        {
-          if (!rowDataReadyToFetch)
-            return true;
-          rowDataReadyToFetch = false;
-          m_fieldCount = sqlite3_data_count(data);
-          for (int i=0; i<m_fieldCount; i++) {
-
-          }
-        }
-    */
+    ~SqliteCursorData() override
+    {
+        delete readAhead;
+    }
 
     sqlite3_stmt *prepared_st_handle;
 
@@ -75,72 +269,12 @@ public:
     const char **curr_colname;
     int cols_pointers_mem_size; //!< size of record's array of pointers to values
     QVector<const char**> records; //!< buffer data
+    QVector<SqliteColumn> columns; //!< types of columns for decoding values
+    SqliteReadAheadThread *readAhead; //!< used for the ReadAhead option
+    QVector<QVariant> currentRecord; //!< current record taken from readAhead
 
-    inline QVariant getValue(KDbField *f, int i) {
-        int type = sqlite3_column_type(prepared_st_handle, i);
-        if (type == SQLITE_NULL) {
-            return QVariant();
-        } else if (!f || type == SQLITE_TEXT) {
-//! @todo support for UTF-16
-            QString text(QString::fromUtf8(
-                (const char*)sqlite3_column_text(prepared_st_handle, i),
-                 sqlite3_column_bytes(prepared_st_handle, i)));
-            if (!f) {
-                return text;
-            }
-            const KDbField::Type t = f->type(); // cache: evaluating type of expressions can be expensive
-            if (KDbField::isTextType(t)) {
-                return text;
-            } else if (t == KDbField::Date) {
-                return QDate::fromString(text, Qt::ISODate);
-            } else if (t == KDbField::Time) {
-                //QDateTime - a hack needed because QVariant(QTime) has broken isNull()
-                return KDbUtils::stringToHackedQTime(text);
-            } else if (t == KDbField::DateTime) {
-                if (text.length() > 10) {
-                    text[10] = QLatin1Char('T'); //for ISODate compatibility
-                }
-                return KDbUtils::dateTimeFromISODateStringWithMs(text);
-            } else if (t == KDbField::Boolean) {
-                return sqliteStringToBool(text);
-            } else {
-                return QVariant(); //!< @todo
-            }
-        } else if (type == SQLITE_INTEGER) {
-            const KDbField::Type t = f->type();  // cache: evaluating type of expressions can be expensive
-            if (t == KDbField::BigInteger) {
-                return QVariant(qint64(sqlite3_column_int64(prepared_st_handle, i)));
-            } else if (KDbField::isIntegerType(t)) {
-                const int intVal = sqlite3_column_int(prepared_st_handle, i);
-                return f->isUnsigned() ? QVariant(static_cast<uint>(intVal)) : QVariant(intVal);
-            } else if (t == KDbField::Boolean) {
-                return sqlite3_column_int(prepared_st_handle, i) != 0;
-            } else if (KDbField::isFPNumericType(t)) { //WEIRD, YEAH?
-                return QVariant(double(sqlite3_column_int(prepared_st_handle, i)));
-            } else {
-                return QVariant(); //!< @todo
-            }
-        } else if (type == SQLITE_FLOAT) {
-            const KDbField::Type t = f->type(); // cache: evaluating type of expressions can be expensive
-            if (KDbField::isFPNumericType(t)) {
-                return QVariant(sqlite3_column_double(prepared_st_handle, i));
-            } else if (t == KDbField::BigInteger) {
-                return QVariant(qint64(sqlite3_column_int64(prepared_st_handle, i)));
-            } else if (KDbField::isIntegerType(t)) {
-                const double doubleVal = sqlite3_column_double(prepared_st_handle, i);
-                return f->isUnsigned() ? QVariant(static_cast<uint>(doubleVal)) : QVariant(static_cast<int>(doubleVal));
-            } else {
-                return QVariant(); //!< @todo
-            }
-        } else if (type == SQLITE_BLOB) {
-            if (f && f->type() == KDbField::BLOB) {
-//! @todo efficient enough?
-                return QByteArray((const char*)sqlite3_column_blob(prepared_st_handle, i),
-                                  sqlite3_column_bytes(prepared_st_handle, i));
-            } else
-                return QVariant(); //!< @todo
-        }
-        return QVariant();
+    inline QVariant getValue(int i) {
+        return sqliteValue(prepared_st_handle, i, i < columns.count() ? columns.at(i) : SqliteColumn());
     }
     Q_DISABLE_COPY(SqliteCursorData)
 };
@@ -189,16 +323,34 @@ bool SqliteCursor::drv_open(const KDbEscapedString& sql)
         storeResult();
         return false;
     }
-    if (isBuffered()) {
+    if (isBuffered() && !usesRecordBuffer()) {
 //! @todo manage size dynamically
         d->records.resize(128);
     }
-
+    const int columnCount = sqlite3_column_count(d->prepared_st_handle);
+    d->columns.clear();
+    d->columns.reserve(columnCount);
+    for (int i = 0; i < columnCount; ++i) {
+        d->columns.append(SqliteColumn(
+            (m_visibleFieldsExpanded && i < m_visibleFieldsExpanded->count())
+                ? m_visibleFieldsExpanded->at(i)->field() : nullptr));
+    }
+    // Reading ahead requires serialized connection (sqlite3_db_mutex() is not null) because
+    // the cursor's owner can use the connection while records are stepped in another thread.
+    if ((options() & KDbCursor::Option::ReadAhead) && !isBuffered()
+        && sqlite3_db_mutex(d->data))
+    {
+        d->readAhead = new SqliteReadAheadThread(d->prepared_st_handle, d->columns);
+        d->readAhead->start();
+    }
     return true;
 }
 
 bool SqliteCursor::drv_close()
 {
+    delete d->readAhead; // stops the thread
+    d->readAhead = nullptr;
+    d->currentRecord.clear();
     int res = sqlite3_finalize(d->prepared_st_handle);
     if (res != SQLITE_OK) {
         m_result.setServerErrorCode(res);
@@ -210,10 +362,12 @@ bool SqliteCursor::drv_close()
 
 void SqliteCursor::drv_getNextRecord()
 {
-    int res = sqlite3_step(d->prepared_st_handle);
+    int res = d->readAhead ? d->readAhead->takeRecord(&d->currentRecord)
+                           : sqlite3_step(d->prepared_st_handle);
     if (res == SQLITE_ROW) {
         m_fetchResult = FetchResult::Ok;
-        m_fieldCount = sqlite3_data_count(d->prepared_st_handle);
+        m_fieldCount = d->readAhead ? d->currentRecord.count()
+                                    : sqlite3_data_count(d->prepared_st_handle);
 //#else //for SQLITE3 data fetching is delayed. Now we even do not take field count information
 //      // -- just set a flag that we've a data not fetched but available
         m_fieldsToStoreInRecord = m_fieldCount;
@@ -308,6 +462,12 @@ const char ** SqliteCursor::recordData() const
 
 bool SqliteCursor::drv_storeCurrentRecord(KDbRecordData* data) const
 {
+    if (d->readAhead) { // values are already decoded
+        for (int i = 0; i < m_fieldCount; i++) {
+            (*data)[i] = d->currentRecord.at(i);
+        }
+        return true;
+    }
     if (!m_visibleFieldsExpanded) {//simple version: without types
         for (int i = 0; i < m_fieldCount; i++) {
             (*data)[i] = QString::fromUtf8(
@@ -317,9 +477,7 @@ bool SqliteCursor::drv_storeCurrentRecord(KDbRecordData* data) const
         return true;
     }
     for (int i = 0; i < m_fieldCount; ++i) {
-        KDbField *f = m_visibleFieldsExpanded->at(i)->field();
-//  sqliteDebug() << "col=" << (col ? *col : 0);
-        (*data)[i] = d->getValue(f, i);
+        (*data)[i] = d->getValue(i);
     }
     return true;
 }
@@ -329,9 +487,13 @@ QVariant SqliteCursor::value(int i)
     if (i < 0 || i > (m_fieldCount - 1)) //range checking
         return QVariant();
 //! @todo allow disable range checking! - performance reasons
-    KDbField *f = (m_visibleFieldsExpanded && i < m_visibleFieldsExpanded->count())
-                  ? m_visibleFieldsExpanded->at(i)->field() : nullptr;
-    return d->getValue(f, i); //, i==m_logicalFieldCount/*ROWID*/);
+    if (const KDbRecordData *record = bufferedRecord()) {
+        return record->value(i);
+    }
+    if (d->readAhead) {
+        return d->currentRecord.at(i);
+    }
+    return d->getValue(i); //, i==m_logicalFieldCount/*ROWID*/);
 }
 
 QString SqliteCursor::serverResultName() const
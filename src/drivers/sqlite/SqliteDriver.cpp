@@ -52,7 +52,8 @@ SqliteDriver::SqliteDriver(QObject *parent, const QVariantList &args)
         , dp(new SqliteDriverPrivate)
 {
     KDbDriverBehavior *beh = behavior();
-    beh->features = SingleTransactions | CursorForward | CompactingDatabaseSupported;
+    beh->features = SingleTransactions | NestedTransactions | CursorForward
+                    | CompactingDatabaseSupported;
 
     //special method for autoincrement definition
     beh->SPECIAL_AUTO_INCREMENT_DEF = true;
@@ -66,13 +67,14 @@ SqliteDriver::SqliteDriver(QObject *parent, const QVariantList &args)
     beh->OPENING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER = '[';
     beh->CLOSING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER = ']';
     beh->SELECT_1_SUBQUERY_SUPPORTED = true;
+    beh->SELECT_NO_LIMIT_VALUE = QLatin1String("-1");
     beh->CONNECTION_REQUIRED_TO_CHECK_DB_EXISTENCE = false;
     beh->CONNECTION_REQUIRED_TO_CREATE_DB = false;
     beh->CONNECTION_REQUIRED_TO_DROP_DB = false;
     beh->GET_TABLE_NAMES_SQL
         = KDbEscapedString("SELECT name FROM sqlite_master WHERE type='table'");
 
-    initDriverSpecificKeywords(keywords);
+    initDriverSpecificKeywords(keywordsHash);
 
     // internal properties
     beh->properties.insert("client_library_version", QLatin1String(sqlite3_libversion()));
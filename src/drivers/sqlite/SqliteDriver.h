@@ -108,6 +108,7 @@ protected:
 
 private:
     static const char * const keywords[];
+    static const KDbUtils::StaticSetOfStrings::HashTable keywordsHash;
     Q_DISABLE_COPY(SqliteDriver)
 };
 
@@ -157,3 +157,23 @@ const char* const SqliteDriver::keywords[] = {
     "WITHOUT",
     nullptr
 };
+
+static const quint16 keywordsHashSeeds[] = {
+    10, 4, 2, 4, 7, 1, 4, 12, 0, 23, 0, 0, 11, 2, 33, 3, 14, 16, 9, 8, 37, 0, 1, 9, 0, 6, 59,
+    25, 2, 2, 22, 25, 0,
+};
+
+static const qint16 keywordsHashSlots[] = {
+    26, 10, 110, -1, 102, -1, 87, 88, 66, -1, -1, -1, -1, 71, -1, 29, 106, 58, 70, 4, 96, 46,
+    7, -1, -1, 12, 101, -1, 103, 47, 92, 93, 42, 63, 56, 6, -1, 53, 121, 128, 68, 48, 57, 40,
+    27, 120, 91, 127, -1, 109, -1, 31, 34, 82, 65, 33, -1, 45, -1, 61, 13, 21, 79, 17, 123,
+    30, 107, -1, 72, 84, 98, -1, 86, 115, 1, -1, -1, 69, 16, 36, 114, -1, 55, 113, 89, 54, 108,
+    -1, 50, 38, 99, 51, 23, 5, 35, 129, 100, 52, 8, -1, 15, 11, -1, 118, 104, -1, 24, 126, 22,
+    9, 44, -1, -1, -1, 77, 2, 78, 81, -1, 37, 119, 116, 111, 105, 20, 112, 49, 95, 64, 32, 97,
+    117, 19, 62, 125, 94, 90, 25, 74, 14, 43, 85, 83, 67, 0, 18, -1, -1, -1, 75, -1, 3, 28,
+    -1, 76, 41, 122, 73, 60, 80, 39, 59, 124,
+};
+
+const KDbUtils::StaticSetOfStrings::HashTable SqliteDriver::keywordsHash = {
+    SqliteDriver::keywords, keywordsHashSeeds, keywordsHashSlots, 33, 163
+};
@@ -35,12 +35,14 @@ SqlitePreparedStatement::~SqlitePreparedStatement()
 
 bool SqlitePreparedStatement::prepare(const KDbEscapedString& sql)
 {
+    m_sql = sql;
     m_sqlResult = connection->prepareSql(sql);
     m_result = connection->result();
     return m_sqlResult && !m_result.isError();
 }
 
-bool SqlitePreparedStatement::bindValue(KDbField *field, const QVariant& value, int par)
+bool SqlitePreparedStatement::bindValue(KDbField *field, const QVariant& value, int par,
+                                        bool copyValue)
 {
     if (value.isNull()) {
         //no value to bind or the value is null: bind NULL
@@ -53,7 +55,18 @@ bool SqlitePreparedStatement::bindValue(KDbField *field, const QVariant& value,
         return true;
     }
     if (field->isTextType()) {
-        //! @todo optimize: make a static copy so SQLITE_STATIC can be used
+        if (!copyValue && value.type() == QVariant::String) {
+            // bind UTF-16 data of the string directly
+            const QString *string = static_cast<const QString*>(value.constData());
+            int res = sqlite3_bind_text16(sqlResult()->prepared_st, par, string->utf16(),
+                                          string->size() * int(sizeof(QChar)), SQLITE_STATIC);
+            if (res != SQLITE_OK) {
+                m_result.setServerErrorCode(res);
+                storeResult(&m_result);
+                return false;
+            }
+            return true;
+        }
         const QByteArray utf8String(value.toString().toUtf8());
         int res = sqlite3_bind_text(sqlResult()->prepared_st, par,
                                     utf8String.constData(), utf8String.length(), SQLITE_TRANSIENT /*??*/);
@@ -164,9 +177,12 @@ bool SqlitePreparedStatement::bindValue(KDbField *field, const QVariant& value,
         break;
     }
     case KDbField::BLOB: {
-        const QByteArray byteArray(value.toByteArray());
-        int res = sqlite3_bind_blob(sqlResult()->prepared_st, par,
-                                    byteArray.constData(), byteArray.size(), SQLITE_TRANSIENT /*??*/);
+        const bool bindDirectly = !copyValue && value.type() == QVariant::ByteArray;
+        const QByteArray byteArray(bindDirectly ? QByteArray() : value.toByteArray());
+        const QByteArray *data = bindDirectly ? static_cast<const QByteArray*>(value.constData())
+                                              : &byteArray;
+        int res = sqlite3_bind_blob(sqlResult()->prepared_st, par, data->constData(), data->size(),
+                                    bindDirectly ? SQLITE_STATIC : SQLITE_TRANSIENT);
         if (res != SQLITE_OK) {
             m_result.setServerErrorCode(res);
             storeResult(&m_result);
@@ -188,6 +204,97 @@ bool SqlitePreparedStatement::bindValue(KDbField *field, const QVariant& value,
     return true;
 }
 
+bool SqlitePreparedStatement::bindValues(const KDbField::List& fieldList,
+                                         const KDbPreparedStatementParameters& parameters)
+{
+    int par = 1; // par.index counted from 1
+    KDbField::ListIterator itFields(fieldList.constBegin());
+    for (QList<QVariant>::ConstIterator it = parameters.constBegin();
+         itFields != fieldList.constEnd();
+         it += (it == parameters.constEnd() ? 0 : 1), ++itFields, par++)
+    {
+        if (!bindValue(*itFields, it == parameters.constEnd() ? QVariant() : *it, par))
+            return false;
+    }
+    return true;
+}
+
+bool SqlitePreparedStatement::bindRecord(const KDbField::List& fieldList,
+                                         const KDbPreparedStatementColumns& columns, int record)
+{
+    static const QVariant nullValue;
+    int par = 1; // par.index counted from 1
+    for (int i = 0; i < fieldList.count(); ++i, ++par) {
+        const QVariant *value = &nullValue;
+        if (i < columns.count() && record < columns.at(i).count()) {
+            value = &columns.at(i).at(record);
+        }
+        if (!bindValue(fieldList.at(i), *value, par, false)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool SqlitePreparedStatement::executeBatch(KDbPreparedStatement::Type type,
+                                           const KDbField::List &fieldList,
+                                           KDbFieldList *insertFieldList,
+                                           const KDbPreparedStatementColumns &columns,
+                                           int recordCount, qint64 *affectedRecords,
+                                           int *failedRecord)
+{
+    Q_UNUSED(type);
+    Q_UNUSED(insertFieldList);
+    if (!sqlResult() || !sqlResult()->prepared_st) {
+        if (!m_result.isError()) {
+            m_result = KDbResult(ERR_OTHER, KDbPreparedStatement::tr("Statement is not prepared."));
+        }
+        *failedRecord = recordCount > 0 ? 0 : -1;
+        return false;
+    }
+    // Values are bound without copying since columns are not modified during the batch.
+    // The statement is reused for all records: bind, step and reset.
+    bool ok = true;
+    for (int record = 0; record < recordCount; ++record) {
+        if (!bindRecord(fieldList, columns, record)) {
+            ok = false;
+        } else {
+            int res = sqlite3_step(sqlResult()->prepared_st);
+            if (res == SQLITE_ERROR && sqlite3_reset(sqlResult()->prepared_st) == SQLITE_SCHEMA) {
+                // compile again after schema change, see execute()
+                if (!prepare(m_sql)) {
+                    *failedRecord = record;
+                    return false;
+                }
+                if (bindRecord(fieldList, columns, record)) {
+                    res = sqlite3_step(sqlResult()->prepared_st);
+                }
+            }
+            if (res == SQLITE_DONE) {
+                *affectedRecords += sqlite3_changes(data);
+            } else {
+                ok = false;
+                m_result.setServerErrorCode(res);
+                storeResult(&m_result);
+                sqliteWarning() << m_result << "in record" << record;
+            }
+            (void)sqlite3_reset(sqlResult()->prepared_st);
+        }
+        if (!ok) {
+            *failedRecord = record;
+            break;
+        }
+    }
+    if (sqlResult() && sqlResult()->prepared_st) {
+        // do not keep pointers to values of the columns
+        (void)sqlite3_clear_bindings(sqlResult()->prepared_st);
+    }
+    if (ok) {
+        m_result = KDbResult();
+    }
+    return ok;
+}
+
 QSharedPointer<KDbSqlResult> SqlitePreparedStatement::execute(
     KDbPreparedStatement::Type type,
     const KDbField::List& selectFieldList,
@@ -198,19 +305,20 @@ QSharedPointer<KDbSqlResult> SqlitePreparedStatement::execute(
     if (!sqlResult()->prepared_st) {
         return QSharedPointer<KDbSqlResult>();
     }
-
-    int par = 1; // par.index counted from 1
-    KDbField::ListIterator itFields(selectFieldList.constBegin());
-    for (QList<QVariant>::ConstIterator it = parameters.constBegin();
-         itFields != selectFieldList.constEnd();
-         it += (it == parameters.constEnd() ? 0 : 1), ++itFields, par++)
-    {
-        if (!bindValue(*itFields, it == parameters.constEnd() ? QVariant() : *it, par))
-            return QSharedPointer<KDbSqlResult>();
+    if (!bindValues(selectFieldList, parameters)) {
+        return QSharedPointer<KDbSqlResult>();
     }
 
     //real execution
-    const int res = sqlite3_step(sqlResult()->prepared_st);
+    int res = sqlite3_step(sqlResult()->prepared_st);
+    if (res == SQLITE_ERROR && sqlite3_reset(sqlResult()->prepared_st) == SQLITE_SCHEMA) {
+        // Statements compiled using sqlite3_prepare() have to be compiled again after
+        // the database schema changes, e.g. when index is created for the table.
+        if (!prepare(m_sql) || !bindValues(selectFieldList, parameters)) {
+            return QSharedPointer<KDbSqlResult>();
+        }
+        res = sqlite3_step(sqlResult()->prepared_st);
+    }
     if (type == KDbPreparedStatement::InsertStatement) {
         const bool ok = res == SQLITE_DONE;
         if (ok) {
@@ -223,6 +331,21 @@ QSharedPointer<KDbSqlResult> SqlitePreparedStatement::execute(
         (void)sqlite3_reset(sqlResult()->prepared_st);
         return m_sqlResult;
     }
+    else if (type == KDbPreparedStatement::UpdateStatement
+             || type == KDbPreparedStatement::DeleteStatement)
+    {
+        const bool ok = res == SQLITE_DONE;
+        if (ok) {
+            m_result = KDbResult();
+        } else {
+            m_result.setServerErrorCode(res);
+            storeResult(&m_result);
+            sqliteWarning() << m_result << QString::fromLatin1(sqlite3_sql(sqlResult()->prepared_st));
+        }
+        (void)sqlite3_reset(sqlResult()->prepared_st);
+        // the compiled statement is kept for next execution
+        return ok ? m_sqlResult : QSharedPointer<KDbSqlResult>();
+    }
     else if (type == KDbPreparedStatement::SelectStatement) {
         //! @todo fetch result
         const bool ok = res == SQLITE_ROW;
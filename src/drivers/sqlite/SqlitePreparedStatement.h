@@ -41,11 +41,29 @@ protected:
             const KDbField::List &selectFieldList, KDbFieldList *insertFieldList,
             const KDbPreparedStatementParameters &parameters) override;
 
-    bool bindValue(KDbField *field, const QVariant& value, int arg);
+    bool executeBatch(KDbPreparedStatement::Type type,
+                      const KDbField::List &fieldList, KDbFieldList *insertFieldList,
+                      const KDbPreparedStatementColumns &columns,
+                      int recordCount, qint64 *affectedRecords, int *failedRecord) override;
+
+    /*! Binds @a value for @a field to parameter @a arg.
+     If @a copyValue is false, text and BLOB data of @a value is bound without copying, so
+     @a value must be kept unchanged until the statement is stepped and bindings are cleared. */
+    bool bindValue(KDbField *field, const QVariant& value, int arg, bool copyValue = true);
+
+    //! Binds @a parameters to the statement; missing values are bound as NULL
+    bool bindValues(const KDbField::List& fieldList,
+                    const KDbPreparedStatementParameters& parameters);
+
+    //! Binds values of @a record from @a columns without copying them;
+    //! missing values are bound as NULL
+    bool bindRecord(const KDbField::List& fieldList, const KDbPreparedStatementColumns& columns,
+                    int record);
 
     inline SqliteSqlResult *sqlResult() { return static_cast<SqliteSqlResult*>(m_sqlResult.data()); }
 
     QSharedPointer<KDbSqlResult> m_sqlResult;
+    KDbEscapedString m_sql; //!< used to compile the statement again after schema change
 private:
     Q_DISABLE_COPY(SqlitePreparedStatement)
 };
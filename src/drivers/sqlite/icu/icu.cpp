@@ -37,12 +37,16 @@
 #include <unicode/uregex.h>
 #include <unicode/ustring.h>
 #include <unicode/ucol.h>
+#include <unicode/uiter.h>
+#include <unicode/uset.h>
 #include <unicode/uvernum.h>
 #if U_ICU_VERSION_MAJOR_NUM>=51
 #include <unicode/utf_old.h>
 #endif
 
 #include <assert.h>
+#include <stdlib.h>
+#include <string.h>
 
 #ifndef SQLITE_CORE
   #include "sqlite3ext.h"
@@ -59,6 +63,16 @@
 # define SQLITE_MAX_LIKE_PATTERN_LENGTH 50000
 #endif
 
+/*
+** Flag for functions that always return the same result for the same
+** arguments; such functions can be used in indexes on expressions.
+*/
+#ifdef SQLITE_DETERMINISTIC
+# define ICU_SQLITE_DETERMINISTIC SQLITE_DETERMINISTIC
+#else
+# define ICU_SQLITE_DETERMINISTIC 0
+#endif
+
 /*
 ** Version of sqlite3_free() that is always a function, never a macro.
 */
@@ -67,86 +81,293 @@ static void xFree(void *p){
 }
 
 /*
-** Compare two UTF-8 strings for equality where the first string is
-** a "LIKE" expression. Return true (1) if they are the same and
-** false (0) if they are different.
+** Value of IcuLikePattern::aChar element for the "_" (match one) character.
 */
-static int icuLikeCompare(
-  const uint8_t *zPattern,   /* LIKE pattern */
-  const uint8_t *zString,    /* The UTF-8 string to compare against */
-  const UChar32 uEsc         /* The escape character */
-){
-  static const int MATCH_ONE = (UChar32)'_';
-  static const int MATCH_ALL = (UChar32)'%';
+#define ICU_LIKE_MATCH_ONE (-1)
 
-  int iPattern = 0;       /* Current byte index in zPattern */
-  int iString = 0;        /* Current byte index in zString */
+/*
+** A LIKE pattern compiled by icuLikeCompile().
+**
+** The pattern is split by "%" characters into segments of case-folded
+** characters and ICU_LIKE_MATCH_ONE values. Segments are matched from
+** left to right at their leftmost positions, which is always correct for
+** LIKE since "%" can match any text between them, so matching needs no
+** backtracking. Segments without "_" are searched using the
+** Knuth-Morris-Pratt algorithm, making the whole match linear in length
+** of the string.
+*/
+typedef struct IcuLikeSegment IcuLikeSegment;
+struct IcuLikeSegment {
+  int iChar;                /* Index of the first character in aChar */
+  int nChar;                /* Number of characters */
+  int hasMatchOne;          /* True if the segment contains "_" */
+};
 
-  int prevEscape = 0;     /* True if the previous character was uEsc */
+typedef struct IcuLikePattern IcuLikePattern;
+struct IcuLikePattern {
+  UChar32 uEsc;             /* Escape character the pattern was compiled for */
+  int hasMatchAll;          /* True if the pattern contains "%" */
+  int startsWithMatchAll;   /* True if the pattern starts with "%" */
+  int endsWithMatchAll;     /* True if the pattern ends with "%" */
+  int matchesNothing;       /* True if the pattern never matches */
+  int nSegment;             /* Number of segments */
+  IcuLikeSegment *aSegment; /* Segments */
+  UChar32 *aChar;           /* Characters of all segments */
+  int *aNext;               /* KMP failure function for each character */
+  UChar32 *aString;         /* Buffer for case-folded string */
+  int nStringAlloc;         /* Allocated size of aString */
+};
+
+/*
+** Returns case-folded character c; ASCII characters are folded without
+** calling ICU.
+*/
+static inline UChar32 icuFoldCase(UChar32 c){
+  if( c<128 ){
+    return (c>='A' && c<='Z') ? c + ('a' - 'A') : c;
+  }
+  return u_foldCase(c, U_FOLD_CASE_DEFAULT);
+}
+
+/*
+** Destructor of compiled LIKE patterns. Registered as a destructor
+** function with sqlite3_set_auxdata().
+*/
+static void icuLikeDelete(void *p){
+  IcuLikePattern *pPattern = (IcuLikePattern *)p;
+  if( pPattern ){
+    sqlite3_free(pPattern->aString);
+    sqlite3_free(pPattern);
+  }
+}
+
+/*
+** Compiles UTF-8 LIKE pattern zPattern of nPattern bytes for escape
+** character uEsc (0 for none). Returns nullptr if out of memory.
+*/
+static IcuLikePattern *icuLikeCompile(
+  const uint8_t *zPattern,
+  int nPattern,
+  UChar32 uEsc
+){
+  static const UChar32 MATCH_ONE = (UChar32)'_';
+  static const UChar32 MATCH_ALL = (UChar32)'%';
+  IcuLikePattern *p;
+  IcuLikeSegment *pSegment = nullptr;
+  int prevEscape = 0;
+  int nChar = 0;
+  int iPattern = 0;
+  int i;
 
-  while( zPattern[iPattern]!=0 ){
+  /* There are at most nPattern characters and nPattern/2+1 segments */
+  const int nByte = (int)(sizeof(IcuLikePattern)
+      + (nPattern/2 + 1) * sizeof(IcuLikeSegment)
+      + nPattern * (sizeof(UChar32) + sizeof(int)));
+  p = (IcuLikePattern *)sqlite3_malloc(nByte);
+  if( !p ){
+    return nullptr;
+  }
+  memset(p, 0, sizeof(IcuLikePattern));
+  p->uEsc = uEsc;
+  p->aSegment = (IcuLikeSegment *)&p[1];
+  p->aChar = (UChar32 *)&p->aSegment[nPattern/2 + 1];
+  p->aNext = (int *)&p->aChar[nPattern];
 
-    /* Read (and consume) the next character from the input pattern. */
+  while( iPattern<nPattern ){
     UChar32 uPattern;
-    U8_NEXT_UNSAFE(zPattern, iPattern, uPattern);
-    assert(uPattern!=0);
-
-    /* There are now 4 possibilities:
-    **
-    **     1. uPattern is an unescaped match-all character "%",
-    **     2. uPattern is an unescaped match-one character "_",
-    **     3. uPattern is an unescaped escape character, or
-    **     4. uPattern is to be handled as an ordinary character
-    */
+    U8_NEXT(zPattern, iPattern, nPattern, uPattern);
+    if( uPattern<0 ){
+      uPattern = 0xFFFD;
+    }
     if( !prevEscape && uPattern==MATCH_ALL ){
-      /* Case 1. */
-      uint8_t c;
-
-      /* Skip any MATCH_ALL or MATCH_ONE characters that follow a
-      ** MATCH_ALL. For each MATCH_ONE, skip one character in the
-      ** test string.
-      */
-      while( (c=zPattern[iPattern]) == MATCH_ALL || c == MATCH_ONE ){
-        if( c==MATCH_ONE ){
-          if( zString[iString]==0 ) return 0;
-          U8_FWD_1_UNSAFE(zString, iString);
-        }
-        iPattern++;
+      p->hasMatchAll = 1;
+      if( nChar==0 && p->nSegment==0 ){
+        p->startsWithMatchAll = 1;
       }
+      pSegment = nullptr;
+      continue;
+    }
+    if( !prevEscape && uPattern==uEsc ){
+      prevEscape = 1;
+      continue;
+    }
+    if( !pSegment ){
+      pSegment = &p->aSegment[p->nSegment++];
+      pSegment->iChar = nChar;
+      pSegment->nChar = 0;
+      pSegment->hasMatchOne = 0;
+    }
+    if( !prevEscape && uPattern==MATCH_ONE ){
+      p->aChar[nChar++] = ICU_LIKE_MATCH_ONE;
+      pSegment->hasMatchOne = 1;
+    }else{
+      p->aChar[nChar++] = icuFoldCase(uPattern);
+    }
+    pSegment->nChar++;
+    prevEscape = 0;
+  }
+  p->endsWithMatchAll = p->hasMatchAll && !pSegment;
+  /* Escape character at the end is ignored but if it follows "%" and
+  ** optional "_" characters nothing matches */
+  if( prevEscape && p->hasMatchAll ){
+    p->matchesNothing = 1;
+    for(i=0; pSegment && i<pSegment->nChar; i++){
+      if( p->aChar[pSegment->iChar + i]!=ICU_LIKE_MATCH_ONE ){
+        p->matchesNothing = 0;
+      }
+    }
+  }
 
-      if( zPattern[iPattern]==0 ) return 1;
+  /* KMP failure function of segments without "_" */
+  for(i=0; i<p->nSegment; i++){
+    const IcuLikeSegment *pSeg = &p->aSegment[i];
+    const UChar32 *aChar = &p->aChar[pSeg->iChar];
+    int *aNext = &p->aNext[pSeg->iChar];
+    int j;
+    int k = 0;
+    if( pSeg->hasMatchOne ) continue;
+    aNext[0] = 0;
+    for(j=1; j<pSeg->nChar; j++){
+      while( k>0 && aChar[j]!=aChar[k] ) k = aNext[k-1];
+      if( aChar[j]==aChar[k] ) k++;
+      aNext[j] = k;
+    }
+  }
+  return p;
+}
 
-      while( zString[iString] ){
-        if( icuLikeCompare(&zPattern[iPattern], &zString[iString], uEsc) ){
-          return 1;
-        }
-        U8_FWD_1_UNSAFE(zString, iString);
-      }
+/*
+** Returns true if segment pSeg of pattern p matches aString at iString.
+*/
+static int icuLikeSegmentMatchesAt(
+  const IcuLikePattern *p,
+  const IcuLikeSegment *pSeg,
+  const UChar32 *aString,
+  int iString
+){
+  const UChar32 *aChar = &p->aChar[pSeg->iChar];
+  int j;
+  for(j=0; j<pSeg->nChar; j++){
+    if( aChar[j]!=ICU_LIKE_MATCH_ONE && aChar[j]!=aString[iString + j] ){
       return 0;
+    }
+  }
+  return 1;
+}
 
-    }else if( !prevEscape && uPattern==MATCH_ONE ){
-      /* Case 2. */
-      if( zString[iString]==0 ) return 0;
-      U8_FWD_1_UNSAFE(zString, iString);
+/*
+** Returns index of the leftmost occurrence of segment pSeg of pattern p
+** in aString between iStart and iEnd, or -1 if there is none.
+*/
+static int icuLikeSegmentFind(
+  const IcuLikePattern *p,
+  const IcuLikeSegment *pSeg,
+  const UChar32 *aString,
+  int iStart,
+  int iEnd
+){
+  int i;
+  if( pSeg->hasMatchOne ){
+    for(i=iStart; i + pSeg->nChar<=iEnd; i++){
+      if( icuLikeSegmentMatchesAt(p, pSeg, aString, i) ){
+        return i;
+      }
+    }
+  }else{
+    const UChar32 *aChar = &p->aChar[pSeg->iChar];
+    const int *aNext = &p->aNext[pSeg->iChar];
+    int k = 0;
+    for(i=iStart; i<iEnd; i++){
+      while( k>0 && aString[i]!=aChar[k] ) k = aNext[k-1];
+      if( aString[i]==aChar[k] ) k++;
+      if( k==pSeg->nChar ){
+        return i + 1 - k;
+      }
+    }
+  }
+  return -1;
+}
 
-    }else if( !prevEscape && uPattern==uEsc){
-      /* Case 3. */
-      prevEscape = 1;
+/*
+** Compare UTF-8 string zString of nString bytes with compiled LIKE
+** pattern p. Return true (1) if they match, false (0) if they do not
+** and -1 if out of memory.
+*/
+static int icuLikeCompare(
+  IcuLikePattern *p,
+  const uint8_t *zString,
+  int nString
+){
+  UChar32 *aString;
+  int n = 0;
+  int iString = 0;
+  int iSegment = 0;
+  int nSegment = p->nSegment;
+  int iPos = 0;
+  int iEnd;
 
+  /* Decode and fold the string once, reusing the buffer */
+  if( nString>0 && p->nStringAlloc<nString ){
+    UChar32 *aNew;
+    if( nString>0x7fffffff/(int)sizeof(UChar32) ){
+      return -1;
+    }
+    aNew = (UChar32 *)sqlite3_realloc(p->aString, nString * (int)sizeof(UChar32));
+    if( !aNew ){
+      return -1;
+    }
+    p->aString = aNew;
+    p->nStringAlloc = nString;
+  }
+  aString = p->aString;
+  while( iString<nString ){
+    UChar32 c = zString[iString];
+    if( c<128 ){
+      iString++;
     }else{
-      /* Case 4. */
-      UChar32 uString;
-      U8_NEXT_UNSAFE(zString, iString, uString);
-      uString = u_foldCase(uString, U_FOLD_CASE_DEFAULT);
-      uPattern = u_foldCase(uPattern, U_FOLD_CASE_DEFAULT);
-      if( uString!=uPattern ){
-        return 0;
+      U8_NEXT(zString, iString, nString, c);
+      if( c<0 ){
+        c = 0xFFFD;
       }
-      prevEscape = 0;
     }
+    aString[n++] = icuFoldCase(c);
   }
 
-  return zString[iString]==0;
+  if( p->matchesNothing ){
+    return 0;
+  }
+  if( !p->hasMatchAll ){
+    return nSegment==0
+        ? n==0
+        : (p->aSegment[0].nChar==n && icuLikeSegmentMatchesAt(p, &p->aSegment[0], aString, 0));
+  }
+  if( !p->startsWithMatchAll ){
+    const IcuLikeSegment *pFirst = &p->aSegment[0];
+    if( pFirst->nChar>n || !icuLikeSegmentMatchesAt(p, pFirst, aString, 0) ){
+      return 0;
+    }
+    iPos = pFirst->nChar;
+    iSegment = 1;
+  }
+  iEnd = n;
+  if( !p->endsWithMatchAll && nSegment>iSegment ){
+    const IcuLikeSegment *pLast = &p->aSegment[nSegment - 1];
+    if( pLast->nChar>n - iPos
+     || !icuLikeSegmentMatchesAt(p, pLast, aString, n - pLast->nChar) ){
+      return 0;
+    }
+    iEnd = n - pLast->nChar;
+    nSegment--;
+  }
+  for(; iSegment<nSegment; iSegment++){
+    const IcuLikeSegment *pSeg = &p->aSegment[iSegment];
+    const int i = icuLikeSegmentFind(p, pSeg, aString, iPos, iEnd);
+    if( i<0 ){
+      return 0;
+    }
+    iPos = i + pSeg->nChar;
+  }
+  return 1;
 }
 
 /*
@@ -161,6 +382,8 @@ static int icuLikeCompare(
 **       A LIKE B ESCAPE E
 **
 ** is mapped to like(B, A, E).
+**
+** The pattern is compiled once per statement if it is constant.
 */
 static void icuLikeFunc(
   sqlite3_context *context,
@@ -170,9 +393,11 @@ static void icuLikeFunc(
   const unsigned char *zA = sqlite3_value_text(argv[0]);
   const unsigned char *zB = sqlite3_value_text(argv[1]);
   UChar32 uEsc = 0;
+  IcuLikePattern *pPattern;
+  int res;
 
   /* Limit the length of the LIKE or GLOB pattern to avoid problems
-  ** of deep recursion and N*N behavior in patternCompare().
+  ** with excessive memory use for compiled patterns.
   */
   if( sqlite3_value_bytes(argv[0])>SQLITE_MAX_LIKE_PATTERN_LENGTH ){
     sqlite3_result_error(context, "LIKE or GLOB pattern too complex", -1);
@@ -196,9 +421,30 @@ static void icuLikeFunc(
     }
   }
 
-  if( zA && zB ){
-    sqlite3_result_int(context, icuLikeCompare(zA, zB, uEsc));
+  if( !zA || !zB ){
+    return;
+  }
+  pPattern = static_cast<IcuLikePattern*>(sqlite3_get_auxdata(context, 0));
+  if( !pPattern || pPattern->uEsc!=uEsc ){
+    pPattern = icuLikeCompile(zA, sqlite3_value_bytes(argv[0]), uEsc);
+    if( !pPattern ){
+      sqlite3_result_error_nomem(context);
+      return;
+    }
+    sqlite3_set_auxdata(context, 0, pPattern, icuLikeDelete);
+    /* sqlite3_set_auxdata() may have destroyed the pattern already */
+    pPattern = static_cast<IcuLikePattern*>(sqlite3_get_auxdata(context, 0));
+    if( !pPattern ){
+      sqlite3_result_error_nomem(context);
+      return;
+    }
+  }
+  res = icuLikeCompare(pPattern, zB, sqlite3_value_bytes(argv[1]));
+  if( res<0 ){
+    sqlite3_result_error_nomem(context);
+    return;
   }
+  sqlite3_result_int(context, res);
 }
 
 /*
@@ -370,18 +616,217 @@ static void icuCaseFunc16(sqlite3_context *p, int nArg, sqlite3_value **apArg){
   sqlite3_result_text16(p, zOutput, -1, xFree);
 }
 
+/*
+** Collation sequence context: an ICU collator and tables used by the
+** fast path for comparing pure ASCII strings.
+**
+** For the fast path each ASCII character that is collated as a single
+** collation element with non-zero primary weight gets ranks of its
+** primary, secondary and tertiary weights (1..128). Comparing rank
+** sequences level by level then gives the same result as the collator.
+** Characters that can be ignorable, expanding or part of a contraction
+** have rank 0 and disable the fast path for strings containing them.
+*/
+typedef struct IcuCollation IcuCollation;
+struct IcuCollation {
+  UCollator *pCollator;       /* ICU library collation object */
+  int nLevel;                 /* Levels compared by the fast path, 0 if disabled */
+  uint8_t aRank[3][128];      /* Ranks of ASCII characters for each level */
+};
+
+/*
+** Returns bytes of level iLevel (0 for primary) of sort key zKey
+** in *pzLevel and their count in *pnLevel.
+*/
+static void icuSortKeyLevel(
+  const uint8_t *zKey,
+  int iLevel,
+  const uint8_t **pzLevel,
+  int *pnLevel
+){
+  int i = 0;
+  for(; iLevel>0; iLevel--){
+    while( zKey[i]>1 ) i++;
+    if( zKey[i]==1 ) i++;
+  }
+  *pzLevel = &zKey[i];
+  *pnLevel = 0;
+  while( zKey[i+*pnLevel]>1 ) (*pnLevel)++;
+}
+
+/*
+** Weight of an ASCII character at a single level of its sort key.
+*/
+typedef struct IcuAsciiWeight IcuAsciiWeight;
+struct IcuAsciiWeight {
+  const uint8_t *z;           /* Bytes of the weight */
+  int n;                      /* Number of bytes */
+  int c;                      /* The character */
+};
+
+/*
+** qsort() comparison function for IcuAsciiWeight objects. Weights are
+** compared like sort keys: byte-wise, a prefix sorts before longer weights.
+*/
+static int icuAsciiWeightCompare(const void *pA, const void *pB){
+  const IcuAsciiWeight *a = static_cast<const IcuAsciiWeight *>(pA);
+  const IcuAsciiWeight *b = static_cast<const IcuAsciiWeight *>(pB);
+  int cmp = memcmp(a->z, b->z, a->n<b->n ? a->n : b->n);
+  if( cmp==0 ) cmp = a->n - b->n;
+  return cmp;
+}
+
+/*
+** Initializes the ASCII fast path tables of pColl. The fast path stays
+** disabled if settings of the collator make it impossible.
+*/
+static void icuCollationInitAscii(IcuCollation *pColl){
+  UErrorCode status = U_ZERO_ERROR;
+  UCollator *p = pColl->pCollator;
+  uint8_t aKey[128][64];      /* Sort keys of ASCII characters */
+  uint8_t aSimple[128];       /* True for characters usable by the fast path */
+  USet *pContractions;
+  USet *pExpansions;
+  UCollationStrength strength;
+  int iLevel;
+  int c;
+
+  pColl->nLevel = 0;
+  memset(pColl->aRank, 0, sizeof(pColl->aRank));
+
+  strength = ucol_getStrength(p);
+  if( strength>UCOL_TERTIARY
+   || ucol_getAttribute(p, UCOL_ALTERNATE_HANDLING, &status)!=UCOL_NON_IGNORABLE
+   || ucol_getAttribute(p, UCOL_FRENCH_COLLATION, &status)!=UCOL_OFF
+   || ucol_getAttribute(p, UCOL_CASE_LEVEL, &status)!=UCOL_OFF
+   || ucol_getAttribute(p, UCOL_NUMERIC_COLLATION, &status)!=UCOL_OFF
+   || !U_SUCCESS(status)
+  ){
+    return;
+  }
+
+  pContractions = uset_openEmpty();
+  pExpansions = uset_openEmpty();
+  ucol_getContractionsAndExpansions(p, pContractions, pExpansions, 1, &status);
+  if( !U_SUCCESS(status) ){
+    uset_close(pContractions);
+    uset_close(pExpansions);
+    return;
+  }
+
+  for(c=0; c<128; c++){
+    const UChar ch = (UChar)c;
+    const uint8_t *zPrimary;
+    int nPrimary;
+    int nKey = ucol_getSortKey(p, &ch, 1, aKey[c], (int)sizeof(aKey[c]));
+    aSimple[c] = nKey>0 && nKey<=(int)sizeof(aKey[c])
+              && !uset_contains(pExpansions, c);
+    if( aSimple[c] ){
+      icuSortKeyLevel(aKey[c], 0, &zPrimary, &nPrimary);
+      aSimple[c] = nPrimary>0;
+    }
+  }
+
+  /* Exclude characters starting or ending a contraction or prefix rule */
+  for(c=0; c<uset_getItemCount(pContractions); c++){
+    UChar aStr[32];
+    UChar32 start, end;
+    int nStr = uset_getItem(pContractions, c, &start, &end, aStr, 32, &status);
+    if( !U_SUCCESS(status) ){
+      break;
+    }
+    if( nStr>0 ){
+      int j;
+      for(j=0; j<nStr; j++){
+        if( aStr[j]<128 ) aSimple[aStr[j]] = 0;
+      }
+    }else{
+      for(; start<=end && start<128; start++) aSimple[start] = 0;
+    }
+  }
+  uset_close(pContractions);
+  uset_close(pExpansions);
+  if( !U_SUCCESS(status) ){
+    return;
+  }
+
+  /* Rank is 1 + number of distinct smaller weights. Weights of each
+  ** level are sorted so equal weights are adjacent and get the same rank. */
+  for(iLevel=0; iLevel<=(int)strength; iLevel++){
+    IcuAsciiWeight aWeight[128];
+    int nWeight = 0;
+    int rank = 0;
+    int i;
+    for(c=0; c<128; c++){
+      if( !aSimple[c] ) continue;
+      icuSortKeyLevel(aKey[c], iLevel, &aWeight[nWeight].z, &aWeight[nWeight].n);
+      aWeight[nWeight].c = c;
+      nWeight++;
+    }
+    qsort(aWeight, nWeight, sizeof(aWeight[0]), icuAsciiWeightCompare);
+    for(i=0; i<nWeight; i++){
+      if( i==0 || icuAsciiWeightCompare(&aWeight[i-1], &aWeight[i])!=0 ) rank++;
+      pColl->aRank[iLevel][aWeight[i].c] = (uint8_t)rank;
+    }
+  }
+  pColl->nLevel = (int)strength + 1;
+}
+
+/*
+** Compares ASCII strings using the fast path tables of pColl. Returns 0
+** and sets *pRes to the result on success. Returns 1 if the strings are
+** not ASCII or contain characters that are not supported by the fast path.
+*/
+static int icuCollationCollAscii(
+  const IcuCollation *pColl,
+  const uint8_t *zLeft,
+  int nLeft,
+  const uint8_t *zRight,
+  int nRight,
+  int *pRes
+){
+  const int n = nLeft<nRight ? nLeft : nRight;
+  int iLevel;
+  int i;
+
+  if( pColl->nLevel==0 ) return 1;
+  for(i=0; i<nLeft; i++){
+    if( zLeft[i]>=128 || pColl->aRank[0][zLeft[i]]==0 ) return 1;
+  }
+  for(i=0; i<nRight; i++){
+    if( zRight[i]>=128 || pColl->aRank[0][zRight[i]]==0 ) return 1;
+  }
+  for(iLevel=0; iLevel<pColl->nLevel; iLevel++){
+    const uint8_t *aRank = pColl->aRank[iLevel];
+    for(i=0; i<n; i++){
+      if( aRank[zLeft[i]]!=aRank[zRight[i]] ){
+        *pRes = aRank[zLeft[i]]<aRank[zRight[i]] ? -1 : +1;
+        return 0;
+      }
+    }
+    if( nLeft!=nRight ){
+      *pRes = nLeft<nRight ? -1 : +1;
+      return 0;
+    }
+  }
+  *pRes = 0;
+  return 0;
+}
+
 /*
 ** Collation sequence destructor function. The pCtx argument points to
-** a UCollator structure previously allocated using ucol_open().
+** an IcuCollation structure previously allocated using icuLoadCollation().
 */
 static void icuCollationDel(void *pCtx){
-  UCollator *p = (UCollator *)pCtx;
-  ucol_close(p);
+  IcuCollation *p = (IcuCollation *)pCtx;
+  ucol_close(p->pCollator);
+  sqlite3_free(p);
 }
 
 /*
-** Collation sequence comparison function. The pCtx argument points to
-** a UCollator structure previously allocated using ucol_open().
+** Collation sequence comparison function for UTF-8 strings. The pCtx
+** argument points to an IcuCollation structure previously allocated
+** using icuLoadCollation().
 */
 static int icuCollationColl(
   void *pCtx,
@@ -390,9 +835,31 @@ static int icuCollationColl(
   int nRight,
   const void *zRight
 ){
+  UErrorCode status = U_ZERO_ERROR;
   UCollationResult res;
-  UCollator *p = (UCollator *)pCtx;
-  res = ucol_strcoll(p, (UChar *)zLeft, nLeft/2, (UChar *)zRight, nRight/2);
+  IcuCollation *p = (IcuCollation *)pCtx;
+  int asciiRes;
+
+  if( nLeft==nRight && memcmp(zLeft, zRight, nLeft)==0 ){
+    return 0;
+  }
+  if( icuCollationCollAscii(p, (const uint8_t *)zLeft, nLeft,
+                            (const uint8_t *)zRight, nRight, &asciiRes)==0 ){
+    return asciiRes;
+  }
+#if U_ICU_VERSION_MAJOR_NUM>=50
+  res = ucol_strcollUTF8(p->pCollator, (const char *)zLeft, nLeft,
+                         (const char *)zRight, nRight, &status);
+#else
+  {
+    UCharIterator iterLeft;
+    UCharIterator iterRight;
+    uiter_setUTF8(&iterLeft, (const char *)zLeft, nLeft);
+    uiter_setUTF8(&iterRight, (const char *)zRight, nRight);
+    res = ucol_strcollIter(p->pCollator, &iterLeft, &iterRight, &status);
+  }
+#endif
+  assert(U_SUCCESS(status));
   switch( res ){
     case UCOL_LESS:    return -1;
     case UCOL_GREATER: return +1;
@@ -414,6 +881,9 @@ static int icuCollationColl(
 ** Where <locale> is a string containing an ICU locale identifier (i.e.
 ** "en_AU", "tr_TR" etc.) and <collation-name> is the name of the
 ** collation sequence to create.
+**
+** The collation sequence is registered for UTF-8 text so no conversion
+** to UTF-16 is needed for comparing values of UTF-8 databases.
 */
 static void icuLoadCollation(
   sqlite3_context *p,
@@ -427,6 +897,7 @@ static void icuLoadCollation(
   const char *zLocale;      /* Locale identifier - (eg. "jp_JP") */
   const char *zName;        /* SQL Collation sequence name (eg. "japanese") */
   UCollator *pUCollator;    /* ICU library collation object */
+  IcuCollation *pColl;      /* Collation sequence context */
   int rc;                   /* Return code from sqlite3_create_collation_x() */
 
   assert(nArg==2);
@@ -444,15 +915,94 @@ static void icuLoadCollation(
   }
   assert(p);
 
-  rc = sqlite3_create_collation_v2(db, zName, SQLITE_UTF16, (void *)pUCollator,
+  pColl = (IcuCollation *)sqlite3_malloc(sizeof(IcuCollation));
+  if( !pColl ){
+    ucol_close(pUCollator);
+    sqlite3_result_error_nomem(p);
+    return;
+  }
+  pColl->pCollator = pUCollator;
+  icuCollationInitAscii(pColl);
+
+  rc = sqlite3_create_collation_v2(db, zName, SQLITE_UTF8, (void *)pColl,
       icuCollationColl, icuCollationDel
   );
   if( rc!=SQLITE_OK ){
-    ucol_close(pUCollator);
+    icuCollationDel(pColl);
     sqlite3_result_error(p, "Error registering collation function", -1);
   }
 }
 
+/*
+** Function to delete collators cached by icu_sortkey(). Registered as
+** a destructor function with sqlite3_set_auxdata().
+*/
+static void icuSortKeyCollatorDelete(void *p){
+  ucol_close((UCollator *)p);
+}
+
+/*
+** Implementation of the scalar function icu_sortkey().
+**
+** Returns ICU sort key of the first argument as a BLOB for the locale
+** given by the second argument. Byte-wise comparison of sort keys gives
+** the same result as comparing the strings with collation sequence
+** created by icu_load_collation() for the same locale, so sort keys can
+** be computed once and stored in an indexed column or used in an index
+** on expression:
+**
+**     CREATE INDEX idx ON t(icu_sortkey(name, 'de_DE'));
+**
+** The collator is cached for the statement if the locale is constant.
+*/
+static void icuSortKeyFunc(sqlite3_context *p, int nArg, sqlite3_value **apArg){
+  UErrorCode status = U_ZERO_ERROR;
+  const UChar *zInput;
+  int nInput;
+  UCollator *pUCollator;
+  uint8_t aBuf[256];
+  uint8_t *zKey = aBuf;
+  int nKey;
+
+  (void)nArg;  /* Unused parameter */
+  assert(nArg==2);
+  zInput = static_cast<const UChar *>(sqlite3_value_text16(apArg[0]));
+  if( !zInput ){
+    return;
+  }
+  nInput = sqlite3_value_bytes16(apArg[0]) / 2;
+
+  pUCollator = static_cast<UCollator *>(sqlite3_get_auxdata(p, 1));
+  if( !pUCollator ){
+    const char *zLocale = (const char *)sqlite3_value_text(apArg[1]);
+    pUCollator = ucol_open(zLocale ? zLocale : "", &status);
+    if( !U_SUCCESS(status) ){
+      icuFunctionError(p, "ucol_open", status);
+      return;
+    }
+    sqlite3_set_auxdata(p, 1, pUCollator, icuSortKeyCollatorDelete);
+    /* sqlite3_set_auxdata() may have destroyed the collator already */
+    pUCollator = static_cast<UCollator *>(sqlite3_get_auxdata(p, 1));
+    if( !pUCollator ){
+      sqlite3_result_error_nomem(p);
+      return;
+    }
+  }
+
+  nKey = ucol_getSortKey(pUCollator, zInput, nInput, zKey, (int)sizeof(aBuf));
+  if( nKey>(int)sizeof(aBuf) ){
+    zKey = static_cast<uint8_t *>(sqlite3_malloc(nKey));
+    if( !zKey ){
+      sqlite3_result_error_nomem(p);
+      return;
+    }
+    nKey = ucol_getSortKey(pUCollator, zInput, nInput, zKey, nKey);
+  }
+  /* do not store the terminating zero */
+  sqlite3_result_blob(p, zKey, nKey>0 ? nKey - 1 : 0,
+                      zKey==aBuf ? SQLITE_TRANSIENT : xFree);
+}
+
 /*
 ** Register the ICU extension functions with database db.
 */
@@ -480,6 +1030,7 @@ KDB_SQLITE_ICU_EXPORT int sqlite3IcuInit(sqlite3 *db){
     {"like",   3, SQLITE_UTF8,         nullptr, icuLikeFunc},
 
     {"icu_load_collation",  2, SQLITE_UTF8, (void*)db, icuLoadCollation},
+    {"icu_sortkey",  2, SQLITE_UTF16 | ICU_SQLITE_DETERMINISTIC, nullptr, icuSortKeyFunc},
   };
 
   int rc = SQLITE_OK;
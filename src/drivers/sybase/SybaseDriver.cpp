@@ -48,6 +48,10 @@ SybaseDriver::SybaseDriver(QObject *parent, const QVariantList &args)
     // confirm
     //beh->SELECT_1_SUBQUERY_SUPPORTED = true;
 
+    // Sybase ASE uses "SELECT TOP n" instead
+    //! @todo support TOP
+    beh->SELECT_LIMIT_SUPPORTED = false;
+
     beh->OPENING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER = '"';
     beh->CLOSING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER = '"';
 
@@ -65,6 +65,7 @@ xBaseDriver::xBaseDriver(QObject *parent, const QVariantList &args)
   beh->OPENING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER = '"';
   beh->CLOSING_QUOTATION_MARK_BEGIN_FOR_IDENTIFIER = '"';
   beh->SELECT_1_SUBQUERY_SUPPORTED = true;
+  beh->SELECT_NO_LIMIT_VALUE = "-1";
 
   // As we provide a wrapper over SQLite, this aspect will be hidden by SQLite to us.
   beh->_1ST_ROW_READ_AHEAD_REQUIRED_TO_KNOW_IF_THE_RESULT_IS_EMPTY=false;
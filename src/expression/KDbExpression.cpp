@@ -213,6 +213,16 @@ void KDbExpressionData::getQueryParameters(QList<KDbQuerySchemaParameter>* param
     Q_UNUSED(params);
 }
 
+bool KDbExpressionData::containsAggregate() const
+{
+    for (const ExplicitlySharedExpressionDataPointer &child : children) {
+        if (child && child->containsAggregate()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 bool KDbExpressionData::addToCallStack(QDebug *dbg, KDb::ExpressionCallStack* callStack) const
 {
     if (callStack->contains(this)) {
@@ -481,6 +491,11 @@ void KDbExpression::getQueryParameters(QList<KDbQuerySchemaParameter>* params)
     d->getQueryParameters(params);
 }
 
+bool KDbExpression::containsAggregate() const
+{
+    return d->containsAggregate();
+}
+
 QDebug KDbExpression::debug(QDebug dbg, KDb::ExpressionCallStack* callStack) const
 {
     if (d)
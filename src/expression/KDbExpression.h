@@ -130,6 +130,13 @@ public:
      @note @a params must not be 0. */
     void getQueryParameters(QList<KDbQuerySchemaParameter>* params);
 
+    /*! @return true if this expression or any of its subexpressions is a call of an aggregate
+     function such as SUM(X), COUNT(X), COUNT(*) or single-argument MAX(X).
+     Such expressions are only allowed in columns and in the HAVING section of a query.
+     @see KDbFunctionExpression::isBuiltInAggregate()
+     @since 3.3 */
+    bool containsAggregate() const;
+
     //! @return expression class for token @a token.
     //! @todo support more tokens
     static KDb::ExpressionClass classForToken(KDbToken token);
@@ -98,6 +98,8 @@ public:
                               KDbQuerySchemaParameterValueListIterator *params = nullptr,
                               KDb::ExpressionCallStack *callStack = nullptr) const;
     virtual void getQueryParameters(QList<KDbQuerySchemaParameter> *params);
+    //! @see KDbExpression::containsAggregate()
+    virtual bool containsAggregate() const;
     bool validate(KDbParseInfo *parseInfo);
     virtual KDbExpressionData* clone();
 
@@ -330,10 +332,14 @@ public:
     ExplicitlySharedExpressionDataPointer args;
 
     void getQueryParameters(QList<KDbQuerySchemaParameter> *params) override;
+    bool containsAggregate() const override;
     KDbFunctionExpressionData* clone() override;
 
     void setArguments(ExplicitlySharedExpressionDataPointer arguments);
 
+    //! @return true if this is a call of aggregate function, e.g. SUM(X) or single-argument MAX(X)
+    bool isAggregate() const;
+
     static KDbEscapedString toString(const QString &name,
                                      const KDbDriver *driver,
                                      const KDbNArgExpressionData *args,
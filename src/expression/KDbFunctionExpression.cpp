@@ -375,6 +375,78 @@ private:
     Q_DISABLE_COPY(CeilingFloorFunctionDeclaration)
 };
 
+//! @return true if @a f is COUNT(*), i.e. COUNT() function with asterisk as the only argument
+static bool isCountAsterisk(const KDbFunctionExpressionData *f)
+{
+    if (f->name != QLatin1String("COUNT") || f->args->children.count() != 1) {
+        return false;
+    }
+    const KDbVariableExpressionData *var
+        = f->args->children.at(0)->convertConst<KDbVariableExpressionData>();
+    return var && var->name == QLatin1String("*");
+}
+
+//! Declaration of a single built-in aggregate function: COUNT(X), COUNT(*), SUM(X), AVG(X),
+//! and single-argument MIN(X) and MAX(X).
+//! Its return type is:
+//! - BigInteger for COUNT()
+//! - BigInteger for SUM() of integers, Double for SUM() of floating-point numbers
+//! - Double for AVG()
+//! - type of the argument for MIN() and MAX()
+//! - NULL if the argument is NULL (except for COUNT())
+//! - InvalidType if the argument contains another aggregate function
+class AggregateFunctionDeclaration : public BuiltInFunctionDeclaration
+{
+    Q_DECLARE_TR_FUNCTIONS(AggregateFunctionDeclaration)
+public:
+    AggregateFunctionDeclaration() {}
+    KDbField::Type returnType(const KDbFunctionExpressionData* f, KDbParseInfo* parseInfo) const override {
+        const KDbNArgExpressionData *argsData = f->args.constData()->convertConst<KDbNArgExpressionData>();
+        if (argsData->children.count() != 1) {
+            return KDbField::InvalidType;
+        }
+        const ExplicitlySharedExpressionDataPointer arg = argsData->children.at(0);
+        if (arg->containsAggregate()) {
+            if (parseInfo) {
+                parseInfo->setErrorMessage(
+                    tr("Nested aggregate functions are not allowed"));
+                parseInfo->setErrorDescription(
+                    tr("Argument of %1() function cannot contain aggregate function.").arg(f->name));
+            }
+            return KDbField::InvalidType;
+        }
+        if (f->name == QLatin1String("COUNT")) {
+            return KDbField::BigInteger;
+        }
+        KDbQueryParameterExpressionData *queryParameterExpressionData
+            = arg->convert<KDbQueryParameterExpressionData>();
+        if (queryParameterExpressionData) {
+            // Set query parameter type to deduced result type
+            //! @todo Most likely but can be also other type
+            queryParameterExpressionData->m_type = KDbField::Double;
+        }
+        const KDbField::Type type = arg->type(); // cache: evaluating type of expressions can be expensive
+        if (type == KDbField::Null || type == KDbField::InvalidType) {
+            return type;
+        }
+        if (f->name == QLatin1String("AVG")) {
+            return KDbField::Double;
+        }
+        if (f->name == QLatin1String("SUM")) {
+            if (KDbField::isFPNumericType(type)) {
+                return KDbField::Double;
+            }
+            if (KDbField::isIntegerType(type)) {
+                return KDbField::BigInteger;
+            }
+            return KDbField::InvalidType;
+        }
+        return type; // MIN(X), MAX(X)
+    }
+private:
+    Q_DISABLE_COPY(AggregateFunctionDeclaration)
+};
+
 //! A map of built-in SQL functions
 //! See https://community.kde.org/Kexi/Plugins/Queries/SQL_Functions for the status.
 class BuiltInFunctions
@@ -384,12 +456,15 @@ public:
     ~BuiltInFunctions()
     {
         qDeleteAll(m_functions);
+        qDeleteAll(m_aggregates);
     }
 
-    //! @return function declaration's structure for name @a name
+    //! @return function declaration's structure for name @a name called with
+    //! @a argumentCount arguments.
     //! If @a name is alias of the function, e.g. "MIN" for "LEAST", the original
-    //! function's declaration is returned.
-    BuiltInFunctionDeclaration* value(const QString &name) const;
+    //! function's declaration is returned. Aggregate variants of functions,
+    //! e.g. single-argument "MIN", are returned if @a argumentCount is 1.
+    BuiltInFunctionDeclaration* value(const QString &name, int argumentCount) const;
 
     //! @return a list of function aliases.
     QStringList aliases() const;
@@ -398,6 +473,8 @@ public:
 private:
     QHash<QString, BuiltInFunctionDeclaration*> m_functions;
     QHash<QString, BuiltInFunctionDeclaration*> m_aliases;
+    //! Single-argument aggregate variants of functions from m_aliases
+    QHash<QString, BuiltInFunctionDeclaration*> m_aggregates;
     Q_DISABLE_COPY(BuiltInFunctions)
 };
 
@@ -441,6 +518,14 @@ BuiltInFunctions::BuiltInFunctions()
     decl->copyReturnTypeFromArg = 0;
     _SIG(abs_1, argAnyNumberOrNull);
 
+    m_functions.insert(QLatin1String("AVG"), decl = new AggregateFunctionDeclaration);
+    // From https://www.sqlite.org/lang_aggfunc.html
+    /* The avg() function returns the average value of all non-NULL X within a group.
+     The result of avg() is always a floating point value as long as at there is at least
+     one non-NULL input even if all inputs are integers. */
+    // example: SELECT owner, AVG(price) FROM cars GROUP BY owner
+    _SIG(avg_1, argAnyNumberOrNull);
+
     m_functions.insert(QLatin1String("CEILING"), decl = new CeilingFloorFunctionDeclaration);
     /* ceiling(X) returns the largest integer value not less than X. */
     // See also https://dev.mysql.com/doc/refman/5.1/en/mathematical-functions.html#function_ceiling
@@ -471,6 +556,16 @@ BuiltInFunctions::BuiltInFunctions()
     static int coalesce_min_args[] = { 2 };
     _SIG(coalesce_N, argAnyOrNull, multipleArgs, coalesce_min_args);
 
+    m_functions.insert(QLatin1String("COUNT"), decl = new AggregateFunctionDeclaration);
+    // From https://www.sqlite.org/lang_aggfunc.html
+    /* The count(X) function returns a count of the number of times that X is not NULL
+     in a group. */
+    /* count(*) function (without arguments) returns the total number of rows in the group. */
+    //! @todo support COUNT(DISTINCT X)
+    // example: SELECT owner, COUNT(id) FROM cars GROUP BY owner
+    // example: SELECT COUNT(*) FROM cars
+    _SIG(count_1, argAnyOrNull);
+
     m_functions.insert(QLatin1String("FLOOR"), decl = new CeilingFloorFunctionDeclaration);
     /* floor(X) returns the largest integer value not greater than X. */
     // See also https://dev.mysql.com/doc/refman/5.1/en/mathematical-functions.html#function_floor
@@ -514,6 +609,14 @@ BuiltInFunctions::BuiltInFunctions()
     static int greatest_min_args[] = { 2 };
     _SIG(greatest_N, argAnyOrNull, multipleArgs, greatest_min_args);
 
+    m_aggregates.insert(QLatin1String("MAX"), decl = new AggregateFunctionDeclaration);
+    // From https://www.sqlite.org/lang_aggfunc.html
+    /* The max() aggregate function returns the maximum value of all values in the group.
+     Aggregate max() returns NULL if and only if there are no non-NULL values in the group. */
+    // Single-argument MAX(X) is the aggregate function; MAX(X,Y,...) is an alias of GREATEST().
+    // example: SELECT owner, MAX(id) FROM cars GROUP BY owner
+    _SIG(max_1, argAnyOrNull);
+
     m_functions.insert(QLatin1String("HEX"), decl = new BuiltInFunctionDeclaration);
     // From https://www.sqlite.org/lang_corefunc.html
     // See also https://dev.mysql.com/doc/refman/5.1/en/string-functions.html#function_hex
@@ -584,6 +687,15 @@ BuiltInFunctions::BuiltInFunctions()
     static int least_min_args[] = { 2 };
     _SIG(least_N, argAnyOrNull, multipleArgs, least_min_args);
 
+    m_aggregates.insert(QLatin1String("MIN"), decl = new AggregateFunctionDeclaration);
+    // From https://www.sqlite.org/lang_aggfunc.html
+    /* The min() aggregate function returns the minimum non-NULL value of all values in
+     the group. Aggregate min() returns NULL if and only if there are no non-NULL values
+     in the group. */
+    // Single-argument MIN(X) is the aggregate function; MIN(X,Y,...) is an alias of LEAST().
+    // example: SELECT owner, MIN(id) FROM cars GROUP BY owner
+    _SIG(min_1, argAnyOrNull);
+
     m_functions.insert(QLatin1String("LENGTH"), decl = new BuiltInFunctionDeclaration);
     // From https://www.sqlite.org/lang_corefunc.html
     // See also https://dev.mysql.com/doc/refman/5.1/en/string-functions.html#function_length
@@ -729,6 +841,13 @@ BuiltInFunctions::BuiltInFunctions()
     _SIG(substr_3, argAnyTextOrNull, argAnyIntOrNull, argAnyIntOrNull);
     decl->copyReturnTypeFromArg = 0;
 
+    m_functions.insert(QLatin1String("SUM"), decl = new AggregateFunctionDeclaration);
+    // From https://www.sqlite.org/lang_aggfunc.html
+    /* The sum() aggregate function returns the sum of all non-NULL values in the group.
+     If there are no non-NULL input rows then sum() returns NULL. */
+    // example: SELECT owner, SUM(price) FROM cars GROUP BY owner
+    _SIG(sum_1, argAnyNumberOrNull);
+
      m_functions.insert(QLatin1String("TRIM"), decl = new BuiltInFunctionDeclaration);
      // From https://www.sqlite.org/lang_corefunc.html
      /* The trim(X,Y) function returns a string formed by removing any and all characters
@@ -798,9 +917,12 @@ BuiltInFunctions::BuiltInFunctions()
 #endif
 }
 
-BuiltInFunctionDeclaration* BuiltInFunctions::value(const QString &name) const
+BuiltInFunctionDeclaration* BuiltInFunctions::value(const QString &name, int argumentCount) const
 {
     BuiltInFunctionDeclaration* f = m_functions.value(name);
+    if (!f && argumentCount == 1) {
+        f = m_aggregates.value(name);
+    }
     if (!f) {
         f = m_aliases.value(name);
     }
@@ -888,6 +1010,9 @@ KDbEscapedString KDbFunctionExpressionData::toStringInternal(
             return driver->lengthFunctionToString(KDbNArgExpression(args), params, callStack);
         }
     }
+    else if (isAggregate()) {
+        // don't change aggregate functions such as single-argument MIN/MAX
+    }
     else if (name == QLatin1String("GREATEST") || name == QLatin1String("MAX")
              || name == QLatin1String("LEAST") || name == QLatin1String("MIN"))
     {
@@ -921,10 +1046,25 @@ void KDbFunctionExpressionData::getQueryParameters(QList<KDbQuerySchemaParameter
     args->getQueryParameters(params);
 }
 
+bool KDbFunctionExpressionData::isAggregate() const
+{
+    if (!KDbFunctionExpression::isBuiltInAggregate(name)) {
+        return false;
+    }
+    // multiple-argument MIN/MAX are aliases of LEAST/GREATEST
+    return args->children.count() == 1
+        || (name != QLatin1String("MIN") && name != QLatin1String("MAX"));
+}
+
+bool KDbFunctionExpressionData::containsAggregate() const
+{
+    return isAggregate() || KDbExpressionData::containsAggregate();
+}
+
 KDbField::Type KDbFunctionExpressionData::typeInternal(KDb::ExpressionCallStack* callStack) const
 {
     Q_UNUSED(callStack);
-    const BuiltInFunctionDeclaration *decl = _builtInFunctions->value(name);
+    const BuiltInFunctionDeclaration *decl = _builtInFunctions->value(name, args->children.count());
     if (decl) {
         return decl->returnType(this, nullptr);
     }
@@ -1153,10 +1293,13 @@ bool KDbFunctionExpressionData::validateInternal(KDbParseInfo *parseInfo,
     if (name.isEmpty()) {
         return false;
     }
-    const BuiltInFunctionDeclaration *decl = _builtInFunctions->value(name);
+    const BuiltInFunctionDeclaration *decl = _builtInFunctions->value(name, args->children.count());
     if (!decl) {
         return false;
     }
+    if (isCountAsterisk(this)) { // asterisk has no type to check
+        return true;
+    }
     const KDbNArgExpressionData *argsData = args->convertConst<KDbNArgExpressionData>();
     if (argsData->containsInvalidArgument()) {
         return false;
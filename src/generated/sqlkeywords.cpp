@@ -106,3 +106,19 @@ const char* const KDbDriverPrivate::kdbSQLKeywords[] = {
     "WHEN",
     nullptr
 };
+
+static const quint16 kdbSQLKeywordsHashSeeds[] = {
+    0, 2, 6, 1, 77, 2, 5, 3, 6, 2, 6, 48, 29, 22, 0, 0, 19, 41, 4, 20,
+};
+
+static const qint16 kdbSQLKeywordsHashSlots[] = {
+    -1, 54, 62, 49, 3, 15, 59, 32, 22, 64, 29, 58, 47, 74, 4, 2, 42, 5, 34, 56, 44, 6, 41, 8,
+    76, 50, 51, 24, -1, -1, 9, 25, -1, 43, 36, -1, 27, 28, 30, 48, 75, -1, -1, 19, 66, 37, 26,
+    65, 33, -1, 23, 53, -1, 17, 73, -1, 7, 67, 0, -1, 57, 12, 35, 61, 18, 55, 20, 14, 16, 11,
+    13, 38, 60, -1, -1, -1, 68, 63, -1, 31, -1, 46, 69, -1, 52, 10, -1, -1, 71, 40, 39, 21,
+    72, 45, 70, -1, 1,
+};
+
+const KDbUtils::StaticSetOfStrings::HashTable KDbDriverPrivate::kdbSQLKeywordsHash = {
+    KDbDriverPrivate::kdbSQLKeywords, kdbSQLKeywordsHashSeeds, kdbSQLKeywordsHashSlots, 20, 97
+};
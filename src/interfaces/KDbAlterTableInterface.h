@@ -0,0 +1,100 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_ALTERTABLE_IFACE_H
+#define KDB_ALTERTABLE_IFACE_H
+
+#include <QList>
+#include <QVariant>
+
+#include "KDbEscapedString.h"
+#include "KDbTristate.h"
+
+class KDbField;
+class KDbTableSchema;
+
+/*! Interface of connections able to alter tables in place using native statements.
+ KDbAlterTableHandler uses it instead of recreating tables and copying their records.
+ Connection classes of drivers inherit it in addition to KDbConnection.
+ Actions that a driver does not implement return @c cancelled, the table is recreated then.
+ @since 3.3 */
+class KDB_EXPORT KDbAlterTableInterface
+{
+public:
+    virtual ~KDbAlterTableInterface();
+
+protected:
+    KDbAlterTableInterface() {}
+
+    /*! Appends to @a statements native statements renaming @a field of @a table to @a newName.
+     The statements are executed later in order of the altering actions, so @a table
+     reflects changes of the previous actions.
+     @return true on success, false on failure, cancelled if the field cannot be renamed
+     in place, the table is recreated then. */
+    virtual tristate drv_renameFieldStatements(KDbTableSchema* table, KDbField* field,
+            const QString& newName, QList<KDbEscapedString> *statements) {
+        Q_UNUSED(table); Q_UNUSED(field); Q_UNUSED(newName); Q_UNUSED(statements);
+        return cancelled;
+    }
+
+    /*! Like drv_renameFieldStatements() but appends statements inserting @a field
+     to @a table at position @a index.
+     @a field is not yet a member of @a table. */
+    virtual tristate drv_insertFieldStatements(KDbTableSchema* table, const KDbField* field,
+            int index, QList<KDbEscapedString> *statements) {
+        Q_UNUSED(table); Q_UNUSED(field); Q_UNUSED(index); Q_UNUSED(statements);
+        return cancelled;
+    }
+
+    /*! Like drv_renameFieldStatements() but appends statements removing @a field
+     from @a table. */
+    virtual tristate drv_removeFieldStatements(KDbTableSchema* table, KDbField* field,
+            QList<KDbEscapedString> *statements) {
+        Q_UNUSED(table); Q_UNUSED(field); Q_UNUSED(statements);
+        return cancelled;
+    }
+
+    /*! Like drv_renameFieldStatements() but appends statements setting property
+     @a propertyName of @a field to @a value, e.g. changing type of the column or setting
+     its default value. Properties are named like in KDb::setFieldProperty().
+     Statements are not needed for properties that are only stored in KDb schema,
+     @c true can be returned for them. */
+    virtual tristate drv_changeFieldPropertyStatements(KDbTableSchema* table, KDbField* field,
+            const QString& propertyName, const QVariant& value,
+            QList<KDbEscapedString> *statements) {
+        Q_UNUSED(table); Q_UNUSED(field); Q_UNUSED(propertyName); Q_UNUSED(value);
+        Q_UNUSED(statements);
+        return cancelled;
+    }
+
+    /*! Like drv_renameFieldStatements() but appends statements moving @a field
+     of @a table to position @a index. The position is counted after removing @a field
+     from the table, as in KDbFieldList::moveField(). */
+    virtual tristate drv_moveFieldStatements(KDbTableSchema* table, KDbField* field,
+            int index, QList<KDbEscapedString> *statements) {
+        Q_UNUSED(table); Q_UNUSED(field); Q_UNUSED(index); Q_UNUSED(statements);
+        return cancelled;
+    }
+
+    friend class KDbAlterTableHandler;
+private:
+    Q_DISABLE_COPY(KDbAlterTableInterface)
+};
+
+#endif
@@ -0,0 +1,89 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_BLOB_IFACE_H
+#define KDB_BLOB_IFACE_H
+
+#include "KDbResult.h"
+#include "KDbEscapedString.h"
+
+class KDbField;
+class KDbTableSchema;
+
+/*! Interface for backend-dependent implementations of incremental BLOB access.
+ @see KDbBlobStream
+ @since 3.3 */
+class KDB_EXPORT KDbBlobInterface : public KDbResultable
+{
+protected:
+    KDbBlobInterface() {}
+    ~KDbBlobInterface() override {}
+
+    /*! For implementation. Opens value of @a field of @a table in the record that matches
+     the @a where condition. The condition compares primary key fields with their values,
+     it is already escaped. If @a writable is true, the value will be modified.
+     Failure to find the record should be reported as ERR_OBJECT_NOT_FOUND. */
+    virtual bool open(KDbTableSchema *table, KDbField *field, const KDbEscapedString &where,
+                      bool writable) = 0;
+
+    //! For implementation. @return size of the value in bytes (0 for NULL), -1 on error
+    virtual qint64 size() = 0;
+
+    /*! For implementation. Reads up to @a maxSize bytes starting at @a offset to @a data.
+     @a offset is not greater than size().
+     @return number of bytes read or -1 on error. */
+    virtual qint64 read(qint64 offset, char *data, qint64 maxSize) = 0;
+
+    /*! For implementation. Overwrites @a size bytes starting at @a offset with @a data.
+     @a offset is not greater than size(); the value is enlarged if needed. */
+    virtual bool write(qint64 offset, const char *data, qint64 size) = 0;
+
+    /*! For implementation. Changes size of the value to @a size bytes.
+     Existing bytes within the new size are kept, new bytes are zero. */
+    virtual bool resize(qint64 size) = 0;
+
+    friend class KDbBlobStream;
+    friend class KDbConnection;
+private:
+    Q_DISABLE_COPY(KDbBlobInterface)
+};
+
+/*! Interface of connections supporting incremental BLOB access.
+ Connection classes of drivers inherit it in addition to KDbConnection and create
+ their KDbBlobInterface implementations in createBlobInterface().
+ @see KDbConnection::openBlob()
+ @since 3.3 */
+class KDB_EXPORT KDbBlobInterfaceFactory
+{
+public:
+    virtual ~KDbBlobInterfaceFactory();
+
+protected:
+    KDbBlobInterfaceFactory() {}
+
+    /*! For implementation. Creates a KDbBlobInterface-derived object used by
+     KDbConnection::openBlob(). Ownership of the returned object is passed to the caller. */
+    virtual KDbBlobInterface* createBlobInterface() /*Q_REQUIRED_RESULT*/ = 0;
+
+    friend class KDbConnection;
+private:
+    Q_DISABLE_COPY(KDbBlobInterfaceFactory)
+};
+
+#endif
@@ -0,0 +1,50 @@
+/* This file is part of the KDE project
+   Copyright (C) 2026 agent <agent@local>
+
+   This program is free software; you can redistribute it and/or
+   modify it under the terms of the GNU Library General Public
+   License as published by the Free Software Foundation; either
+   version 2 of the License, or (at your option) any later version.
+
+   This program is distributed in the hope that it will be useful,
+   but WITHOUT ANY WARRANTY; without even the implied warranty of
+   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+   Library General Public License for more details.
+
+   You should have received a copy of the GNU Library General Public License
+   along with this program; see the file COPYING.  If not, write to
+   the Free Software Foundation, Inc., 51 Franklin Street, Fifth Floor,
+ * Boston, MA 02110-1301, USA.
+*/
+
+#ifndef KDB_CANCELQUERY_IFACE_H
+#define KDB_CANCELQUERY_IFACE_H
+
+#include <QtGlobal>
+
+#include "kdb_export.h"
+
+/*! Interface of connections able to cancel statements being executed.
+ Connection classes of drivers inherit it in addition to KDbConnection.
+ @see KDbConnection::cancelQuery()
+ @since 3.3 */
+class KDB_EXPORT KDbCancelQueryInterface
+{
+public:
+    virtual ~KDbCancelQueryInterface();
+
+protected:
+    KDbCancelQueryInterface() {}
+
+    /*! For implementation: cancels statement that is being executed by the connection.
+     It is called from a thread other than the one executing the statement so only thread-safe
+     APIs of the backend should be used and result of the connection must not be altered.
+     @return @c true if the request has been delivered to the database backend. */
+    virtual bool drv_cancelQuery() = 0;
+
+    friend class KDbConnection;
+private:
+    Q_DISABLE_COPY(KDbCancelQueryInterface)
+};
+
+#endif
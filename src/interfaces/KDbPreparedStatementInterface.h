@@ -53,6 +53,22 @@ protected:
         KDbFieldList* insertFieldList,
         const KDbPreparedStatementParameters& parameters) /*Q_REQUIRED_RESULT*/ = 0;
 
+    /*! For implementation, executes the prepared statement once for each of @a recordCount
+     records. Value of parameter @c i for record @c j is columns[i][j], missing values are NULL.
+     Execution stops at the first failing record, its index is stored in @a failedRecord.
+     Total number of affected records is added to @a affectedRecords. On failure result()
+     is set and @a failedRecord is set to the index of the failing record.
+     The default implementation calls execute() for every record. It counts one affected
+     record per INSERT and sets @a affectedRecords to -1 for UPDATE and DELETE statements
+     since execute() does not report their number of records. Backends reimplement this
+     method to avoid per-record overhead and to report exact numbers.
+     @since 3.3 */
+    virtual bool executeBatch(KDbPreparedStatement::Type type,
+                              const KDbField::List& fieldList,
+                              KDbFieldList* insertFieldList,
+                              const KDbPreparedStatementColumns& columns,
+                              int recordCount, qint64 *affectedRecords, int *failedRecord);
+
     friend class KDbConnection;
     friend class KDbPreparedStatement;
 private:
@@ -503,8 +503,28 @@ KDbQuerySchema* buildSelectQuery(
                 setError(parseInfo.errorMessage(), parseInfo.errorDescription());
                 return nullptr;
             }
+            if (options->whereExpr.containsAggregate()) {
+                setError(KDbParser::tr("Aggregate function not allowed in WHERE section"),
+                         KDbParser::tr("Use HAVING section for conditions containing aggregate functions."));
+                return nullptr;
+            }
             KDbQuerySchemaPrivate::setWhereExpressionInternal(querySchema, options->whereExpr);
         }
+        //----- GROUP BY, HAVING
+        QString errorMessage;
+        QString errorDescription;
+        if (!options->groupByExprs.isEmpty()
+            && !querySchema->setGroupByExpressions(options->groupByExprs, &errorMessage, &errorDescription))
+        {
+            setError(errorMessage, errorDescription);
+            return nullptr;
+        }
+        if (!options->havingExpr.isNull()
+            && !querySchema->setHavingExpression(options->havingExpr, &errorMessage, &errorDescription))
+        {
+            setError(errorMessage, errorDescription);
+            return nullptr;
+        }
         //----- ORDER BY
         if (options->orderByColumns) {
             KDbOrderByColumnList *orderByColumnList = querySchema->orderByColumnList();
@@ -545,6 +565,18 @@ KDbQuerySchema* buildSelectQuery(
                 }
             }
         }
+        //----- LIMIT, OFFSET
+        querySchema->setLimit(options->limit);
+        querySchema->setOffset(options->offset);
+    }
+    //----- columns of grouped query
+    {
+        QString errorMessage;
+        QString errorDescription;
+        if (!KDbQuerySchemaPrivate::validateGrouping(querySchema, &errorMessage, &errorDescription)) {
+            setError(errorMessage, errorDescription);
+            return nullptr;
+        }
     }
 // kdbDebug() << "Select ColViews=" << (colViews ? colViews->debugString() : QString())
 //  << " Tables=" << (tablesList ? tablesList->debugString() : QString()s);
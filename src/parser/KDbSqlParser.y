@@ -18,6 +18,8 @@
    Boston, MA 02110-1301, USA.
 */
 
+%define parse.error verbose
+
 // To keep binary compatibility, do not reorder tokens! Add new only at the end.
 %token SQL_TYPE
 %token AS
@@ -416,6 +418,9 @@
 %type <sortOrderValue> OrderByOption
 %type <variantValue> OrderByColumnId
 %type <selectOptions> SelectOptions
+%type <selectOptions> SelectConditions
+%type <selectOptions> LimitClause
+%type <selectOptions> GroupByClause
 %type <expr> FlatTable
 %type <exprList> Tables
 %type <exprList> FlatTableList
@@ -539,6 +544,10 @@ int yylex();
 //%nonassoc    FALSE_P
 
 // <-- To keep binary compatibility insert new tokens here.
+%token LIMIT
+%token OFFSET
+%token GROUP
+%token HAVING
 
 /*
  * These might seem to be low-precedence, but actually they are not part
@@ -742,7 +751,20 @@ SELECT
 }
 ;
 
-SelectOptions: /* todo: more options (having, group by, limit...) */
+SelectOptions:
+SelectConditions
+| LimitClause
+| SelectConditions LimitClause
+{
+    sqlParserDebug() << "SelectConditions LimitClause";
+    $$ = $1;
+    $$->limit = $2->limit;
+    $$->offset = $2->offset;
+    delete $2;
+}
+;
+
+SelectConditions:
 WhereClause
 {
     sqlParserDebug() << "WhereClause";
@@ -772,6 +794,28 @@ WhereClause
     delete $4;
     $$->orderByColumns = $3;
 }
+| GroupByClause
+| WhereClause GroupByClause
+{
+    sqlParserDebug() << "WhereClause GroupByClause";
+    $$ = $2;
+    $$->whereExpr = *$1;
+    delete $1;
+}
+| GroupByClause ORDER BY OrderByClause
+{
+    sqlParserDebug() << "GroupByClause ORDER BY OrderByClause";
+    $$ = $1;
+    $$->orderByColumns = $4;
+}
+| WhereClause GroupByClause ORDER BY OrderByClause
+{
+    sqlParserDebug() << "WhereClause GroupByClause ORDER BY OrderByClause";
+    $$ = $2;
+    $$->whereExpr = *$1;
+    delete $1;
+    $$->orderByColumns = $5;
+}
 ;
 
 WhereClause:
@@ -781,6 +825,58 @@ WHERE aExpr
 }
 ;
 
+GroupByClause:
+GROUP BY aExprList2
+{
+    sqlParserDebug() << "GROUP BY" << *$3;
+    $$ = new SelectOptionsInternal;
+    for (int i = 0; i < $3->argCount(); ++i) {
+        $$->groupByExprs.append($3->arg(i));
+    }
+    delete $3;
+}
+| GROUP BY aExprList2 HAVING aExpr
+{
+    sqlParserDebug() << "GROUP BY" << *$3 << "HAVING" << *$5;
+    $$ = new SelectOptionsInternal;
+    for (int i = 0; i < $3->argCount(); ++i) {
+        $$->groupByExprs.append($3->arg(i));
+    }
+    delete $3;
+    $$->havingExpr = *$5;
+    delete $5;
+}
+| HAVING aExpr
+{
+    sqlParserDebug() << "HAVING" << *$2;
+    $$ = new SelectOptionsInternal;
+    $$->havingExpr = *$2;
+    delete $2;
+}
+;
+
+LimitClause:
+LIMIT INTEGER_CONST
+{
+    sqlParserDebug() << "LIMIT" << $2;
+    $$ = new SelectOptionsInternal;
+    $$->limit = $2;
+}
+| LIMIT INTEGER_CONST OFFSET INTEGER_CONST
+{
+    sqlParserDebug() << "LIMIT" << $2 << "OFFSET" << $4;
+    $$ = new SelectOptionsInternal;
+    $$->limit = $2;
+    $$->offset = $4;
+}
+| OFFSET INTEGER_CONST
+{
+    sqlParserDebug() << "OFFSET" << $2;
+    $$ = new SelectOptionsInternal;
+    $$->offset = $2;
+}
+;
+
 /* todo: support "ORDER BY NULL" as described here https://dev.mysql.com/doc/refman/5.1/en/select.html */
 /* todo: accept expr and position as well */
 OrderByClause:
@@ -1328,6 +1424,13 @@ aExprList:
 {
     $$ = new KDbNArgExpression(KDb::ArgumentListExpression, ',');
 }
+| '(' '*' ')'
+{
+    sqlParserDebug() << "(*)";
+    // only COUNT(*) is valid, this is checked when the function is validated
+    $$ = new KDbNArgExpression(KDb::ArgumentListExpression, ',');
+    $$->append(KDbVariableExpression(QLatin1String("*")));
+}
 ;
 
 aExprList2:
@@ -65,12 +65,16 @@ struct OrderByColumnInternal
 
 //! @internal
 struct SelectOptionsInternal {
-    SelectOptionsInternal() : orderByColumns(nullptr) {}
+    SelectOptionsInternal() : orderByColumns(nullptr), limit(-1), offset(0) {}
     ~SelectOptionsInternal() {
         delete orderByColumns; // delete because this is internal temp. structure
     }
     KDbExpression whereExpr;
     QList<OrderByColumnInternal>* orderByColumns;
+    QList<KDbExpression> groupByExprs;
+    KDbExpression havingExpr;
+    qint64 limit; //!< -1 if there is no LIMIT section
+    qint64 offset;
 };
 
 class KDbExpressionPtr
@@ -58,7 +58,7 @@ cd $srcdir
 flex -ogenerated/sqlscanner.cpp KDbSqlScanner.l
 # Correct a few yy_size_t vs size_t vs int differences that some bisons cause
 sed --in-place 's/int yyleng/yy_size_t yyleng/g;s/int yyget_leng/yy_size_t yyget_leng/g;s/yyleng = (int)/yyleng = (size_t)/g;' generated/sqlscanner.cpp
-bison -d KDbSqlParser.y -Wall -fall -rall --report-file=$builddir/KDbSqlParser.output
+bison -d KDbSqlParser.y -Wall -fcaret -rall --report-file=$builddir/KDbSqlParser.output
 
 # postprocess
 cat << EOF > generated/sqlparser.h
@@ -212,6 +212,9 @@ cat << EOF >> generated/KDbToken.h
     //! @return true if this token is not equal to @a other token
     inline bool operator!=(char charToken) const { return v != charToken; }
 
+    //! Assigns a token
+    inline void operator=(char charToken) { v = charToken; }
+
     static QList<KDbToken> allTokens();
 
     // -- constants go here --
@@ -219,8 +222,10 @@ EOF
 
 function extractTokens()
 {
+    # skip YYEOF, YYUNDEF and similar tokens defined by newer bison versions
     grep -E  "    [A-Z0-9_]+ = [[:digit:]]+" generated/sqlparser.h \
-        | sed -e "s/^    //g;s/ = / /g;s/,//g"
+        | grep -v "^    YY" \
+        | sed -e "s/^    //g;s/ = / /g;s/,//g;s/[[:space:]]*\/\*.*//g"
 }
 
 extractTokens | while read token value; do
@@ -191,5 +191,9 @@ const KDbToken KDbToken::TABS_OR_SPACES(::TABS_OR_SPACES);
 const KDbToken KDbToken::DATE_TIME_INTEGER(::DATE_TIME_INTEGER);
 const KDbToken KDbToken::TIME_AM(::TIME_AM);
 const KDbToken KDbToken::TIME_PM(::TIME_PM);
+const KDbToken KDbToken::LIMIT(::LIMIT);
+const KDbToken KDbToken::OFFSET(::OFFSET);
+const KDbToken KDbToken::GROUP(::GROUP);
+const KDbToken KDbToken::HAVING(::HAVING);
 const KDbToken KDbToken::BETWEEN_AND(0x1001);
 const KDbToken KDbToken::NOT_BETWEEN_AND(0x1002);
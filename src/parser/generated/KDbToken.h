@@ -169,6 +169,10 @@ public:
     static const KDbToken DATE_TIME_INTEGER;
     static const KDbToken TIME_AM;
     static const KDbToken TIME_PM;
+    static const KDbToken LIMIT;
+    static const KDbToken OFFSET;
+    static const KDbToken GROUP;
+    static const KDbToken HAVING;
     //! Custom tokens are not used in parser but used as an extension in expression classes.
     static const KDbToken BETWEEN_AND;
     static const KDbToken NOT_BETWEEN_AND;
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 435 "KDbSqlParser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 440 "KDbSqlParser.y"
 
 #include <stdio.h>
 #include <string.h>
@@ -132,183 +137,258 @@ int yylex();
     }
 
 
-#line 136 "sqlparser.cpp" /* yacc.c:339  */
+#line 141 "sqlparser.cpp"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "KDbSqlParser.tab.h".  */
-#ifndef YY_YY_KDBSQLPARSER_TAB_H_INCLUDED
-# define YY_YY_KDBSQLPARSER_TAB_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SQL_TYPE = 258,
-    AS = 259,
-    AS_EMPTY = 260,
-    ASC = 261,
-    AUTO_INCREMENT = 262,
-    BIT = 263,
-    BITWISE_SHIFT_LEFT = 264,
-    BITWISE_SHIFT_RIGHT = 265,
-    BY = 266,
-    CHARACTER_STRING_LITERAL = 267,
-    CONCATENATION = 268,
-    CREATE = 269,
-    DESC = 270,
-    DISTINCT = 271,
-    DOUBLE_QUOTED_STRING = 272,
-    FROM = 273,
-    JOIN = 274,
-    KEY = 275,
-    LEFT = 276,
-    LESS_OR_EQUAL = 277,
-    GREATER_OR_EQUAL = 278,
-    SQL_NULL = 279,
-    SQL_IS = 280,
-    SQL_IS_NULL = 281,
-    SQL_IS_NOT_NULL = 282,
-    ORDER = 283,
-    PRIMARY = 284,
-    SELECT = 285,
-    INTEGER_CONST = 286,
-    REAL_CONST = 287,
-    RIGHT = 288,
-    SQL_ON = 289,
-    DATE_CONST = 290,
-    DATETIME_CONST = 291,
-    TIME_CONST = 292,
-    TABLE = 293,
-    IDENTIFIER = 294,
-    IDENTIFIER_DOT_ASTERISK = 295,
-    QUERY_PARAMETER = 296,
-    VARCHAR = 297,
-    WHERE = 298,
-    SQL = 299,
-    SQL_TRUE = 300,
-    SQL_FALSE = 301,
-    UNION = 302,
-    SCAN_ERROR = 303,
-    AND = 304,
-    BETWEEN = 305,
-    NOT_BETWEEN = 306,
-    EXCEPT = 307,
-    SQL_IN = 308,
-    INTERSECT = 309,
-    LIKE = 310,
-    ILIKE = 311,
-    NOT_LIKE = 312,
-    NOT = 313,
-    NOT_EQUAL = 314,
-    NOT_EQUAL2 = 315,
-    OR = 316,
-    SIMILAR_TO = 317,
-    NOT_SIMILAR_TO = 318,
-    XOR = 319,
-    UMINUS = 320,
-    TABS_OR_SPACES = 321,
-    DATE_TIME_INTEGER = 322,
-    TIME_AM = 323,
-    TIME_PM = 324
-  };
-#endif
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
-{
-#line 505 "KDbSqlParser.y" /* yacc.c:355  */
-
-    QString* stringValue;
-    QByteArray* binaryValue;
-    qint64 integerValue;
-    bool booleanValue;
-    KDbDate* dateValue;
-    KDbYear* yearValue;
-    KDbTime* timeValue;
-    KDbTime::Period timePeriodValue;
-    KDbDateTime* dateTimeValue;
-    KDbOrderByColumn::SortOrder sortOrderValue;
-    KDbField::Type colType;
-    KDbField *field;
-    KDbExpression *expr;
-    KDbNArgExpression *exprList;
-    KDbConstExpression *constExpression;
-    KDbQuerySchema *querySchema;
-    SelectOptionsInternal *selectOptions;
-    QList<OrderByColumnInternal> *orderByColumns;
-    QVariant *variantValue;
-
-#line 268 "sqlparser.cpp" /* yacc.c:355  */
+#include "KDbSqlParser.tab.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
+{
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SQL_TYPE = 3,                   /* SQL_TYPE  */
+  YYSYMBOL_AS = 4,                         /* AS  */
+  YYSYMBOL_AS_EMPTY = 5,                   /* AS_EMPTY  */
+  YYSYMBOL_ASC = 6,                        /* ASC  */
+  YYSYMBOL_AUTO_INCREMENT = 7,             /* AUTO_INCREMENT  */
+  YYSYMBOL_BIT = 8,                        /* BIT  */
+  YYSYMBOL_BITWISE_SHIFT_LEFT = 9,         /* BITWISE_SHIFT_LEFT  */
+  YYSYMBOL_BITWISE_SHIFT_RIGHT = 10,       /* BITWISE_SHIFT_RIGHT  */
+  YYSYMBOL_BY = 11,                        /* BY  */
+  YYSYMBOL_CHARACTER_STRING_LITERAL = 12,  /* CHARACTER_STRING_LITERAL  */
+  YYSYMBOL_CONCATENATION = 13,             /* CONCATENATION  */
+  YYSYMBOL_CREATE = 14,                    /* CREATE  */
+  YYSYMBOL_DESC = 15,                      /* DESC  */
+  YYSYMBOL_DISTINCT = 16,                  /* DISTINCT  */
+  YYSYMBOL_DOUBLE_QUOTED_STRING = 17,      /* DOUBLE_QUOTED_STRING  */
+  YYSYMBOL_FROM = 18,                      /* FROM  */
+  YYSYMBOL_JOIN = 19,                      /* JOIN  */
+  YYSYMBOL_KEY = 20,                       /* KEY  */
+  YYSYMBOL_LEFT = 21,                      /* LEFT  */
+  YYSYMBOL_LESS_OR_EQUAL = 22,             /* LESS_OR_EQUAL  */
+  YYSYMBOL_GREATER_OR_EQUAL = 23,          /* GREATER_OR_EQUAL  */
+  YYSYMBOL_SQL_NULL = 24,                  /* SQL_NULL  */
+  YYSYMBOL_SQL_IS = 25,                    /* SQL_IS  */
+  YYSYMBOL_SQL_IS_NULL = 26,               /* SQL_IS_NULL  */
+  YYSYMBOL_SQL_IS_NOT_NULL = 27,           /* SQL_IS_NOT_NULL  */
+  YYSYMBOL_ORDER = 28,                     /* ORDER  */
+  YYSYMBOL_PRIMARY = 29,                   /* PRIMARY  */
+  YYSYMBOL_SELECT = 30,                    /* SELECT  */
+  YYSYMBOL_INTEGER_CONST = 31,             /* INTEGER_CONST  */
+  YYSYMBOL_REAL_CONST = 32,                /* REAL_CONST  */
+  YYSYMBOL_RIGHT = 33,                     /* RIGHT  */
+  YYSYMBOL_SQL_ON = 34,                    /* SQL_ON  */
+  YYSYMBOL_DATE_CONST = 35,                /* DATE_CONST  */
+  YYSYMBOL_DATETIME_CONST = 36,            /* DATETIME_CONST  */
+  YYSYMBOL_TIME_CONST = 37,                /* TIME_CONST  */
+  YYSYMBOL_TABLE = 38,                     /* TABLE  */
+  YYSYMBOL_IDENTIFIER = 39,                /* IDENTIFIER  */
+  YYSYMBOL_IDENTIFIER_DOT_ASTERISK = 40,   /* IDENTIFIER_DOT_ASTERISK  */
+  YYSYMBOL_QUERY_PARAMETER = 41,           /* QUERY_PARAMETER  */
+  YYSYMBOL_VARCHAR = 42,                   /* VARCHAR  */
+  YYSYMBOL_WHERE = 43,                     /* WHERE  */
+  YYSYMBOL_SQL = 44,                       /* SQL  */
+  YYSYMBOL_SQL_TRUE = 45,                  /* SQL_TRUE  */
+  YYSYMBOL_SQL_FALSE = 46,                 /* SQL_FALSE  */
+  YYSYMBOL_UNION = 47,                     /* UNION  */
+  YYSYMBOL_SCAN_ERROR = 48,                /* SCAN_ERROR  */
+  YYSYMBOL_AND = 49,                       /* AND  */
+  YYSYMBOL_BETWEEN = 50,                   /* BETWEEN  */
+  YYSYMBOL_NOT_BETWEEN = 51,               /* NOT_BETWEEN  */
+  YYSYMBOL_EXCEPT = 52,                    /* EXCEPT  */
+  YYSYMBOL_SQL_IN = 53,                    /* SQL_IN  */
+  YYSYMBOL_INTERSECT = 54,                 /* INTERSECT  */
+  YYSYMBOL_LIKE = 55,                      /* LIKE  */
+  YYSYMBOL_ILIKE = 56,                     /* ILIKE  */
+  YYSYMBOL_NOT_LIKE = 57,                  /* NOT_LIKE  */
+  YYSYMBOL_NOT = 58,                       /* NOT  */
+  YYSYMBOL_NOT_EQUAL = 59,                 /* NOT_EQUAL  */
+  YYSYMBOL_NOT_EQUAL2 = 60,                /* NOT_EQUAL2  */
+  YYSYMBOL_OR = 61,                        /* OR  */
+  YYSYMBOL_SIMILAR_TO = 62,                /* SIMILAR_TO  */
+  YYSYMBOL_NOT_SIMILAR_TO = 63,            /* NOT_SIMILAR_TO  */
+  YYSYMBOL_XOR = 64,                       /* XOR  */
+  YYSYMBOL_UMINUS = 65,                    /* UMINUS  */
+  YYSYMBOL_TABS_OR_SPACES = 66,            /* TABS_OR_SPACES  */
+  YYSYMBOL_DATE_TIME_INTEGER = 67,         /* DATE_TIME_INTEGER  */
+  YYSYMBOL_TIME_AM = 68,                   /* TIME_AM  */
+  YYSYMBOL_TIME_PM = 69,                   /* TIME_PM  */
+  YYSYMBOL_LIMIT = 70,                     /* LIMIT  */
+  YYSYMBOL_OFFSET = 71,                    /* OFFSET  */
+  YYSYMBOL_GROUP = 72,                     /* GROUP  */
+  YYSYMBOL_HAVING = 73,                    /* HAVING  */
+  YYSYMBOL_74_ = 74,                       /* ';'  */
+  YYSYMBOL_75_ = 75,                       /* ','  */
+  YYSYMBOL_76_ = 76,                       /* '.'  */
+  YYSYMBOL_77_ = 77,                       /* '>'  */
+  YYSYMBOL_78_ = 78,                       /* '<'  */
+  YYSYMBOL_79_ = 79,                       /* '='  */
+  YYSYMBOL_80_ = 80,                       /* '+'  */
+  YYSYMBOL_81_ = 81,                       /* '-'  */
+  YYSYMBOL_82_ = 82,                       /* '&'  */
+  YYSYMBOL_83_ = 83,                       /* '|'  */
+  YYSYMBOL_84_ = 84,                       /* '/'  */
+  YYSYMBOL_85_ = 85,                       /* '*'  */
+  YYSYMBOL_86_ = 86,                       /* '%'  */
+  YYSYMBOL_87_ = 87,                       /* '~'  */
+  YYSYMBOL_88_ = 88,                       /* '#'  */
+  YYSYMBOL_89_ = 89,                       /* ':'  */
+  YYSYMBOL_90_ = 90,                       /* '('  */
+  YYSYMBOL_91_ = 91,                       /* ')'  */
+  YYSYMBOL_YYACCEPT = 92,                  /* $accept  */
+  YYSYMBOL_TopLevelStatement = 93,         /* TopLevelStatement  */
+  YYSYMBOL_StatementList = 94,             /* StatementList  */
+  YYSYMBOL_Statement = 95,                 /* Statement  */
+  YYSYMBOL_SelectStatement = 96,           /* SelectStatement  */
+  YYSYMBOL_Select = 97,                    /* Select  */
+  YYSYMBOL_SelectOptions = 98,             /* SelectOptions  */
+  YYSYMBOL_SelectConditions = 99,          /* SelectConditions  */
+  YYSYMBOL_WhereClause = 100,              /* WhereClause  */
+  YYSYMBOL_GroupByClause = 101,            /* GroupByClause  */
+  YYSYMBOL_LimitClause = 102,              /* LimitClause  */
+  YYSYMBOL_OrderByClause = 103,            /* OrderByClause  */
+  YYSYMBOL_OrderByColumnId = 104,          /* OrderByColumnId  */
+  YYSYMBOL_OrderByOption = 105,            /* OrderByOption  */
+  YYSYMBOL_aExpr = 106,                    /* aExpr  */
+  YYSYMBOL_aExpr2 = 107,                   /* aExpr2  */
+  YYSYMBOL_aExpr3 = 108,                   /* aExpr3  */
+  YYSYMBOL_aExpr4 = 109,                   /* aExpr4  */
+  YYSYMBOL_aExpr5 = 110,                   /* aExpr5  */
+  YYSYMBOL_aExpr6 = 111,                   /* aExpr6  */
+  YYSYMBOL_aExpr7 = 112,                   /* aExpr7  */
+  YYSYMBOL_aExpr8 = 113,                   /* aExpr8  */
+  YYSYMBOL_aExpr9 = 114,                   /* aExpr9  */
+  YYSYMBOL_DateConst = 115,                /* DateConst  */
+  YYSYMBOL_DateValue = 116,                /* DateValue  */
+  YYSYMBOL_YearConst = 117,                /* YearConst  */
+  YYSYMBOL_TimeConst = 118,                /* TimeConst  */
+  YYSYMBOL_TimeValue = 119,                /* TimeValue  */
+  YYSYMBOL_TimeMs = 120,                   /* TimeMs  */
+  YYSYMBOL_TimePeriod = 121,               /* TimePeriod  */
+  YYSYMBOL_DateTimeConst = 122,            /* DateTimeConst  */
+  YYSYMBOL_aExpr10 = 123,                  /* aExpr10  */
+  YYSYMBOL_aExprList = 124,                /* aExprList  */
+  YYSYMBOL_aExprList2 = 125,               /* aExprList2  */
+  YYSYMBOL_Tables = 126,                   /* Tables  */
+  YYSYMBOL_FlatTableList = 127,            /* FlatTableList  */
+  YYSYMBOL_FlatTable = 128,                /* FlatTable  */
+  YYSYMBOL_ColViews = 129,                 /* ColViews  */
+  YYSYMBOL_ColItem = 130,                  /* ColItem  */
+  YYSYMBOL_ColExpression = 131,            /* ColExpression  */
+  YYSYMBOL_ColWildCard = 132               /* ColWildCard  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_KDBSQLPARSER_TAB_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 285 "sqlparser.cpp" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -316,15 +396,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_uint8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -338,47 +431,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -391,8 +480,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if 1
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -457,8 +560,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* 1 */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -467,17 +569,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -490,11 +592,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -506,12 +608,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -523,42 +625,45 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  7
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   231
+#define YYLAST   263
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  88
+#define YYNTOKENS  92
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  38
+#define YYNNTS  41
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  119
+#define YYNRULES  133
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  201
+#define YYNSTATES  227
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   324
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   328
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,    84,     2,    82,    78,     2,
-      86,    87,    81,    76,    71,    77,    72,    80,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,    85,    70,
-      74,    75,    73,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,    88,     2,    86,    82,     2,
+      90,    91,    85,    80,    75,    81,    76,    84,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,    89,    74,
+      78,    79,    77,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,    79,     2,    83,     2,     2,     2,
+       2,     2,     2,     2,    83,     2,    87,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -578,313 +683,330 @@ static const yytype_uint8 yytranslate[] =
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
       55,    56,    57,    58,    59,    60,    61,    62,    63,    64,
-      65,    66,    67,    68,    69
+      65,    66,    67,    68,    69,    70,    71,    72,    73
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,   564,   564,   574,   578,   579,   594,   693,   699,   706,
-     711,   717,   723,   729,   738,   746,   753,   759,   767,   778,
-     787,   796,   806,   814,   826,   832,   839,   846,   850,   857,
-     862,   869,   875,   882,   887,   893,   899,   905,   911,   918,
-     923,   929,   935,   941,   947,   953,   959,   965,   975,   986,
-     991,   996,  1002,  1007,  1013,  1020,  1025,  1031,  1037,  1043,
-    1049,  1056,  1061,  1067,  1073,  1080,  1086,  1091,  1096,  1101,
-    1106,  1114,  1120,  1128,  1135,  1142,  1146,  1150,  1156,  1173,
-    1179,  1185,  1191,  1198,  1202,  1210,  1218,  1229,  1235,  1241,
-    1250,  1258,  1266,  1278,  1282,  1289,  1293,  1297,  1304,  1314,
-    1323,  1327,  1334,  1340,  1349,  1394,  1400,  1409,  1437,  1447,
-    1462,  1469,  1479,  1488,  1493,  1503,  1516,  1562,  1571,  1580
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
+{
+       0,   573,   573,   583,   587,   588,   603,   702,   708,   715,
+     720,   726,   732,   738,   747,   755,   756,   757,   768,   775,
+     781,   789,   797,   798,   805,   811,   822,   829,   838,   849,
+     859,   865,   872,   883,   892,   902,   910,   922,   928,   935,
+     942,   946,   953,   958,   965,   971,   978,   983,   989,   995,
+    1001,  1007,  1014,  1019,  1025,  1031,  1037,  1043,  1049,  1055,
+    1061,  1071,  1082,  1087,  1092,  1098,  1103,  1109,  1116,  1121,
+    1127,  1133,  1139,  1145,  1152,  1157,  1163,  1169,  1176,  1182,
+    1187,  1192,  1197,  1202,  1210,  1216,  1224,  1231,  1238,  1242,
+    1246,  1252,  1269,  1275,  1281,  1287,  1294,  1298,  1306,  1314,
+    1325,  1331,  1337,  1346,  1354,  1362,  1374,  1378,  1385,  1389,
+    1393,  1400,  1410,  1419,  1423,  1427,  1437,  1443,  1452,  1497,
+    1503,  1512,  1540,  1550,  1565,  1572,  1582,  1591,  1596,  1606,
+    1619,  1665,  1674,  1683
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if 1
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SQL_TYPE", "AS", "AS_EMPTY", "ASC",
-  "AUTO_INCREMENT", "BIT", "BITWISE_SHIFT_LEFT", "BITWISE_SHIFT_RIGHT",
-  "BY", "CHARACTER_STRING_LITERAL", "CONCATENATION", "CREATE", "DESC",
-  "DISTINCT", "DOUBLE_QUOTED_STRING", "FROM", "JOIN", "KEY", "LEFT",
-  "LESS_OR_EQUAL", "GREATER_OR_EQUAL", "SQL_NULL", "SQL_IS", "SQL_IS_NULL",
-  "SQL_IS_NOT_NULL", "ORDER", "PRIMARY", "SELECT", "INTEGER_CONST",
-  "REAL_CONST", "RIGHT", "SQL_ON", "DATE_CONST", "DATETIME_CONST",
-  "TIME_CONST", "TABLE", "IDENTIFIER", "IDENTIFIER_DOT_ASTERISK",
-  "QUERY_PARAMETER", "VARCHAR", "WHERE", "SQL", "SQL_TRUE", "SQL_FALSE",
-  "UNION", "SCAN_ERROR", "AND", "BETWEEN", "NOT_BETWEEN", "EXCEPT",
-  "SQL_IN", "INTERSECT", "LIKE", "ILIKE", "NOT_LIKE", "NOT", "NOT_EQUAL",
-  "NOT_EQUAL2", "OR", "SIMILAR_TO", "NOT_SIMILAR_TO", "XOR", "UMINUS",
-  "TABS_OR_SPACES", "DATE_TIME_INTEGER", "TIME_AM", "TIME_PM", "';'",
-  "','", "'.'", "'>'", "'<'", "'='", "'+'", "'-'", "'&'", "'|'", "'/'",
-  "'*'", "'%'", "'~'", "'#'", "':'", "'('", "')'", "$accept",
-  "TopLevelStatement", "StatementList", "Statement", "SelectStatement",
-  "Select", "SelectOptions", "WhereClause", "OrderByClause",
-  "OrderByColumnId", "OrderByOption", "aExpr", "aExpr2", "aExpr3",
-  "aExpr4", "aExpr5", "aExpr6", "aExpr7", "aExpr8", "aExpr9", "DateConst",
-  "DateValue", "YearConst", "TimeConst", "TimeValue", "TimeMs",
-  "TimePeriod", "DateTimeConst", "aExpr10", "aExprList", "aExprList2",
-  "Tables", "FlatTableList", "FlatTable", "ColViews", "ColItem",
-  "ColExpression", "ColWildCard", YY_NULLPTR
+  "\"end of file\"", "error", "\"invalid token\"", "SQL_TYPE", "AS",
+  "AS_EMPTY", "ASC", "AUTO_INCREMENT", "BIT", "BITWISE_SHIFT_LEFT",
+  "BITWISE_SHIFT_RIGHT", "BY", "CHARACTER_STRING_LITERAL", "CONCATENATION",
+  "CREATE", "DESC", "DISTINCT", "DOUBLE_QUOTED_STRING", "FROM", "JOIN",
+  "KEY", "LEFT", "LESS_OR_EQUAL", "GREATER_OR_EQUAL", "SQL_NULL", "SQL_IS",
+  "SQL_IS_NULL", "SQL_IS_NOT_NULL", "ORDER", "PRIMARY", "SELECT",
+  "INTEGER_CONST", "REAL_CONST", "RIGHT", "SQL_ON", "DATE_CONST",
+  "DATETIME_CONST", "TIME_CONST", "TABLE", "IDENTIFIER",
+  "IDENTIFIER_DOT_ASTERISK", "QUERY_PARAMETER", "VARCHAR", "WHERE", "SQL",
+  "SQL_TRUE", "SQL_FALSE", "UNION", "SCAN_ERROR", "AND", "BETWEEN",
+  "NOT_BETWEEN", "EXCEPT", "SQL_IN", "INTERSECT", "LIKE", "ILIKE",
+  "NOT_LIKE", "NOT", "NOT_EQUAL", "NOT_EQUAL2", "OR", "SIMILAR_TO",
+  "NOT_SIMILAR_TO", "XOR", "UMINUS", "TABS_OR_SPACES", "DATE_TIME_INTEGER",
+  "TIME_AM", "TIME_PM", "LIMIT", "OFFSET", "GROUP", "HAVING", "';'", "','",
+  "'.'", "'>'", "'<'", "'='", "'+'", "'-'", "'&'", "'|'", "'/'", "'*'",
+  "'%'", "'~'", "'#'", "':'", "'('", "')'", "$accept", "TopLevelStatement",
+  "StatementList", "Statement", "SelectStatement", "Select",
+  "SelectOptions", "SelectConditions", "WhereClause", "GroupByClause",
+  "LimitClause", "OrderByClause", "OrderByColumnId", "OrderByOption",
+  "aExpr", "aExpr2", "aExpr3", "aExpr4", "aExpr5", "aExpr6", "aExpr7",
+  "aExpr8", "aExpr9", "DateConst", "DateValue", "YearConst", "TimeConst",
+  "TimeValue", "TimeMs", "TimePeriod", "DateTimeConst", "aExpr10",
+  "aExprList", "aExprList2", "Tables", "FlatTableList", "FlatTable",
+  "ColViews", "ColItem", "ColExpression", "ColWildCard", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
-{
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-      59,    44,    46,    62,    60,    61,    43,    45,    38,   124,
-      47,    42,    37,   126,    35,    58,    40,    41
-};
-# endif
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
+{
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -143
+#define YYPACT_NINF (-74)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-143)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-       1,  -143,    52,  -143,    -8,  -143,    22,  -143,     1,  -143,
-     -27,    25,  -143,  -143,  -143,   -60,  -143,  -143,  -143,   126,
-     126,   126,  -143,   126,    44,   126,  -143,  -143,   -16,    13,
-     163,  -143,    86,     0,    64,  -143,  -143,  -143,  -143,   -11,
-      29,  -143,    10,  -143,  -143,   102,    11,    -5,  -143,   -23,
-      -2,  -143,   -21,  -143,  -143,  -143,  -143,   -61,     4,    26,
-     -43,    24,    20,    35,   126,   126,   126,   126,   126,   126,
-     126,   126,  -143,  -143,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,   126,   126,   126,   126,   126,   126,   126,
-     126,   126,   126,    96,   126,  -143,    84,    78,  -143,   -11,
-      74,  -143,    38,    98,  -143,    25,  -143,  -143,  -143,    71,
-      48,   110,    89,    99,  -143,  -143,   101,  -143,   103,  -143,
-    -143,  -143,  -143,  -143,  -143,  -143,  -143,  -143,  -143,   114,
-     120,  -143,  -143,  -143,  -143,  -143,  -143,  -143,  -143,  -143,
-    -143,  -143,  -143,  -143,  -143,  -143,  -143,  -143,    58,  -143,
-     172,  -143,  -143,  -143,  -143,  -143,  -143,   126,  -143,   111,
-     -12,   112,   115,   121,   126,   126,  -143,   128,   144,    12,
-      58,  -143,    63,   134,   137,   -48,  -143,   138,  -143,  -143,
-     167,  -143,  -143,  -143,    58,   136,  -143,  -143,  -143,  -143,
-     139,  -143,  -143,  -143,  -143,  -143,  -143,    58,   -48,  -143,
-    -143
+      -6,   -74,    26,   -74,   -32,   -74,    16,   -74,    -6,   -74,
+      -9,    54,   -74,   -74,   -74,     1,   -74,   -74,   -74,   130,
+     130,   130,   -74,   130,   -17,   130,   -74,   -74,   -28,    49,
+     175,   -74,    44,    32,    88,   -74,   -74,   -74,   -74,   127,
+      -5,   -74,    10,   -74,   -74,   106,    13,    12,   -74,   -27,
+      -2,   -74,     8,   -74,   -74,   -74,   -74,   -38,    28,    58,
+     -47,    30,    33,    25,   130,   130,   130,   130,   130,   130,
+     130,   130,   -74,   -74,   130,   130,   130,   130,   130,   130,
+     130,   130,   130,   130,   130,   130,   130,   130,   130,   130,
+     130,   130,   130,   118,   130,   113,   115,   138,   130,   -74,
+      29,   -13,   122,   -74,    78,   -74,   127,   114,   -74,    65,
+     121,   -74,    54,   -74,   -74,    66,   -74,    92,   101,   156,
+     137,   139,   -74,   -74,   140,   -74,   141,   -74,   -74,   -74,
+     -74,   -74,   -74,   -74,   -74,   -74,   -74,   160,   163,   -74,
+     -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,   -74,
+     -74,   -74,   -74,   -74,   -74,   -74,    -4,   -74,   142,   -74,
+     130,   -74,   -74,   203,   187,   205,   -74,   -74,   -74,   -74,
+     -74,   -74,   -74,   130,   -74,   143,   -58,   132,   134,   148,
+     130,   130,   -74,   147,   188,     5,   202,   171,    -4,   234,
+      -4,   -74,    53,   179,   180,     7,   -74,   181,   -74,   -74,
+     210,   -74,   -74,   -74,    -4,   176,   -74,   130,   -74,    -4,
+     -74,   -74,   -74,   -74,   174,   -74,   -74,   -74,   -74,   -74,
+     -74,    -4,   -74,   -74,     7,   -74,   -74
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
 static const yytype_uint8 yydefact[] =
 {
-       0,    14,     0,     2,     4,     6,     7,     1,     5,    77,
-       0,     0,    74,    78,    79,    70,    71,    75,    76,     0,
-       0,     0,   118,     0,     0,     0,   116,    29,    33,    39,
-      49,    52,    55,    61,    65,    80,    81,    82,    83,    10,
-       8,   111,   112,   113,     3,     0,   107,   104,   106,     0,
-       0,    72,    70,    69,    67,    66,    68,    87,     0,     0,
+       0,    14,     0,     2,     4,     6,     7,     1,     5,    90,
+       0,     0,    87,    91,    92,    83,    84,    88,    89,     0,
+       0,     0,   132,     0,     0,     0,   130,    42,    46,    52,
+      62,    65,    68,    74,    78,    93,    94,    95,    96,    10,
+       8,   125,   126,   127,     3,     0,   121,   118,   120,     0,
+       0,    85,    83,    82,    80,    79,    81,   100,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,    50,    51,     0,     0,     0,     0,     0,     0,
+       0,     0,    63,    64,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,    12,    15,     0,    11,     9,
-       0,   115,     0,     0,   108,     0,    73,   119,   101,   103,
-       0,     0,     0,     0,    88,    89,     0,    84,     0,    90,
-      99,    30,    31,    32,    37,    35,    34,    36,    38,     0,
-       0,    44,    42,    43,    40,    41,    45,    46,    53,    54,
-      57,    56,    58,    59,    60,    62,    63,    64,     0,    19,
-       0,   110,    13,   114,   117,   109,   105,     0,   100,     0,
-      94,     0,     0,     0,     0,     0,    26,    24,    16,    20,
-       0,   102,     0,     0,     0,    97,    98,     0,    47,    48,
-       0,    18,    27,    28,     0,    21,    17,    87,    86,    93,
-      94,    95,    96,    91,    85,    25,    22,     0,    97,    23,
-      92
+       0,     0,     0,     0,     0,     0,     0,     0,     0,    12,
+      15,    18,    22,    16,     0,    11,     9,     0,   129,     0,
+       0,   122,     0,    86,   133,     0,   114,   117,     0,     0,
+       0,     0,   101,   102,     0,    97,     0,   103,   112,    43,
+      44,    45,    50,    48,    47,    49,    51,     0,     0,    57,
+      55,    56,    53,    54,    58,    59,    66,    67,    70,    69,
+      71,    72,    73,    75,    76,    77,     0,    26,    30,    32,
+       0,    29,    17,     0,    23,     0,   124,    13,   128,   131,
+     123,   119,   115,     0,   113,     0,   107,     0,     0,     0,
+       0,     0,    39,    37,    19,    33,     0,    27,     0,     0,
+       0,   116,     0,     0,     0,   110,   111,     0,    60,    61,
+       0,    21,    40,    41,     0,    34,    31,     0,    20,     0,
+      24,   100,    99,   106,   107,   108,   109,   104,    98,    38,
+      35,     0,    28,    25,   110,    36,   105
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -143,  -143,   200,  -143,  -143,  -143,   -29,    47,  -142,  -143,
-    -143,   -25,    87,   106,   -73,  -143,    32,   107,    90,   108,
-    -143,  -143,    45,  -143,   105,    34,    21,  -143,  -143,  -143,
-      70,   188,  -143,   124,  -143,   133,   186,  -143
+     -74,   -74,   244,   -74,   -74,   -74,   -24,   -74,    69,   153,
+     155,    15,   -74,   -74,   -25,   119,   110,   -73,   -74,    48,
+     154,    99,   120,   -74,   -74,    64,   -74,   133,    45,    34,
+     -74,   -74,   -74,   -68,   220,   -74,   149,   -74,   158,   218,
+     -74
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int16 yydefgoto[] =
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_uint8 yydefgoto[] =
 {
-      -1,     2,     3,     4,     5,     6,    95,    96,   168,   169,
-     185,    26,    27,    28,    29,    30,    31,    32,    33,    34,
-      35,    60,    61,    36,    62,   175,   193,    37,    38,    51,
-     110,    39,    47,    48,    40,    41,    42,    43
+       0,     2,     3,     4,     5,     6,    99,   100,   101,   102,
+     103,   184,   185,   205,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    60,    61,    36,    62,   195,   217,
+      37,    38,    51,   118,    39,    47,    48,    40,    41,    42,
+      43
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
 static const yytype_uint8 yytable[] =
 {
-      63,   129,   130,   131,   132,   133,   134,   135,   136,   137,
-       9,    98,    49,    85,   100,   103,   106,    93,   182,   112,
-     191,   192,    12,   116,   113,   109,    50,   183,   186,    13,
-      14,     1,    94,    64,     9,    67,    68,    52,    10,    16,
-      11,   117,   196,    17,    18,    65,    12,    11,    66,   101,
-     104,   111,     7,    13,    14,   199,    19,    93,   107,    45,
-     173,    15,     8,    16,    46,    50,   105,    17,    18,   149,
-     152,   114,    94,   174,    20,    21,    86,    87,    88,    89,
-      19,    23,    24,   184,    25,   108,    69,    70,    71,   166,
-       9,   178,   179,   115,    10,    83,    84,   167,    20,    21,
-      97,   118,    12,    22,   119,    23,    24,   148,    25,    13,
-      14,    57,   150,   153,     9,   138,   139,    15,    10,    16,
-      58,    59,   120,    17,    18,   154,    12,    53,    54,    55,
-     187,    56,   109,    13,    14,   158,    19,   155,     9,    58,
-      59,    52,   157,    16,    90,    91,    92,    17,    18,   106,
-      12,   121,   122,   123,    20,    21,   159,    13,    14,    22,
-      19,    23,    24,   164,    25,    52,   160,    16,   161,   165,
-     163,    17,    18,   124,   125,   126,   127,   128,    20,    21,
-     145,   146,   147,   170,    19,    23,    24,    94,    25,    72,
-      73,   172,   140,   141,   142,   143,   144,   113,   177,   176,
-     180,   189,    20,    21,   190,   194,   195,   197,    44,    23,
-      24,   173,    25,    74,    75,   181,    76,   188,    77,   200,
-      78,   162,    79,    80,   198,    81,    82,   171,    99,   156,
-     151,   102
+      63,   137,   138,   139,   140,   141,   142,   143,   144,   145,
+       9,   202,   113,    11,   107,   163,   105,   110,   193,   124,
+     203,    64,    12,    93,     1,   117,     7,   182,     9,    13,
+      14,   194,    10,    65,    11,   183,    66,    52,    94,    16,
+      12,   125,     8,    17,    18,    85,   120,    13,    14,   108,
+      57,   121,   111,    83,    84,    15,    19,    16,   114,    97,
+      98,    17,    18,    58,    59,    95,    96,    97,    98,   157,
+     104,    67,    68,   161,    19,   215,   216,    49,    20,    21,
+     204,    45,   167,   115,   119,    23,    24,   112,    25,   116,
+       9,    50,   187,    46,    10,   122,    20,    21,    50,    95,
+      96,    22,    12,    23,    24,   191,    25,   198,   199,    13,
+      14,   126,    86,    87,    88,    89,   128,    15,     9,    16,
+     211,   127,    10,    17,    18,   123,    69,    70,    71,   156,
+      12,   146,   147,    58,    59,   117,    19,    13,    14,    53,
+      54,    55,     9,    56,   158,    52,   159,    16,   117,   160,
+     165,    17,    18,   168,    12,    93,   169,   172,    20,    21,
+     170,    13,    14,    22,    19,    23,    24,   173,    25,    52,
+      94,    16,    90,    91,    92,    17,    18,   132,   133,   134,
+     135,   136,   222,   129,   130,   131,    20,    21,    19,   153,
+     154,   155,   174,    23,    24,   113,    25,    95,    96,    97,
+      98,    72,    73,   208,   175,   210,   176,   177,   179,   180,
+      20,    21,   181,   186,   188,   189,   190,    23,    24,   220,
+      25,   121,   196,   200,   223,    74,    75,   192,    76,   197,
+      77,    94,    78,   206,    79,    80,   225,    81,    82,   148,
+     149,   150,   151,   152,   207,   209,   213,   214,   218,   219,
+     193,   221,    44,   201,   164,   162,   212,   178,   226,   224,
+     106,   171,   166,   109
 };
 
 static const yytype_uint8 yycheck[] =
 {
       25,    74,    75,    76,    77,    78,    79,    80,    81,    82,
-      12,    40,    72,    13,     4,     4,    39,    28,     6,    80,
-      68,    69,    24,    66,    85,    50,    86,    15,   170,    31,
-      32,    30,    43,    49,    12,    22,    23,    39,    16,    41,
-      18,    84,   184,    45,    46,    61,    24,    18,    64,    39,
-      39,    72,     0,    31,    32,   197,    58,    28,    81,    86,
-      72,    39,    70,    41,    39,    86,    71,    45,    46,    94,
-      99,    67,    43,    85,    76,    77,    76,    77,    78,    79,
-      58,    83,    84,    71,    86,    87,    73,    74,    75,    31,
-      12,   164,   165,    67,    16,     9,    10,    39,    76,    77,
-      71,    77,    24,    81,    84,    83,    84,    11,    86,    31,
-      32,    67,    28,    39,    12,    83,    84,    39,    16,    41,
-      76,    77,    87,    45,    46,    87,    24,    19,    20,    21,
-      67,    23,   157,    31,    32,    87,    58,    39,    12,    76,
-      77,    39,    71,    41,    80,    81,    82,    45,    46,    39,
-      24,    64,    65,    66,    76,    77,    67,    31,    32,    81,
-      58,    83,    84,    49,    86,    39,    67,    41,    67,    49,
-      67,    45,    46,    67,    68,    69,    70,    71,    76,    77,
-      90,    91,    92,    11,    58,    83,    84,    43,    86,    26,
-      27,    80,    85,    86,    87,    88,    89,    85,    77,    84,
-      72,    67,    76,    77,    67,    67,    39,    71,     8,    83,
-      84,    72,    86,    50,    51,   168,    53,   172,    55,   198,
-      57,   116,    59,    60,   190,    62,    63,   157,    40,   105,
-      97,    45
+      12,     6,    39,    18,     4,    28,    40,     4,    76,    66,
+      15,    49,    24,    28,    30,    50,     0,    31,    12,    31,
+      32,    89,    16,    61,    18,    39,    64,    39,    43,    41,
+      24,    88,    74,    45,    46,    13,    84,    31,    32,    39,
+      67,    89,    39,     9,    10,    39,    58,    41,    85,    72,
+      73,    45,    46,    80,    81,    70,    71,    72,    73,    94,
+      75,    22,    23,    98,    58,    68,    69,    76,    80,    81,
+      75,    90,   106,    85,    76,    87,    88,    75,    90,    91,
+      12,    90,   160,    39,    16,    67,    80,    81,    90,    70,
+      71,    85,    24,    87,    88,   173,    90,   180,   181,    31,
+      32,    81,    80,    81,    82,    83,    91,    39,    12,    41,
+      67,    88,    16,    45,    46,    67,    77,    78,    79,    11,
+      24,    83,    84,    80,    81,   160,    58,    31,    32,    19,
+      20,    21,    12,    23,    31,    39,    31,    41,   173,    11,
+      28,    45,    46,    39,    24,    28,    91,    91,    80,    81,
+      39,    31,    32,    85,    58,    87,    88,    75,    90,    39,
+      43,    41,    84,    85,    86,    45,    46,    67,    68,    69,
+      70,    71,   207,    64,    65,    66,    80,    81,    58,    90,
+      91,    92,    91,    87,    88,    39,    90,    70,    71,    72,
+      73,    26,    27,   188,    67,   190,    67,    67,    67,    49,
+      80,    81,    49,    71,    11,    28,    11,    87,    88,   204,
+      90,    89,    88,    76,   209,    50,    51,    84,    53,    81,
+      55,    43,    57,    31,    59,    60,   221,    62,    63,    85,
+      86,    87,    88,    89,    73,    11,    67,    67,    67,    39,
+      76,    75,     8,   184,   101,   100,   192,   124,   224,   214,
+      40,   112,   104,    45
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
 static const yytype_uint8 yystos[] =
 {
-       0,    30,    89,    90,    91,    92,    93,     0,    70,    12,
+       0,    30,    93,    94,    95,    96,    97,     0,    74,    12,
       16,    18,    24,    31,    32,    39,    41,    45,    46,    58,
-      76,    77,    81,    83,    84,    86,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   111,   115,   116,   119,
-     122,   123,   124,   125,    90,    86,    39,   120,   121,    72,
-      86,   117,    39,   107,   107,   107,   107,    67,    76,    77,
-     109,   110,   112,    99,    49,    61,    64,    22,    23,    73,
-      74,    75,    26,    27,    50,    51,    53,    55,    57,    59,
-      60,    62,    63,     9,    10,    13,    76,    77,    78,    79,
-      80,    81,    82,    28,    43,    94,    95,    71,    94,   119,
-       4,    39,   124,     4,    39,    71,    39,    81,    87,    99,
-     118,    72,    80,    85,    67,    67,    66,    84,    77,    84,
-      87,   100,   100,   100,   101,   101,   101,   101,   101,   102,
-     102,   102,   102,   102,   102,   102,   102,   102,   104,   104,
-     105,   105,   105,   105,   105,   106,   106,   106,    11,    99,
-      28,   123,    94,    39,    87,    39,   121,    71,    87,    67,
-      67,    67,   112,    67,    49,    49,    31,    39,    96,    97,
-      11,   118,    80,    72,    85,   113,    84,    77,   102,   102,
-      72,    95,     6,    15,    71,    98,    96,    67,   110,    67,
-      67,    68,    69,   114,    67,    39,    96,    71,   113,    96,
-     114
+      80,    81,    85,    87,    88,    90,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   115,   118,   122,   123,   126,
+     129,   130,   131,   132,    94,    90,    39,   127,   128,    76,
+      90,   124,    39,   114,   114,   114,   114,    67,    80,    81,
+     116,   117,   119,   106,    49,    61,    64,    22,    23,    77,
+      78,    79,    26,    27,    50,    51,    53,    55,    57,    59,
+      60,    62,    63,     9,    10,    13,    80,    81,    82,    83,
+      84,    85,    86,    28,    43,    70,    71,    72,    73,    98,
+      99,   100,   101,   102,    75,    98,   126,     4,    39,   131,
+       4,    39,    75,    39,    85,    85,    91,   106,   125,    76,
+      84,    89,    67,    67,    66,    88,    81,    88,    91,   107,
+     107,   107,   108,   108,   108,   108,   108,   109,   109,   109,
+     109,   109,   109,   109,   109,   109,   111,   111,   112,   112,
+     112,   112,   112,   113,   113,   113,    11,   106,    31,    31,
+      11,   106,   102,    28,   101,    28,   130,    98,    39,    91,
+      39,   128,    91,    75,    91,    67,    67,    67,   119,    67,
+      49,    49,    31,    39,   103,   104,    71,   125,    11,    28,
+      11,   125,    84,    76,    89,   120,    88,    81,   109,   109,
+      76,   100,     6,    15,    75,   105,    31,    73,   103,    11,
+     103,    67,   117,    67,    67,    68,    69,   121,    67,    39,
+     103,    75,   106,   103,   120,   103,   121
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
 static const yytype_uint8 yyr1[] =
 {
-       0,    88,    89,    90,    90,    90,    91,    92,    92,    92,
-      92,    92,    92,    92,    93,    94,    94,    94,    94,    95,
-      96,    96,    96,    96,    97,    97,    97,    98,    98,    99,
-     100,   100,   100,   100,   101,   101,   101,   101,   101,   101,
-     102,   102,   102,   102,   102,   102,   102,   102,   102,   102,
-     103,   103,   103,   104,   104,   104,   105,   105,   105,   105,
-     105,   105,   106,   106,   106,   106,   107,   107,   107,   107,
-     107,   107,   107,   107,   107,   107,   107,   107,   107,   107,
-     107,   107,   107,   107,   108,   109,   109,   110,   110,   110,
-     111,   112,   112,   113,   113,   114,   114,   114,   115,   116,
-     117,   117,   118,   118,   119,   120,   120,   121,   121,   121,
-     122,   122,   123,   123,   123,   123,   124,   124,   125,   125
+       0,    92,    93,    94,    94,    94,    95,    96,    96,    96,
+      96,    96,    96,    96,    97,    98,    98,    98,    99,    99,
+      99,    99,    99,    99,    99,    99,   100,   101,   101,   101,
+     102,   102,   102,   103,   103,   103,   103,   104,   104,   104,
+     105,   105,   106,   107,   107,   107,   107,   108,   108,   108,
+     108,   108,   108,   109,   109,   109,   109,   109,   109,   109,
+     109,   109,   109,   110,   110,   110,   111,   111,   111,   112,
+     112,   112,   112,   112,   112,   113,   113,   113,   113,   114,
+     114,   114,   114,   114,   114,   114,   114,   114,   114,   114,
+     114,   114,   114,   114,   114,   114,   114,   115,   116,   116,
+     117,   117,   117,   118,   119,   119,   120,   120,   121,   121,
+     121,   122,   123,   124,   124,   124,   125,   125,   126,   127,
+     127,   128,   128,   128,   129,   129,   130,   130,   130,   130,
+     131,   131,   132,   132
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     1,     3,     1,     2,     1,     1,     2,     3,
-       2,     3,     3,     4,     1,     1,     3,     4,     4,     2,
-       1,     2,     3,     4,     1,     3,     1,     1,     1,     1,
-       3,     3,     3,     1,     3,     3,     3,     3,     3,     1,
-       3,     3,     3,     3,     3,     3,     3,     5,     5,     1,
-       2,     2,     1,     3,     3,     1,     3,     3,     3,     3,
-       3,     1,     3,     3,     3,     1,     2,     2,     2,     2,
-       1,     1,     2,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     3,     5,     5,     1,     2,     2,
-       3,     5,     7,     2,     0,     1,     1,     0,     5,     3,
-       3,     2,     3,     1,     2,     3,     1,     1,     2,     3,
-       3,     1,     1,     1,     3,     2,     1,     4,     1,     3
+       2,     3,     3,     4,     1,     1,     1,     2,     1,     3,
+       4,     4,     1,     2,     4,     5,     2,     3,     5,     2,
+       2,     4,     2,     1,     2,     3,     4,     1,     3,     1,
+       1,     1,     1,     3,     3,     3,     1,     3,     3,     3,
+       3,     3,     1,     3,     3,     3,     3,     3,     3,     3,
+       5,     5,     1,     2,     2,     1,     3,     3,     1,     3,
+       3,     3,     3,     3,     1,     3,     3,     3,     1,     2,
+       2,     2,     2,     1,     1,     2,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     3,     5,     5,
+       1,     2,     2,     3,     5,     7,     2,     0,     1,     1,
+       0,     5,     3,     3,     2,     3,     3,     1,     2,     3,
+       1,     1,     2,     3,     3,     1,     1,     1,     3,     2,
+       1,     4,     1,     3
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -901,55 +1023,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -958,7 +1077,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -981,21 +1100,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1010,8 +1129,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1034,28 +1153,76 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
+/* Context of a parse error.  */
+typedef struct
+{
+  yy_state_t *yyssp;
+  yysymbol_kind_t yytoken;
+} yypcontext_t;
+
+/* Put in YYARG at most YYARGN of the expected tokens given the
+   current YYCTX, and return the number of tokens stored in YYARG.  If
+   YYARG is null, return the number of expected tokens (guaranteed to
+   be less than YYNTOKENS).  Return YYENOMEM on memory exhaustion.
+   Return 0 if there are more than YYARGN expected tokens, yet fill
+   YYARG up to YYARGN. */
+static int
+yypcontext_expected_tokens (const yypcontext_t *yyctx,
+                            yysymbol_kind_t yyarg[], int yyargn)
+{
+  /* Actual size of YYARG. */
+  int yycount = 0;
+  int yyn = yypact[+*yyctx->yyssp];
+  if (!yypact_value_is_default (yyn))
+    {
+      /* Start YYX at -YYN if negative to avoid negative indexes in
+         YYCHECK.  In other words, skip the first -YYN actions for
+         this state because they are default actions.  */
+      int yyxbegin = yyn < 0 ? -yyn : 0;
+      /* Stay within bounds of both yycheck and yytname.  */
+      int yychecklim = YYLAST - yyn + 1;
+      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
+      int yyx;
+      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
+        if (yycheck[yyx + yyn] == yyx && yyx != YYSYMBOL_YYerror
+            && !yytable_value_is_error (yytable[yyx + yyn]))
+          {
+            if (!yyarg)
+              ++yycount;
+            else if (yycount == yyargn)
+              return 0;
+            else
+              yyarg[yycount++] = YY_CAST (yysymbol_kind_t, yyx);
+          }
+    }
+  if (yyarg && yycount == 0 && 0 < yyargn)
+    yyarg[0] = YYSYMBOL_YYEMPTY;
+  return yycount;
+}
+
+
 
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
+
+#ifndef yystrlen
+# if defined __GLIBC__ && defined _STRING_H
+#  define yystrlen(S) (YY_CAST (YYPTRDIFF_T, strlen (S)))
+# else
 /* Return the length of YYSTR.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yystrlen (const char *yystr)
 {
-  YYSIZE_T yylen;
+  YYPTRDIFF_T yylen;
   for (yylen = 0; yystr[yylen]; yylen++)
     continue;
   return yylen;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
+#ifndef yystpcpy
+# if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
+#  define yystpcpy stpcpy
+# else
 /* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
    YYDEST.  */
 static char *
@@ -1069,10 +1236,10 @@ yystpcpy (char *yydest, const char *yysrc)
 
   return yyd - 1;
 }
-#  endif
 # endif
+#endif
 
-# ifndef yytnamerr
+#ifndef yytnamerr
 /* Copy to YYRES the contents of YYSTR after stripping away unnecessary
    quotes and backslashes, so that it's suitable for yyerror.  The
    heuristic is that double-quoting is unnecessary unless the string
@@ -1080,14 +1247,13 @@ yystpcpy (char *yydest, const char *yysrc)
    backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
    null, do not copy; instead, return the length of what the result
    would have been.  */
-static YYSIZE_T
+static YYPTRDIFF_T
 yytnamerr (char *yyres, const char *yystr)
 {
   if (*yystr == '"')
     {
-      YYSIZE_T yyn = 0;
+      YYPTRDIFF_T yyn = 0;
       char const *yyp = yystr;
-
       for (;;)
         switch (*++yyp)
           {
@@ -1098,7 +1264,10 @@ yytnamerr (char *yyres, const char *yystr)
           case '\\':
             if (*++yyp != '\\')
               goto do_not_strip_quotes;
-            /* Fall through.  */
+            else
+              goto append;
+
+          append:
           default:
             if (yyres)
               yyres[yyn] = *yyp;
@@ -1113,36 +1282,20 @@ yytnamerr (char *yyres, const char *yystr)
     do_not_strip_quotes: ;
     }
 
-  if (! yyres)
+  if (yyres)
+    return yystpcpy (yyres, yystr) - yyres;
+  else
     return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
 }
-# endif
+#endif
 
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
 
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
 static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
+yy_syntax_error_arguments (const yypcontext_t *yyctx,
+                           yysymbol_kind_t yyarg[], int yyargn)
 {
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
+  /* Actual size of YYARG. */
   int yycount = 0;
-
   /* There are many possibilities here to consider:
      - If this state is a consistent state with a default action, then
        the only way this function was invoked is if the default action
@@ -1166,63 +1319,78 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
        one exception: it will still contain any token that will not be
        accepted due to an error action in a later state.
   */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
+  if (yyctx->yytoken != YYSYMBOL_YYEMPTY)
+    {
+      int yyn;
+      if (yyarg)
+        yyarg[yycount] = yyctx->yytoken;
+      ++yycount;
+      yyn = yypcontext_expected_tokens (yyctx,
+                                        yyarg ? yyarg + 1 : yyarg, yyargn - 1);
+      if (yyn == YYENOMEM)
+        return YYENOMEM;
+      else
+        yycount += yyn;
     }
+  return yycount;
+}
+
+/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
+   about the unexpected token YYTOKEN for the state stack whose top is
+   YYSSP.
+
+   Return 0 if *YYMSG was successfully written.  Return -1 if *YYMSG is
+   not large enough to hold the message.  In that case, also set
+   *YYMSG_ALLOC to the required number of bytes.  Return YYENOMEM if the
+   required number of bytes is too large to store.  */
+static int
+yysyntax_error (YYPTRDIFF_T *yymsg_alloc, char **yymsg,
+                const yypcontext_t *yyctx)
+{
+  enum { YYARGS_MAX = 5 };
+  /* Internationalized format string. */
+  const char *yyformat = YY_NULLPTR;
+  /* Arguments of yyformat: reported tokens (one for the "unexpected",
+     one per "expected"). */
+  yysymbol_kind_t yyarg[YYARGS_MAX];
+  /* Cumulated lengths of YYARG.  */
+  YYPTRDIFF_T yysize = 0;
+
+  /* Actual size of YYARG. */
+  int yycount = yy_syntax_error_arguments (yyctx, yyarg, YYARGS_MAX);
+  if (yycount == YYENOMEM)
+    return YYENOMEM;
 
   switch (yycount)
     {
-# define YYCASE_(N, S)                      \
+#define YYCASE_(N, S)                       \
       case N:                               \
         yyformat = S;                       \
-      break
+        break
+    default: /* Avoid compiler warnings. */
       YYCASE_(0, YY_("syntax error"));
       YYCASE_(1, YY_("syntax error, unexpected %s"));
       YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
       YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
       YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
       YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
+#undef YYCASE_
     }
 
+  /* Compute error message size.  Don't count the "%s"s, but reserve
+     room for the terminator.  */
+  yysize = yystrlen (yyformat) - 2 * yycount + 1;
   {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
+    int yyi;
+    for (yyi = 0; yyi < yycount; ++yyi)
+      {
+        YYPTRDIFF_T yysize1
+          = yysize + yytnamerr (YY_NULLPTR, yytname[yyarg[yyi]]);
+        if (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM)
+          yysize = yysize1;
+        else
+          return YYENOMEM;
+      }
   }
 
   if (*yymsg_alloc < yysize)
@@ -1231,7 +1399,7 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
       if (! (yysize <= *yymsg_alloc
              && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
         *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
+      return -1;
     }
 
   /* Avoid sprintf, as that infringes on the user's name space.
@@ -1243,40 +1411,39 @@ yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
     while ((*yyp = *yyformat) != '\0')
       if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
         {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
+          yyp += yytnamerr (yyp, yytname[yyarg[yyi++]]);
           yyformat += 2;
         }
       else
         {
-          yyp++;
-          yyformat++;
+          ++yyp;
+          ++yyformat;
         }
   }
   return 0;
 }
-#endif /* YYERROR_VERBOSE */
+
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -1285,6 +1452,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -1292,43 +1461,39 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
   /* Buffer for error messages, and its allocated size.  */
   char yymsgbuf[128];
   char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+  YYPTRDIFF_T yymsg_alloc = sizeof yymsgbuf;
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -1336,71 +1501,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -1408,30 +1577,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -1442,18 +1612,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1481,15 +1662,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1504,7 +1683,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -1524,176 +1703,291 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 565 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 2: /* TopLevelStatement: StatementList  */
+#line 574 "KDbSqlParser.y"
+{
 //todo: multiple statements
 //todo: not only "select" statements
     KDbParserPrivate::get(globalParser)->setStatementType(KDbParser::Select);
     KDbParserPrivate::get(globalParser)->setQuerySchema((yyvsp[0].querySchema));
 }
-#line 1536 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1715 "sqlparser.cpp"
     break;
 
-  case 3:
-#line 575 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 3: /* StatementList: Statement ';' StatementList  */
+#line 584 "KDbSqlParser.y"
+{
 //todo: multiple statements
 }
-#line 1544 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1723 "sqlparser.cpp"
     break;
 
-  case 5:
-#line 580 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 5: /* StatementList: Statement ';'  */
+#line 589 "KDbSqlParser.y"
+{
     (yyval.querySchema) = (yyvsp[-1].querySchema);
 }
-#line 1552 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1731 "sqlparser.cpp"
     break;
 
-  case 6:
-#line 595 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 6: /* Statement: SelectStatement  */
+#line 604 "KDbSqlParser.y"
+{
     (yyval.querySchema) = (yyvsp[0].querySchema);
 }
-#line 1560 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1739 "sqlparser.cpp"
     break;
 
-  case 7:
-#line 694 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 7: /* SelectStatement: Select  */
+#line 703 "KDbSqlParser.y"
+{
     sqlParserDebug() << "Select";
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[0].querySchema), nullptr )))
         YYABORT;
 }
-#line 1570 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1749 "sqlparser.cpp"
     break;
 
-  case 8:
-#line 700 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 8: /* SelectStatement: Select ColViews  */
+#line 709 "KDbSqlParser.y"
+{
     sqlParserDebug() << "Select ColViews=" << *(yyvsp[0].exprList);
 
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[-1].querySchema), (yyvsp[0].exprList) )))
         YYABORT;
 }
-#line 1581 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1760 "sqlparser.cpp"
     break;
 
-  case 9:
-#line 707 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 9: /* SelectStatement: Select ColViews Tables  */
+#line 716 "KDbSqlParser.y"
+{
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[-2].querySchema), (yyvsp[-1].exprList), (yyvsp[0].exprList) )))
         YYABORT;
 }
-#line 1590 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1769 "sqlparser.cpp"
     break;
 
-  case 10:
-#line 712 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 10: /* SelectStatement: Select Tables  */
+#line 721 "KDbSqlParser.y"
+{
     sqlParserDebug() << "Select ColViews Tables";
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[-1].querySchema), nullptr, (yyvsp[0].exprList) )))
         YYABORT;
 }
-#line 1600 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1779 "sqlparser.cpp"
     break;
 
-  case 11:
-#line 718 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 11: /* SelectStatement: Select ColViews SelectOptions  */
+#line 727 "KDbSqlParser.y"
+{
     sqlParserDebug() << "Select ColViews Conditions";
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[-2].querySchema), (yyvsp[-1].exprList), nullptr, (yyvsp[0].selectOptions) )))
         YYABORT;
 }
-#line 1610 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1789 "sqlparser.cpp"
     break;
 
-  case 12:
-#line 724 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 12: /* SelectStatement: Select Tables SelectOptions  */
+#line 733 "KDbSqlParser.y"
+{
     sqlParserDebug() << "Select Tables SelectOptions";
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[-2].querySchema), nullptr, (yyvsp[-1].exprList), (yyvsp[0].selectOptions) )))
         YYABORT;
 }
-#line 1620 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1799 "sqlparser.cpp"
     break;
 
-  case 13:
-#line 730 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 13: /* SelectStatement: Select ColViews Tables SelectOptions  */
+#line 739 "KDbSqlParser.y"
+{
     sqlParserDebug() << "Select ColViews Tables SelectOptions";
     if (!((yyval.querySchema) = buildSelectQuery( (yyvsp[-3].querySchema), (yyvsp[-2].exprList), (yyvsp[-1].exprList), (yyvsp[0].selectOptions) )))
         YYABORT;
 }
-#line 1630 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1809 "sqlparser.cpp"
     break;
 
-  case 14:
-#line 739 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 14: /* Select: SELECT  */
+#line 748 "KDbSqlParser.y"
+{
     sqlParserDebug() << "SELECT";
     (yyval.querySchema) = KDbParserPrivate::get(globalParser)->createQuery();
 }
-#line 1639 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1818 "sqlparser.cpp"
     break;
 
-  case 15:
-#line 747 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 17: /* SelectOptions: SelectConditions LimitClause  */
+#line 758 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "SelectConditions LimitClause";
+    (yyval.selectOptions) = (yyvsp[-1].selectOptions);
+    (yyval.selectOptions)->limit = (yyvsp[0].selectOptions)->limit;
+    (yyval.selectOptions)->offset = (yyvsp[0].selectOptions)->offset;
+    delete (yyvsp[0].selectOptions);
+}
+#line 1830 "sqlparser.cpp"
+    break;
+
+  case 18: /* SelectConditions: WhereClause  */
+#line 769 "KDbSqlParser.y"
+{
     sqlParserDebug() << "WhereClause";
     (yyval.selectOptions) = new SelectOptionsInternal;
     (yyval.selectOptions)->whereExpr = *(yyvsp[0].expr);
     delete (yyvsp[0].expr);
 }
-#line 1650 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1841 "sqlparser.cpp"
     break;
 
-  case 16:
-#line 754 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 19: /* SelectConditions: ORDER BY OrderByClause  */
+#line 776 "KDbSqlParser.y"
+{
     sqlParserDebug() << "OrderByClause";
     (yyval.selectOptions) = new SelectOptionsInternal;
     (yyval.selectOptions)->orderByColumns = (yyvsp[0].orderByColumns);
 }
-#line 1660 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1851 "sqlparser.cpp"
     break;
 
-  case 17:
-#line 760 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 20: /* SelectConditions: WhereClause ORDER BY OrderByClause  */
+#line 782 "KDbSqlParser.y"
+{
     sqlParserDebug() << "WhereClause ORDER BY OrderByClause";
     (yyval.selectOptions) = new SelectOptionsInternal;
     (yyval.selectOptions)->whereExpr = *(yyvsp[-3].expr);
     delete (yyvsp[-3].expr);
     (yyval.selectOptions)->orderByColumns = (yyvsp[0].orderByColumns);
 }
-#line 1672 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1863 "sqlparser.cpp"
     break;
 
-  case 18:
-#line 768 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 21: /* SelectConditions: ORDER BY OrderByClause WhereClause  */
+#line 790 "KDbSqlParser.y"
+{
     sqlParserDebug() << "OrderByClause WhereClause";
     (yyval.selectOptions) = new SelectOptionsInternal;
     (yyval.selectOptions)->whereExpr = *(yyvsp[0].expr);
     delete (yyvsp[0].expr);
     (yyval.selectOptions)->orderByColumns = (yyvsp[-1].orderByColumns);
 }
-#line 1684 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1875 "sqlparser.cpp"
     break;
 
-  case 19:
-#line 779 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 23: /* SelectConditions: WhereClause GroupByClause  */
+#line 799 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "WhereClause GroupByClause";
+    (yyval.selectOptions) = (yyvsp[0].selectOptions);
+    (yyval.selectOptions)->whereExpr = *(yyvsp[-1].expr);
+    delete (yyvsp[-1].expr);
+}
+#line 1886 "sqlparser.cpp"
+    break;
+
+  case 24: /* SelectConditions: GroupByClause ORDER BY OrderByClause  */
+#line 806 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "GroupByClause ORDER BY OrderByClause";
+    (yyval.selectOptions) = (yyvsp[-3].selectOptions);
+    (yyval.selectOptions)->orderByColumns = (yyvsp[0].orderByColumns);
+}
+#line 1896 "sqlparser.cpp"
+    break;
+
+  case 25: /* SelectConditions: WhereClause GroupByClause ORDER BY OrderByClause  */
+#line 812 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "WhereClause GroupByClause ORDER BY OrderByClause";
+    (yyval.selectOptions) = (yyvsp[-3].selectOptions);
+    (yyval.selectOptions)->whereExpr = *(yyvsp[-4].expr);
+    delete (yyvsp[-4].expr);
+    (yyval.selectOptions)->orderByColumns = (yyvsp[0].orderByColumns);
+}
+#line 1908 "sqlparser.cpp"
+    break;
+
+  case 26: /* WhereClause: WHERE aExpr  */
+#line 823 "KDbSqlParser.y"
+{
     (yyval.expr) = (yyvsp[0].expr);
 }
-#line 1692 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1916 "sqlparser.cpp"
     break;
 
-  case 20:
-#line 788 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 27: /* GroupByClause: GROUP BY aExprList2  */
+#line 830 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "GROUP BY" << *(yyvsp[0].exprList);
+    (yyval.selectOptions) = new SelectOptionsInternal;
+    for (int i = 0; i < (yyvsp[0].exprList)->argCount(); ++i) {
+        (yyval.selectOptions)->groupByExprs.append((yyvsp[0].exprList)->arg(i));
+    }
+    delete (yyvsp[0].exprList);
+}
+#line 1929 "sqlparser.cpp"
+    break;
+
+  case 28: /* GroupByClause: GROUP BY aExprList2 HAVING aExpr  */
+#line 839 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "GROUP BY" << *(yyvsp[-2].exprList) << "HAVING" << *(yyvsp[0].expr);
+    (yyval.selectOptions) = new SelectOptionsInternal;
+    for (int i = 0; i < (yyvsp[-2].exprList)->argCount(); ++i) {
+        (yyval.selectOptions)->groupByExprs.append((yyvsp[-2].exprList)->arg(i));
+    }
+    delete (yyvsp[-2].exprList);
+    (yyval.selectOptions)->havingExpr = *(yyvsp[0].expr);
+    delete (yyvsp[0].expr);
+}
+#line 1944 "sqlparser.cpp"
+    break;
+
+  case 29: /* GroupByClause: HAVING aExpr  */
+#line 850 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "HAVING" << *(yyvsp[0].expr);
+    (yyval.selectOptions) = new SelectOptionsInternal;
+    (yyval.selectOptions)->havingExpr = *(yyvsp[0].expr);
+    delete (yyvsp[0].expr);
+}
+#line 1955 "sqlparser.cpp"
+    break;
+
+  case 30: /* LimitClause: LIMIT INTEGER_CONST  */
+#line 860 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "LIMIT" << (yyvsp[0].integerValue);
+    (yyval.selectOptions) = new SelectOptionsInternal;
+    (yyval.selectOptions)->limit = (yyvsp[0].integerValue);
+}
+#line 1965 "sqlparser.cpp"
+    break;
+
+  case 31: /* LimitClause: LIMIT INTEGER_CONST OFFSET INTEGER_CONST  */
+#line 866 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "LIMIT" << (yyvsp[-2].integerValue) << "OFFSET" << (yyvsp[0].integerValue);
+    (yyval.selectOptions) = new SelectOptionsInternal;
+    (yyval.selectOptions)->limit = (yyvsp[-2].integerValue);
+    (yyval.selectOptions)->offset = (yyvsp[0].integerValue);
+}
+#line 1976 "sqlparser.cpp"
+    break;
+
+  case 32: /* LimitClause: OFFSET INTEGER_CONST  */
+#line 873 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "OFFSET" << (yyvsp[0].integerValue);
+    (yyval.selectOptions) = new SelectOptionsInternal;
+    (yyval.selectOptions)->offset = (yyvsp[0].integerValue);
+}
+#line 1986 "sqlparser.cpp"
+    break;
+
+  case 33: /* OrderByClause: OrderByColumnId  */
+#line 884 "KDbSqlParser.y"
+{
     sqlParserDebug() << "ORDER BY IDENTIFIER";
     (yyval.orderByColumns) = new QList<OrderByColumnInternal>;
     OrderByColumnInternal orderByColumn;
@@ -1701,12 +1995,12 @@ yyreduce:
     (yyval.orderByColumns)->append( orderByColumn );
     delete (yyvsp[0].variantValue);
 }
-#line 1705 "sqlparser.cpp" /* yacc.c:1646  */
+#line 1999 "sqlparser.cpp"
     break;
 
-  case 21:
-#line 797 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 34: /* OrderByClause: OrderByColumnId OrderByOption  */
+#line 893 "KDbSqlParser.y"
+{
     sqlParserDebug() << "ORDER BY IDENTIFIER OrderByOption";
     (yyval.orderByColumns) = new QList<OrderByColumnInternal>;
     OrderByColumnInternal orderByColumn;
@@ -1715,24 +2009,24 @@ yyreduce:
     (yyval.orderByColumns)->append( orderByColumn );
     delete (yyvsp[-1].variantValue);
 }
-#line 1719 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2013 "sqlparser.cpp"
     break;
 
-  case 22:
-#line 807 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 35: /* OrderByClause: OrderByColumnId ',' OrderByClause  */
+#line 903 "KDbSqlParser.y"
+{
     (yyval.orderByColumns) = (yyvsp[0].orderByColumns);
     OrderByColumnInternal orderByColumn;
     orderByColumn.setColumnByNameOrNumber( *(yyvsp[-2].variantValue) );
     (yyval.orderByColumns)->append( orderByColumn );
     delete (yyvsp[-2].variantValue);
 }
-#line 1731 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2025 "sqlparser.cpp"
     break;
 
-  case 23:
-#line 815 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 36: /* OrderByClause: OrderByColumnId OrderByOption ',' OrderByClause  */
+#line 911 "KDbSqlParser.y"
+{
     (yyval.orderByColumns) = (yyvsp[0].orderByColumns);
     OrderByColumnInternal orderByColumn;
     orderByColumn.setColumnByNameOrNumber( *(yyvsp[-3].variantValue) );
@@ -1740,209 +2034,209 @@ yyreduce:
     (yyval.orderByColumns)->append( orderByColumn );
     delete (yyvsp[-3].variantValue);
 }
-#line 1744 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2038 "sqlparser.cpp"
     break;
 
-  case 24:
-#line 827 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 37: /* OrderByColumnId: IDENTIFIER  */
+#line 923 "KDbSqlParser.y"
+{
     (yyval.variantValue) = new QVariant( *(yyvsp[0].stringValue) );
     sqlParserDebug() << "OrderByColumnId: " << *(yyval.variantValue);
     delete (yyvsp[0].stringValue);
 }
-#line 1754 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2048 "sqlparser.cpp"
     break;
 
-  case 25:
-#line 833 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 38: /* OrderByColumnId: IDENTIFIER '.' IDENTIFIER  */
+#line 929 "KDbSqlParser.y"
+{
     (yyval.variantValue) = new QVariant( *(yyvsp[-2].stringValue) + QLatin1Char('.') + *(yyvsp[0].stringValue) );
     sqlParserDebug() << "OrderByColumnId: " << *(yyval.variantValue);
     delete (yyvsp[-2].stringValue);
     delete (yyvsp[0].stringValue);
 }
-#line 1765 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2059 "sqlparser.cpp"
     break;
 
-  case 26:
-#line 840 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 39: /* OrderByColumnId: INTEGER_CONST  */
+#line 936 "KDbSqlParser.y"
+{
     (yyval.variantValue) = new QVariant((yyvsp[0].integerValue));
     sqlParserDebug() << "OrderByColumnId: " << *(yyval.variantValue);
 }
-#line 1774 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2068 "sqlparser.cpp"
     break;
 
-  case 27:
-#line 847 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 40: /* OrderByOption: ASC  */
+#line 943 "KDbSqlParser.y"
+{
     (yyval.sortOrderValue) = KDbOrderByColumn::SortOrder::Ascending;
 }
-#line 1782 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2076 "sqlparser.cpp"
     break;
 
-  case 28:
-#line 851 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 41: /* OrderByOption: DESC  */
+#line 947 "KDbSqlParser.y"
+{
     (yyval.sortOrderValue) = KDbOrderByColumn::SortOrder::Descending;
 }
-#line 1790 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2084 "sqlparser.cpp"
     break;
 
-  case 30:
-#line 863 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 43: /* aExpr2: aExpr3 AND aExpr2  */
+#line 959 "KDbSqlParser.y"
+{
 //    sqlParserDebug() << "AND " << $3.debugString();
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::AND, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1801 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2095 "sqlparser.cpp"
     break;
 
-  case 31:
-#line 870 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 44: /* aExpr2: aExpr3 OR aExpr2  */
+#line 966 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::OR, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1811 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2105 "sqlparser.cpp"
     break;
 
-  case 32:
-#line 876 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 45: /* aExpr2: aExpr3 XOR aExpr2  */
+#line 972 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::XOR, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1821 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2115 "sqlparser.cpp"
     break;
 
-  case 34:
-#line 888 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 47: /* aExpr3: aExpr4 '>' aExpr3  */
+#line 984 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '>', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1831 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2125 "sqlparser.cpp"
     break;
 
-  case 35:
-#line 894 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 48: /* aExpr3: aExpr4 GREATER_OR_EQUAL aExpr3  */
+#line 990 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::GREATER_OR_EQUAL, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1841 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2135 "sqlparser.cpp"
     break;
 
-  case 36:
-#line 900 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 49: /* aExpr3: aExpr4 '<' aExpr3  */
+#line 996 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '<', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1851 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2145 "sqlparser.cpp"
     break;
 
-  case 37:
-#line 906 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 50: /* aExpr3: aExpr4 LESS_OR_EQUAL aExpr3  */
+#line 1002 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::LESS_OR_EQUAL, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1861 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2155 "sqlparser.cpp"
     break;
 
-  case 38:
-#line 912 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 51: /* aExpr3: aExpr4 '=' aExpr3  */
+#line 1008 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '=', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1871 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2165 "sqlparser.cpp"
     break;
 
-  case 40:
-#line 924 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 53: /* aExpr4: aExpr5 NOT_EQUAL aExpr4  */
+#line 1020 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::NOT_EQUAL, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1881 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2175 "sqlparser.cpp"
     break;
 
-  case 41:
-#line 930 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 54: /* aExpr4: aExpr5 NOT_EQUAL2 aExpr4  */
+#line 1026 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::NOT_EQUAL2, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1891 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2185 "sqlparser.cpp"
     break;
 
-  case 42:
-#line 936 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 55: /* aExpr4: aExpr5 LIKE aExpr4  */
+#line 1032 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::LIKE, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1901 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2195 "sqlparser.cpp"
     break;
 
-  case 43:
-#line 942 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 56: /* aExpr4: aExpr5 NOT_LIKE aExpr4  */
+#line 1038 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::NOT_LIKE, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1911 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2205 "sqlparser.cpp"
     break;
 
-  case 44:
-#line 948 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 57: /* aExpr4: aExpr5 SQL_IN aExpr4  */
+#line 1044 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::SQL_IN, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1921 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2215 "sqlparser.cpp"
     break;
 
-  case 45:
-#line 954 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 58: /* aExpr4: aExpr5 SIMILAR_TO aExpr4  */
+#line 1050 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::SIMILAR_TO, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1931 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2225 "sqlparser.cpp"
     break;
 
-  case 46:
-#line 960 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 59: /* aExpr4: aExpr5 NOT_SIMILAR_TO aExpr4  */
+#line 1056 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::NOT_SIMILAR_TO, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1941 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2235 "sqlparser.cpp"
     break;
 
-  case 47:
-#line 966 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 60: /* aExpr4: aExpr5 BETWEEN aExpr4 AND aExpr4  */
+#line 1062 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbNArgExpression(KDb::RelationalExpression, KDbToken::BETWEEN_AND);
     (yyval.expr)->toNArg().append( *(yyvsp[-4].expr) );
     (yyval.expr)->toNArg().append( *(yyvsp[-2].expr) );
@@ -1951,12 +2245,12 @@ yyreduce:
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1955 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2249 "sqlparser.cpp"
     break;
 
-  case 48:
-#line 976 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 61: /* aExpr4: aExpr5 NOT_BETWEEN aExpr4 AND aExpr4  */
+#line 1072 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbNArgExpression(KDb::RelationalExpression, KDbToken::NOT_BETWEEN_AND);
     (yyval.expr)->toNArg().append( *(yyvsp[-4].expr) );
     (yyval.expr)->toNArg().append( *(yyvsp[-2].expr) );
@@ -1965,247 +2259,247 @@ yyreduce:
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1969 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2263 "sqlparser.cpp"
     break;
 
-  case 50:
-#line 992 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 63: /* aExpr5: aExpr5 SQL_IS_NULL  */
+#line 1088 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbUnaryExpression( KDbToken::SQL_IS_NULL, *(yyvsp[-1].expr) );
     delete (yyvsp[-1].expr);
 }
-#line 1978 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2272 "sqlparser.cpp"
     break;
 
-  case 51:
-#line 997 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 64: /* aExpr5: aExpr5 SQL_IS_NOT_NULL  */
+#line 1093 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbUnaryExpression( KDbToken::SQL_IS_NOT_NULL, *(yyvsp[-1].expr) );
     delete (yyvsp[-1].expr);
 }
-#line 1987 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2281 "sqlparser.cpp"
     break;
 
-  case 53:
-#line 1008 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 66: /* aExpr6: aExpr7 BITWISE_SHIFT_LEFT aExpr6  */
+#line 1104 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::BITWISE_SHIFT_LEFT, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 1997 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2291 "sqlparser.cpp"
     break;
 
-  case 54:
-#line 1014 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 67: /* aExpr6: aExpr7 BITWISE_SHIFT_RIGHT aExpr6  */
+#line 1110 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::BITWISE_SHIFT_RIGHT, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2007 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2301 "sqlparser.cpp"
     break;
 
-  case 56:
-#line 1026 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 69: /* aExpr7: aExpr8 '+' aExpr7  */
+#line 1122 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '+', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2017 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2311 "sqlparser.cpp"
     break;
 
-  case 57:
-#line 1032 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 70: /* aExpr7: aExpr8 CONCATENATION aExpr7  */
+#line 1128 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), KDbToken::CONCATENATION, *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2027 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2321 "sqlparser.cpp"
     break;
 
-  case 58:
-#line 1038 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 71: /* aExpr7: aExpr8 '-' aExpr7  */
+#line 1134 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '-', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2037 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2331 "sqlparser.cpp"
     break;
 
-  case 59:
-#line 1044 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 72: /* aExpr7: aExpr8 '&' aExpr7  */
+#line 1140 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '&', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2047 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2341 "sqlparser.cpp"
     break;
 
-  case 60:
-#line 1050 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 73: /* aExpr7: aExpr8 '|' aExpr7  */
+#line 1146 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '|', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2057 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2351 "sqlparser.cpp"
     break;
 
-  case 62:
-#line 1062 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 75: /* aExpr8: aExpr9 '/' aExpr8  */
+#line 1158 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '/', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2067 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2361 "sqlparser.cpp"
     break;
 
-  case 63:
-#line 1068 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 76: /* aExpr8: aExpr9 '*' aExpr8  */
+#line 1164 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '*', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2077 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2371 "sqlparser.cpp"
     break;
 
-  case 64:
-#line 1074 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 77: /* aExpr8: aExpr9 '%' aExpr8  */
+#line 1170 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(*(yyvsp[-2].expr), '%', *(yyvsp[0].expr));
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].expr);
 }
-#line 2087 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2381 "sqlparser.cpp"
     break;
 
-  case 66:
-#line 1087 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 79: /* aExpr9: '-' aExpr9  */
+#line 1183 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbUnaryExpression( '-', *(yyvsp[0].expr) );
     delete (yyvsp[0].expr);
 }
-#line 2096 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2390 "sqlparser.cpp"
     break;
 
-  case 67:
-#line 1092 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 80: /* aExpr9: '+' aExpr9  */
+#line 1188 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbUnaryExpression( '+', *(yyvsp[0].expr) );
     delete (yyvsp[0].expr);
 }
-#line 2105 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2399 "sqlparser.cpp"
     break;
 
-  case 68:
-#line 1097 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 81: /* aExpr9: '~' aExpr9  */
+#line 1193 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbUnaryExpression( '~', *(yyvsp[0].expr) );
     delete (yyvsp[0].expr);
 }
-#line 2114 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2408 "sqlparser.cpp"
     break;
 
-  case 69:
-#line 1102 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 82: /* aExpr9: NOT aExpr9  */
+#line 1198 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbUnaryExpression( KDbToken::NOT, *(yyvsp[0].expr) );
     delete (yyvsp[0].expr);
 }
-#line 2123 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2417 "sqlparser.cpp"
     break;
 
-  case 70:
-#line 1107 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 83: /* aExpr9: IDENTIFIER  */
+#line 1203 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbVariableExpression( *(yyvsp[0].stringValue) );
 
     //! @todo simplify this later if that's 'only one field name' expression
     sqlParserDebug() << "  + identifier: " << *(yyvsp[0].stringValue);
     delete (yyvsp[0].stringValue);
 }
-#line 2135 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2429 "sqlparser.cpp"
     break;
 
-  case 71:
-#line 1115 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 84: /* aExpr9: QUERY_PARAMETER  */
+#line 1211 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbQueryParameterExpression( *(yyvsp[0].stringValue) );
     sqlParserDebug() << "  + query parameter:" << *(yyval.expr);
     delete (yyvsp[0].stringValue);
 }
-#line 2145 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2439 "sqlparser.cpp"
     break;
 
-  case 72:
-#line 1121 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 85: /* aExpr9: IDENTIFIER aExprList  */
+#line 1217 "KDbSqlParser.y"
+{
     sqlParserDebug() << "  + function:" << *(yyvsp[-1].stringValue) << "(" << *(yyvsp[0].exprList) << ")";
     (yyval.expr) = new KDbFunctionExpression(*(yyvsp[-1].stringValue), *(yyvsp[0].exprList));
     delete (yyvsp[-1].stringValue);
     delete (yyvsp[0].exprList);
 }
-#line 2156 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2450 "sqlparser.cpp"
     break;
 
-  case 73:
-#line 1129 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 86: /* aExpr9: IDENTIFIER '.' IDENTIFIER  */
+#line 1225 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbVariableExpression( *(yyvsp[-2].stringValue) + QLatin1Char('.') + *(yyvsp[0].stringValue) );
     sqlParserDebug() << "  + identifier.identifier:" << *(yyvsp[-2].stringValue) << "." << *(yyvsp[0].stringValue);
     delete (yyvsp[-2].stringValue);
     delete (yyvsp[0].stringValue);
 }
-#line 2167 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2461 "sqlparser.cpp"
     break;
 
-  case 74:
-#line 1136 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 87: /* aExpr9: SQL_NULL  */
+#line 1232 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression( KDbToken::SQL_NULL, QVariant() );
     sqlParserDebug() << "  + NULL";
 //    $$ = new KDbField();
     //$$->setName(QString::null);
 }
-#line 2178 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2472 "sqlparser.cpp"
     break;
 
-  case 75:
-#line 1143 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 88: /* aExpr9: SQL_TRUE  */
+#line 1239 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression( KDbToken::SQL_TRUE, true );
 }
-#line 2186 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2480 "sqlparser.cpp"
     break;
 
-  case 76:
-#line 1147 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 89: /* aExpr9: SQL_FALSE  */
+#line 1243 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression( KDbToken::SQL_FALSE, false );
 }
-#line 2194 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2488 "sqlparser.cpp"
     break;
 
-  case 77:
-#line 1151 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 90: /* aExpr9: CHARACTER_STRING_LITERAL  */
+#line 1247 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression( KDbToken::CHARACTER_STRING_LITERAL, *(yyvsp[0].stringValue) );
     sqlParserDebug() << "  + constant " << (yyvsp[0].stringValue);
     delete (yyvsp[0].stringValue);
 }
-#line 2204 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2498 "sqlparser.cpp"
     break;
 
-  case 78:
-#line 1157 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 91: /* aExpr9: INTEGER_CONST  */
+#line 1253 "KDbSqlParser.y"
+{
     QVariant val;
     if ((yyvsp[0].integerValue) <= INT_MAX && (yyvsp[0].integerValue) >= INT_MIN)
         val = (int)(yyvsp[0].integerValue);
@@ -2221,136 +2515,136 @@ yyreduce:
     (yyval.expr) = new KDbConstExpression( KDbToken::INTEGER_CONST, val );
     sqlParserDebug() << "  + int constant: " << val.toString();
 }
-#line 2225 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2519 "sqlparser.cpp"
     break;
 
-  case 79:
-#line 1174 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 92: /* aExpr9: REAL_CONST  */
+#line 1270 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression( KDbToken::REAL_CONST, *(yyvsp[0].binaryValue) );
     sqlParserDebug() << "  + real constant: " << *(yyvsp[0].binaryValue);
     delete (yyvsp[0].binaryValue);
 }
-#line 2235 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2529 "sqlparser.cpp"
     break;
 
-  case 80:
-#line 1180 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 93: /* aExpr9: DateConst  */
+#line 1276 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression(KDbToken::DATE_CONST, QVariant::fromValue(*(yyvsp[0].dateValue)));
     sqlParserDebug() << "  + date constant:" << *(yyvsp[0].dateValue);
     delete (yyvsp[0].dateValue);
 }
-#line 2245 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2539 "sqlparser.cpp"
     break;
 
-  case 81:
-#line 1186 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 94: /* aExpr9: TimeConst  */
+#line 1282 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression(KDbToken::TIME_CONST, QVariant::fromValue(*(yyvsp[0].timeValue)));
     sqlParserDebug() << "  + time constant:" << *(yyvsp[0].timeValue);
     delete (yyvsp[0].timeValue);
 }
-#line 2255 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2549 "sqlparser.cpp"
     break;
 
-  case 82:
-#line 1192 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 95: /* aExpr9: DateTimeConst  */
+#line 1288 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbConstExpression(KDbToken::DATETIME_CONST, QVariant::fromValue(*(yyvsp[0].dateTimeValue)));
     sqlParserDebug() << "  + datetime constant:" << *(yyvsp[0].dateTimeValue);
     delete (yyvsp[0].dateTimeValue);
 }
-#line 2265 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2559 "sqlparser.cpp"
     break;
 
-  case 84:
-#line 1203 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 97: /* DateConst: '#' DateValue '#'  */
+#line 1299 "KDbSqlParser.y"
+{
     (yyval.dateValue) = (yyvsp[-1].dateValue);
     sqlParserDebug() << "DateConst:" << *(yyval.dateValue);
 }
-#line 2274 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2568 "sqlparser.cpp"
     break;
 
-  case 85:
-#line 1211 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 98: /* DateValue: YearConst '-' DATE_TIME_INTEGER '-' DATE_TIME_INTEGER  */
+#line 1307 "KDbSqlParser.y"
+{
     (yyval.dateValue) = new KDbDate(*(yyvsp[-4].yearValue), *(yyvsp[-2].binaryValue), *(yyvsp[0].binaryValue));
     sqlParserDebug() << "DateValue:" << *(yyval.dateValue);
     delete (yyvsp[-4].yearValue);
     delete (yyvsp[-2].binaryValue);
     delete (yyvsp[0].binaryValue);
 }
-#line 2286 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2580 "sqlparser.cpp"
     break;
 
-  case 86:
-#line 1219 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 99: /* DateValue: DATE_TIME_INTEGER '/' DATE_TIME_INTEGER '/' YearConst  */
+#line 1315 "KDbSqlParser.y"
+{
     (yyval.dateValue) = new KDbDate(*(yyvsp[0].yearValue), *(yyvsp[-4].binaryValue), *(yyvsp[-2].binaryValue));
     sqlParserDebug() << "DateValue:" << *(yyval.dateValue);
     delete (yyvsp[-4].binaryValue);
     delete (yyvsp[-2].binaryValue);
     delete (yyvsp[0].yearValue);
 }
-#line 2298 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2592 "sqlparser.cpp"
     break;
 
-  case 87:
-#line 1230 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 100: /* YearConst: DATE_TIME_INTEGER  */
+#line 1326 "KDbSqlParser.y"
+{
     (yyval.yearValue) = new KDbYear(KDbYear::Sign::None, *(yyvsp[0].binaryValue));
     sqlParserDebug() << "YearConst:" << *(yyval.yearValue);
     delete (yyvsp[0].binaryValue);
 }
-#line 2308 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2602 "sqlparser.cpp"
     break;
 
-  case 88:
-#line 1236 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 101: /* YearConst: '+' DATE_TIME_INTEGER  */
+#line 1332 "KDbSqlParser.y"
+{
     (yyval.yearValue) = new KDbYear(KDbYear::Sign::Plus, *(yyvsp[0].binaryValue));
     sqlParserDebug() << "YearConst:" << *(yyval.yearValue);
     delete (yyvsp[0].binaryValue);
 }
-#line 2318 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2612 "sqlparser.cpp"
     break;
 
-  case 89:
-#line 1242 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 102: /* YearConst: '-' DATE_TIME_INTEGER  */
+#line 1338 "KDbSqlParser.y"
+{
     (yyval.yearValue) = new KDbYear(KDbYear::Sign::Minus, *(yyvsp[0].binaryValue));
     sqlParserDebug() << "YearConst:" << *(yyval.yearValue);
     delete (yyvsp[0].binaryValue);
 }
-#line 2328 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2622 "sqlparser.cpp"
     break;
 
-  case 90:
-#line 1251 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 103: /* TimeConst: '#' TimeValue '#'  */
+#line 1347 "KDbSqlParser.y"
+{
     (yyval.timeValue) = (yyvsp[-1].timeValue);
     sqlParserDebug() << "TimeConst:" << *(yyval.timeValue);
 }
-#line 2337 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2631 "sqlparser.cpp"
     break;
 
-  case 91:
-#line 1259 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 104: /* TimeValue: DATE_TIME_INTEGER ':' DATE_TIME_INTEGER TimeMs TimePeriod  */
+#line 1355 "KDbSqlParser.y"
+{
     (yyval.timeValue) = new KDbTime(*(yyvsp[-4].binaryValue), *(yyvsp[-2].binaryValue), {}, *(yyvsp[-1].binaryValue), (yyvsp[0].timePeriodValue));
     sqlParserDebug() << "TimeValue:" << *(yyval.timeValue);
     delete (yyvsp[-4].binaryValue);
     delete (yyvsp[-2].binaryValue);
     delete (yyvsp[-1].binaryValue);
 }
-#line 2349 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2643 "sqlparser.cpp"
     break;
 
-  case 92:
-#line 1267 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 105: /* TimeValue: DATE_TIME_INTEGER ':' DATE_TIME_INTEGER ':' DATE_TIME_INTEGER TimeMs TimePeriod  */
+#line 1363 "KDbSqlParser.y"
+{
     (yyval.timeValue) = new KDbTime(*(yyvsp[-6].binaryValue), *(yyvsp[-4].binaryValue), *(yyvsp[-2].binaryValue), *(yyvsp[-1].binaryValue), (yyvsp[0].timePeriodValue));
     sqlParserDebug() << "TimeValue:" << *(yyval.timeValue);
     delete (yyvsp[-6].binaryValue);
@@ -2358,137 +2652,148 @@ yyreduce:
     delete (yyvsp[-2].binaryValue);
     delete (yyvsp[-1].binaryValue);
 }
-#line 2362 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2656 "sqlparser.cpp"
     break;
 
-  case 93:
-#line 1279 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 106: /* TimeMs: '.' DATE_TIME_INTEGER  */
+#line 1375 "KDbSqlParser.y"
+{
     (yyval.binaryValue) = (yyvsp[0].binaryValue);
 }
-#line 2370 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2664 "sqlparser.cpp"
     break;
 
-  case 94:
-#line 1283 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 107: /* TimeMs: %empty  */
+#line 1379 "KDbSqlParser.y"
+{
     (yyval.binaryValue) = new QByteArray;
 }
-#line 2378 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2672 "sqlparser.cpp"
     break;
 
-  case 95:
-#line 1290 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 108: /* TimePeriod: TIME_AM  */
+#line 1386 "KDbSqlParser.y"
+{
     (yyval.timePeriodValue) = KDbTime::Period::Am;
 }
-#line 2386 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2680 "sqlparser.cpp"
     break;
 
-  case 96:
-#line 1294 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 109: /* TimePeriod: TIME_PM  */
+#line 1390 "KDbSqlParser.y"
+{
     (yyval.timePeriodValue) = KDbTime::Period::Pm;
 }
-#line 2394 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2688 "sqlparser.cpp"
     break;
 
-  case 97:
-#line 1298 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 110: /* TimePeriod: %empty  */
+#line 1394 "KDbSqlParser.y"
+{
     (yyval.timePeriodValue) = KDbTime::Period::None;
 }
-#line 2402 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2696 "sqlparser.cpp"
     break;
 
-  case 98:
-#line 1305 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 111: /* DateTimeConst: '#' DateValue TABS_OR_SPACES TimeValue '#'  */
+#line 1401 "KDbSqlParser.y"
+{
     (yyval.dateTimeValue) = new KDbDateTime(*(yyvsp[-3].dateValue), *(yyvsp[-1].timeValue));
     sqlParserDebug() << "DateTimeConst:" << *(yyval.dateTimeValue);
     delete (yyvsp[-3].dateValue);
     delete (yyvsp[-1].timeValue);
 }
-#line 2413 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2707 "sqlparser.cpp"
     break;
 
-  case 99:
-#line 1315 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 112: /* aExpr10: '(' aExpr ')'  */
+#line 1411 "KDbSqlParser.y"
+{
     sqlParserDebug() << "(expr)";
     (yyval.expr) = new KDbUnaryExpression('(', *(yyvsp[-1].expr));
     delete (yyvsp[-1].expr);
 }
-#line 2423 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2717 "sqlparser.cpp"
     break;
 
-  case 100:
-#line 1324 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 113: /* aExprList: '(' aExprList2 ')'  */
+#line 1420 "KDbSqlParser.y"
+{
     (yyval.exprList) = (yyvsp[-1].exprList);
 }
-#line 2431 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2725 "sqlparser.cpp"
     break;
 
-  case 101:
-#line 1328 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 114: /* aExprList: '(' ')'  */
+#line 1424 "KDbSqlParser.y"
+{
     (yyval.exprList) = new KDbNArgExpression(KDb::ArgumentListExpression, ',');
 }
-#line 2439 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2733 "sqlparser.cpp"
     break;
 
-  case 102:
-#line 1335 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 115: /* aExprList: '(' '*' ')'  */
+#line 1428 "KDbSqlParser.y"
+{
+    sqlParserDebug() << "(*)";
+    // only COUNT(*) is valid, this is checked when the function is validated
+    (yyval.exprList) = new KDbNArgExpression(KDb::ArgumentListExpression, ',');
+    (yyval.exprList)->append(KDbVariableExpression(QLatin1String("*")));
+}
+#line 2744 "sqlparser.cpp"
+    break;
+
+  case 116: /* aExprList2: aExpr ',' aExprList2  */
+#line 1438 "KDbSqlParser.y"
+{
     (yyval.exprList) = (yyvsp[0].exprList);
     (yyval.exprList)->prepend( *(yyvsp[-2].expr) );
     delete (yyvsp[-2].expr);
 }
-#line 2449 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2754 "sqlparser.cpp"
     break;
 
-  case 103:
-#line 1341 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 117: /* aExprList2: aExpr  */
+#line 1444 "KDbSqlParser.y"
+{
     (yyval.exprList) = new KDbNArgExpression(KDb::ArgumentListExpression, ',');
     (yyval.exprList)->append( *(yyvsp[0].expr) );
     delete (yyvsp[0].expr);
 }
-#line 2459 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2764 "sqlparser.cpp"
     break;
 
-  case 104:
-#line 1350 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 118: /* Tables: FROM FlatTableList  */
+#line 1453 "KDbSqlParser.y"
+{
     (yyval.exprList) = (yyvsp[0].exprList);
 }
-#line 2467 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2772 "sqlparser.cpp"
     break;
 
-  case 105:
-#line 1395 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 119: /* FlatTableList: FlatTableList ',' FlatTable  */
+#line 1498 "KDbSqlParser.y"
+{
     (yyval.exprList) = (yyvsp[-2].exprList);
     (yyval.exprList)->append(*(yyvsp[0].expr));
     delete (yyvsp[0].expr);
 }
-#line 2477 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2782 "sqlparser.cpp"
     break;
 
-  case 106:
-#line 1401 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 120: /* FlatTableList: FlatTable  */
+#line 1504 "KDbSqlParser.y"
+{
     (yyval.exprList) = new KDbNArgExpression(KDb::TableListExpression, KDbToken::IDENTIFIER); //ok?
     (yyval.exprList)->append(*(yyvsp[0].expr));
     delete (yyvsp[0].expr);
 }
-#line 2487 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2792 "sqlparser.cpp"
     break;
 
-  case 107:
-#line 1410 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 121: /* FlatTable: IDENTIFIER  */
+#line 1513 "KDbSqlParser.y"
+{
     sqlParserDebug() << "FROM: '" << *(yyvsp[0].stringValue) << "'";
     (yyval.expr) = new KDbVariableExpression(*(yyvsp[0].stringValue));
 
@@ -2515,12 +2820,12 @@ yyreduce:
     }*/
     delete (yyvsp[0].stringValue);
 }
-#line 2519 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2824 "sqlparser.cpp"
     break;
 
-  case 108:
-#line 1438 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 122: /* FlatTable: IDENTIFIER IDENTIFIER  */
+#line 1541 "KDbSqlParser.y"
+{
     //table + alias
     (yyval.expr) = new KDbBinaryExpression(
         KDbVariableExpression(*(yyvsp[-1].stringValue)), KDbToken::AS_EMPTY,
@@ -2529,12 +2834,12 @@ yyreduce:
     delete (yyvsp[-1].stringValue);
     delete (yyvsp[0].stringValue);
 }
-#line 2533 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2838 "sqlparser.cpp"
     break;
 
-  case 109:
-#line 1448 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 123: /* FlatTable: IDENTIFIER AS IDENTIFIER  */
+#line 1551 "KDbSqlParser.y"
+{
     //table + alias
     (yyval.expr) = new KDbBinaryExpression(
         KDbVariableExpression(*(yyvsp[-2].stringValue)), KDbToken::AS,
@@ -2543,34 +2848,34 @@ yyreduce:
     delete (yyvsp[-2].stringValue);
     delete (yyvsp[0].stringValue);
 }
-#line 2547 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2852 "sqlparser.cpp"
     break;
 
-  case 110:
-#line 1463 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 124: /* ColViews: ColViews ',' ColItem  */
+#line 1566 "KDbSqlParser.y"
+{
     (yyval.exprList) = (yyvsp[-2].exprList);
     (yyval.exprList)->append(*(yyvsp[0].expr));
     delete (yyvsp[0].expr);
     sqlParserDebug() << "ColViews: ColViews , ColItem";
 }
-#line 2558 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2863 "sqlparser.cpp"
     break;
 
-  case 111:
-#line 1470 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 125: /* ColViews: ColItem  */
+#line 1573 "KDbSqlParser.y"
+{
     (yyval.exprList) = new KDbNArgExpression(KDb::FieldListExpression, KDbToken());
     (yyval.exprList)->append(*(yyvsp[0].expr));
     delete (yyvsp[0].expr);
     sqlParserDebug() << "ColViews: ColItem";
 }
-#line 2569 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2874 "sqlparser.cpp"
     break;
 
-  case 112:
-#line 1480 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 126: /* ColItem: ColExpression  */
+#line 1583 "KDbSqlParser.y"
+{
 //    $$ = new KDbField();
 //    dummy->addField($$);
 //    $$->setExpression( $1 );
@@ -2578,21 +2883,21 @@ yyreduce:
     (yyval.expr) = (yyvsp[0].expr);
     sqlParserDebug() << " added column expr:" << *(yyvsp[0].expr);
 }
-#line 2582 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2887 "sqlparser.cpp"
     break;
 
-  case 113:
-#line 1489 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 127: /* ColItem: ColWildCard  */
+#line 1592 "KDbSqlParser.y"
+{
     (yyval.expr) = (yyvsp[0].expr);
     sqlParserDebug() << " added column wildcard:" << *(yyvsp[0].expr);
 }
-#line 2591 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2896 "sqlparser.cpp"
     break;
 
-  case 114:
-#line 1494 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 128: /* ColItem: ColExpression AS IDENTIFIER  */
+#line 1597 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(
         *(yyvsp[-2].expr), KDbToken::AS,
         KDbVariableExpression(*(yyvsp[0].stringValue))
@@ -2601,12 +2906,12 @@ yyreduce:
     delete (yyvsp[-2].expr);
     delete (yyvsp[0].stringValue);
 }
-#line 2605 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2910 "sqlparser.cpp"
     break;
 
-  case 115:
-#line 1504 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 129: /* ColItem: ColExpression IDENTIFIER  */
+#line 1607 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbBinaryExpression(
         *(yyvsp[-1].expr), KDbToken::AS_EMPTY,
         KDbVariableExpression(*(yyvsp[0].stringValue))
@@ -2615,30 +2920,30 @@ yyreduce:
     delete (yyvsp[-1].expr);
     delete (yyvsp[0].stringValue);
 }
-#line 2619 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2924 "sqlparser.cpp"
     break;
 
-  case 116:
-#line 1517 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 130: /* ColExpression: aExpr  */
+#line 1620 "KDbSqlParser.y"
+{
     (yyval.expr) = (yyvsp[0].expr);
 }
-#line 2627 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2932 "sqlparser.cpp"
     break;
 
-  case 117:
-#line 1563 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 131: /* ColExpression: DISTINCT '(' ColExpression ')'  */
+#line 1666 "KDbSqlParser.y"
+{
     (yyval.expr) = (yyvsp[-1].expr);
 //! @todo DISTINCT '(' ColExpression ')'
 //    $$->setName("DISTINCT(" + $3->name() + ")");
 }
-#line 2637 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2942 "sqlparser.cpp"
     break;
 
-  case 118:
-#line 1572 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 132: /* ColWildCard: '*'  */
+#line 1675 "KDbSqlParser.y"
+{
     (yyval.expr) = new KDbVariableExpression(QLatin1String("*"));
     sqlParserDebug() << "all columns";
 
@@ -2646,23 +2951,24 @@ yyreduce:
 //    globalParser->query()->addAsterisk(ast);
 //    requiresTable = true;
 }
-#line 2650 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2955 "sqlparser.cpp"
     break;
 
-  case 119:
-#line 1581 "KDbSqlParser.y" /* yacc.c:1646  */
-    {
+  case 133: /* ColWildCard: IDENTIFIER '.' '*'  */
+#line 1684 "KDbSqlParser.y"
+{
     QString s( *(yyvsp[-2].stringValue) );
     s += QLatin1String(".*");
     (yyval.expr) = new KDbVariableExpression(s);
     sqlParserDebug() << "  + all columns from " << s;
     delete (yyvsp[-2].stringValue);
 }
-#line 2662 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2967 "sqlparser.cpp"
     break;
 
 
-#line 2666 "sqlparser.cpp" /* yacc.c:1646  */
+#line 2971 "sqlparser.cpp"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -2676,25 +2982,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -2705,50 +3009,44 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
-      yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
       {
+        yypcontext_t yyctx
+          = {yyssp, yytoken};
         char const *yymsgp = YY_("syntax error");
         int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
+        yysyntax_error_status = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
         if (yysyntax_error_status == 0)
           yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
+        else if (yysyntax_error_status == -1)
           {
             if (yymsg != yymsgbuf)
               YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
+            yymsg = YY_CAST (char *,
+                             YYSTACK_ALLOC (YY_CAST (YYSIZE_T, yymsg_alloc)));
+            if (yymsg)
               {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
+                yysyntax_error_status
+                  = yysyntax_error (&yymsg_alloc, &yymsg, &yyctx);
+                yymsgp = yymsg;
               }
             else
               {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
+                yymsg = yymsgbuf;
+                yymsg_alloc = sizeof yymsgbuf;
+                yysyntax_error_status = YYENOMEM;
               }
           }
         yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
+        if (yysyntax_error_status == YYENOMEM)
+          YYNOMEM;
       }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -2777,12 +3075,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -2799,13 +3096,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -2819,7 +3117,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -2831,7 +3129,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -2842,26 +3140,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -2877,20 +3179,19 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
   if (yymsg != yymsgbuf)
     YYSTACK_FREE (yymsg);
-#endif
   return yyresult;
 }
-#line 1596 "KDbSqlParser.y" /* yacc.c:1906  */
+
+#line 1699 "KDbSqlParser.y"
 
 
 KDB_TESTING_EXPORT const char* g_tokenName(unsigned int offset) {
@@ -13,11 +13,12 @@
 struct OrderByColumnInternal;
 struct SelectOptionsInternal;
 
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -30,7 +31,7 @@ struct SelectOptionsInternal;
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -45,6 +46,10 @@ struct SelectOptionsInternal;
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_KDBSQLPARSER_TAB_H_INCLUDED
 # define YY_YY_KDBSQLPARSER_TAB_H_INCLUDED
 /* Debug traces.  */
@@ -55,87 +60,95 @@ struct SelectOptionsInternal;
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    SQL_TYPE = 258,
-    AS = 259,
-    AS_EMPTY = 260,
-    ASC = 261,
-    AUTO_INCREMENT = 262,
-    BIT = 263,
-    BITWISE_SHIFT_LEFT = 264,
-    BITWISE_SHIFT_RIGHT = 265,
-    BY = 266,
-    CHARACTER_STRING_LITERAL = 267,
-    CONCATENATION = 268,
-    CREATE = 269,
-    DESC = 270,
-    DISTINCT = 271,
-    DOUBLE_QUOTED_STRING = 272,
-    FROM = 273,
-    JOIN = 274,
-    KEY = 275,
-    LEFT = 276,
-    LESS_OR_EQUAL = 277,
-    GREATER_OR_EQUAL = 278,
-    SQL_NULL = 279,
-    SQL_IS = 280,
-    SQL_IS_NULL = 281,
-    SQL_IS_NOT_NULL = 282,
-    ORDER = 283,
-    PRIMARY = 284,
-    SELECT = 285,
-    INTEGER_CONST = 286,
-    REAL_CONST = 287,
-    RIGHT = 288,
-    SQL_ON = 289,
-    DATE_CONST = 290,
-    DATETIME_CONST = 291,
-    TIME_CONST = 292,
-    TABLE = 293,
-    IDENTIFIER = 294,
-    IDENTIFIER_DOT_ASTERISK = 295,
-    QUERY_PARAMETER = 296,
-    VARCHAR = 297,
-    WHERE = 298,
-    SQL = 299,
-    SQL_TRUE = 300,
-    SQL_FALSE = 301,
-    UNION = 302,
-    SCAN_ERROR = 303,
-    AND = 304,
-    BETWEEN = 305,
-    NOT_BETWEEN = 306,
-    EXCEPT = 307,
-    SQL_IN = 308,
-    INTERSECT = 309,
-    LIKE = 310,
-    ILIKE = 311,
-    NOT_LIKE = 312,
-    NOT = 313,
-    NOT_EQUAL = 314,
-    NOT_EQUAL2 = 315,
-    OR = 316,
-    SIMILAR_TO = 317,
-    NOT_SIMILAR_TO = 318,
-    XOR = 319,
-    UMINUS = 320,
-    TABS_OR_SPACES = 321,
-    DATE_TIME_INTEGER = 322,
-    TIME_AM = 323,
-    TIME_PM = 324
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SQL_TYPE = 258,                /* SQL_TYPE  */
+    AS = 259,                      /* AS  */
+    AS_EMPTY = 260,                /* AS_EMPTY  */
+    ASC = 261,                     /* ASC  */
+    AUTO_INCREMENT = 262,          /* AUTO_INCREMENT  */
+    BIT = 263,                     /* BIT  */
+    BITWISE_SHIFT_LEFT = 264,      /* BITWISE_SHIFT_LEFT  */
+    BITWISE_SHIFT_RIGHT = 265,     /* BITWISE_SHIFT_RIGHT  */
+    BY = 266,                      /* BY  */
+    CHARACTER_STRING_LITERAL = 267, /* CHARACTER_STRING_LITERAL  */
+    CONCATENATION = 268,           /* CONCATENATION  */
+    CREATE = 269,                  /* CREATE  */
+    DESC = 270,                    /* DESC  */
+    DISTINCT = 271,                /* DISTINCT  */
+    DOUBLE_QUOTED_STRING = 272,    /* DOUBLE_QUOTED_STRING  */
+    FROM = 273,                    /* FROM  */
+    JOIN = 274,                    /* JOIN  */
+    KEY = 275,                     /* KEY  */
+    LEFT = 276,                    /* LEFT  */
+    LESS_OR_EQUAL = 277,           /* LESS_OR_EQUAL  */
+    GREATER_OR_EQUAL = 278,        /* GREATER_OR_EQUAL  */
+    SQL_NULL = 279,                /* SQL_NULL  */
+    SQL_IS = 280,                  /* SQL_IS  */
+    SQL_IS_NULL = 281,             /* SQL_IS_NULL  */
+    SQL_IS_NOT_NULL = 282,         /* SQL_IS_NOT_NULL  */
+    ORDER = 283,                   /* ORDER  */
+    PRIMARY = 284,                 /* PRIMARY  */
+    SELECT = 285,                  /* SELECT  */
+    INTEGER_CONST = 286,           /* INTEGER_CONST  */
+    REAL_CONST = 287,              /* REAL_CONST  */
+    RIGHT = 288,                   /* RIGHT  */
+    SQL_ON = 289,                  /* SQL_ON  */
+    DATE_CONST = 290,              /* DATE_CONST  */
+    DATETIME_CONST = 291,          /* DATETIME_CONST  */
+    TIME_CONST = 292,              /* TIME_CONST  */
+    TABLE = 293,                   /* TABLE  */
+    IDENTIFIER = 294,              /* IDENTIFIER  */
+    IDENTIFIER_DOT_ASTERISK = 295, /* IDENTIFIER_DOT_ASTERISK  */
+    QUERY_PARAMETER = 296,         /* QUERY_PARAMETER  */
+    VARCHAR = 297,                 /* VARCHAR  */
+    WHERE = 298,                   /* WHERE  */
+    SQL = 299,                     /* SQL  */
+    SQL_TRUE = 300,                /* SQL_TRUE  */
+    SQL_FALSE = 301,               /* SQL_FALSE  */
+    UNION = 302,                   /* UNION  */
+    SCAN_ERROR = 303,              /* SCAN_ERROR  */
+    AND = 304,                     /* AND  */
+    BETWEEN = 305,                 /* BETWEEN  */
+    NOT_BETWEEN = 306,             /* NOT_BETWEEN  */
+    EXCEPT = 307,                  /* EXCEPT  */
+    SQL_IN = 308,                  /* SQL_IN  */
+    INTERSECT = 309,               /* INTERSECT  */
+    LIKE = 310,                    /* LIKE  */
+    ILIKE = 311,                   /* ILIKE  */
+    NOT_LIKE = 312,                /* NOT_LIKE  */
+    NOT = 313,                     /* NOT  */
+    NOT_EQUAL = 314,               /* NOT_EQUAL  */
+    NOT_EQUAL2 = 315,              /* NOT_EQUAL2  */
+    OR = 316,                      /* OR  */
+    SIMILAR_TO = 317,              /* SIMILAR_TO  */
+    NOT_SIMILAR_TO = 318,          /* NOT_SIMILAR_TO  */
+    XOR = 319,                     /* XOR  */
+    UMINUS = 320,                  /* UMINUS  */
+    TABS_OR_SPACES = 321,          /* TABS_OR_SPACES  */
+    DATE_TIME_INTEGER = 322,       /* DATE_TIME_INTEGER  */
+    TIME_AM = 323,                 /* TIME_AM  */
+    TIME_PM = 324,                 /* TIME_PM  */
+    LIMIT = 325,                   /* LIMIT  */
+    OFFSET = 326,                  /* OFFSET  */
+    GROUP = 327,                   /* GROUP  */
+    HAVING = 328                   /* HAVING  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 505 "KDbSqlParser.y" /* yacc.c:1909  */
+#line 510 "KDbSqlParser.y"
 
     QString* stringValue;
     QByteArray* binaryValue;
@@ -157,9 +170,9 @@ union YYSTYPE
     QList<OrderByColumnInternal> *orderByColumns;
     QVariant *variantValue;
 
-#line 146 "KDbSqlParser.tab.h" /* yacc.c:1909  */
-};
+#line 159 "KDbSqlParser.tab.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -168,7 +181,9 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_KDBSQLPARSER_TAB_H_INCLUDED  */
 #endif
@@ -22,29 +22,144 @@
 #include "KDbJsonTrader_p.h"
 #include "KDb.h"
 #include "kdb_debug.h"
+#include "config-kdb.h"
+#include "kdb_version.h"
+
+#include <KPluginMetaData>
 
 #include <QList>
 #include <QPluginLoader>
+#include <QJsonDocument>
 #include <QJsonObject>
 #include <QJsonArray>
 #include <QDirIterator>
 #include <QDir>
 #include <QCoreApplication>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QLibrary>
+#include <QSaveFile>
+#include <QSet>
+#include <QStandardPaths>
 
 Q_GLOBAL_STATIC(KDbJsonTrader, KDbJsonTrader_instance)
 
+//! Version of the plugin index format, increase on incompatible changes
+static const int PLUGIN_INDEX_VERSION = 1;
+
 class Q_DECL_HIDDEN KDbJsonTrader::Private
 {
 public:
-    Private() : pluginPathFound(false)
+    Private() : pluginPathFound(false), indexLoaded(false), indexModified(false)
     {
     }
+
+    //! Loads the index file if it is not loaded yet
+    void loadIndex();
+
+    //! Saves the index file if it was modified
+    void saveIndex();
+
+    //! @return metadata of plugin file @a fileInfo, reads it using the index if possible;
+    //! object is empty if the file is not a plugin
+    QJsonObject metaData(const QFileInfo &fileInfo);
+
+    //! @return metadata of plugins from @a path matching @a servicetype and @a mimetype
+    QList<KPluginMetaData> findPlugins(const QString &path, const QString &servicetype,
+                                       const QString &mimetype);
+
     bool pluginPathFound;
     QStringList pluginPaths;
+    bool indexLoaded;
+    bool indexModified;
+    QJsonObject index; //!< file path -> {mtime, size, metaData}
+    QSet<QString> usedIndexEntries;
 private:
     Q_DISABLE_COPY(Private)
 };
 
+void KDbJsonTrader::Private::loadIndex()
+{
+    if (indexLoaded) {
+        return;
+    }
+    indexLoaded = true;
+    const QString path(KDbJsonTrader::indexFilePath());
+    if (path.isEmpty()) {
+        return;
+    }
+    QFile file(path);
+    if (!file.open(QIODevice::ReadOnly)) {
+        return;
+    }
+    const QJsonObject root(QJsonDocument::fromJson(file.readAll()).object());
+    if (root.value(QLatin1String("version")).toInt() == PLUGIN_INDEX_VERSION
+        && root.value(QLatin1String("kdbVersion")).toString() == QLatin1String(KDB_VERSION_STRING))
+    {
+        index = root.value(QLatin1String("files")).toObject();
+    }
+}
+
+void KDbJsonTrader::Private::saveIndex()
+{
+    // forget files that do not exist anymore
+    for (auto it = index.begin(); it != index.end();) {
+        if (usedIndexEntries.contains(it.key())) {
+            ++it;
+        } else {
+            it = index.erase(it);
+            indexModified = true;
+        }
+    }
+    usedIndexEntries.clear();
+    const QString path(KDbJsonTrader::indexFilePath());
+    if (!indexModified || path.isEmpty()) {
+        return;
+    }
+    indexModified = false;
+    if (!QDir().mkpath(QFileInfo(path).absolutePath())) {
+        kdbWarning() << "Could not create directory for plugin index" << path;
+        return;
+    }
+    QJsonObject root;
+    root.insert(QLatin1String("version"), PLUGIN_INDEX_VERSION);
+    root.insert(QLatin1String("kdbVersion"), QLatin1String(KDB_VERSION_STRING));
+    root.insert(QLatin1String("files"), index);
+    QSaveFile file(path);
+    if (!file.open(QIODevice::WriteOnly)
+        || file.write(QJsonDocument(root).toJson(QJsonDocument::Compact)) < 0
+        || !file.commit())
+    {
+        kdbWarning() << "Could not save plugin index" << path << file.errorString();
+    }
+}
+
+QJsonObject KDbJsonTrader::Private::metaData(const QFileInfo &fileInfo)
+{
+    const QString filePath(fileInfo.filePath());
+    const double mtime = fileInfo.lastModified().toMSecsSinceEpoch();
+    const double size = fileInfo.size();
+    usedIndexEntries.insert(filePath);
+    const QJsonObject entry(index.value(filePath).toObject());
+    if (!entry.isEmpty() && entry.value(QLatin1String("mtime")).toDouble() == mtime
+        && entry.value(QLatin1String("size")).toDouble() == size)
+    {
+        return entry.value(QLatin1String("metaData")).toObject();
+    }
+    QJsonObject result;
+    if (QLibrary::isLibrary(filePath)) {
+        result = QPluginLoader(filePath).metaData();
+    }
+    QJsonObject newEntry;
+    newEntry.insert(QLatin1String("mtime"), mtime);
+    newEntry.insert(QLatin1String("size"), size);
+    newEntry.insert(QLatin1String("metaData"), result);
+    index.insert(filePath, newEntry);
+    indexModified = true;
+    return result;
+}
+
 // ---
 
 KDbJsonTrader::KDbJsonTrader()
@@ -63,11 +178,24 @@ KDbJsonTrader* KDbJsonTrader::self()
     return KDbJsonTrader_instance;
 }
 
-//! Checks loader @a loader
-static bool checkLoader(QPluginLoader *loader, const QString &servicetype,
-                        const QString &mimetype)
+//static
+QString KDbJsonTrader::indexFilePath()
+{
+    if (!qEnvironmentVariableIsEmpty("KDB_NO_PLUGIN_INDEX")) {
+        return QString();
+    }
+    const QString dir(QStandardPaths::writableLocation(QStandardPaths::GenericCacheLocation));
+    if (dir.isEmpty()) {
+        return QString();
+    }
+    return dir + QLatin1String("/" KDB_BASE_NAME_LOWER "/plugin-index.json");
+}
+
+//! Checks plugin metadata @a metaData
+static bool checkMetaData(const QJsonObject &metaData, const QString &servicetype,
+                          const QString &mimetype)
 {
-    QJsonObject json = loader->metaData().value(QLatin1String("MetaData")).toObject();
+    QJsonObject json = metaData.value(QLatin1String("MetaData")).toObject();
     if (json.isEmpty()) {
         //kdbDebug() << dirIter.filePath() << "has no json!";
         return false;
@@ -90,35 +218,63 @@ static bool checkLoader(QPluginLoader *loader, const QString &servicetype,
     return true;
 }
 
-static QList<QPluginLoader *> findPlugins(const QString &path, const QString &servicetype,
-                                          const QString &mimetype)
+//! @return plugin identifier of plugin metadata @a metaData
+static QString pluginId(const QJsonObject &metaData)
+{
+    return metaData.value(QLatin1String("MetaData")).toObject()
+        .value(QLatin1String("KPlugin")).toObject().value(QLatin1String("Id")).toString();
+}
+
+QList<KPluginMetaData> KDbJsonTrader::Private::findPlugins(const QString &path,
+                                                          const QString &servicetype,
+                                                          const QString &mimetype)
 {
-    QList<QPluginLoader*> list;
+    QList<KPluginMetaData> list;
     QDirIterator dirIter(path, QDirIterator::Subdirectories | QDirIterator::FollowSymlinks);
     while (dirIter.hasNext()) {
         dirIter.next();
         if (dirIter.fileInfo().isFile()) {
-            QPluginLoader *loader = new QPluginLoader(dirIter.filePath());
-            if (checkLoader(loader, servicetype, mimetype)) {
-                list.append(loader);
-            } else {
-                delete loader;
+            const QJsonObject json(metaData(dirIter.fileInfo()));
+            if (checkMetaData(json, servicetype, mimetype)) {
+                list.append(KPluginMetaData(json.value(QLatin1String("MetaData")).toObject(),
+                                            dirIter.filePath()));
             }
         }
     }
     return list;
 }
 
-QList<QPluginLoader *> KDbJsonTrader::query(const QString &servicetype,
+QList<KPluginMetaData> KDbJsonTrader::query(const QString &servicetype,
                                             const QString &mimetype)
 {
     if (!d->pluginPathFound) {
         d->pluginPaths = KDb::libraryPaths();
+        d->pluginPathFound = true;
     }
 
-    QList<QPluginLoader *> list;
+    QList<KPluginMetaData> list;
+    for (const QStaticPlugin &plugin : QPluginLoader::staticPlugins()) {
+        const QJsonObject metaData(plugin.metaData());
+        if (checkMetaData(metaData, servicetype, mimetype)) {
+            list.append(KPluginMetaData(metaData.value(QLatin1String("MetaData")).toObject(),
+                                        QString()));
+        }
+    }
+    d->loadIndex();
     foreach(const QString &path, d->pluginPaths) {
-        list += findPlugins(path, servicetype, mimetype);
+        list += d->findPlugins(path, servicetype, mimetype);
     }
+    d->saveIndex();
     return list;
 }
+
+//static
+QObject *KDbJsonTrader::staticPluginInstance(const QString &pluginId)
+{
+    for (const QStaticPlugin &plugin : QPluginLoader::staticPlugins()) {
+        if (::pluginId(plugin.metaData()) == pluginId) {
+            return plugin.instance();
+        }
+    }
+    return nullptr;
+}
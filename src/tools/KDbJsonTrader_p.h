@@ -25,10 +25,16 @@
 #include <QList>
 #include <QString>
 
-class QPluginLoader;
+class KPluginMetaData;
+class QObject;
 
 /**
  *  Support class to fetch a list of relevant plugins
+ *
+ *  Metadata of plugin files is stored in a persistent index (see indexFilePath())
+ *  keyed by file path, modification time and size, so plugin files are only read
+ *  again when they change. Statically linked plugins (see Q_IMPORT_PLUGIN)
+ *  are found too.
  */
 class KDbJsonTrader
 {
@@ -42,7 +48,7 @@ public:
     /**
      * The main function in the KDbJsonTrader class.
      *
-     * It will return a list of QPluginLoader objects that match your
+     * It will return a list of plugin metadata objects that match your
      * specifications.  The only required parameter is the @a servicetype.
      * The @a mimetype parameter is used to limit the possible choices
      * returned based on the constraints you give it.
@@ -54,12 +60,24 @@ public:
      * @param mimetype    A mimetype constraint to limit the choices returned, QString() to
      *                    get all services of the given @p servicetype.
      *
-     * @return A list of QPluginLoader that satisfy the query
+     * @return A list of metadata of plugins that satisfy the query. Statically linked
+     *         plugins are listed first and have empty file name.
      * @see https://techbase.kde.org/Development/Tutorials/Services/Traders#The_KTrader_Query_Language
-     *
-     * @note Ownership of the QPluginLoader objects is transferred to the caller.
      */
-     QList<QPluginLoader *> query(const QString &servicetype, const QString &mimetype = QString());
+     QList<KPluginMetaData> query(const QString &servicetype, const QString &mimetype = QString());
+
+     /**
+      * @return instance of statically linked plugin with identifier @a pluginId
+      * or @c nullptr if there is no such plugin.
+      */
+     static QObject *staticPluginInstance(const QString &pluginId);
+
+     /**
+      * @return path of the persistent plugin index file
+      *
+      * The index is not used if the KDB_NO_PLUGIN_INDEX environment variable is set.
+      */
+     static QString indexFilePath();
 
 private:
      Q_DISABLE_COPY(KDbJsonTrader)
@@ -39,6 +39,10 @@
 #include <QDir>
 #include <QFile>
 #include <QFileInfo>
+#include <QVector>
+
+#include <algorithm>
+#include <numeric>
 
 static const int SQUEEZED_TEXT_LIMIT = 1024;
 static const int SQUEEZED_TEXT_SUFFIX = 24;
@@ -201,6 +205,171 @@ QDateTime KDbUtils::stringToHackedQTime(const QString &s)
     return QDateTime(QDate(0, 1, 2), KDbUtils::timeFromISODateStringWithMs(s));
 }
 
+namespace {
+
+//! Decodes exactly @a count decimal digits of @a data at @a *pos, moves @a *pos after them.
+//! @return decoded number or -1 on failure
+inline int parseDigits(const char *data, int length, int *pos, int count)
+{
+    if (*pos + count > length) {
+        return -1;
+    }
+    int result = 0;
+    for (int i = 0; i < count; ++i) {
+        const char c = data[*pos + i];
+        if (c < '0' || c > '9') {
+            return -1;
+        }
+        result = result * 10 + (c - '0');
+    }
+    *pos += count;
+    return result;
+}
+
+inline bool parseChar(const char *data, int length, int *pos, char c)
+{
+    if (*pos < length && data[*pos] == c) {
+        ++(*pos);
+        return true;
+    }
+    return false;
+}
+
+//! Decodes "yyyy-MM-dd" at @a *pos
+QDate parseISODate(const char *data, int length, int *pos)
+{
+    const int year = parseDigits(data, length, pos, 4);
+    if (year < 0 || !parseChar(data, length, pos, '-')) {
+        return QDate();
+    }
+    const int month = parseDigits(data, length, pos, 2);
+    if (month < 0 || !parseChar(data, length, pos, '-')) {
+        return QDate();
+    }
+    const int day = parseDigits(data, length, pos, 2);
+    return day < 0 ? QDate() : QDate(year, month, day);
+}
+
+//! Decodes "HH:mm[:ss[.zzz]]" at @a *pos
+QTime parseISOTime(const char *data, int length, int *pos)
+{
+    const int hour = parseDigits(data, length, pos, 2);
+    if (hour < 0 || !parseChar(data, length, pos, ':')) {
+        return QTime();
+    }
+    const int minute = parseDigits(data, length, pos, 2);
+    if (minute < 0) {
+        return QTime();
+    }
+    int second = 0;
+    int msec = 0;
+    if (parseChar(data, length, pos, ':')) {
+        second = parseDigits(data, length, pos, 2);
+        if (second < 0) {
+            return QTime();
+        }
+        if (parseChar(data, length, pos, '.') || parseChar(data, length, pos, ',')) {
+            // use 4 digits of the fraction for rounding to milliseconds, skip the rest
+            int fraction = 0;
+            int digits = 0;
+            for (; *pos < length && data[*pos] >= '0' && data[*pos] <= '9'; ++(*pos), ++digits) {
+                if (digits < 4) {
+                    fraction = fraction * 10 + (data[*pos] - '0');
+                }
+            }
+            if (digits == 0) {
+                return QTime();
+            }
+            for (; digits < 4; ++digits) {
+                fraction *= 10;
+            }
+            msec = qMin((fraction + 5) / 10, 999);
+        }
+    }
+    return QTime(hour, minute, second, msec);
+}
+
+inline int dataLength(const char *data, int length)
+{
+    return length < 0 ? int(qstrlen(data)) : length;
+}
+
+} // namespace
+
+QDate KDbUtils::dateFromISODateString(const char *data, int length)
+{
+    if (!data) {
+        return QDate();
+    }
+    length = dataLength(data, length);
+    int pos = 0;
+    const QDate date = parseISODate(data, length, &pos);
+    return pos == length ? date : QDate();
+}
+
+QTime KDbUtils::timeFromISODateStringWithMs(const char *data, int length)
+{
+    if (!data) {
+        return QTime();
+    }
+    length = dataLength(data, length);
+    int pos = 0;
+    const QTime time = parseISOTime(data, length, &pos);
+    return pos == length ? time : QTime();
+}
+
+QDateTime KDbUtils::dateTimeFromISODateStringWithMs(const char *data, int length)
+{
+    if (!data) {
+        return QDateTime();
+    }
+    length = dataLength(data, length);
+    int pos = 0;
+    const QDate date = parseISODate(data, length, &pos);
+    if (!date.isValid()) {
+        return QDateTime();
+    }
+    if (pos == length) {
+        return QDateTime(date, QTime(0, 0));
+    }
+    if (!parseChar(data, length, &pos, 'T') && !parseChar(data, length, &pos, ' ')) {
+        return QDateTime();
+    }
+    const QTime time = parseISOTime(data, length, &pos);
+    if (!time.isValid()) {
+        return QDateTime();
+    }
+    if (pos == length) {
+        return QDateTime(date, time);
+    }
+    if (parseChar(data, length, &pos, 'Z')) {
+        return pos == length ? QDateTime(date, time, Qt::UTC) : QDateTime();
+    }
+    const int sign = parseChar(data, length, &pos, '+') ? 1
+                   : (parseChar(data, length, &pos, '-') ? -1 : 0);
+    if (sign == 0) {
+        return QDateTime();
+    }
+    const int offsetHours = parseDigits(data, length, &pos, 2);
+    int offsetMinutes = 0;
+    if (pos < length) {
+        parseChar(data, length, &pos, ':');
+        offsetMinutes = parseDigits(data, length, &pos, 2);
+    }
+    if (offsetHours < 0 || offsetMinutes < 0 || pos != length) {
+        return QDateTime();
+    }
+    return QDateTime(date, time, Qt::OffsetFromUTC, sign * (offsetHours * 3600 + offsetMinutes * 60));
+}
+
+QDateTime KDbUtils::stringToHackedQTime(const char *data, int length)
+{
+    if (!data || dataLength(data, length) == 0) {
+        return QDateTime();
+    }
+    return QDateTime(QDate(0, 1, 2), KDbUtils::timeFromISODateStringWithMs(data, length));
+}
+
 void KDbUtils::serializeMap(const QMap<QString, QString>& map, QByteArray *array)
 {
     if (!array) {
@@ -322,18 +491,115 @@ void* KDbUtils::stringToPointerInternal(const QString& string, int size)
 
 //---------
 
+//! Multiplier of the hash function selecting buckets of StaticSetOfStrings::HashTable
+static const quint32 bucketHashMultiplier = 65599;
+
+//! @return multiplier of the hash function selecting slots for bucket's @a seed
+static inline quint32 slotHashMultiplier(quint16 seed)
+{
+    return 2 * quint32(seed) + 31;
+}
+
+/*! @return case-insensitive hash of @a string of @a length bytes.
+ Has to be kept in sync with tools/sql_keywords_hash.awk. */
+static quint32 hashOfString(const char *string, int length, quint32 multiplier)
+{
+    quint32 h = 0;
+    for (int i = 0; i < length; ++i) {
+        uchar c = string[i];
+        if (c >= 'a' && c <= 'z') {
+            c -= 'a' - 'A';
+        }
+        h = h * multiplier + c;
+    }
+    return h;
+}
+
+bool StaticSetOfStrings::HashTable::contains(const char *string, int length) const
+{
+    if (slotCount == 0) {
+        return false;
+    }
+    const quint16 seed = seeds[hashOfString(string, length, bucketHashMultiplier) % bucketCount];
+    const qint16 index = slots[hashOfString(string, length, slotHashMultiplier(seed)) % slotCount];
+    return index >= 0 && qstrlen(strings[index]) == uint(length)
+           && qstrnicmp(strings[index], string, length) == 0;
+}
+
 //! @internal
 class Q_DECL_HIDDEN StaticSetOfStrings::Private
 {
 public:
-    Private() : array(nullptr), set(nullptr) {}
-    ~Private() {
-        delete set;
-    }
-    const char* const * array;
-    QSet<QByteArray> *set;
+    Private() : table(nullptr) {}
+
+    //! Computes ownTable for @a array the same way as tools/sql_keywords_hash.awk does
+    void computeTable(const char* const array[]);
+
+    const HashTable *table;
+    HashTable ownTable;
+    QVector<quint16> seeds;
+    QVector<qint16> slots;
 };
 
+void StaticSetOfStrings::Private::computeTable(const char* const array[])
+{
+    QVector<int> keys;
+    QSet<QByteArray> uniqueKeys;
+    for (int i = 0; array[i]; ++i) {
+        const QByteArray key(QByteArray(array[i]).toUpper());
+        if (!key.isEmpty() && !uniqueKeys.contains(key)) {
+            uniqueKeys.insert(key);
+            keys.append(i);
+        }
+    }
+    const int bucketCount = keys.count() / 4 + 1;
+    const int slotCount = keys.count() + keys.count() / 4 + 1;
+    QVector<QVector<int>> buckets(bucketCount);
+    for (int key : qAsConst(keys)) {
+        buckets[hashOfString(array[key], qstrlen(array[key]), bucketHashMultiplier) % bucketCount]
+            .append(key);
+    }
+    QVector<int> order(bucketCount);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&buckets](int b1, int b2) {
+        return buckets[b1].count() > buckets[b2].count();
+    });
+    seeds.fill(0, bucketCount);
+    slots.fill(-1, slotCount);
+    for (int bucket : qAsConst(order)) {
+        QVector<int> usedSlots;
+        quint16 seed = 0;
+        for (; seed < 32768; ++seed) {
+            usedSlots.clear();
+            for (int key : qAsConst(buckets[bucket])) {
+                const int slot = hashOfString(array[key], qstrlen(array[key]),
+                                              slotHashMultiplier(seed)) % slotCount;
+                if (slots[slot] != -1 || usedSlots.contains(slot)) {
+                    break;
+                }
+                usedSlots.append(slot);
+            }
+            if (usedSlots.count() == buckets[bucket].count()) {
+                break;
+            }
+        }
+        if (seed == 32768) {
+            kdbWarning() << "No perfect hash found for" << keys.count() << "strings";
+            seeds.clear();
+            slots.clear();
+            ownTable = { array, nullptr, nullptr, 0, 0 };
+            table = &ownTable;
+            return;
+        }
+        seeds[bucket] = seed;
+        for (int i = 0; i < usedSlots.count(); ++i) {
+            slots[usedSlots[i]] = buckets[bucket][i];
+        }
+    }
+    ownTable = { array, seeds.constData(), slots.constData(), bucketCount, slotCount };
+    table = &ownTable;
+}
+
 StaticSetOfStrings::StaticSetOfStrings()
         : d(new Private)
 {
@@ -345,6 +611,12 @@ StaticSetOfStrings::StaticSetOfStrings(const char* const array[])
     setStrings(array);
 }
 
+StaticSetOfStrings::StaticSetOfStrings(const HashTable &table)
+        : d(new Private)
+{
+    setStrings(table);
+}
+
 StaticSetOfStrings::~StaticSetOfStrings()
 {
     delete d;
@@ -352,24 +624,25 @@ StaticSetOfStrings::~StaticSetOfStrings()
 
 void StaticSetOfStrings::setStrings(const char* const array[])
 {
-    delete d->set;
-    d->set = nullptr;
-    d->array = array;
+    d->table = nullptr;
+    if (array) {
+        d->computeTable(array);
+    }
+}
+
+void StaticSetOfStrings::setStrings(const HashTable &table)
+{
+    d->table = &table;
 }
 
 bool StaticSetOfStrings::isEmpty() const
 {
-    return d->array == nullptr;
+    return d->table == nullptr;
 }
 
 bool StaticSetOfStrings::contains(const QByteArray& string) const
 {
-    if (!d->set) {
-        d->set = new QSet<QByteArray>();
-        for (const char * const * p = d->array;*p;p++)
-            d->set->insert(QByteArray::fromRawData(*p, qstrlen(*p)));
-    }
-    return d->set->contains(string);
+    return d->table && d->table->contains(string.constData(), string.length());
 }
 
 //---------
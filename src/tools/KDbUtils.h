@@ -102,6 +102,45 @@ KDB_EXPORT QDateTime dateTimeFromISODateStringWithMs(const QString &string);
 //! QDateTime - a hack needed because QVariant(QTime) has broken isNull()
 KDB_EXPORT QDateTime stringToHackedQTime(const QString& s);
 
+/**
+ * Returns the date represented by the ISO "yyyy-MM-dd" text
+ *
+ * @a data of @a length bytes does not have to be null-terminated; if @a length is negative
+ * @a data is null-terminated. The text is decoded without allocations so the function is
+ * suitable for decoding values directly from buffers of database drivers.
+ * Invalid date is returned if @a data is @c nullptr or the text is not a valid date.
+ *
+ * @since 3.3
+ */
+KDB_EXPORT QDate dateFromISODateString(const char *data, int length = -1);
+
+/**
+ * Returns the time represented by the ISO "HH:mm[:ss[.zzz]]" text
+ *
+ * Works like timeFromISODateStringWithMs(const QString&) but decodes @a data of @a length
+ * bytes without allocations. Fraction of seconds may have any number of digits
+ * and is rounded to milliseconds.
+ *
+ * @since 3.3
+ */
+KDB_EXPORT QTime timeFromISODateStringWithMs(const char *data, int length = -1);
+
+/**
+ * Returns the date/time represented by the ISO "yyyy-MM-ddTHH:mm[:ss[.zzz]]" text
+ *
+ * Works like dateTimeFromISODateStringWithMs(const QString&) but decodes @a data of @a length
+ * bytes without allocations. A space is also accepted as the date and time separator,
+ * as used by SQL. Optional time zone designator ("Z", "+HH", "+HH:mm" or "+HHmm")
+ * sets UTC or offset from UTC, otherwise local time is assumed.
+ *
+ * @since 3.3
+ */
+KDB_EXPORT QDateTime dateTimeFromISODateStringWithMs(const char *data, int length = -1);
+
+//! @overload stringToHackedQTime(const QString&)
+//! Decodes @a data of @a length bytes without allocations. @since 3.3
+KDB_EXPORT QDateTime stringToHackedQTime(const char *data, int length = -1);
+
 /*! Serializes @a map to the array pointed by @a array.
  KDbUtils::deserializeMap() can be used to deserialize this array back to map.
  Does nothing if @a array is @c nullptr. */
@@ -383,17 +422,49 @@ public:
     }
 };
 
-//! A set created from static (0-terminated) array of raw null-terminated strings.
+/*! A set created from static (0-terminated) array of raw null-terminated strings.
+ Lookups use a perfect hash table, they do not allocate memory and are thread-safe. */
 class KDB_EXPORT StaticSetOfStrings
 {
 public:
+    /*! Perfect hash table of a static array of strings.
+     Tables are generated by tools/sql_keywords.sh, so they need no initialization
+     at run time. Slots contain indices of strings or -1 for unused slots.
+     @since 3.3 */
+    struct HashTable {
+        //! @return true if @a string of @a length bytes can be found within the table,
+        //! comparison is case insensitive for ASCII letters
+        bool contains(const char *string, int length) const;
+
+        const char* const *strings;
+        const quint16 *seeds;
+        const qint16 *slots;
+        int bucketCount;
+        int slotCount;
+    };
+
     StaticSetOfStrings();
+
+    //! Creates set of strings from @a array, see setStrings(const char* const[])
     explicit StaticSetOfStrings(const char* const array[]);
+
+    //! Creates set of strings using pregenerated @a table
+    //! @since 3.3
+    explicit StaticSetOfStrings(const HashTable &table);
+
     ~StaticSetOfStrings();
+
+    //! Sets strings of the set to @a array. Hash table is computed immediately.
     void setStrings(const char* const array[]);
+
+    //! Sets strings of the set using pregenerated @a table. The table is not copied.
+    //! @since 3.3
+    void setStrings(const HashTable &table);
+
     bool isEmpty() const;
 
-    //! @return true if @a string can be found within set, comparison is case sensitive
+    //! @return true if @a string can be found within set, comparison is case insensitive
+    //! for ASCII letters
     bool contains(const QByteArray& string) const;
 private:
     class Private;
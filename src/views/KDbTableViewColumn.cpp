@@ -153,8 +153,10 @@ KDbTableViewColumn::KDbTableViewColumn(
     //setup column's readonly flag: true, if
     // - it's not from parent table's field, or
     // - if the query itself is coming from read-only connection, or
-    // - if the query itself is stored (i.e. has connection) and lookup column is defined
-    const bool columnFromMasterTable = query.masterTable() == d->columnInfo->field()->table();
+    // - if the query itself is stored (i.e. has connection) and lookup column is defined, or
+    // - if the query is grouped (records of grouped query are read-only)
+    const bool columnFromMasterTable = query.masterTable() == d->columnInfo->field()->table()
+                                       && !query.isGrouped();
     d->readOnly = !columnFromMasterTable;
 //! @todo remove this when queries become editable            ^^^^^^^^^^^^^^
 // kdbDebug() << "KDbTableViewColumn: query.masterTable()=="
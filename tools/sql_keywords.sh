@@ -10,7 +10,9 @@
 # It extracts keywords from the lexer of the DB sources, deletes keywords that
 # are already going to be escaped because they are part of KDb's SQL dialect,
 # and writes the resulting keywords to a "char *keywords[]" construct in a .cpp 
-# file that can then be used in the driver.
+# file that can then be used in the driver. A perfect hash table of the keywords
+# is generated as well using sql_keywords_hash.awk, so keyword lookups do not need
+# any initialization at run time.
 #
 # To use:
 # Put the DB source tarballs/sources (e.g. mysql-4.1.7.tar.gz, 
@@ -69,26 +71,39 @@ EOF1
   fi
   cat <<EOF2 >> "$outFile";
 
-  ${array}[] = {
+${array}[] = {
 EOF2
 }
 
 body() {
   local inFile="$1"
   local outFile="$2"
-  awk '/^[a-zA-Z_0-9]*/ { print "\t\t\""$$1"\","; } ' "$inFile" >> "$outFile"
+  awk '/^[a-zA-Z_0-9]*/ { print "    \""$$1"\","; } ' "$inFile" >> "$outFile"
 }
 
 footer() {
   local outFile="$1"
   cat <<EOF >> "$outFile";
-		0
-  };
-}
+    nullptr
+};
 EOF
 
 }
 
+# hashTable
+# params : name    - scoped name of the hash table to generate
+#          strings - scoped name of the array of keywords
+#          inFile  - file containing raw keywords
+#          outFile - file to write
+hashTable() {
+  local name="$1"
+  local strings="$2"
+  local inFile="$3"
+  local outFile="$4"
+  awk -v name="$name" -v strings="$strings" \
+      -f "$(dirname "$0")/sql_keywords_hash.awk" "$inFile" >> "$outFile"
+}
+
 ################################################################################
 # Keyword comparison functions
 # Globals: keywords
@@ -255,6 +270,7 @@ checkTarballs () {
     header "const char* const ${appName}Driver::keywords" "${filePrefix}driver.h" "$inFile" "${filePrefix}keywords.cpp"
     body   "$appVer.new" "${filePrefix}keywords.cpp"
     footer "${filePrefix}keywords.cpp"
+    hashTable "${appName}Driver::keywordsHash" "${appName}Driver::keywords" "$appVer.new" "${filePrefix}keywords.cpp"
   fi
 
   ls mysql-*.tar.gz postgresql-*.tar.gz 2>/dev/null | while read tarball ; do
@@ -275,6 +291,7 @@ checkTarballs () {
          header "const char* const ${appName}Driver::keywords" "${filePrefix}driver.h" "$appVer/$pathInTar" "${filePrefix}keywords.cpp"
          body   "$appVer.new" "${filePrefix}keywords.cpp"
          footer "${filePrefix}keywords.cpp"
+         hashTable "${appName}Driver::keywordsHash" "${appName}Driver::keywords" "$appVer.new" "${filePrefix}keywords.cpp"
        fi
        ;;
 
@@ -294,6 +311,7 @@ checkTarballs () {
          header "const char* const ${appName}Driver::keywords" "${filePrefix}driver.h" "$appVer/$pathInTar" "${filePrefix}keywords.cpp"
          body   "$appVer.new" "${filePrefix}keywords.cpp"
          footer "${filePrefix}keywords.cpp"
+         hashTable "${appName}Driver::keywordsHash" "${appName}Driver::keywords" "$appVer.new" "${filePrefix}keywords.cpp"
        fi
        ;;
 
@@ -310,6 +328,7 @@ src=`printf "src/parser/KDbSqlScanner.l\n"\
 header "const char* const KDbDriverPrivate::kdbSQLKeywords" "Driver_p.h" "$src" "keywords.cpp"
 body "kdb.all" "keywords.cpp"
 footer "keywords.cpp"
+hashTable "KDbDriverPrivate::kdbSQLKeywordsHash" "KDbDriverPrivate::kdbSQLKeywords" "kdb.all" "keywords.cpp"
 
 checkTarballs
 wc -l *.all *.new | awk '{print $2" "$1}' |sort|awk '{print $1"\t"$2}'
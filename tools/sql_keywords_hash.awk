@@ -0,0 +1,122 @@
+################################################################################
+# sql_keywords_hash.awk
+#
+# Generate perfect hash table for a set of keywords.
+# Used by sql_keywords.sh. Reads keywords (one per line, in the same order as
+# in the generated array of keywords) and writes initializer of
+# KDbUtils::StaticSetOfStrings::HashTable. Keywords are case-insensitive,
+# duplicates are skipped.
+#
+# Hash-and-displace method is used: keywords are distributed into buckets
+# using the first hash function, then for every bucket (largest first) a seed
+# is searched, so the second hash function maps all keywords of the bucket to
+# free slots.
+#
+# Both hash functions MUST be kept in sync with hashOfString() from
+# src/tools/KDbUtils.cpp.
+#
+# Variables: name    - scoped name of the hash table to generate
+#            strings - scoped name of the array of keywords
+#
+# Copyright (C) 2026 agent <agent@local>
+
+function hash(s, multiplier,    h, i) {
+  h = 0
+  for (i = 1; i <= length(s); i++) {
+    h = (h * multiplier + ord[substr(s, i, 1)]) % 4294967296
+  }
+  return h
+}
+
+function printArray(type, arrayName, values, count,    i, line) {
+  print ""
+  print "static const " type " " arrayName "[] = {"
+  line = "   "
+  for (i = 0; i < count; i++) {
+    line = line " " values[i] ","
+    if (length(line) > 90) {
+      print line
+      line = "   "
+    }
+  }
+  if (line != "   ") {
+    print line
+  }
+  print "};"
+}
+
+BEGIN {
+  for (i = 32; i < 127; i++) {
+    ord[sprintf("%c", i)] = i
+  }
+  bucketMultiplier = 65599
+  n = 0
+}
+
+/^[a-zA-Z_0-9]*/ {
+  word = toupper($1)
+  if (word != "" && !(word in seen)) {
+    seen[word] = 1
+    key[n] = word
+    keyIndex[n] = NR - 1
+    n++
+  }
+}
+
+END {
+  bucketCount = int(n / 4) + 1
+  slotCount = n + int(n / 4) + 1
+  for (b = 0; b < bucketCount; b++) {
+    size[b] = 0
+    seed[b] = 0
+    order[b] = b
+  }
+  for (k = 0; k < n; k++) {
+    b = hash(key[k], bucketMultiplier) % bucketCount
+    members[b, size[b]++] = k
+  }
+  for (i = 0; i < bucketCount; i++) {
+    for (j = i + 1; j < bucketCount; j++) {
+      if (size[order[j]] > size[order[i]]) {
+        t = order[i]; order[i] = order[j]; order[j] = t
+      }
+    }
+  }
+  for (s = 0; s < slotCount; s++) {
+    slot[s] = -1
+  }
+  for (i = 0; i < bucketCount && size[order[i]] > 0; i++) {
+    b = order[i]
+    found = 0
+    for (sd = 0; sd < 32768 && !found; sd++) {
+      found = 1
+      split("", used)
+      for (m = 0; m < size[b]; m++) {
+        s = hash(key[members[b, m]], 2 * sd + 31) % slotCount
+        if (slot[s] != -1 || (s in used)) {
+          found = 0
+          break
+        }
+        used[s] = 1
+      }
+    }
+    if (!found) {
+      print "No perfect hash found for " name > "/dev/stderr"
+      exit 1
+    }
+    seed[b] = --sd
+    for (m = 0; m < size[b]; m++) {
+      slot[hash(key[members[b, m]], 2 * sd + 31) % slotCount] = keyIndex[members[b, m]]
+    }
+  }
+
+  prefix = name
+  sub(/.*::/, "", prefix)
+  sub(/^m_/, "", prefix)
+  printArray("quint16", prefix "Seeds", seed, bucketCount)
+  printArray("qint16", prefix "Slots", slot, slotCount)
+  print ""
+  print "const KDbUtils::StaticSetOfStrings::HashTable " name " = {"
+  print "    " strings ", " prefix "Seeds, " prefix "Slots, " bucketCount ", " slotCount
+  print "};"
+}